@@ -0,0 +1,18 @@
+# SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+#
+# SPDX-License-Identifier: GPL-3.0-or-later
+
+find_path(LIBDEFLATE_INCLUDE_DIR
+  NAMES libdeflate.h
+  DOC "libdeflate (https://github.com/ebiggers/libdeflate)")
+find_library(LIBDEFLATE_LIBRARY
+  NAMES deflate libdeflate)
+
+include(FindPackageHandleStandardArgs)
+find_package_handle_standard_args(Libdeflate DEFAULT_MSG LIBDEFLATE_LIBRARY LIBDEFLATE_INCLUDE_DIR)
+
+set(LIBDEFLATE_INCLUDE_DIRS ${LIBDEFLATE_INCLUDE_DIR})
+set(LIBDEFLATE_LIBRARIES ${LIBDEFLATE_LIBRARY})
+
+mark_as_advanced(LIBDEFLATE_INCLUDE_DIR)
+mark_as_advanced(LIBDEFLATE_LIBRARY)
@@ -7,5 +7,14 @@
 /* file load/save operations */
 #include <Vector/BLF/File.h>
 
+/* merge files */
+#include <Vector/BLF/FileMerger.h>
+
+/* cut and concatenate files */
+#include <Vector/BLF/FileSplicer.h>
+
+/* executor for the pipelines of many files */
+#include <Vector/BLF/ThreadPoolExecutor.h>
+
 /* exceptions */
 #include <Vector/BLF/Exceptions.h>
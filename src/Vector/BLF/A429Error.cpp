@@ -4,45 +4,39 @@
 
 #include <Vector/BLF/A429Error.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of A429Error from channel to reservedA429Error */
+using A429ErrorFields = Fields<
+    VECTOR_BLF_FIELD(A429Error, channel),
+    VECTOR_BLF_FIELD(A429Error, errorType),
+    VECTOR_BLF_FIELD(A429Error, sourceIdentifier),
+    VECTOR_BLF_FIELD(A429Error, errReason),
+    VECTOR_BLF_FIELD(A429Error, errorText),
+    VECTOR_BLF_FIELD(A429Error, errorAttributes),
+    VECTOR_BLF_FIELD(A429Error, reservedA429Error)>;
+
 A429Error::A429Error() :
     ObjectHeader(ObjectType::A429_ERROR) {
 }
 
 void A429Error::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&errorType), sizeof(errorType));
-    is.read(reinterpret_cast<char *>(&sourceIdentifier), sizeof(sourceIdentifier));
-    is.read(reinterpret_cast<char *>(&errReason), sizeof(errReason));
-    is.read(reinterpret_cast<char *>(errorText.data()), static_cast<std::streamsize>(errorText.size()));
-    is.read(reinterpret_cast<char *>(errorAttributes.data()), static_cast<std::streamsize>(errorAttributes.size()));
-    is.read(reinterpret_cast<char *>(&reservedA429Error), sizeof(reservedA429Error));
+    A429ErrorFields::read(is, *this);
 }
 
 void A429Error::write(AbstractFile & os) {
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&errorType), sizeof(errorType));
-    os.write(reinterpret_cast<char *>(&sourceIdentifier), sizeof(sourceIdentifier));
-    os.write(reinterpret_cast<char *>(&errReason), sizeof(errReason));
-    os.write(reinterpret_cast<char *>(errorText.data()), static_cast<std::streamsize>(errorText.size()));
-    os.write(reinterpret_cast<char *>(errorAttributes.data()), static_cast<std::streamsize>(errorAttributes.size()));
-    os.write(reinterpret_cast<char *>(&reservedA429Error), sizeof(reservedA429Error));
+    A429ErrorFields::write(os, *this);
 }
 
 uint32_t A429Error::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        sizeof(channel) +
-        sizeof(errorType) +
-        sizeof(sourceIdentifier) +
-        sizeof(errReason) +
-        static_cast<uint32_t>(errorText.size()) +
-        static_cast<uint32_t>(errorAttributes.size()) +
-        sizeof(reservedA429Error);
+        A429ErrorFields::size();
 }
 
 }
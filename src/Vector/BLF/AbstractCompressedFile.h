@@ -0,0 +1,60 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <Vector/BLF/platform.h>
+
+#include <ios>
+
+#include <Vector/BLF/AbstractFile.h>
+
+#include <Vector/BLF/vector_blf_export.h>
+
+namespace Vector {
+namespace BLF {
+
+/**
+ * Generic interface to access the storage of the (compressed) BLF data.
+ *
+ * This is implemented by CompressedFile (file stream), MemoryMappedFile,
+ * MemoryFile and StreamFile.
+ */
+struct VECTOR_BLF_EXPORT AbstractCompressedFile : AbstractFile {
+    /**
+     * is file open?
+     *
+     * @return true if file is open
+     */
+    virtual bool is_open() const = 0;
+
+    /**
+     * Close file.
+     */
+    virtual void close() = 0;
+
+    /**
+     * Set position in output sequence.
+     *
+     * @param[in] pos Position
+     */
+    virtual void seekp(std::streampos pos) = 0;
+
+    /**
+     * Clear error state, e.g. to seek again after end of file was reached.
+     */
+    virtual void clear() = 0;
+
+    /**
+     * Check if the get position can be set anywhere.
+     *
+     * Otherwise seekg can only skip data forward, e.g. when reading from a pipe.
+     *
+     * @return true if seekable
+     */
+    virtual bool seekable() const = 0;
+};
+
+}
+}
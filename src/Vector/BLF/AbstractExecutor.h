@@ -0,0 +1,46 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <Vector/BLF/platform.h>
+
+#include <functional>
+
+#include <Vector/BLF/vector_blf_export.h>
+
+namespace Vector {
+namespace BLF {
+
+/**
+ * Abstract executor, that runs tasks on threads it owns.
+ *
+ * Files use it to run their read/write pipeline as cooperative tasks
+ * (see File::executor), so that many open files can share threads.
+ */
+class VECTOR_BLF_EXPORT AbstractExecutor {
+  public:
+    /** task */
+    using Task = std::function<void()>;
+
+    AbstractExecutor() = default;
+    virtual ~AbstractExecutor() = default;
+    AbstractExecutor(const AbstractExecutor &) = default;
+    AbstractExecutor & operator=(const AbstractExecutor &) = default;
+    AbstractExecutor(AbstractExecutor &&) = default;
+    AbstractExecutor & operator=(AbstractExecutor &&) = default;
+
+    /**
+     * Run a task asynchronously.
+     *
+     * This must return without waiting for the task, as the task may
+     * submit itself again. Tasks may be run concurrently and in any order.
+     *
+     * @param[in] task task
+     */
+    virtual void execute(Task task) = 0;
+};
+
+}
+}
@@ -9,6 +9,14 @@
 namespace Vector {
 namespace BLF {
 
+const char * AbstractFile::readView(std::streamsize /*n*/) {
+    return nullptr;
+}
+
+PayloadView AbstractFile::readPayload(std::streamsize /*n*/) {
+    return PayloadView();
+}
+
 void AbstractFile::skipp(std::streamsize s) {
     std::vector<char> zero;
     zero.resize(s);
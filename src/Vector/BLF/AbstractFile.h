@@ -8,6 +8,8 @@
 
 #include <ios>
 
+#include <Vector/BLF/PayloadView.h>
+
 #include <Vector/BLF/vector_blf_export.h>
 
 namespace Vector {
@@ -41,6 +43,30 @@ struct VECTOR_BLF_EXPORT AbstractFile {
      */
     virtual void read(char * s, std::streamsize n) = 0;
 
+    /**
+     * Get direct access to a block of data.
+     *
+     * On success the get position is advanced as in read, but no data is copied.
+     * This is only supported by files, which have their content in memory.
+     * The data stays valid as long as the file is open.
+     *
+     * @param[in] n Requested size of data
+     * @return Pointer to data, or nullptr if not supported or not available
+     */
+    virtual const char * readView(std::streamsize n);
+
+    /**
+     * Get a view of a block of payload data, that keeps its storage alive.
+     *
+     * On success the get position is advanced as in read, but no data is copied.
+     * This is only supported by files, which share their storage, e.g. an
+     * ObjectBuffer loaded from the LogContainers of an UncompressedFile.
+     *
+     * @param[in] n Requested size of data
+     * @return View of data, or a view without data if not supported or not available
+     */
+    virtual PayloadView readPayload(std::streamsize n);
+
     /**
      * Get position in input sequence.
      *
@@ -0,0 +1,144 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <Vector/BLF/platform.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <Vector/BLF/vector_blf_export.h>
+
+namespace Vector {
+namespace BLF {
+
+/**
+ * Generic interface of the queues, that hand over objects between two threads.
+ *
+ * This is implemented by ObjectQueue (mutex protected queue) and
+ * RingObjectQueue (lock-free single-producer/single-consumer ring).
+ */
+template <typename T>
+struct VECTOR_BLF_EXPORT AbstractObjectQueue {
+    virtual ~AbstractObjectQueue() noexcept = default;
+
+    /**
+     * Get access to front of queue.
+     *
+     * @return object (or nullptr if empty)
+     */
+    virtual T * read() = 0;
+
+    /**
+     * Get up to maxObjects objects from front of queue.
+     *
+     * This waits until at least one object is available, and then
+     * takes all available objects at once.
+     *
+     * @param[out] objects objects are appended here
+     * @param[in] maxObjects maximum number of objects
+     * @return number of objects (or 0 if empty)
+     */
+    virtual std::size_t read(std::vector<T *> & objects, std::size_t maxObjects) = 0;
+
+    /** @copydoc AbstractFile::tellg */
+    virtual uint32_t tellg() const = 0;
+
+    /**
+     * Enqueue an object to end of queue.
+     *
+     * nullptr can be pushed to indicate eof.
+     *
+     * Ownership is taken over from the user to the queue. After abort,
+     * write doesn't block anymore. The object is still enqueued, if there
+     * is free space, otherwise it's deleted.
+     *
+     * @param[in] obj object
+     */
+    virtual void write(T * obj) = 0;
+
+    /**
+     * Enqueue objects to end of queue.
+     *
+     * This enqueues as many objects at once as there is free space.
+     *
+     * Ownership is taken over as in write(T *). After abort, objects are
+     * enqueued as long as there is free space, the remaining ones are
+     * deleted.
+     *
+     * @param[in] objects objects
+     */
+    virtual void write(const std::vector<T *> & objects) = 0;
+
+    /** @copydoc AbstractFile::tellp */
+    virtual uint32_t tellp() const = 0;
+
+    /** @copydoc AbstractFile::good */
+    virtual bool good() const = 0;
+
+    /** @copydoc AbstractFile::eof */
+    virtual bool eof() const = 0;
+
+    /** @copydoc UncompressedFile::abort */
+    virtual void abort() = 0;
+
+    /** @copydoc UncompressedFile::reset */
+    virtual void reset() = 0;
+
+    /** @copydoc UncompressedFile::setFileSize */
+    virtual void setFileSize(uint32_t fileSize) = 0;
+
+    /** @copydoc UncompressedFile::bufferSize */
+    virtual uint32_t bufferSize() const = 0;
+
+    /** @copydoc UncompressedFile::setBufferSize */
+    virtual void setBufferSize(uint32_t bufferSize) = 0;
+
+    /**
+     * Get the size of the enqueued objects.
+     *
+     * @return sum of the objectSize of the enqueued objects
+     */
+    virtual uint64_t bufferedBytes() const = 0;
+
+    /**
+     * Get the maximum of bufferedBytes since the last reset.
+     *
+     * @return maximum size of the enqueued objects
+     */
+    virtual uint64_t peakBufferedBytes() const = 0;
+
+    /**
+     * Sets the maximum size of the enqueued objects.
+     *
+     * Write operations block, if the size is reached. An object is always
+     * enqueued into an empty queue, so it can be larger.
+     *
+     * @param[in] maxBufferedBytes maximum size of the enqueued objects
+     */
+    virtual void setMaxBufferedBytes(uint64_t maxBufferedBytes) = 0;
+
+    /**
+     * Check if write would block, as bufferSize or maxBufferedBytes is reached.
+     *
+     * @return true if full
+     */
+    virtual bool full() const = 0;
+
+  protected:
+    /**
+     * Size of an object in the queue.
+     *
+     * @param[in] obj object (or nullptr)
+     * @return objectSize
+     */
+    static uint64_t objectBytes(const T * obj) {
+        return (obj != nullptr) ? obj->objectSize : 0;
+    }
+};
+
+}
+}
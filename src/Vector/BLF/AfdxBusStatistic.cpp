@@ -4,85 +4,53 @@
 
 #include <Vector/BLF/AfdxBusStatistic.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of AfdxBusStatistic from channel to reservedAfdxBusStatistic2 */
+using AfdxBusStatisticFields = Fields<
+    VECTOR_BLF_FIELD(AfdxBusStatistic, channel),
+    VECTOR_BLF_FIELD(AfdxBusStatistic, flags),
+    VECTOR_BLF_FIELD(AfdxBusStatistic, statDuration),
+    VECTOR_BLF_FIELD(AfdxBusStatistic, statRxPacketCountHW),
+    VECTOR_BLF_FIELD(AfdxBusStatistic, statTxPacketCountHW),
+    VECTOR_BLF_FIELD(AfdxBusStatistic, statRxErrorCountHW),
+    VECTOR_BLF_FIELD(AfdxBusStatistic, statTxErrorCountHW),
+    VECTOR_BLF_FIELD(AfdxBusStatistic, statRxBytesHW),
+    VECTOR_BLF_FIELD(AfdxBusStatistic, statTxBytesHW),
+    VECTOR_BLF_FIELD(AfdxBusStatistic, statRxPacketCount),
+    VECTOR_BLF_FIELD(AfdxBusStatistic, statTxPacketCount),
+    VECTOR_BLF_FIELD(AfdxBusStatistic, statDroppedPacketCount),
+    VECTOR_BLF_FIELD(AfdxBusStatistic, statInvalidPacketCount),
+    VECTOR_BLF_FIELD(AfdxBusStatistic, statLostPacketCount),
+    VECTOR_BLF_FIELD(AfdxBusStatistic, line),
+    VECTOR_BLF_FIELD(AfdxBusStatistic, linkStatus),
+    VECTOR_BLF_FIELD(AfdxBusStatistic, linkSpeed),
+    VECTOR_BLF_FIELD(AfdxBusStatistic, linkLost),
+    VECTOR_BLF_FIELD(AfdxBusStatistic, reservedAfdxBusStatistic1),
+    VECTOR_BLF_FIELD(AfdxBusStatistic, reservedAfdxBusStatistic2)>;
+
 AfdxBusStatistic::AfdxBusStatistic() :
     ObjectHeader(ObjectType::A429_BUS_STATISTIC) {
 }
 
 void AfdxBusStatistic::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&flags), sizeof(flags));
-    is.read(reinterpret_cast<char *>(&statDuration), sizeof(statDuration));
-    is.read(reinterpret_cast<char *>(&statRxPacketCountHW), sizeof(statRxPacketCountHW));
-    is.read(reinterpret_cast<char *>(&statTxPacketCountHW), sizeof(statTxPacketCountHW));
-    is.read(reinterpret_cast<char *>(&statRxErrorCountHW), sizeof(statRxErrorCountHW));
-    is.read(reinterpret_cast<char *>(&statTxErrorCountHW), sizeof(statTxErrorCountHW));
-    is.read(reinterpret_cast<char *>(&statRxBytesHW), sizeof(statRxBytesHW));
-    is.read(reinterpret_cast<char *>(&statTxBytesHW), sizeof(statTxBytesHW));
-    is.read(reinterpret_cast<char *>(&statRxPacketCount), sizeof(statRxPacketCount));
-    is.read(reinterpret_cast<char *>(&statTxPacketCount), sizeof(statTxPacketCount));
-    is.read(reinterpret_cast<char *>(&statDroppedPacketCount), sizeof(statDroppedPacketCount));
-    is.read(reinterpret_cast<char *>(&statInvalidPacketCount), sizeof(statInvalidPacketCount));
-    is.read(reinterpret_cast<char *>(&statLostPacketCount), sizeof(statLostPacketCount));
-    is.read(reinterpret_cast<char *>(&line), sizeof(line));
-    is.read(reinterpret_cast<char *>(&linkStatus), sizeof(linkStatus));
-    is.read(reinterpret_cast<char *>(&linkSpeed), sizeof(linkSpeed));
-    is.read(reinterpret_cast<char *>(&linkLost), sizeof(linkLost));
-    is.read(reinterpret_cast<char *>(&reservedAfdxBusStatistic1), sizeof(reservedAfdxBusStatistic1));
-    is.read(reinterpret_cast<char *>(&reservedAfdxBusStatistic2), sizeof(reservedAfdxBusStatistic2));
+    AfdxBusStatisticFields::read(is, *this);
     // @note might be extended in future versions
 }
 
 void AfdxBusStatistic::write(AbstractFile & os) {
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&flags), sizeof(flags));
-    os.write(reinterpret_cast<char *>(&statDuration), sizeof(statDuration));
-    os.write(reinterpret_cast<char *>(&statRxPacketCountHW), sizeof(statRxPacketCountHW));
-    os.write(reinterpret_cast<char *>(&statTxPacketCountHW), sizeof(statTxPacketCountHW));
-    os.write(reinterpret_cast<char *>(&statRxErrorCountHW), sizeof(statRxErrorCountHW));
-    os.write(reinterpret_cast<char *>(&statTxErrorCountHW), sizeof(statTxErrorCountHW));
-    os.write(reinterpret_cast<char *>(&statRxBytesHW), sizeof(statRxBytesHW));
-    os.write(reinterpret_cast<char *>(&statTxBytesHW), sizeof(statTxBytesHW));
-    os.write(reinterpret_cast<char *>(&statRxPacketCount), sizeof(statRxPacketCount));
-    os.write(reinterpret_cast<char *>(&statTxPacketCount), sizeof(statTxPacketCount));
-    os.write(reinterpret_cast<char *>(&statDroppedPacketCount), sizeof(statDroppedPacketCount));
-    os.write(reinterpret_cast<char *>(&statInvalidPacketCount), sizeof(statInvalidPacketCount));
-    os.write(reinterpret_cast<char *>(&statLostPacketCount), sizeof(statLostPacketCount));
-    os.write(reinterpret_cast<char *>(&line), sizeof(line));
-    os.write(reinterpret_cast<char *>(&linkStatus), sizeof(linkStatus));
-    os.write(reinterpret_cast<char *>(&linkSpeed), sizeof(linkSpeed));
-    os.write(reinterpret_cast<char *>(&linkLost), sizeof(linkLost));
-    os.write(reinterpret_cast<char *>(&reservedAfdxBusStatistic1), sizeof(reservedAfdxBusStatistic1));
-    os.write(reinterpret_cast<char *>(&reservedAfdxBusStatistic2), sizeof(reservedAfdxBusStatistic2));
+    AfdxBusStatisticFields::write(os, *this);
 }
 
 uint32_t AfdxBusStatistic::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        sizeof(channel) +
-        sizeof(flags) +
-        sizeof(statDuration) +
-        sizeof(statRxPacketCountHW) +
-        sizeof(statTxPacketCountHW) +
-        sizeof(statRxErrorCountHW) +
-        sizeof(statTxErrorCountHW) +
-        sizeof(statRxBytesHW) +
-        sizeof(statTxBytesHW) +
-        sizeof(statRxPacketCount) +
-        sizeof(statTxPacketCount) +
-        sizeof(statDroppedPacketCount) +
-        sizeof(statInvalidPacketCount) +
-        sizeof(statLostPacketCount) +
-        sizeof(line) +
-        sizeof(linkStatus) +
-        sizeof(linkSpeed) +
-        sizeof(linkLost) +
-        sizeof(reservedAfdxBusStatistic1) +
-        sizeof(reservedAfdxBusStatistic2);
+        AfdxBusStatisticFields::size();
 }
 
 }
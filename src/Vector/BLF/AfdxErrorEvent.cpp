@@ -4,40 +4,38 @@
 
 #include <Vector/BLF/AfdxErrorEvent.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of AfdxErrorEvent from channel to errorAttributes */
+using AfdxErrorEventFields = Fields<
+    VECTOR_BLF_FIELD(AfdxErrorEvent, channel),
+    VECTOR_BLF_FIELD(AfdxErrorEvent, errorLevel),
+    VECTOR_BLF_FIELD(AfdxErrorEvent, sourceIdentifier),
+    VECTOR_BLF_FIELD(AfdxErrorEvent, errorText),
+    VECTOR_BLF_FIELD(AfdxErrorEvent, errorAttributes)>;
+
 AfdxErrorEvent::AfdxErrorEvent() :
     ObjectHeader(ObjectType::AFDX_ERROR_EVENT) {
 }
 
 void AfdxErrorEvent::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&errorLevel), sizeof(errorLevel));
-    is.read(reinterpret_cast<char *>(&sourceIdentifier), sizeof(sourceIdentifier));
-    is.read(reinterpret_cast<char *>(errorText.data()), static_cast<std::streamsize>(errorText.size()));
-    is.read(reinterpret_cast<char *>(errorAttributes.data()), static_cast<std::streamsize>(errorAttributes.size()));
+    AfdxErrorEventFields::read(is, *this);
     // @note might be extended in future versions
 }
 
 void AfdxErrorEvent::write(AbstractFile & os) {
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&errorLevel), sizeof(errorLevel));
-    os.write(reinterpret_cast<char *>(&sourceIdentifier), sizeof(sourceIdentifier));
-    os.write(reinterpret_cast<char *>(errorText.data()), static_cast<std::streamsize>(errorText.size()));
-    os.write(reinterpret_cast<char *>(errorAttributes.data()), static_cast<std::streamsize>(errorAttributes.size()));
+    AfdxErrorEventFields::write(os, *this);
 }
 
 uint32_t AfdxErrorEvent::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        sizeof(channel) +
-        sizeof(errorLevel) +
-        sizeof(sourceIdentifier) +
-        errorText.size() +
-        errorAttributes.size();
+        AfdxErrorEventFields::size();
 }
 
 }
@@ -4,30 +4,36 @@
 
 #include <Vector/BLF/AfdxFrame.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of AfdxFrame from sourceAddress to reservedAfdxFrame4 */
+using AfdxFrameFields = Fields<
+    VECTOR_BLF_FIELD(AfdxFrame, sourceAddress),
+    VECTOR_BLF_FIELD(AfdxFrame, channel),
+    VECTOR_BLF_FIELD(AfdxFrame, destinationAddress),
+    VECTOR_BLF_FIELD(AfdxFrame, dir),
+    VECTOR_BLF_FIELD(AfdxFrame, type),
+    VECTOR_BLF_FIELD(AfdxFrame, tpid),
+    VECTOR_BLF_FIELD(AfdxFrame, tci),
+    VECTOR_BLF_FIELD(AfdxFrame, ethChannel),
+    VECTOR_BLF_FIELD(AfdxFrame, reservedAfdxFrame1),
+    VECTOR_BLF_FIELD(AfdxFrame, afdxFlags),
+    VECTOR_BLF_FIELD(AfdxFrame, reservedAfdxFrame2),
+    VECTOR_BLF_FIELD(AfdxFrame, bagUsec),
+    VECTOR_BLF_FIELD(AfdxFrame, payLoadLength),
+    VECTOR_BLF_FIELD(AfdxFrame, reservedAfdxFrame3),
+    VECTOR_BLF_FIELD(AfdxFrame, reservedAfdxFrame4)>;
+
 AfdxFrame::AfdxFrame() :
     ObjectHeader(ObjectType::AFDX_FRAME) {
 }
 
 void AfdxFrame::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(sourceAddress.data()), static_cast<std::streamsize>(sourceAddress.size()));
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(destinationAddress.data()), static_cast<std::streamsize>(destinationAddress.size()));
-    is.read(reinterpret_cast<char *>(&dir), sizeof(dir));
-    is.read(reinterpret_cast<char *>(&type), sizeof(type));
-    is.read(reinterpret_cast<char *>(&tpid), sizeof(tpid));
-    is.read(reinterpret_cast<char *>(&tci), sizeof(tci));
-    is.read(reinterpret_cast<char *>(&ethChannel), sizeof(ethChannel));
-    is.read(reinterpret_cast<char *>(&reservedAfdxFrame1), sizeof(reservedAfdxFrame1));
-    is.read(reinterpret_cast<char *>(&afdxFlags), sizeof(afdxFlags));
-    is.read(reinterpret_cast<char *>(&reservedAfdxFrame2), sizeof(reservedAfdxFrame2));
-    is.read(reinterpret_cast<char *>(&bagUsec), sizeof(bagUsec));
-    is.read(reinterpret_cast<char *>(&payLoadLength), sizeof(payLoadLength));
-    is.read(reinterpret_cast<char *>(&reservedAfdxFrame3), sizeof(reservedAfdxFrame3));
-    is.read(reinterpret_cast<char *>(&reservedAfdxFrame4), sizeof(reservedAfdxFrame4));
+    AfdxFrameFields::read(is, *this);
     payLoad.resize(payLoadLength);
     is.read(reinterpret_cast<char *>(payLoad.data()), payLoadLength);
 
@@ -40,21 +46,7 @@ void AfdxFrame::write(AbstractFile & os) {
     payLoadLength = static_cast<uint16_t>(payLoad.size());
 
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(sourceAddress.data()), static_cast<std::streamsize>(sourceAddress.size()));
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(destinationAddress.data()), static_cast<std::streamsize>(destinationAddress.size()));
-    os.write(reinterpret_cast<char *>(&dir), sizeof(dir));
-    os.write(reinterpret_cast<char *>(&type), sizeof(type));
-    os.write(reinterpret_cast<char *>(&tpid), sizeof(tpid));
-    os.write(reinterpret_cast<char *>(&tci), sizeof(tci));
-    os.write(reinterpret_cast<char *>(&ethChannel), sizeof(ethChannel));
-    os.write(reinterpret_cast<char *>(&reservedAfdxFrame1), sizeof(reservedAfdxFrame1));
-    os.write(reinterpret_cast<char *>(&afdxFlags), sizeof(afdxFlags));
-    os.write(reinterpret_cast<char *>(&reservedAfdxFrame2), sizeof(reservedAfdxFrame2));
-    os.write(reinterpret_cast<char *>(&bagUsec), sizeof(bagUsec));
-    os.write(reinterpret_cast<char *>(&payLoadLength), sizeof(payLoadLength));
-    os.write(reinterpret_cast<char *>(&reservedAfdxFrame3), sizeof(reservedAfdxFrame3));
-    os.write(reinterpret_cast<char *>(&reservedAfdxFrame4), sizeof(reservedAfdxFrame4));
+    AfdxFrameFields::write(os, *this);
     os.write(reinterpret_cast<char *>(payLoad.data()), payLoadLength);
 
     /* skip padding */
@@ -64,21 +56,7 @@ void AfdxFrame::write(AbstractFile & os) {
 uint32_t AfdxFrame::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        static_cast<uint32_t>(sourceAddress.size()) +
-        sizeof(channel) +
-        static_cast<uint32_t>(destinationAddress.size()) +
-        sizeof(dir) +
-        sizeof(type) +
-        sizeof(tpid) +
-        sizeof(tci) +
-        sizeof(ethChannel) +
-        sizeof(reservedAfdxFrame1) +
-        sizeof(afdxFlags) +
-        sizeof(reservedAfdxFrame2) +
-        sizeof(bagUsec) +
-        sizeof(payLoadLength) +
-        sizeof(reservedAfdxFrame3) +
-        sizeof(reservedAfdxFrame4) +
+        AfdxFrameFields::size() +
         payLoadLength;
 }
 
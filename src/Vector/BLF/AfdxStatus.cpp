@@ -4,17 +4,23 @@
 
 #include <Vector/BLF/AfdxStatus.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of AfdxStatus from channel to reservedAfdxStatus1 */
+using AfdxStatusFields = Fields<
+    VECTOR_BLF_FIELD(AfdxStatus, channel),
+    VECTOR_BLF_FIELD(AfdxStatus, reservedAfdxStatus1)>;
+
 AfdxStatus::AfdxStatus() :
     ObjectHeader(ObjectType::AFDX_STATUS) {
 }
 
 void AfdxStatus::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&reservedAfdxStatus1), sizeof(reservedAfdxStatus1));
+    AfdxStatusFields::read(is, *this);
     statusA.read(is);
     statusB.read(is);
     is.read(reinterpret_cast<char *>(&reservedAfdxStatus2), sizeof(reservedAfdxStatus2));
@@ -22,8 +28,7 @@ void AfdxStatus::read(AbstractFile & is) {
 
 void AfdxStatus::write(AbstractFile & os) {
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&reservedAfdxStatus1), sizeof(reservedAfdxStatus1));
+    AfdxStatusFields::write(os, *this);
     statusA.write(os);
     statusB.write(os);
     os.write(reinterpret_cast<char *>(&reservedAfdxStatus2), sizeof(reservedAfdxStatus2));
@@ -32,8 +37,7 @@ void AfdxStatus::write(AbstractFile & os) {
 uint32_t AfdxStatus::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        sizeof(channel) +
-        sizeof(reservedAfdxStatus1) +
+        AfdxStatusFields::size() +
         statusA.calculateObjectSize() +
         statusB.calculateObjectSize() +
         sizeof(reservedAfdxStatus2);
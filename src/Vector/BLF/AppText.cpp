@@ -6,19 +6,25 @@
 
 #include <Vector/BLF/AppText.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of AppText from source to reservedAppText2 */
+using AppTextFields = Fields<
+    VECTOR_BLF_FIELD(AppText, source),
+    VECTOR_BLF_FIELD(AppText, reservedAppText1),
+    VECTOR_BLF_FIELD(AppText, textLength),
+    VECTOR_BLF_FIELD(AppText, reservedAppText2)>;
+
 AppText::AppText() :
     ObjectHeader(ObjectType::APP_TEXT) {
 }
 
 void AppText::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&source), sizeof(source));
-    is.read(reinterpret_cast<char *>(&reservedAppText1), sizeof(reservedAppText1));
-    is.read(reinterpret_cast<char *>(&textLength), sizeof(textLength));
-    is.read(reinterpret_cast<char *>(&reservedAppText2), sizeof(reservedAppText2));
+    AppTextFields::read(is, *this);
     text.resize(textLength);
     is.read(const_cast<char *>(text.data()), textLength);
 
@@ -31,10 +37,7 @@ void AppText::write(AbstractFile & os) {
     textLength = static_cast<uint32_t>(text.size());
 
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&source), sizeof(source));
-    os.write(reinterpret_cast<char *>(&reservedAppText1), sizeof(reservedAppText1));
-    os.write(reinterpret_cast<char *>(&textLength), sizeof(textLength));
-    os.write(reinterpret_cast<char *>(&reservedAppText2), sizeof(reservedAppText2));
+    AppTextFields::write(os, *this);
     os.write(const_cast<char *>(text.data()), textLength);
 
     /* skip padding */
@@ -44,10 +47,7 @@ void AppText::write(AbstractFile & os) {
 uint32_t AppText::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        sizeof(source) +
-        sizeof(reservedAppText1) +
-        sizeof(textLength) +
-        sizeof(reservedAppText2) +
+        AppTextFields::size() +
         textLength;
 }
 
@@ -4,39 +4,37 @@
 
 #include <Vector/BLF/AppTrigger.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of AppTrigger from preTriggerTime to appSpecific2 */
+using AppTriggerFields = Fields<
+    VECTOR_BLF_FIELD(AppTrigger, preTriggerTime),
+    VECTOR_BLF_FIELD(AppTrigger, postTriggerTime),
+    VECTOR_BLF_FIELD(AppTrigger, channel),
+    VECTOR_BLF_FIELD(AppTrigger, flags),
+    VECTOR_BLF_FIELD(AppTrigger, appSpecific2)>;
+
 AppTrigger::AppTrigger() :
     ObjectHeader(ObjectType::APP_TRIGGER) {
 }
 
 void AppTrigger::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&preTriggerTime), sizeof(preTriggerTime));
-    is.read(reinterpret_cast<char *>(&postTriggerTime), sizeof(postTriggerTime));
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&flags), sizeof(flags));
-    is.read(reinterpret_cast<char *>(&appSpecific2), sizeof(appSpecific2));
+    AppTriggerFields::read(is, *this);
 }
 
 void AppTrigger::write(AbstractFile & os) {
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&preTriggerTime), sizeof(preTriggerTime));
-    os.write(reinterpret_cast<char *>(&postTriggerTime), sizeof(postTriggerTime));
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&flags), sizeof(flags));
-    os.write(reinterpret_cast<char *>(&appSpecific2), sizeof(appSpecific2));
+    AppTriggerFields::write(os, *this);
 }
 
 uint32_t AppTrigger::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        sizeof(preTriggerTime) +
-        sizeof(postTriggerTime) +
-        sizeof(channel) +
-        sizeof(flags) +
-        sizeof(appSpecific2);
+        AppTriggerFields::size();
 }
 
 }
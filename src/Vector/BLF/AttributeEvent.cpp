@@ -4,19 +4,25 @@
 
 #include <Vector/BLF/AttributeEvent.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of AttributeEvent from mainAttributableObjectPathLength to dataLength */
+using AttributeEventFields = Fields<
+    VECTOR_BLF_FIELD(AttributeEvent, mainAttributableObjectPathLength),
+    VECTOR_BLF_FIELD(AttributeEvent, memberPathLength),
+    VECTOR_BLF_FIELD(AttributeEvent, attributeDefinitionPathLength),
+    VECTOR_BLF_FIELD(AttributeEvent, dataLength)>;
+
 AttributeEvent::AttributeEvent() :
     ObjectHeader(ObjectType::ATTRIBUTE_EVENT) {
 }
 
 void AttributeEvent::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&mainAttributableObjectPathLength), sizeof(mainAttributableObjectPathLength));
-    is.read(reinterpret_cast<char *>(&memberPathLength), sizeof(memberPathLength));
-    is.read(reinterpret_cast<char *>(&attributeDefinitionPathLength), sizeof(attributeDefinitionPathLength));
-    is.read(reinterpret_cast<char *>(&dataLength), sizeof(dataLength));
+    AttributeEventFields::read(is, *this);
     mainAttributableObjectPath.resize(mainAttributableObjectPathLength);
     is.read(const_cast<char *>(mainAttributableObjectPath.data()), mainAttributableObjectPathLength);
     memberPath.resize(memberPathLength);
@@ -35,10 +41,7 @@ void AttributeEvent::write(AbstractFile & os) {
     dataLength = static_cast<uint32_t>(data.size());
 
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&mainAttributableObjectPathLength), sizeof(mainAttributableObjectPathLength));
-    os.write(reinterpret_cast<char *>(&memberPathLength), sizeof(memberPathLength));
-    os.write(reinterpret_cast<char *>(&attributeDefinitionPathLength), sizeof(attributeDefinitionPathLength));
-    os.write(reinterpret_cast<char *>(&dataLength), sizeof(dataLength));
+    AttributeEventFields::write(os, *this);
     os.write(const_cast<char *>(mainAttributableObjectPath.data()), mainAttributableObjectPathLength);
     os.write(const_cast<char *>(memberPath.data()), memberPathLength);
     os.write(const_cast<char *>(attributeDefinitionPath.data()), attributeDefinitionPathLength);
@@ -48,10 +51,7 @@ void AttributeEvent::write(AbstractFile & os) {
 uint32_t AttributeEvent::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        sizeof(mainAttributableObjectPathLength) +
-        sizeof(memberPathLength) +
-        sizeof(attributeDefinitionPathLength) +
-        sizeof(dataLength) +
+        AttributeEventFields::size() +
         mainAttributableObjectPathLength +
         memberPathLength +
         attributeDefinitionPathLength +
@@ -4,36 +4,36 @@
 
 #include <Vector/BLF/CanDriverError.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of CanDriverError from channel to errorCode */
+using CanDriverErrorFields = Fields<
+    VECTOR_BLF_FIELD(CanDriverError, channel),
+    VECTOR_BLF_FIELD(CanDriverError, txErrors),
+    VECTOR_BLF_FIELD(CanDriverError, rxErrors),
+    VECTOR_BLF_FIELD(CanDriverError, errorCode)>;
+
 CanDriverError::CanDriverError() :
     ObjectHeader(ObjectType::CAN_DRIVER_ERROR) {
 }
 
 void CanDriverError::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&txErrors), sizeof(txErrors));
-    is.read(reinterpret_cast<char *>(&rxErrors), sizeof(rxErrors));
-    is.read(reinterpret_cast<char *>(&errorCode), sizeof(errorCode));
+    CanDriverErrorFields::read(is, *this);
 }
 
 void CanDriverError::write(AbstractFile & os) {
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&txErrors), sizeof(txErrors));
-    os.write(reinterpret_cast<char *>(&rxErrors), sizeof(rxErrors));
-    os.write(reinterpret_cast<char *>(&errorCode), sizeof(errorCode));
+    CanDriverErrorFields::write(os, *this);
 }
 
 uint32_t CanDriverError::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        sizeof(channel) +
-        sizeof(txErrors) +
-        sizeof(rxErrors) +
-        sizeof(errorCode);
+        CanDriverErrorFields::size();
 }
 
 }
@@ -4,36 +4,36 @@
 
 #include <Vector/BLF/CanDriverHwSync.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of CanDriverHwSync from channel to reservedCanDriverHwSync2 */
+using CanDriverHwSyncFields = Fields<
+    VECTOR_BLF_FIELD(CanDriverHwSync, channel),
+    VECTOR_BLF_FIELD(CanDriverHwSync, flags),
+    VECTOR_BLF_FIELD(CanDriverHwSync, reservedCanDriverHwSync1),
+    VECTOR_BLF_FIELD(CanDriverHwSync, reservedCanDriverHwSync2)>;
+
 CanDriverHwSync::CanDriverHwSync() :
     ObjectHeader(ObjectType::CAN_DRIVER_SYNC) {
 }
 
 void CanDriverHwSync::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&flags), sizeof(flags));
-    is.read(reinterpret_cast<char *>(&reservedCanDriverHwSync1), sizeof(reservedCanDriverHwSync1));
-    is.read(reinterpret_cast<char *>(&reservedCanDriverHwSync2), sizeof(reservedCanDriverHwSync2));
+    CanDriverHwSyncFields::read(is, *this);
 }
 
 void CanDriverHwSync::write(AbstractFile & os) {
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&flags), sizeof(flags));
-    os.write(reinterpret_cast<char *>(&reservedCanDriverHwSync1), sizeof(reservedCanDriverHwSync1));
-    os.write(reinterpret_cast<char *>(&reservedCanDriverHwSync2), sizeof(reservedCanDriverHwSync2));
+    CanDriverHwSyncFields::write(os, *this);
 }
 
 uint32_t CanDriverHwSync::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        sizeof(channel) +
-        sizeof(flags) +
-        sizeof(reservedCanDriverHwSync1) +
-        sizeof(reservedCanDriverHwSync2);
+        CanDriverHwSyncFields::size();
 }
 
 }
@@ -4,25 +4,30 @@
 
 #include <Vector/BLF/CanErrorFrame.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of CanErrorFrame from channel to length */
+using CanErrorFrameFields = Fields<
+    VECTOR_BLF_FIELD(CanErrorFrame, channel),
+    VECTOR_BLF_FIELD(CanErrorFrame, length)>;
+
 CanErrorFrame::CanErrorFrame() :
     ObjectHeader(ObjectType::CAN_ERROR) {
 }
 
 void CanErrorFrame::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&length), sizeof(length));
+    CanErrorFrameFields::read(is, *this);
     if (length > 0)
         is.read(reinterpret_cast<char *>(&reservedCanErrorFrame), sizeof(reservedCanErrorFrame));
 }
 
 void CanErrorFrame::write(AbstractFile & os) {
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&length), sizeof(length));
+    CanErrorFrameFields::write(os, *this);
     if (length > 0)
         os.write(reinterpret_cast<char *>(&reservedCanErrorFrame), sizeof(reservedCanErrorFrame));
 }
@@ -30,8 +35,7 @@ void CanErrorFrame::write(AbstractFile & os) {
 uint32_t CanErrorFrame::calculateObjectSize() const {
     uint32_t size =
         ObjectHeader::calculateObjectSize() +
-        sizeof(channel) +
-        sizeof(length);
+        CanErrorFrameFields::size();
     if (length > 0)
         size += sizeof(reservedCanErrorFrame);
     return size;
@@ -4,60 +4,46 @@
 
 #include <Vector/BLF/CanErrorFrameExt.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of CanErrorFrameExt from channel to reservedCanErrorFrameExt2 */
+using CanErrorFrameExtFields = Fields<
+    VECTOR_BLF_FIELD(CanErrorFrameExt, channel),
+    VECTOR_BLF_FIELD(CanErrorFrameExt, length),
+    VECTOR_BLF_FIELD(CanErrorFrameExt, flags),
+    VECTOR_BLF_FIELD(CanErrorFrameExt, ecc),
+    VECTOR_BLF_FIELD(CanErrorFrameExt, position),
+    VECTOR_BLF_FIELD(CanErrorFrameExt, dlc),
+    VECTOR_BLF_FIELD(CanErrorFrameExt, reservedCanErrorFrameExt1),
+    VECTOR_BLF_FIELD(CanErrorFrameExt, frameLengthInNs),
+    VECTOR_BLF_FIELD(CanErrorFrameExt, id),
+    VECTOR_BLF_FIELD(CanErrorFrameExt, flagsExt),
+    VECTOR_BLF_FIELD(CanErrorFrameExt, reservedCanErrorFrameExt2)>;
+
 CanErrorFrameExt::CanErrorFrameExt() :
     ObjectHeader(ObjectType::CAN_ERROR_EXT) {
 }
 
 void CanErrorFrameExt::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&length), sizeof(length));
-    is.read(reinterpret_cast<char *>(&flags), sizeof(flags));
-    is.read(reinterpret_cast<char *>(&ecc), sizeof(ecc));
-    is.read(reinterpret_cast<char *>(&position), sizeof(position));
-    is.read(reinterpret_cast<char *>(&dlc), sizeof(dlc));
-    is.read(reinterpret_cast<char *>(&reservedCanErrorFrameExt1), sizeof(reservedCanErrorFrameExt1));
-    is.read(reinterpret_cast<char *>(&frameLengthInNs), sizeof(frameLengthInNs));
-    is.read(reinterpret_cast<char *>(&id), sizeof(id));
-    is.read(reinterpret_cast<char *>(&flagsExt), sizeof(flagsExt));
-    is.read(reinterpret_cast<char *>(&reservedCanErrorFrameExt2), sizeof(reservedCanErrorFrameExt2));
+    CanErrorFrameExtFields::read(is, *this);
     data.resize(objectSize - calculateObjectSize()); // all remaining data
     is.read(reinterpret_cast<char *>(data.data()), static_cast<std::streamsize>(data.size()));
 }
 
 void CanErrorFrameExt::write(AbstractFile & os) {
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&length), sizeof(length));
-    os.write(reinterpret_cast<char *>(&flags), sizeof(flags));
-    os.write(reinterpret_cast<char *>(&ecc), sizeof(ecc));
-    os.write(reinterpret_cast<char *>(&position), sizeof(position));
-    os.write(reinterpret_cast<char *>(&dlc), sizeof(dlc));
-    os.write(reinterpret_cast<char *>(&reservedCanErrorFrameExt1), sizeof(reservedCanErrorFrameExt1));
-    os.write(reinterpret_cast<char *>(&frameLengthInNs), sizeof(frameLengthInNs));
-    os.write(reinterpret_cast<char *>(&id), sizeof(id));
-    os.write(reinterpret_cast<char *>(&flagsExt), sizeof(flagsExt));
-    os.write(reinterpret_cast<char *>(&reservedCanErrorFrameExt2), sizeof(reservedCanErrorFrameExt2));
+    CanErrorFrameExtFields::write(os, *this);
     os.write(reinterpret_cast<char *>(data.data()), static_cast<std::streamsize>(data.size()));
 }
 
 uint32_t CanErrorFrameExt::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        sizeof(channel) +
-        sizeof(length) +
-        sizeof(flags) +
-        sizeof(ecc) +
-        sizeof(position) +
-        sizeof(dlc) +
-        sizeof(reservedCanErrorFrameExt1) +
-        sizeof(frameLengthInNs) +
-        sizeof(id) +
-        sizeof(flagsExt) +
-        sizeof(reservedCanErrorFrameExt2) +
+        CanErrorFrameExtFields::size() +
         static_cast<uint32_t>(data.size());
 }
 
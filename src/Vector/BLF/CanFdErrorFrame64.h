@@ -10,6 +10,7 @@
 
 #include <Vector/BLF/AbstractFile.h>
 #include <Vector/BLF/CanFdExtFrameData.h>
+#include <Vector/BLF/InlineVector.h>
 #include <Vector/BLF/ObjectHeader.h>
 
 #include <Vector/BLF/vector_blf_export.h>
@@ -180,7 +181,7 @@ struct VECTOR_BLF_EXPORT CanFdErrorFrame64 final : ObjectHeader, CanFdExtFrameDa
      * dlc, e.g. when DLC is 12 data has length
      * 24)
      */
-    std::vector<uint8_t> data {};
+    InlineVector<uint8_t, 64> data {};
 
     /**
      * reserved
@@ -4,25 +4,29 @@
 
 #include <Vector/BLF/CanFdExtFrameData.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of CanFdExtFrameData from btrExtArb to btrExtData */
+using CanFdExtFrameDataFields = Fields<
+    VECTOR_BLF_FIELD(CanFdExtFrameData, btrExtArb),
+    VECTOR_BLF_FIELD(CanFdExtFrameData, btrExtData)>;
+
 void CanFdExtFrameData::read(AbstractFile & is) {
-    is.read(reinterpret_cast<char *>(&btrExtArb), sizeof(btrExtArb));
-    is.read(reinterpret_cast<char *>(&btrExtData), sizeof(btrExtData));
+    CanFdExtFrameDataFields::read(is, *this);
     // @note reservedCanFdExtFrameData is read by CanFdMessage64/CanFdErrorFrame64 due to objectSize known there.
 }
 
 void CanFdExtFrameData::write(AbstractFile & os) {
-    os.write(reinterpret_cast<char *>(&btrExtArb), sizeof(btrExtArb));
-    os.write(reinterpret_cast<char *>(&btrExtData), sizeof(btrExtData));
+    CanFdExtFrameDataFields::write(os, *this);
     os.write(reinterpret_cast<char *>(reservedCanFdExtFrameData.data()), reservedCanFdExtFrameData.size());
 }
 
 uint32_t CanFdExtFrameData::calculateObjectSize() const {
     return
-        sizeof(btrExtArb) +
-        sizeof(btrExtData) +
+        CanFdExtFrameDataFields::size() +
         static_cast<uint32_t>(reservedCanFdExtFrameData.size());
 }
 
@@ -4,61 +4,45 @@
 
 #include <Vector/BLF/CanFdMessage.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of CanFdMessage from channel to reservedCanFdMessage3 */
+using CanFdMessageFields = Fields<
+    VECTOR_BLF_FIELD(CanFdMessage, channel),
+    VECTOR_BLF_FIELD(CanFdMessage, flags),
+    VECTOR_BLF_FIELD(CanFdMessage, dlc),
+    VECTOR_BLF_FIELD(CanFdMessage, id),
+    VECTOR_BLF_FIELD(CanFdMessage, frameLength),
+    VECTOR_BLF_FIELD(CanFdMessage, arbBitCount),
+    VECTOR_BLF_FIELD(CanFdMessage, canFdFlags),
+    VECTOR_BLF_FIELD(CanFdMessage, validDataBytes),
+    VECTOR_BLF_FIELD(CanFdMessage, reservedCanFdMessage1),
+    VECTOR_BLF_FIELD(CanFdMessage, reservedCanFdMessage2),
+    VECTOR_BLF_FIELD(CanFdMessage, data),
+    VECTOR_BLF_FIELD(CanFdMessage, reservedCanFdMessage3)>;
+
 CanFdMessage::CanFdMessage() :
     ObjectHeader(ObjectType::CAN_FD_MESSAGE) {
 }
 
 void CanFdMessage::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&flags), sizeof(flags));
-    is.read(reinterpret_cast<char *>(&dlc), sizeof(dlc));
-    is.read(reinterpret_cast<char *>(&id), sizeof(id));
-    is.read(reinterpret_cast<char *>(&frameLength), sizeof(frameLength));
-    is.read(reinterpret_cast<char *>(&arbBitCount), sizeof(arbBitCount));
-    is.read(reinterpret_cast<char *>(&canFdFlags), sizeof(canFdFlags));
-    is.read(reinterpret_cast<char *>(&validDataBytes), sizeof(validDataBytes));
-    is.read(reinterpret_cast<char *>(&reservedCanFdMessage1), sizeof(reservedCanFdMessage1));
-    is.read(reinterpret_cast<char *>(&reservedCanFdMessage2), sizeof(reservedCanFdMessage2));
-    is.read(reinterpret_cast<char *>(data.data()), static_cast<std::streamsize>(data.size()));
-    is.read(reinterpret_cast<char *>(&reservedCanFdMessage3), sizeof(reservedCanFdMessage3));
+    CanFdMessageFields::read(is, *this);
     // @note might be extended in future versions
 }
 
 void CanFdMessage::write(AbstractFile & os) {
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&flags), sizeof(flags));
-    os.write(reinterpret_cast<char *>(&dlc), sizeof(dlc));
-    os.write(reinterpret_cast<char *>(&id), sizeof(id));
-    os.write(reinterpret_cast<char *>(&frameLength), sizeof(frameLength));
-    os.write(reinterpret_cast<char *>(&arbBitCount), sizeof(arbBitCount));
-    os.write(reinterpret_cast<char *>(&canFdFlags), sizeof(canFdFlags));
-    os.write(reinterpret_cast<char *>(&validDataBytes), sizeof(validDataBytes));
-    os.write(reinterpret_cast<char *>(&reservedCanFdMessage1), sizeof(reservedCanFdMessage1));
-    os.write(reinterpret_cast<char *>(&reservedCanFdMessage2), sizeof(reservedCanFdMessage2));
-    os.write(reinterpret_cast<char *>(data.data()), static_cast<std::streamsize>(data.size()));
-    os.write(reinterpret_cast<char *>(&reservedCanFdMessage3), sizeof(reservedCanFdMessage3));
+    CanFdMessageFields::write(os, *this);
 }
 
 uint32_t CanFdMessage::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        sizeof(channel) +
-        sizeof(flags) +
-        sizeof(dlc) +
-        sizeof(id) +
-        sizeof(frameLength) +
-        sizeof(arbBitCount) +
-        sizeof(canFdFlags) +
-        sizeof(validDataBytes) +
-        sizeof(reservedCanFdMessage1) +
-        sizeof(reservedCanFdMessage2) +
-        static_cast<uint32_t>(data.size()) +
-        sizeof(reservedCanFdMessage3);
+        CanFdMessageFields::size();
 }
 
 }
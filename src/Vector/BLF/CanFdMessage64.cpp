@@ -4,9 +4,29 @@
 
 #include <Vector/BLF/CanFdMessage64.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of CanFdMessage64 from channel to crc */
+using CanFdMessage64Fields = Fields<
+    VECTOR_BLF_FIELD(CanFdMessage64, channel),
+    VECTOR_BLF_FIELD(CanFdMessage64, dlc),
+    VECTOR_BLF_FIELD(CanFdMessage64, validDataBytes),
+    VECTOR_BLF_FIELD(CanFdMessage64, txCount),
+    VECTOR_BLF_FIELD(CanFdMessage64, id),
+    VECTOR_BLF_FIELD(CanFdMessage64, frameLength),
+    VECTOR_BLF_FIELD(CanFdMessage64, flags),
+    VECTOR_BLF_FIELD(CanFdMessage64, btrCfgArb),
+    VECTOR_BLF_FIELD(CanFdMessage64, btrCfgData),
+    VECTOR_BLF_FIELD(CanFdMessage64, timeOffsetBrsNs),
+    VECTOR_BLF_FIELD(CanFdMessage64, timeOffsetCrcDelNs),
+    VECTOR_BLF_FIELD(CanFdMessage64, bitCount),
+    VECTOR_BLF_FIELD(CanFdMessage64, dir),
+    VECTOR_BLF_FIELD(CanFdMessage64, extDataOffset),
+    VECTOR_BLF_FIELD(CanFdMessage64, crc)>;
+
 CanFdMessage64::CanFdMessage64() :
     ObjectHeader(ObjectType::CAN_FD_MESSAGE_64),
     CanFdExtFrameData() {
@@ -14,23 +34,14 @@ CanFdMessage64::CanFdMessage64() :
 
 void CanFdMessage64::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&dlc), sizeof(dlc));
-    is.read(reinterpret_cast<char *>(&validDataBytes), sizeof(validDataBytes));
-    is.read(reinterpret_cast<char *>(&txCount), sizeof(txCount));
-    is.read(reinterpret_cast<char *>(&id), sizeof(id));
-    is.read(reinterpret_cast<char *>(&frameLength), sizeof(frameLength));
-    is.read(reinterpret_cast<char *>(&flags), sizeof(flags));
-    is.read(reinterpret_cast<char *>(&btrCfgArb), sizeof(btrCfgArb));
-    is.read(reinterpret_cast<char *>(&btrCfgData), sizeof(btrCfgData));
-    is.read(reinterpret_cast<char *>(&timeOffsetBrsNs), sizeof(timeOffsetBrsNs));
-    is.read(reinterpret_cast<char *>(&timeOffsetCrcDelNs), sizeof(timeOffsetCrcDelNs));
-    is.read(reinterpret_cast<char *>(&bitCount), sizeof(bitCount));
-    is.read(reinterpret_cast<char *>(&dir), sizeof(dir));
-    is.read(reinterpret_cast<char *>(&extDataOffset), sizeof(extDataOffset));
-    is.read(reinterpret_cast<char *>(&crc), sizeof(crc));
-    data.resize(validDataBytes);
-    is.read(reinterpret_cast<char *>(data.data()), static_cast<std::streamsize>(data.size()));
+    CanFdMessage64Fields::read(is, *this);
+    dataView = is.readPayload(validDataBytes);
+    if (dataView.data() == nullptr) {
+        data.resize(validDataBytes);
+        is.read(reinterpret_cast<char *>(data.data()), static_cast<std::streamsize>(data.size()));
+    } else {
+        data.clear();
+    }
     if (hasExtData())
         CanFdExtFrameData::read(is);
     // @note reservedCanFdExtFrameData is read here as CanFdExtFrameData doesn't know the objectSize
@@ -40,25 +51,11 @@ void CanFdMessage64::read(AbstractFile & is) {
 
 void CanFdMessage64::write(AbstractFile & os) {
     /* pre processing */
-    validDataBytes = static_cast<uint8_t>(data.size());
+    validDataBytes = static_cast<uint8_t>(PayloadView::sizeOf(data, dataView));
 
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&dlc), sizeof(dlc));
-    os.write(reinterpret_cast<char *>(&validDataBytes), sizeof(validDataBytes));
-    os.write(reinterpret_cast<char *>(&txCount), sizeof(txCount));
-    os.write(reinterpret_cast<char *>(&id), sizeof(id));
-    os.write(reinterpret_cast<char *>(&frameLength), sizeof(frameLength));
-    os.write(reinterpret_cast<char *>(&flags), sizeof(flags));
-    os.write(reinterpret_cast<char *>(&btrCfgArb), sizeof(btrCfgArb));
-    os.write(reinterpret_cast<char *>(&btrCfgData), sizeof(btrCfgData));
-    os.write(reinterpret_cast<char *>(&timeOffsetBrsNs), sizeof(timeOffsetBrsNs));
-    os.write(reinterpret_cast<char *>(&timeOffsetCrcDelNs), sizeof(timeOffsetCrcDelNs));
-    os.write(reinterpret_cast<char *>(&bitCount), sizeof(bitCount));
-    os.write(reinterpret_cast<char *>(&dir), sizeof(dir));
-    os.write(reinterpret_cast<char *>(&extDataOffset), sizeof(extDataOffset));
-    os.write(reinterpret_cast<char *>(&crc), sizeof(crc));
-    os.write(reinterpret_cast<char *>(data.data()), static_cast<std::streamsize>(data.size()));
+    CanFdMessage64Fields::write(os, *this);
+    os.write(reinterpret_cast<const char *>(PayloadView::dataOf(data, dataView)), validDataBytes);
     if (hasExtData())
         CanFdExtFrameData::write(os);
 }
@@ -72,22 +69,8 @@ bool CanFdMessage64::hasExtData() const {
 uint32_t CanFdMessage64::calculateObjectSize() const {
     uint32_t size =
         ObjectHeader::calculateObjectSize() +
-        sizeof(channel) +
-        sizeof(dlc) +
-        sizeof(validDataBytes) +
-        sizeof(txCount) +
-        sizeof(id) +
-        sizeof(frameLength) +
-        sizeof(flags) +
-        sizeof(btrCfgArb) +
-        sizeof(btrCfgData) +
-        sizeof(timeOffsetBrsNs) +
-        sizeof(timeOffsetCrcDelNs) +
-        sizeof(bitCount) +
-        sizeof(dir) +
-        sizeof(extDataOffset) +
-        sizeof(crc) +
-        static_cast<uint32_t>(data.size());
+        CanFdMessage64Fields::size() +
+        static_cast<uint32_t>(PayloadView::sizeOf(data, dataView));
     if (hasExtData())
         size += CanFdExtFrameData::calculateObjectSize();
     return size;
@@ -6,11 +6,12 @@
 
 #include <Vector/BLF/platform.h>
 
-#include <vector>
 
 #include <Vector/BLF/AbstractFile.h>
 #include <Vector/BLF/CanFdExtFrameData.h>
+#include <Vector/BLF/InlineVector.h>
 #include <Vector/BLF/ObjectHeader.h>
+#include <Vector/BLF/PayloadView.h>
 
 #include <Vector/BLF/vector_blf_export.h>
 
@@ -178,7 +179,14 @@ struct VECTOR_BLF_EXPORT CanFdMessage64 final : ObjectHeader, CanFdExtFrameData
      * than 64 bytes, according to the value of
      * dlc).
      */
-    std::vector<uint8_t> data {};
+    InlineVector<uint8_t, 64> data {};
+
+    /**
+     * view of data, if read with File::lazyPayloads
+     *
+     * data is empty then. On write, data is used, unless it is empty.
+     */
+    PayloadView dataView {};
 };
 
 }
@@ -4,39 +4,37 @@
 
 #include <Vector/BLF/CanMessage.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of CanMessage from channel to data */
+using CanMessageFields = Fields<
+    VECTOR_BLF_FIELD(CanMessage, channel),
+    VECTOR_BLF_FIELD(CanMessage, flags),
+    VECTOR_BLF_FIELD(CanMessage, dlc),
+    VECTOR_BLF_FIELD(CanMessage, id),
+    VECTOR_BLF_FIELD(CanMessage, data)>;
+
 CanMessage::CanMessage() :
     ObjectHeader(ObjectType::CAN_MESSAGE) {
 }
 
 void CanMessage::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&flags), sizeof(flags));
-    is.read(reinterpret_cast<char *>(&dlc), sizeof(dlc));
-    is.read(reinterpret_cast<char *>(&id), sizeof(id));
-    is.read(reinterpret_cast<char *>(data.data()), static_cast<std::streamsize>(data.size()));
+    CanMessageFields::read(is, *this);
 }
 
 void CanMessage::write(AbstractFile & os) {
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&flags), sizeof(flags));
-    os.write(reinterpret_cast<char *>(&dlc), sizeof(dlc));
-    os.write(reinterpret_cast<char *>(&id), sizeof(id));
-    os.write(reinterpret_cast<char *>(data.data()), static_cast<std::streamsize>(data.size()));
+    CanMessageFields::write(os, *this);
 }
 
 uint32_t CanMessage::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        sizeof(channel) +
-        sizeof(flags) +
-        sizeof(dlc) +
-        sizeof(id) +
-        static_cast<uint32_t>(data.size());
+        CanMessageFields::size();
 }
 
 }
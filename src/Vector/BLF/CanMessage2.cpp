@@ -4,53 +4,51 @@
 
 #include <Vector/BLF/CanMessage2.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of CanMessage2 from channel to id */
+using CanMessage2Fields1 = Fields<
+    VECTOR_BLF_FIELD(CanMessage2, channel),
+    VECTOR_BLF_FIELD(CanMessage2, flags),
+    VECTOR_BLF_FIELD(CanMessage2, dlc),
+    VECTOR_BLF_FIELD(CanMessage2, id)>;
+
+/** fields of CanMessage2 from frameLength to reservedCanMessage2 */
+using CanMessage2Fields2 = Fields<
+    VECTOR_BLF_FIELD(CanMessage2, frameLength),
+    VECTOR_BLF_FIELD(CanMessage2, bitCount),
+    VECTOR_BLF_FIELD(CanMessage2, reservedCanMessage1),
+    VECTOR_BLF_FIELD(CanMessage2, reservedCanMessage2)>;
+
 CanMessage2::CanMessage2() :
     ObjectHeader(ObjectType::CAN_MESSAGE2) {
 }
 
 void CanMessage2::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&flags), sizeof(flags));
-    is.read(reinterpret_cast<char *>(&dlc), sizeof(dlc));
-    is.read(reinterpret_cast<char *>(&id), sizeof(id));
+    CanMessage2Fields1::read(is, *this);
     data.resize(objectSize - calculateObjectSize()); // all remaining data
     is.read(reinterpret_cast<char *>(data.data()), static_cast<std::streamsize>(data.size()));
-    is.read(reinterpret_cast<char *>(&frameLength), sizeof(frameLength));
-    is.read(reinterpret_cast<char *>(&bitCount), sizeof(bitCount));
-    is.read(reinterpret_cast<char *>(&reservedCanMessage1), sizeof(reservedCanMessage1));
-    is.read(reinterpret_cast<char *>(&reservedCanMessage2), sizeof(reservedCanMessage2));
+    CanMessage2Fields2::read(is, *this);
     // @note might be extended in future versions
 }
 
 void CanMessage2::write(AbstractFile & os) {
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&flags), sizeof(flags));
-    os.write(reinterpret_cast<char *>(&dlc), sizeof(dlc));
-    os.write(reinterpret_cast<char *>(&id), sizeof(id));
+    CanMessage2Fields1::write(os, *this);
     os.write(reinterpret_cast<char *>(data.data()), static_cast<std::streamsize>(data.size()));
-    os.write(reinterpret_cast<char *>(&frameLength), sizeof(frameLength));
-    os.write(reinterpret_cast<char *>(&bitCount), sizeof(bitCount));
-    os.write(reinterpret_cast<char *>(&reservedCanMessage1), sizeof(reservedCanMessage1));
-    os.write(reinterpret_cast<char *>(&reservedCanMessage2), sizeof(reservedCanMessage2));
+    CanMessage2Fields2::write(os, *this);
 }
 
 uint32_t CanMessage2::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        sizeof(channel) +
-        sizeof(flags) +
-        sizeof(dlc) +
-        sizeof(id) +
+        CanMessage2Fields1::size() +
         static_cast<uint32_t>(data.size()) +
-        sizeof(frameLength) +
-        sizeof(bitCount) +
-        sizeof(reservedCanMessage1) +
-        sizeof(reservedCanMessage2);
+        CanMessage2Fields2::size();
 }
 
 }
@@ -4,33 +4,35 @@
 
 #include <Vector/BLF/CanOverloadFrame.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of CanOverloadFrame from channel to reservedCanOverloadFrame2 */
+using CanOverloadFrameFields = Fields<
+    VECTOR_BLF_FIELD(CanOverloadFrame, channel),
+    VECTOR_BLF_FIELD(CanOverloadFrame, reservedCanOverloadFrame1),
+    VECTOR_BLF_FIELD(CanOverloadFrame, reservedCanOverloadFrame2)>;
+
 CanOverloadFrame::CanOverloadFrame() :
     ObjectHeader(ObjectType::CAN_OVERLOAD) {
 }
 
 void CanOverloadFrame::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&reservedCanOverloadFrame1), sizeof(reservedCanOverloadFrame1));
-    is.read(reinterpret_cast<char *>(&reservedCanOverloadFrame2), sizeof(reservedCanOverloadFrame2));
+    CanOverloadFrameFields::read(is, *this);
 }
 
 void CanOverloadFrame::write(AbstractFile & os) {
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&reservedCanOverloadFrame1), sizeof(reservedCanOverloadFrame1));
-    os.write(reinterpret_cast<char *>(&reservedCanOverloadFrame2), sizeof(reservedCanOverloadFrame2));
+    CanOverloadFrameFields::write(os, *this);
 }
 
 uint32_t CanOverloadFrame::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        sizeof(channel) +
-        sizeof(reservedCanOverloadFrame1) +
-        sizeof(reservedCanOverloadFrame2);
+        CanOverloadFrameFields::size();
 }
 
 }
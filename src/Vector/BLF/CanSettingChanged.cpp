@@ -4,32 +4,36 @@
 
 #include <Vector/BLF/CanSettingChanged.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of CanSettingChanged from channel to changedType */
+using CanSettingChangedFields = Fields<
+    VECTOR_BLF_FIELD(CanSettingChanged, channel),
+    VECTOR_BLF_FIELD(CanSettingChanged, changedType)>;
+
 CanSettingChanged::CanSettingChanged() :
     ObjectHeader(ObjectType::CAN_SETTING_CHANGED) {
 }
 
 void CanSettingChanged::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&changedType), sizeof(changedType));
+    CanSettingChangedFields::read(is, *this);
     bitTimings.read(is);
 }
 
 void CanSettingChanged::write(AbstractFile & os) {
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&changedType), sizeof(changedType));
+    CanSettingChangedFields::write(os, *this);
     bitTimings.write(os);
 }
 
 uint32_t CanSettingChanged::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        sizeof(channel) +
-        sizeof(changedType) +
+        CanSettingChangedFields::size() +
         bitTimings.calculateObjectSize();
 }
 
@@ -4,24 +4,28 @@
 
 #include <Vector/BLF/CompactSerialEvent.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of CompactSerialEvent from compactLength to compactData */
+using CompactSerialEventFields = Fields<
+    VECTOR_BLF_FIELD(CompactSerialEvent, compactLength),
+    VECTOR_BLF_FIELD(CompactSerialEvent, compactData)>;
+
 uint32_t CompactSerialEvent::calculateObjectSize() const {
     return
-        sizeof(compactLength) +
-        static_cast<uint32_t>(compactData.size());
+        CompactSerialEventFields::size();
 }
 
 void CompactSerialEvent::read(AbstractFile & is) {
-    is.read(reinterpret_cast<char *>(&compactLength), sizeof(compactLength));
-    is.read(reinterpret_cast<char *>(compactData.data()), static_cast<std::streamsize>(compactData.size()));
+    CompactSerialEventFields::read(is, *this);
     // @note might be extended in future versions
 }
 
 void CompactSerialEvent::write(AbstractFile & os) {
-    os.write(reinterpret_cast<char *>(&compactLength), sizeof(compactLength));
-    os.write(reinterpret_cast<char *>(&compactData), sizeof(compactData));
+    CompactSerialEventFields::write(os, *this);
 }
 
 }
@@ -95,5 +95,16 @@ void CompressedFile::seekp(std::streampos pos) {
     m_file.seekp(pos);
 }
 
+void CompressedFile::clear() {
+    /* mutex lock */
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_file.clear();
+}
+
+bool CompressedFile::seekable() const {
+    return true;
+}
+
 }
 }
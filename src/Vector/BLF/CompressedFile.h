@@ -9,7 +9,7 @@
 #include <fstream>
 #include <mutex>
 
-#include <Vector/BLF/AbstractFile.h>
+#include <Vector/BLF/AbstractCompressedFile.h>
 
 #include <Vector/BLF/vector_blf_export.h>
 
@@ -21,7 +21,7 @@ namespace BLF {
  *
  * This class is thread-safe.
  */
-class VECTOR_BLF_EXPORT CompressedFile final : public AbstractFile {
+class VECTOR_BLF_EXPORT CompressedFile final : public AbstractCompressedFile {
   public:
     CompressedFile() = default;
     ~CompressedFile() override;
@@ -38,6 +38,11 @@ class VECTOR_BLF_EXPORT CompressedFile final : public AbstractFile {
     std::streampos tellp() override;
     bool good() const override;
     bool eof() const override;
+    bool is_open() const override;
+    void close() override;
+    void seekp(std::streampos pos) override;
+    void clear() override;
+    bool seekable() const override;
 
     /**
      * open file
@@ -47,25 +52,6 @@ class VECTOR_BLF_EXPORT CompressedFile final : public AbstractFile {
      */
     virtual void open(const char * filename, std::ios_base::openmode openMode);
 
-    /**
-     * is file open?
-     *
-     * @return true if file is open
-     */
-    virtual bool is_open() const;
-
-    /**
-     * Close file.
-     */
-    virtual void close();
-
-    /**
-     * Set position in output sequence.
-     *
-     * @param[in] pos Position
-     */
-    virtual void seekp(std::streampos pos);
-
   private:
     /**
      * file stream
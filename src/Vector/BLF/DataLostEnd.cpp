@@ -4,33 +4,35 @@
 
 #include <Vector/BLF/DataLostEnd.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of DataLostEnd from queueIdentifier to numberOfLostEvents */
+using DataLostEndFields = Fields<
+    VECTOR_BLF_FIELD(DataLostEnd, queueIdentifier),
+    VECTOR_BLF_FIELD(DataLostEnd, firstObjectLostTimeStamp),
+    VECTOR_BLF_FIELD(DataLostEnd, numberOfLostEvents)>;
+
 DataLostEnd::DataLostEnd() :
     ObjectHeader(ObjectType::DATA_LOST_END) {
 }
 
 void DataLostEnd::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&queueIdentifier), sizeof(queueIdentifier));
-    is.read(reinterpret_cast<char *>(&firstObjectLostTimeStamp), sizeof(firstObjectLostTimeStamp));
-    is.read(reinterpret_cast<char *>(&numberOfLostEvents), sizeof(numberOfLostEvents));
+    DataLostEndFields::read(is, *this);
 }
 
 void DataLostEnd::write(AbstractFile & os) {
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&queueIdentifier), sizeof(queueIdentifier));
-    os.write(reinterpret_cast<char *>(&firstObjectLostTimeStamp), sizeof(firstObjectLostTimeStamp));
-    os.write(reinterpret_cast<char *>(&numberOfLostEvents), sizeof(numberOfLostEvents));
+    DataLostEndFields::write(os, *this);
 }
 
 uint32_t DataLostEnd::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        sizeof(queueIdentifier) +
-        sizeof(firstObjectLostTimeStamp) +
-        sizeof(numberOfLostEvents);
+        DataLostEndFields::size();
 }
 
 }
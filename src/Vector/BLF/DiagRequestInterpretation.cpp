@@ -4,21 +4,27 @@
 
 #include <Vector/BLF/DiagRequestInterpretation.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of DiagRequestInterpretation from diagDescriptionHandle to serviceQualifierLength */
+using DiagRequestInterpretationFields = Fields<
+    VECTOR_BLF_FIELD(DiagRequestInterpretation, diagDescriptionHandle),
+    VECTOR_BLF_FIELD(DiagRequestInterpretation, diagVariantHandle),
+    VECTOR_BLF_FIELD(DiagRequestInterpretation, diagServiceHandle),
+    VECTOR_BLF_FIELD(DiagRequestInterpretation, ecuQualifierLength),
+    VECTOR_BLF_FIELD(DiagRequestInterpretation, variantQualifierLength),
+    VECTOR_BLF_FIELD(DiagRequestInterpretation, serviceQualifierLength)>;
+
 DiagRequestInterpretation::DiagRequestInterpretation() :
     ObjectHeader(ObjectType::DIAG_REQUEST_INTERPRETATION) {
 }
 
 void DiagRequestInterpretation::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&diagDescriptionHandle), sizeof(diagDescriptionHandle));
-    is.read(reinterpret_cast<char *>(&diagVariantHandle), sizeof(diagVariantHandle));
-    is.read(reinterpret_cast<char *>(&diagServiceHandle), sizeof(diagServiceHandle));
-    is.read(reinterpret_cast<char *>(&ecuQualifierLength), sizeof(ecuQualifierLength));
-    is.read(reinterpret_cast<char *>(&variantQualifierLength), sizeof(variantQualifierLength));
-    is.read(reinterpret_cast<char *>(&serviceQualifierLength), sizeof(serviceQualifierLength));
+    DiagRequestInterpretationFields::read(is, *this);
     ecuQualifier.resize(ecuQualifierLength);
     is.read(const_cast<char *>(ecuQualifier.data()), ecuQualifierLength);
     variantQualifier.resize(variantQualifierLength);
@@ -34,12 +40,7 @@ void DiagRequestInterpretation::write(AbstractFile & os) {
     serviceQualifierLength = static_cast<uint32_t>(serviceQualifier.size());
 
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&diagDescriptionHandle), sizeof(diagDescriptionHandle));
-    os.write(reinterpret_cast<char *>(&diagVariantHandle), sizeof(diagVariantHandle));
-    os.write(reinterpret_cast<char *>(&diagServiceHandle), sizeof(diagServiceHandle));
-    os.write(reinterpret_cast<char *>(&ecuQualifierLength), sizeof(ecuQualifierLength));
-    os.write(reinterpret_cast<char *>(&variantQualifierLength), sizeof(variantQualifierLength));
-    os.write(reinterpret_cast<char *>(&serviceQualifierLength), sizeof(serviceQualifierLength));
+    DiagRequestInterpretationFields::write(os, *this);
     os.write(const_cast<char *>(ecuQualifier.data()), ecuQualifierLength);
     os.write(const_cast<char *>(variantQualifier.data()), variantQualifierLength);
     os.write(const_cast<char *>(serviceQualifier.data()), serviceQualifierLength);
@@ -48,12 +49,7 @@ void DiagRequestInterpretation::write(AbstractFile & os) {
 uint32_t DiagRequestInterpretation::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        sizeof(diagDescriptionHandle) +
-        sizeof(diagVariantHandle) +
-        sizeof(diagServiceHandle) +
-        sizeof(ecuQualifierLength) +
-        sizeof(variantQualifierLength) +
-        sizeof(serviceQualifierLength) +
+        DiagRequestInterpretationFields::size() +
         ecuQualifierLength +
         variantQualifierLength +
         serviceQualifierLength;
@@ -4,19 +4,25 @@
 
 #include <Vector/BLF/DistributedObjectMember.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of DistributedObjectMember from memberType to dataLength */
+using DistributedObjectMemberFields = Fields<
+    VECTOR_BLF_FIELD(DistributedObjectMember, memberType),
+    VECTOR_BLF_FIELD(DistributedObjectMember, detailType),
+    VECTOR_BLF_FIELD(DistributedObjectMember, pathLength),
+    VECTOR_BLF_FIELD(DistributedObjectMember, dataLength)>;
+
 DistributedObjectMember::DistributedObjectMember() :
     ObjectHeader(ObjectType::DISTRIBUTED_OBJECT_MEMBER) {
 }
 
 void DistributedObjectMember::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&memberType), sizeof(memberType));
-    is.read(reinterpret_cast<char *>(&detailType), sizeof(detailType));
-    is.read(reinterpret_cast<char *>(&pathLength), sizeof(pathLength));
-    is.read(reinterpret_cast<char *>(&dataLength), sizeof(dataLength));
+    DistributedObjectMemberFields::read(is, *this);
     path.resize(pathLength);
     is.read(const_cast<char *>(path.data()), pathLength);
     data.resize(dataLength);
@@ -29,10 +35,7 @@ void DistributedObjectMember::write(AbstractFile & os) {
     dataLength = static_cast<uint32_t>(data.size());
 
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&memberType), sizeof(memberType));
-    os.write(reinterpret_cast<char *>(&detailType), sizeof(detailType));
-    os.write(reinterpret_cast<char *>(&pathLength), sizeof(pathLength));
-    os.write(reinterpret_cast<char *>(&dataLength), sizeof(dataLength));
+    DistributedObjectMemberFields::write(os, *this);
     os.write(const_cast<char *>(path.data()), pathLength);
     os.write(reinterpret_cast<char *>(data.data()), dataLength);
 }
@@ -40,10 +43,7 @@ void DistributedObjectMember::write(AbstractFile & os) {
 uint32_t DistributedObjectMember::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        sizeof(memberType) +
-        sizeof(detailType) +
-        sizeof(pathLength) +
-        sizeof(dataLength) +
+        DistributedObjectMemberFields::size() +
         pathLength +
         dataLength;
 }
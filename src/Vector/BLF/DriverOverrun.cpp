@@ -4,33 +4,35 @@
 
 #include <Vector/BLF/DriverOverrun.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of DriverOverrun from busType to reservedDriverOverrun */
+using DriverOverrunFields = Fields<
+    VECTOR_BLF_FIELD(DriverOverrun, busType),
+    VECTOR_BLF_FIELD(DriverOverrun, channel),
+    VECTOR_BLF_FIELD(DriverOverrun, reservedDriverOverrun)>;
+
 DriverOverrun::DriverOverrun() :
     ObjectHeader(ObjectType::OVERRUN_ERROR) {
 }
 
 void DriverOverrun::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&busType), sizeof(busType));
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&reservedDriverOverrun), sizeof(reservedDriverOverrun));
+    DriverOverrunFields::read(is, *this);
 }
 
 void DriverOverrun::write(AbstractFile & os) {
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&busType), sizeof(busType));
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&reservedDriverOverrun), sizeof(reservedDriverOverrun));
+    DriverOverrunFields::write(os, *this);
 }
 
 uint32_t DriverOverrun::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        sizeof(busType) +
-        sizeof(channel) +
-        sizeof(reservedDriverOverrun);
+        DriverOverrunFields::size();
 }
 
 }
@@ -6,9 +6,17 @@
 
 #include <Vector/BLF/EnvironmentVariable.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of EnvironmentVariable from nameLength to reservedEnvironmentVariable */
+using EnvironmentVariableFields = Fields<
+    VECTOR_BLF_FIELD(EnvironmentVariable, nameLength),
+    VECTOR_BLF_FIELD(EnvironmentVariable, dataLength),
+    VECTOR_BLF_FIELD(EnvironmentVariable, reservedEnvironmentVariable)>;
+
 EnvironmentVariable::EnvironmentVariable(/*const ObjectType objectType*/) :
     ObjectHeader(ObjectType::UNKNOWN) {
     /* can be one of:
@@ -21,9 +29,7 @@ EnvironmentVariable::EnvironmentVariable(/*const ObjectType objectType*/) :
 
 void EnvironmentVariable::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&nameLength), sizeof(nameLength));
-    is.read(reinterpret_cast<char *>(&dataLength), sizeof(dataLength));
-    is.read(reinterpret_cast<char *>(&reservedEnvironmentVariable), sizeof(reservedEnvironmentVariable));
+    EnvironmentVariableFields::read(is, *this);
     name.resize(nameLength);
     is.read(const_cast<char *>(name.data()), nameLength);
     data.resize(dataLength);
@@ -39,9 +45,7 @@ void EnvironmentVariable::write(AbstractFile & os) {
     dataLength = static_cast<uint32_t>(data.size());
 
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&nameLength), sizeof(nameLength));
-    os.write(reinterpret_cast<char *>(&dataLength), sizeof(dataLength));
-    os.write(reinterpret_cast<char *>(&reservedEnvironmentVariable), sizeof(reservedEnvironmentVariable));
+    EnvironmentVariableFields::write(os, *this);
     os.write(const_cast<char *>(name.data()), nameLength);
     os.write(reinterpret_cast<char *>(data.data()), dataLength);
 
@@ -52,9 +56,7 @@ void EnvironmentVariable::write(AbstractFile & os) {
 uint32_t EnvironmentVariable::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        sizeof(nameLength) +
-        sizeof(dataLength) +
-        sizeof(reservedEnvironmentVariable) +
+        EnvironmentVariableFields::size() +
         nameLength +
         dataLength;
 }
@@ -4,25 +4,31 @@
 
 #include <Vector/BLF/EthernetErrorEx.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of EthernetErrorEx from structLength to error */
+using EthernetErrorExFields = Fields<
+    VECTOR_BLF_FIELD(EthernetErrorEx, structLength),
+    VECTOR_BLF_FIELD(EthernetErrorEx, flags),
+    VECTOR_BLF_FIELD(EthernetErrorEx, channel),
+    VECTOR_BLF_FIELD(EthernetErrorEx, hardwareChannel),
+    VECTOR_BLF_FIELD(EthernetErrorEx, frameDuration),
+    VECTOR_BLF_FIELD(EthernetErrorEx, frameChecksum),
+    VECTOR_BLF_FIELD(EthernetErrorEx, dir),
+    VECTOR_BLF_FIELD(EthernetErrorEx, frameLength),
+    VECTOR_BLF_FIELD(EthernetErrorEx, frameHandle),
+    VECTOR_BLF_FIELD(EthernetErrorEx, error)>;
+
 EthernetErrorEx::EthernetErrorEx() :
     ObjectHeader(ObjectType::ETHERNET_ERROR_EX) {
 }
 
 void EthernetErrorEx::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&structLength), sizeof(structLength));
-    is.read(reinterpret_cast<char *>(&flags), sizeof(flags));
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&hardwareChannel), sizeof(hardwareChannel));
-    is.read(reinterpret_cast<char *>(&frameDuration), sizeof(frameDuration));
-    is.read(reinterpret_cast<char *>(&frameChecksum), sizeof(frameChecksum));
-    is.read(reinterpret_cast<char *>(&dir), sizeof(dir));
-    is.read(reinterpret_cast<char *>(&frameLength), sizeof(frameLength));
-    is.read(reinterpret_cast<char *>(&frameHandle), sizeof(frameHandle));
-    is.read(reinterpret_cast<char *>(&error), sizeof(error));
+    EthernetErrorExFields::read(is, *this);
     frameData.resize(frameLength);
     is.read(reinterpret_cast<char *>(frameData.data()), frameLength);
 }
@@ -33,32 +39,14 @@ void EthernetErrorEx::write(AbstractFile & os) {
     frameLength = static_cast<uint16_t>(frameData.size());
 
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&structLength), sizeof(structLength));
-    os.write(reinterpret_cast<char *>(&flags), sizeof(flags));
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&hardwareChannel), sizeof(hardwareChannel));
-    os.write(reinterpret_cast<char *>(&frameDuration), sizeof(frameDuration));
-    os.write(reinterpret_cast<char *>(&frameChecksum), sizeof(frameChecksum));
-    os.write(reinterpret_cast<char *>(&dir), sizeof(dir));
-    os.write(reinterpret_cast<char *>(&frameLength), sizeof(frameLength));
-    os.write(reinterpret_cast<char *>(&frameHandle), sizeof(frameHandle));
-    os.write(reinterpret_cast<char *>(&error), sizeof(error));
+    EthernetErrorExFields::write(os, *this);
     os.write(reinterpret_cast<char *>(frameData.data()), frameLength);
 }
 
 uint32_t EthernetErrorEx::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        sizeof(structLength) +
-        sizeof(flags) +
-        sizeof(channel) +
-        sizeof(hardwareChannel) +
-        sizeof(frameDuration) +
-        sizeof(frameChecksum) +
-        sizeof(dir) +
-        sizeof(frameLength) +
-        sizeof(frameHandle) +
-        sizeof(error) +
+        EthernetErrorExFields::size() +
         frameLength;
 }
 
@@ -4,26 +4,37 @@
 
 #include <Vector/BLF/EthernetFrame.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of EthernetFrame from sourceAddress to reservedEthernetFrame */
+using EthernetFrameFields = Fields<
+    VECTOR_BLF_FIELD(EthernetFrame, sourceAddress),
+    VECTOR_BLF_FIELD(EthernetFrame, channel),
+    VECTOR_BLF_FIELD(EthernetFrame, destinationAddress),
+    VECTOR_BLF_FIELD(EthernetFrame, dir),
+    VECTOR_BLF_FIELD(EthernetFrame, type),
+    VECTOR_BLF_FIELD(EthernetFrame, tpid),
+    VECTOR_BLF_FIELD(EthernetFrame, tci),
+    VECTOR_BLF_FIELD(EthernetFrame, payLoadLength),
+    VECTOR_BLF_FIELD(EthernetFrame, reservedEthernetFrame)>;
+
 EthernetFrame::EthernetFrame() :
     ObjectHeader(ObjectType::ETHERNET_FRAME) {
 }
 
 void EthernetFrame::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(sourceAddress.data()), static_cast<std::streamsize>(sourceAddress.size()));
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(destinationAddress.data()), static_cast<std::streamsize>(destinationAddress.size()));
-    is.read(reinterpret_cast<char *>(&dir), sizeof(dir));
-    is.read(reinterpret_cast<char *>(&type), sizeof(type));
-    is.read(reinterpret_cast<char *>(&tpid), sizeof(tpid));
-    is.read(reinterpret_cast<char *>(&tci), sizeof(tci));
-    is.read(reinterpret_cast<char *>(&payLoadLength), sizeof(payLoadLength));
-    is.read(reinterpret_cast<char *>(&reservedEthernetFrame), sizeof(reservedEthernetFrame));
-    payLoad.resize(payLoadLength);
-    is.read(reinterpret_cast<char *>(payLoad.data()), payLoadLength);
+    EthernetFrameFields::read(is, *this);
+    payLoadView = is.readPayload(payLoadLength);
+    if (payLoadView.data() == nullptr) {
+        payLoad.resize(payLoadLength);
+        is.read(reinterpret_cast<char *>(payLoad.data()), payLoadLength);
+    } else {
+        payLoad.clear();
+    }
 
     /* skip padding */
     is.seekg(objectSize % 4, std::ios_base::cur);
@@ -31,19 +42,11 @@ void EthernetFrame::read(AbstractFile & is) {
 
 void EthernetFrame::write(AbstractFile & os) {
     /* pre processing */
-    payLoadLength = static_cast<uint16_t>(payLoad.size());
+    payLoadLength = static_cast<uint16_t>(PayloadView::sizeOf(payLoad, payLoadView));
 
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(sourceAddress.data()), static_cast<std::streamsize>(sourceAddress.size()));
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(destinationAddress.data()), static_cast<std::streamsize>(destinationAddress.size()));
-    os.write(reinterpret_cast<char *>(&dir), sizeof(dir));
-    os.write(reinterpret_cast<char *>(&type), sizeof(type));
-    os.write(reinterpret_cast<char *>(&tpid), sizeof(tpid));
-    os.write(reinterpret_cast<char *>(&tci), sizeof(tci));
-    os.write(reinterpret_cast<char *>(&payLoadLength), sizeof(payLoadLength));
-    os.write(reinterpret_cast<char *>(&reservedEthernetFrame), sizeof(reservedEthernetFrame));
-    os.write(reinterpret_cast<char *>(payLoad.data()), payLoadLength);
+    EthernetFrameFields::write(os, *this);
+    os.write(reinterpret_cast<const char *>(PayloadView::dataOf(payLoad, payLoadView)), payLoadLength);
 
     /* skip padding */
     os.skipp(objectSize % 4);
@@ -52,15 +55,7 @@ void EthernetFrame::write(AbstractFile & os) {
 uint32_t EthernetFrame::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        static_cast<uint32_t>(sourceAddress.size()) +
-        sizeof(channel) +
-        static_cast<uint32_t>(destinationAddress.size()) +
-        sizeof(dir) +
-        sizeof(type) +
-        sizeof(tpid) +
-        sizeof(tci) +
-        sizeof(payLoadLength) +
-        sizeof(reservedEthernetFrame) +
+        EthernetFrameFields::size() +
         payLoadLength;
 }
 
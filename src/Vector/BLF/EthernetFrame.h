@@ -11,6 +11,7 @@
 
 #include <Vector/BLF/AbstractFile.h>
 #include <Vector/BLF/ObjectHeader.h>
+#include <Vector/BLF/PayloadView.h>
 
 #include <Vector/BLF/vector_blf_export.h>
 
@@ -99,6 +100,13 @@ struct VECTOR_BLF_EXPORT EthernetFrame final : ObjectHeader {
      * header)
      */
     std::vector<uint8_t> payLoad {};
+
+    /**
+     * view of payLoad, if read with File::lazyPayloads
+     *
+     * payLoad is empty then. On write, payLoad is used, unless it is empty.
+     */
+    PayloadView payLoadView {};
 };
 
 }
@@ -4,61 +4,54 @@
 
 #include <Vector/BLF/EthernetFrameForwarded.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of EthernetFrameForwarded from structLength to reservedEthernetFrameForwarded */
+using EthernetFrameForwardedFields = Fields<
+    VECTOR_BLF_FIELD(EthernetFrameForwarded, structLength),
+    VECTOR_BLF_FIELD(EthernetFrameForwarded, flags),
+    VECTOR_BLF_FIELD(EthernetFrameForwarded, channel),
+    VECTOR_BLF_FIELD(EthernetFrameForwarded, hardwareChannel),
+    VECTOR_BLF_FIELD(EthernetFrameForwarded, frameDuration),
+    VECTOR_BLF_FIELD(EthernetFrameForwarded, frameChecksum),
+    VECTOR_BLF_FIELD(EthernetFrameForwarded, dir),
+    VECTOR_BLF_FIELD(EthernetFrameForwarded, frameLength),
+    VECTOR_BLF_FIELD(EthernetFrameForwarded, frameHandle),
+    VECTOR_BLF_FIELD(EthernetFrameForwarded, reservedEthernetFrameForwarded)>;
+
 EthernetFrameForwarded::EthernetFrameForwarded() :
     ObjectHeader(ObjectType::ETHERNET_FRAME_FORWARDED) {
 }
 
 void EthernetFrameForwarded::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&structLength), sizeof(structLength));
-    is.read(reinterpret_cast<char *>(&flags), sizeof(flags));
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&hardwareChannel), sizeof(hardwareChannel));
-    is.read(reinterpret_cast<char *>(&frameDuration), sizeof(frameDuration));
-    is.read(reinterpret_cast<char *>(&frameChecksum), sizeof(frameChecksum));
-    is.read(reinterpret_cast<char *>(&dir), sizeof(dir));
-    is.read(reinterpret_cast<char *>(&frameLength), sizeof(frameLength));
-    is.read(reinterpret_cast<char *>(&frameHandle), sizeof(frameHandle));
-    is.read(reinterpret_cast<char *>(&reservedEthernetFrameForwarded), sizeof(reservedEthernetFrameForwarded));
-    frameData.resize(frameLength);
-    is.read(reinterpret_cast<char *>(frameData.data()), frameLength);
+    EthernetFrameForwardedFields::read(is, *this);
+    frameDataView = is.readPayload(frameLength);
+    if (frameDataView.data() == nullptr) {
+        frameData.resize(frameLength);
+        is.read(reinterpret_cast<char *>(frameData.data()), frameLength);
+    } else {
+        frameData.clear();
+    }
 }
 
 void EthernetFrameForwarded::write(AbstractFile & os) {
     /* pre processing */
     structLength = calculateStructLength();
-    frameLength = static_cast<uint16_t>(frameData.size());
+    frameLength = static_cast<uint16_t>(PayloadView::sizeOf(frameData, frameDataView));
 
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&structLength), sizeof(structLength));
-    os.write(reinterpret_cast<char *>(&flags), sizeof(flags));
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&hardwareChannel), sizeof(hardwareChannel));
-    os.write(reinterpret_cast<char *>(&frameDuration), sizeof(frameDuration));
-    os.write(reinterpret_cast<char *>(&frameChecksum), sizeof(frameChecksum));
-    os.write(reinterpret_cast<char *>(&dir), sizeof(dir));
-    os.write(reinterpret_cast<char *>(&frameLength), sizeof(frameLength));
-    os.write(reinterpret_cast<char *>(&frameHandle), sizeof(frameHandle));
-    os.write(reinterpret_cast<char *>(&reservedEthernetFrameForwarded), sizeof(reservedEthernetFrameForwarded));
-    os.write(reinterpret_cast<char *>(frameData.data()), frameLength);
+    EthernetFrameForwardedFields::write(os, *this);
+    os.write(reinterpret_cast<const char *>(PayloadView::dataOf(frameData, frameDataView)), frameLength);
 }
 
 uint32_t EthernetFrameForwarded::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        sizeof(structLength) +
-        sizeof(flags) +
-        sizeof(channel) +
-        sizeof(hardwareChannel) +
-        sizeof(frameDuration) +
-        sizeof(frameChecksum) +
-        sizeof(dir) +
-        sizeof(frameLength) +
-        sizeof(frameHandle) +
-        sizeof(reservedEthernetFrameForwarded) +
+        EthernetFrameForwardedFields::size() +
         frameLength;
 }
 
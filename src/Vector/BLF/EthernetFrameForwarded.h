@@ -10,6 +10,7 @@
 
 #include <Vector/BLF/AbstractFile.h>
 #include <Vector/BLF/ObjectHeader.h>
+#include <Vector/BLF/PayloadView.h>
 
 #include <Vector/BLF/vector_blf_export.h>
 
@@ -92,6 +93,13 @@ struct VECTOR_BLF_EXPORT EthernetFrameForwarded final : ObjectHeader {
      * @brief Max 1612 data bytes per frame. Contains Ethernet header + Ethernet payload
      */
     std::vector<uint8_t> frameData {};
+
+    /**
+     * view of frameData, if read with File::lazyPayloads
+     *
+     * frameData is empty then. On write, frameData is used, unless it is empty.
+     */
+    PayloadView frameDataView {};
 };
 
 }
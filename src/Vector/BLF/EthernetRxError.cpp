@@ -4,23 +4,29 @@
 
 #include <Vector/BLF/EthernetRxError.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of EthernetRxError from structLength to error */
+using EthernetRxErrorFields = Fields<
+    VECTOR_BLF_FIELD(EthernetRxError, structLength),
+    VECTOR_BLF_FIELD(EthernetRxError, channel),
+    VECTOR_BLF_FIELD(EthernetRxError, dir),
+    VECTOR_BLF_FIELD(EthernetRxError, hardwareChannel),
+    VECTOR_BLF_FIELD(EthernetRxError, fcs),
+    VECTOR_BLF_FIELD(EthernetRxError, frameDataLength),
+    VECTOR_BLF_FIELD(EthernetRxError, reservedEthernetRxError),
+    VECTOR_BLF_FIELD(EthernetRxError, error)>;
+
 EthernetRxError::EthernetRxError() :
     ObjectHeader(ObjectType::ETHERNET_RX_ERROR) {
 }
 
 void EthernetRxError::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&structLength), sizeof(structLength));
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&dir), sizeof(dir));
-    is.read(reinterpret_cast<char *>(&hardwareChannel), sizeof(hardwareChannel));
-    is.read(reinterpret_cast<char *>(&fcs), sizeof(fcs));
-    is.read(reinterpret_cast<char *>(&frameDataLength), sizeof(frameDataLength));
-    is.read(reinterpret_cast<char *>(&reservedEthernetRxError), sizeof(reservedEthernetRxError));
-    is.read(reinterpret_cast<char *>(&error), sizeof(error));
+    EthernetRxErrorFields::read(is, *this);
     frameData.resize(frameDataLength);
     is.read(reinterpret_cast<char *>(frameData.data()), frameDataLength);
 
@@ -34,14 +40,7 @@ void EthernetRxError::write(AbstractFile & os) {
     frameDataLength = static_cast<uint16_t>(frameData.size());
 
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&structLength), sizeof(structLength));
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&dir), sizeof(dir));
-    os.write(reinterpret_cast<char *>(&hardwareChannel), sizeof(hardwareChannel));
-    os.write(reinterpret_cast<char *>(&fcs), sizeof(fcs));
-    os.write(reinterpret_cast<char *>(&frameDataLength), sizeof(frameDataLength));
-    os.write(reinterpret_cast<char *>(&reservedEthernetRxError), sizeof(reservedEthernetRxError));
-    os.write(reinterpret_cast<char *>(&error), sizeof(error));
+    EthernetRxErrorFields::write(os, *this);
     os.write(reinterpret_cast<char *>(frameData.data()), frameDataLength);
 
     /* skip padding */
@@ -51,14 +50,7 @@ void EthernetRxError::write(AbstractFile & os) {
 uint32_t EthernetRxError::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        sizeof(structLength) +
-        sizeof(channel) +
-        sizeof(dir) +
-        sizeof(hardwareChannel) +
-        sizeof(fcs) +
-        sizeof(frameDataLength) +
-        sizeof(reservedEthernetRxError) +
-        sizeof(error) +
+        EthernetRxErrorFields::size() +
         frameDataLength;
 }
 
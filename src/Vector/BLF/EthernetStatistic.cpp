@@ -4,63 +4,45 @@
 
 #include <Vector/BLF/EthernetStatistic.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of EthernetStatistic from channel to reservedEthernetStatistic3 */
+using EthernetStatisticFields = Fields<
+    VECTOR_BLF_FIELD(EthernetStatistic, channel),
+    VECTOR_BLF_FIELD(EthernetStatistic, reservedEthernetStatistic1),
+    VECTOR_BLF_FIELD(EthernetStatistic, reservedEthernetStatistic2),
+    VECTOR_BLF_FIELD(EthernetStatistic, rcvOk_HW),
+    VECTOR_BLF_FIELD(EthernetStatistic, xmitOk_HW),
+    VECTOR_BLF_FIELD(EthernetStatistic, rcvError_HW),
+    VECTOR_BLF_FIELD(EthernetStatistic, xmitError_HW),
+    VECTOR_BLF_FIELD(EthernetStatistic, rcvBytes_HW),
+    VECTOR_BLF_FIELD(EthernetStatistic, xmitBytes_HW),
+    VECTOR_BLF_FIELD(EthernetStatistic, rcvNoBuffer_HW),
+    VECTOR_BLF_FIELD(EthernetStatistic, sqi),
+    VECTOR_BLF_FIELD(EthernetStatistic, hardwareChannel),
+    VECTOR_BLF_FIELD(EthernetStatistic, reservedEthernetStatistic3)>;
+
 EthernetStatistic::EthernetStatistic() :
     ObjectHeader(ObjectType::ETHERNET_STATISTIC) {
 }
 
 void EthernetStatistic::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&reservedEthernetStatistic1), sizeof(reservedEthernetStatistic1));
-    is.read(reinterpret_cast<char *>(&reservedEthernetStatistic2), sizeof(reservedEthernetStatistic2));
-    is.read(reinterpret_cast<char *>(&rcvOk_HW), sizeof(rcvOk_HW));
-    is.read(reinterpret_cast<char *>(&xmitOk_HW), sizeof(xmitOk_HW));
-    is.read(reinterpret_cast<char *>(&rcvError_HW), sizeof(rcvError_HW));
-    is.read(reinterpret_cast<char *>(&xmitError_HW), sizeof(xmitError_HW));
-    is.read(reinterpret_cast<char *>(&rcvBytes_HW), sizeof(rcvBytes_HW));
-    is.read(reinterpret_cast<char *>(&xmitBytes_HW), sizeof(xmitBytes_HW));
-    is.read(reinterpret_cast<char *>(&rcvNoBuffer_HW), sizeof(rcvNoBuffer_HW));
-    is.read(reinterpret_cast<char *>(&sqi), sizeof(sqi));
-    is.read(reinterpret_cast<char *>(&hardwareChannel), sizeof(hardwareChannel));
-    is.read(reinterpret_cast<char *>(&reservedEthernetStatistic3), sizeof(reservedEthernetStatistic3));
+    EthernetStatisticFields::read(is, *this);
 }
 
 void EthernetStatistic::write(AbstractFile & os) {
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&reservedEthernetStatistic1), sizeof(reservedEthernetStatistic1));
-    os.write(reinterpret_cast<char *>(&reservedEthernetStatistic2), sizeof(reservedEthernetStatistic2));
-    os.write(reinterpret_cast<char *>(&rcvOk_HW), sizeof(rcvOk_HW));
-    os.write(reinterpret_cast<char *>(&xmitOk_HW), sizeof(xmitOk_HW));
-    os.write(reinterpret_cast<char *>(&rcvError_HW), sizeof(rcvError_HW));
-    os.write(reinterpret_cast<char *>(&xmitError_HW), sizeof(xmitError_HW));
-    os.write(reinterpret_cast<char *>(&rcvBytes_HW), sizeof(rcvBytes_HW));
-    os.write(reinterpret_cast<char *>(&xmitBytes_HW), sizeof(xmitBytes_HW));
-    os.write(reinterpret_cast<char *>(&rcvNoBuffer_HW), sizeof(rcvNoBuffer_HW));
-    os.write(reinterpret_cast<char *>(&sqi), sizeof(sqi));
-    os.write(reinterpret_cast<char *>(&hardwareChannel), sizeof(hardwareChannel));
-    os.write(reinterpret_cast<char *>(&reservedEthernetStatistic3), sizeof(reservedEthernetStatistic3));
+    EthernetStatisticFields::write(os, *this);
 }
 
 uint32_t EthernetStatistic::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        sizeof(channel) +
-        sizeof(reservedEthernetStatistic1) +
-        sizeof(reservedEthernetStatistic2) +
-        sizeof(rcvOk_HW) +
-        sizeof(xmitOk_HW) +
-        sizeof(rcvError_HW) +
-        sizeof(xmitError_HW) +
-        sizeof(rcvBytes_HW) +
-        sizeof(xmitBytes_HW) +
-        sizeof(rcvNoBuffer_HW) +
-        sizeof(sqi) +
-        sizeof(hardwareChannel) +
-        sizeof(reservedEthernetStatistic3);
+        EthernetStatisticFields::size();
 }
 
 }
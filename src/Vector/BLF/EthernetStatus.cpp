@@ -4,9 +4,30 @@
 
 #include <Vector/BLF/EthernetStatus.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of EthernetStatus from channel to bitrate */
+using EthernetStatusFields = Fields<
+    VECTOR_BLF_FIELD(EthernetStatus, channel),
+    VECTOR_BLF_FIELD(EthernetStatus, flags),
+    VECTOR_BLF_FIELD(EthernetStatus, linkStatus),
+    VECTOR_BLF_FIELD(EthernetStatus, ethernetPhy),
+    VECTOR_BLF_FIELD(EthernetStatus, duplex),
+    VECTOR_BLF_FIELD(EthernetStatus, mdi),
+    VECTOR_BLF_FIELD(EthernetStatus, connector),
+    VECTOR_BLF_FIELD(EthernetStatus, clockMode),
+    VECTOR_BLF_FIELD(EthernetStatus, pairs),
+    VECTOR_BLF_FIELD(EthernetStatus, hardwareChannel),
+    VECTOR_BLF_FIELD(EthernetStatus, bitrate)>;
+
+/** fields of EthernetStatus from reservedEthernetStatus1 to reservedEthernetStatus2, only available in Version 2 and above */
+using EthernetStatusV2Fields = Fields<
+    VECTOR_BLF_FIELD(EthernetStatus, reservedEthernetStatus1),
+    VECTOR_BLF_FIELD(EthernetStatus, reservedEthernetStatus2)>;
+
 EthernetStatus::EthernetStatus() :
     ObjectHeader(ObjectType::ETHERNET_STATUS) {
 }
@@ -14,60 +35,28 @@ EthernetStatus::EthernetStatus() :
 void EthernetStatus::read(AbstractFile & is) {
     apiMajor = 1;
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&flags), sizeof(flags));
-    is.read(reinterpret_cast<char *>(&linkStatus), sizeof(linkStatus));
-    is.read(reinterpret_cast<char *>(&ethernetPhy), sizeof(ethernetPhy));
-    is.read(reinterpret_cast<char *>(&duplex), sizeof(duplex));
-    is.read(reinterpret_cast<char *>(&mdi), sizeof(mdi));
-    is.read(reinterpret_cast<char *>(&connector), sizeof(connector));
-    is.read(reinterpret_cast<char *>(&clockMode), sizeof(clockMode));
-    is.read(reinterpret_cast<char *>(&pairs), sizeof(pairs));
-    is.read(reinterpret_cast<char *>(&hardwareChannel), sizeof(hardwareChannel));
-    is.read(reinterpret_cast<char *>(&bitrate), sizeof(bitrate));
+    EthernetStatusFields::read(is, *this);
 
     /* the following variables are only available in Version 2 and above */
     if (objectSize > calculateObjectSize()) {
         apiMajor = 2;
-        is.read(reinterpret_cast<char *>(&reservedEthernetStatus1), sizeof(reservedEthernetStatus1));
-        is.read(reinterpret_cast<char *>(&reservedEthernetStatus2), sizeof(reservedEthernetStatus2));
+        EthernetStatusV2Fields::read(is, *this);
     }
 }
 
 void EthernetStatus::write(AbstractFile & os) {
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&flags), sizeof(flags));
-    os.write(reinterpret_cast<char *>(&linkStatus), sizeof(linkStatus));
-    os.write(reinterpret_cast<char *>(&ethernetPhy), sizeof(ethernetPhy));
-    os.write(reinterpret_cast<char *>(&duplex), sizeof(duplex));
-    os.write(reinterpret_cast<char *>(&mdi), sizeof(mdi));
-    os.write(reinterpret_cast<char *>(&connector), sizeof(connector));
-    os.write(reinterpret_cast<char *>(&clockMode), sizeof(clockMode));
-    os.write(reinterpret_cast<char *>(&pairs), sizeof(pairs));
-    os.write(reinterpret_cast<char *>(&hardwareChannel), sizeof(hardwareChannel));
-    os.write(reinterpret_cast<char *>(&bitrate), sizeof(bitrate));
+    EthernetStatusFields::write(os, *this);
 
     if (apiMajor < 2)
         return;
-    os.write(reinterpret_cast<char *>(&reservedEthernetStatus1), sizeof(reservedEthernetStatus1));
-    os.write(reinterpret_cast<char *>(&reservedEthernetStatus2), sizeof(reservedEthernetStatus2));
+    EthernetStatusV2Fields::write(os, *this);
 }
 
 uint32_t EthernetStatus::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        sizeof(channel) +
-        sizeof(flags) +
-        sizeof(linkStatus) +
-        sizeof(ethernetPhy) +
-        sizeof(duplex) +
-        sizeof(mdi) +
-        sizeof(connector) +
-        sizeof(clockMode) +
-        sizeof(pairs) +
-        sizeof(hardwareChannel) +
-        sizeof(bitrate);
+        EthernetStatusFields::size();
 }
 
 }
@@ -6,18 +6,24 @@
 
 #include <Vector/BLF/EventComment.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of EventComment from commentedEventType to reservedEventComment */
+using EventCommentFields = Fields<
+    VECTOR_BLF_FIELD(EventComment, commentedEventType),
+    VECTOR_BLF_FIELD(EventComment, textLength),
+    VECTOR_BLF_FIELD(EventComment, reservedEventComment)>;
+
 EventComment::EventComment() :
     ObjectHeader(ObjectType::EVENT_COMMENT) {
 }
 
 void EventComment::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&commentedEventType), sizeof(commentedEventType));
-    is.read(reinterpret_cast<char *>(&textLength), sizeof(textLength));
-    is.read(reinterpret_cast<char *>(&reservedEventComment), sizeof(reservedEventComment));
+    EventCommentFields::read(is, *this);
     text.resize(textLength);
     is.read(const_cast<char *>(text.data()), textLength);
 
@@ -30,9 +36,7 @@ void EventComment::write(AbstractFile & os) {
     textLength = static_cast<uint32_t>(text.size());
 
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&commentedEventType), sizeof(commentedEventType));
-    os.write(reinterpret_cast<char *>(&textLength), sizeof(textLength));
-    os.write(reinterpret_cast<char *>(&reservedEventComment), sizeof(reservedEventComment));
+    EventCommentFields::write(os, *this);
     os.write(const_cast<char *>(text.data()), textLength);
 
     /* skip padding */
@@ -42,9 +46,7 @@ void EventComment::write(AbstractFile & os) {
 uint32_t EventComment::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        sizeof(commentedEventType) +
-        sizeof(textLength) +
-        sizeof(reservedEventComment) +
+        EventCommentFields::size() +
         textLength;
 }
 
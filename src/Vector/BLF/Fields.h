@@ -0,0 +1,199 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <Vector/BLF/platform.h>
+
+#include <cstdint>
+#include <ios>
+#include <type_traits>
+
+#include <Vector/BLF/AbstractFile.h>
+
+namespace Vector {
+namespace BLF {
+
+/**
+ * Descriptor of a fixed-size member field
+ *
+ * Use VECTOR_BLF_FIELD to declare it.
+ *
+ * @tparam P type of member pointer
+ * @tparam member member pointer
+ */
+template <typename P, P member>
+struct Field;
+
+/** @copydoc Field */
+template <typename C, typename M, M C::*member>
+struct Field<M C::*, member> {
+    static_assert(std::is_trivially_copyable<M>::value, "Field: member is not trivially copyable");
+
+    /**
+     * Get size of field in file.
+     *
+     * @return size
+     */
+    static constexpr uint32_t size() {
+        return sizeof(M);
+    }
+
+    /**
+     * Get address of field in object.
+     *
+     * @param[in] obj object
+     * @return address
+     */
+    template <typename T>
+    static char * data(T & obj) {
+        return reinterpret_cast<char *>(&(obj.*member));
+    }
+
+    /** @copydoc data */
+    template <typename T>
+    static const char * data(const T & obj) {
+        return reinterpret_cast<const char *>(&(obj.*member));
+    }
+};
+
+/**
+ * Declare Field of a member.
+ *
+ * @param Class class containing the member
+ * @param member name of member
+ */
+#define VECTOR_BLF_FIELD(Class, member) ::Vector::BLF::Field<decltype(&Class::member), &Class::member>
+
+/**
+ * Codec of a run of fixed-size fields, in file order
+ *
+ * The size of the run is known at compile time. If the fields are also
+ * contiguous in memory, i.e. there is no padding between them, the run
+ * is read resp. written in one block. Otherwise it falls back to field
+ * by field. The check only depends on the member offsets, so the
+ * compiler usually resolves it at compile time.
+ *
+ * @tparam F fields
+ */
+template <typename... F>
+struct Fields;
+
+/** @copydoc Fields */
+template <>
+struct Fields<> {
+    /** @copydoc Fields<F, Rest...>::size */
+    static constexpr uint32_t size() {
+        return 0;
+    }
+
+    /** @copydoc Fields<F, Rest...>::contiguousFrom */
+    template <typename T>
+    static bool contiguousFrom(const T & /*obj*/, const char * /*position*/) {
+        return true;
+    }
+
+    /** @copydoc Fields<F, Rest...>::readEach */
+    template <typename T>
+    static void readEach(AbstractFile & /*is*/, T & /*obj*/) {
+    }
+
+    /** @copydoc Fields<F, Rest...>::writeEach */
+    template <typename T>
+    static void writeEach(AbstractFile & /*os*/, const T & /*obj*/) {
+    }
+};
+
+/** @copydoc Fields */
+template <typename F, typename... Rest>
+struct Fields<F, Rest...> {
+    /**
+     * Get size of fields in file.
+     *
+     * @return size
+     */
+    static constexpr uint32_t size() {
+        return F::size() + Fields<Rest...>::size();
+    }
+
+    /**
+     * Read fields.
+     *
+     * @param[in] is input stream
+     * @param[out] obj object
+     */
+    template <typename T>
+    static void read(AbstractFile & is, T & obj) {
+        if (contiguous(obj))
+            is.read(F::data(obj), size());
+        else
+            readEach(is, obj);
+    }
+
+    /**
+     * Write fields.
+     *
+     * @param[in] os output stream
+     * @param[in] obj object
+     */
+    template <typename T>
+    static void write(AbstractFile & os, const T & obj) {
+        if (contiguous(obj))
+            os.write(F::data(obj), size());
+        else
+            writeEach(os, obj);
+    }
+
+    /**
+     * Check if fields are contiguous in memory.
+     *
+     * @param[in] obj object
+     * @return true if each field directly follows the previous one
+     */
+    template <typename T>
+    static bool contiguous(const T & obj) {
+        return contiguousFrom(obj, F::data(obj));
+    }
+
+    /**
+     * Check if fields are contiguous in memory, starting at position.
+     *
+     * @param[in] obj object
+     * @param[in] position expected address of first field
+     * @return true if each field directly follows the previous one
+     */
+    template <typename T>
+    static bool contiguousFrom(const T & obj, const char * position) {
+        return
+            (F::data(obj) == position) &&
+            Fields<Rest...>::contiguousFrom(obj, position + F::size());
+    }
+
+    /**
+     * Read fields one by one.
+     *
+     * @param[in] is input stream
+     * @param[out] obj object
+     */
+    template <typename T>
+    static void readEach(AbstractFile & is, T & obj) {
+        is.read(F::data(obj), F::size());
+        Fields<Rest...>::readEach(is, obj);
+    }
+
+    /**
+     * Write fields one by one.
+     *
+     * @param[in] os output stream
+     * @param[in] obj object
+     */
+    template <typename T>
+    static void writeEach(AbstractFile & os, const T & obj) {
+        os.write(F::data(obj), F::size());
+        Fields<Rest...>::writeEach(os, obj);
+    }
+};
+
+}
+}
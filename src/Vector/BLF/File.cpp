@@ -4,17 +4,65 @@
 
 #include <Vector/BLF/File.h>
 
+#include <algorithm>
 #include <cstring>
 #include <iostream>
+#include <limits>
+#include <memory>
+#include <typeinfo>
 
 #include <Vector/BLF/Exceptions.h>
+#include <Vector/BLF/ObjectReader.h>
 
 namespace Vector {
 namespace BLF {
 
-File::File() {
+namespace {
+
+/** steps of the task, before it gives tasks of other files on the executor their turn */
+const unsigned int TaskSteps = 64;
+
+/** data inflated ahead of the next object, by the task or in synchronous mode */
+const std::streamsize ReadAhead = 0x10000;
+
+/** channel of object classes with a channel */
+template <typename T>
+auto channel(const T & obj, int) -> decltype(static_cast<uint16_t>(obj.channel)) {
+    return static_cast<uint16_t>(obj.channel);
+}
+
+/** object classes without a channel */
+template <typename T>
+uint16_t channel(const T & /*obj*/, ...) {
+    return 0;
+}
+
+/**
+ * Get channel of object.
+ *
+ * The object type can be changed by the caller, so the class of the object
+ * is checked before the cast.
+ *
+ * @param[in] ohb object
+ * @return channel, or 0 if the object is not of class T or has no channel
+ */
+template <typename T>
+uint16_t objectChannelOf(const ObjectHeaderBase * ohb) {
+    if (typeid(*ohb) != typeid(T))
+        return 0;
+    return channel(*static_cast<const T *>(ohb), 0);
+}
+
+}
+
+File::File() :
+    m_objectTypeSelected(static_cast<std::size_t>(ObjectType::ATTRIBUTE_EVENT) + 1) {
+    /* construct all object types */
+    for (std::atomic<bool> & selected : m_objectTypeSelected)
+        selected = true;
+
     /* set performance/memory values */
-    m_readWriteQueue.setBufferSize(10);
+    createReadWriteQueue();
     m_uncompressedFile.setBufferSize(m_uncompressedFile.defaultLogContainerSize());
 }
 
@@ -28,75 +76,226 @@ void File::open(const char * filename, const std::ios_base::openmode mode) {
         return;
 
     /* try to open file */
-    m_compressedFile.open(filename, mode | std::ios_base::binary);
-    if (!m_compressedFile.is_open())
+    if (memoryMapped && (mode & std::ios_base::in)) {
+        MemoryMappedFile * memoryMappedFile = new MemoryMappedFile;
+        m_compressedFile.reset(memoryMappedFile);
+        memoryMappedFile->open(filename);
+    } else {
+        CompressedFile * compressedFile = new CompressedFile;
+        m_compressedFile.reset(compressedFile);
+        compressedFile->open(filename, mode | std::ios_base::binary);
+    }
+    if (!m_compressedFile->is_open())
         return;
-    m_openMode = mode;
-
-    /* read */
-    if (mode & std::ios_base::in) {
-        /* read file statistics */
-        fileStatistics.read(m_compressedFile);
-
-        /* read restore points */
-        // @todo read restore points
-
-        /* fileStatistics done */
-        currentUncompressedFileSize += fileStatistics.statisticsSize;
-
-        /* prepare threads */
-        m_uncompressedFileThreadRunning = true;
-        m_compressedFileThreadRunning = true;
+    init(mode);
+}
 
-        /* create read threads */
-        m_uncompressedFileThread = std::thread(uncompressedFileReadThread, this);
-        m_compressedFileThread = std::thread(compressedFileReadThread, this);
-    } else
+void File::open(const std::string & filename, std::ios_base::openmode mode) {
+    open(filename.c_str(), mode);
+}
 
-        /* write */
-        if (mode & std::ios_base::out) {
-            /* write file statistics */
-            fileStatistics.write(m_compressedFile);
+void File::openMemory(const char * data, std::streamsize size) {
+    /* check */
+    if (is_open())
+        return;
 
-            /* fileStatistics done */
-            currentUncompressedFileSize += fileStatistics.statisticsSize;
+    /* open memory */
+    MemoryFile * memoryFile = new MemoryFile;
+    m_compressedFile.reset(memoryFile);
+    memoryFile->open(data, size);
+    init(std::ios_base::in);
+}
 
-            /* prepare threads */
-            m_uncompressedFileThreadRunning = true;
-            m_compressedFileThreadRunning = true;
+void File::openMemory(std::vector<char> & data) {
+    /* check */
+    if (is_open())
+        return;
 
-            /* create write threads */
-            m_uncompressedFileThread = std::thread(uncompressedFileWriteThread, this);
-            m_compressedFileThread = std::thread(compressedFileWriteThread, this);
-        }
+    /* open memory */
+    MemoryFile * memoryFile = new MemoryFile;
+    m_compressedFile.reset(memoryFile);
+    memoryFile->open(data);
+    init(std::ios_base::out);
 }
 
-void File::open(const std::string & filename, std::ios_base::openmode mode) {
-    open(filename.c_str(), mode);
+void File::openStream(std::istream & stream) {
+    /* check */
+    if (is_open())
+        return;
+
+    /* open stream */
+    StreamFile * streamFile = new StreamFile;
+    m_compressedFile.reset(streamFile);
+    streamFile->open(stream);
+    init(std::ios_base::in);
 }
 
 bool File::is_open() const {
-    return m_compressedFile.is_open();
+    return m_compressedFile && m_compressedFile->is_open();
 }
 
 bool File::good() const {
-    return m_readWriteQueue.good();
+    if (m_synchronous)
+        return m_uncompressedFileThreadRunning;
+
+    return m_readWriteQueue->good();
 }
 
 bool File::eof() const {
-    return m_readWriteQueue.eof();
+    if (m_synchronous)
+        return !m_uncompressedFileThreadRunning;
+
+    return m_readWriteQueue->eof();
 }
 
 ObjectHeaderBase * File::read() {
+    /* read object inline */
+    if (m_synchronous)
+        return compressedFile2Object();
+
     /* read object */
-    ObjectHeaderBase * ohb = m_readWriteQueue.read();
+    ObjectHeaderBase * ohb = m_readWriteQueue->read();
+
+    /* continue task waiting for free space */
+    if (m_executor != nullptr)
+        resumeTask();
 
     return ohb;
 }
 
+std::size_t File::read(std::vector<ObjectHeaderBase *> & objects, std::size_t maxObjects) {
+    /* read objects inline */
+    if (m_synchronous) {
+        std::size_t count = 0;
+        ObjectHeaderBase * ohb;
+        while ((count < maxObjects) && ((ohb = compressedFile2Object()) != nullptr)) {
+            objects.push_back(ohb);
+            count++;
+        }
+        return count;
+    }
+
+    /* read objects */
+    std::size_t count = m_readWriteQueue->read(objects, maxObjects);
+
+    /* continue task waiting for free space */
+    if (m_executor != nullptr)
+        resumeTask();
+
+    return count;
+}
+
+void File::recycle(ObjectHeaderBase * ohb) {
+    /* return to pool */
+    m_objectPool.recycle(ohb);
+}
+
+File::ReadAllGuard::ReadAllGuard(File & file, std::vector<ObjectHeaderBase *> & objects) :
+    m_file(file),
+    m_objects(objects) {
+}
+
+File::ReadAllGuard::~ReadAllGuard() {
+    /* objects not visited */
+    for (ObjectHeaderBase * ohb : m_objects)
+        m_file.recycle(ohb);
+    m_objects.clear();
+
+    /* construct all object types again */
+    for (std::atomic<bool> & selected : m_file.m_objectTypeSelected)
+        selected = true;
+}
+
+void File::seek(uint64_t timeStamp) {
+    /* check */
+    if (!is_open() || !(m_openMode & std::ios_base::in))
+        return;
+
+    /* streams can only be read forward */
+    if (!m_compressedFile->seekable())
+        throw Exception("File::seek(): File is not seekable.");
+
+    /* stop reading */
+    stopReadThreads();
+    m_readWriteQueue->reset();
+    m_uncompressedFile.reset();
+    m_uncompressedFileThreadException = nullptr;
+    m_compressedFileThreadException = nullptr;
+
+    /* continue at first LogContainer in fileIndex with objects not before timeStamp */
+    if (!fileIndex.logContainers.empty()) {
+        std::vector<FileIndexEntry>::const_iterator fileIndexEntry = std::find_if(
+                    fileIndex.logContainers.cbegin(),
+                    fileIndex.logContainers.cend(),
+        [timeStamp](const FileIndexEntry & fileIndexEntry) {
+            return
+                (fileIndexEntry.uncompressedFileOffset < fileIndexEntry.uncompressedFileSize) &&
+                (fileIndexEntry.maxTimeStamp >= timeStamp);
+        });
+        m_compressedFile->clear();
+        if (fileIndexEntry != fileIndex.logContainers.cend())
+            m_compressedFile->seekg(static_cast<std::streamoff>(fileIndexEntry->compressedFilePosition), std::ios_base::beg);
+        else
+            m_compressedFile->seekg(static_cast<std::streamoff>(fileStatistics.fileSize), std::ios_base::beg);
+
+        /* restart reading, the objects continued from the previous LogContainer are dropped */
+        m_seekTimeStamp = timeStamp;
+        startReadThreads();
+        return;
+    }
+
+    /* find last restore point before timeStamp */
+    std::vector<RestorePoint>::const_iterator restorePoint = std::lower_bound(
+                restorePoints.restorePoints.cbegin(),
+                restorePoints.restorePoints.cend(),
+                timeStamp,
+    [](const RestorePoint & restorePoint, uint64_t timeStamp) {
+        return restorePoint.timeStamp < timeStamp;
+    });
+
+    /* continue at restore point, or at the beginning of the file */
+    m_compressedFile->clear();
+    if (restorePoint != restorePoints.restorePoints.cbegin()) {
+        --restorePoint;
+        m_compressedFile->seekg(static_cast<std::streamoff>(restorePoint->compressedFilePosition), std::ios_base::beg);
+        m_uncompressedFile.seekg(restorePoint->uncompressedFileOffset);
+    } else
+        m_compressedFile->seekg(fileStatistics.statisticsSize, std::ios_base::beg);
+
+    /* restart reading */
+    m_seekTimeStamp = timeStamp;
+    startReadThreads();
+}
+
 void File::write(ObjectHeaderBase * ohb) {
+    /* write object inline */
+    if (m_synchronous) {
+        object2CompressedFile(ohb);
+        return;
+    }
+
     /* push to queue */
-    m_readWriteQueue.write(ohb);
+    m_readWriteQueue->write(ohb);
+
+    /* continue task waiting for data */
+    if (m_executor != nullptr)
+        resumeTask();
+}
+
+void File::write(const std::vector<ObjectHeaderBase *> & objects) {
+    /* write objects inline */
+    if (m_synchronous) {
+        for (ObjectHeaderBase * ohb : objects)
+            object2CompressedFile(ohb);
+        return;
+    }
+
+    /* push to queue */
+    m_readWriteQueue->write(objects);
+
+    /* continue task waiting for data */
+    if (m_executor != nullptr)
+        resumeTask();
 }
 
 void File::close() {
@@ -106,30 +305,31 @@ void File::close() {
 
     /* read */
     if (m_openMode & std::ios_base::in) {
-        /* finalize compressedFileThread */
-        m_compressedFileThreadRunning = false;
-        m_compressedFile.close();
-
-        /* finalize uncompressedFileThread */
-        m_uncompressedFileThreadRunning = false;
-        m_uncompressedFile.abort();
+        /* finalize read threads */
+        stopReadThreads();
 
-        /* abort readWriteQueue */
-        m_readWriteQueue.abort();
-
-        /* finalize compressedFileThread */
-        if (m_compressedFileThread.joinable())
-            m_compressedFileThread.join();
-
-        /* finalize uncompressedFileThread */
-        if (m_uncompressedFileThread.joinable())
-            m_uncompressedFileThread.join();
+        /* close compressedFile, after no thread accesses it anymore */
+        m_compressedFile->close();
     }
 
     /* write */
     if (m_openMode & std::ios_base::out) {
         /* set eof */
-        m_readWriteQueue.setFileSize(m_readWriteQueue.tellp()); // set eof
+        m_readWriteQueue->setFileSize(m_readWriteQueue->tellp()); // set eof
+
+        /* write remaining data inline */
+        if (m_synchronous) {
+            uncompressedFile2CompressedFileRemaining();
+            m_uncompressedFile.setBufferSize(m_uncompressedFile.defaultLogContainerSize());
+        }
+
+        /* finalize task */
+        if (m_executor != nullptr) {
+            m_readWriteQueueClosed = true;
+            resumeTask();
+            waitTask();
+            m_uncompressedFile.setBufferSize(m_uncompressedFile.defaultLogContainerSize());
+        }
 
         /* finalize uncompressedFileThread */
         if (m_uncompressedFileThread.joinable())
@@ -159,27 +359,36 @@ void File::close() {
             m_uncompressedFile.nextLogContainer();
 
             /* set file size */
-            fileStatistics.restorePointsOffset = static_cast<uint64_t>(m_compressedFile.tellp());
-
-            /* write end of file message */
-//            auto * unknown115 = new Unknown115;
-//            m_readWriteQueue.write(unknown115);
-
-            /* process once */
-            readWriteQueue2UncompressedFile();
-            uncompressedFile2CompressedFile();
+            fileStatistics.restorePointsOffset = static_cast<uint64_t>(m_compressedFile->tellp());
+
+            /* write restore point containers, without blocking, as the uncompressedFileThread already finished */
+            m_uncompressedFile.setBufferSize(std::numeric_limits<std::streamsize>::max());
+            if (writeRestorePointData)
+                restorePoints2UncompressedFile(); // this also shifts eof
+            else
+                m_uncompressedFile.setFileSize(m_uncompressedFile.tellp()); // an empty log container
+
+            /* process till end of file */
+            do {
+                uncompressedFile2CompressedFile();
+            } while (m_uncompressedFile.good());
+            m_uncompressedFile.setBufferSize(m_uncompressedFile.defaultLogContainerSize());
         }
+        logContainerThreadPool2CompressedFile(0);
+
+        /* finalize logContainerThreadPool */
+        m_logContainerThreadPool.stop();
 
         /* set file statistics */
-        fileStatistics.fileSize = static_cast<uint64_t>(m_compressedFile.tellp());
+        fileStatistics.fileSize = static_cast<uint64_t>(m_compressedFile->tellp());
         fileStatistics.uncompressedFileSize = currentUncompressedFileSize;
         fileStatistics.objectCount = currentObjectCount;
         // @todo fileStatistics.objectsRead = ?
 
         /* write fileStatistics and close compressedFile */
-        m_compressedFile.seekp(0);
-        fileStatistics.write(m_compressedFile);
-        m_compressedFile.close();
+        m_compressedFile->seekp(0);
+        fileStatistics.write(*m_compressedFile);
+        m_compressedFile->close();
     }
 }
 
@@ -191,571 +400,621 @@ void File::setDefaultLogContainerSize(uint32_t defaultLogContainerSize) {
     m_uncompressedFile.setDefaultLogContainerSize(defaultLogContainerSize);
 }
 
-ObjectHeaderBase * File::createObject(ObjectType type) {
-    ObjectHeaderBase * obj = nullptr;
+ReadAheadUsage File::readAheadUsage() const {
+    ReadAheadUsage usage;
+    usage.readWriteQueueBytes = m_readWriteQueue->bufferedBytes();
+    usage.readWriteQueuePeakBytes = m_readWriteQueue->peakBufferedBytes();
+    usage.uncompressedFileBytes = static_cast<uint64_t>(m_uncompressedFile.bufferedBytes());
+    usage.uncompressedFilePeakBytes = static_cast<uint64_t>(m_uncompressedFile.peakBufferedBytes());
+    return usage;
+}
 
+ObjectHeaderBase * File::createObject(ObjectType type) {
     switch (type) {
-    case ObjectType::UNKNOWN:
-        break;
-
-    case ObjectType::CAN_MESSAGE:
-        obj = new CanMessage();
-        break;
-
-    case ObjectType::CAN_ERROR:
-        obj = new CanErrorFrame();
-        break;
+#define VECTOR_BLF_OBJECT_TYPE(objectType, T) \
+    case ObjectType::objectType: \
+        return new T;
+    VECTOR_BLF_OBJECT_TYPES(VECTOR_BLF_OBJECT_TYPE)
+#undef VECTOR_BLF_OBJECT_TYPE
 
-    case ObjectType::CAN_OVERLOAD:
-        obj = new CanOverloadFrame();
-        break;
-
-    case ObjectType::CAN_STATISTIC:
-        obj = new CanDriverStatistic();
-        break;
-
-    case ObjectType::APP_TRIGGER:
-        obj = new AppTrigger();
-        break;
-
-    case ObjectType::ENV_INTEGER:
-    case ObjectType::ENV_DOUBLE:
-    case ObjectType::ENV_STRING:
-    case ObjectType::ENV_DATA:
-        obj = new EnvironmentVariable();
-        break;
-
-    case ObjectType::LOG_CONTAINER:
-        obj = new LogContainer();
-        break;
-
-    case ObjectType::LIN_MESSAGE:
-        obj = new LinMessage();
-        break;
-
-    case ObjectType::LIN_CRC_ERROR:
-        obj = new LinCrcError();
-        break;
-
-    case ObjectType::LIN_DLC_INFO:
-        obj = new LinDlcInfo();
-        break;
-
-    case ObjectType::LIN_RCV_ERROR:
-        obj = new LinReceiveError();
-        break;
-
-    case ObjectType::LIN_SND_ERROR:
-        obj = new LinSendError();
-        break;
-
-    case ObjectType::LIN_SLV_TIMEOUT:
-        obj = new LinSlaveTimeout();
-        break;
-
-    case ObjectType::LIN_SCHED_MODCH:
-        obj = new LinSchedulerModeChange();
-        break;
-
-    case ObjectType::LIN_SYN_ERROR:
-        obj = new LinSyncError();
-        break;
-
-    case ObjectType::LIN_BAUDRATE:
-        obj = new LinBaudrateEvent();
-        break;
-
-    case ObjectType::LIN_SLEEP:
-        obj = new LinSleepModeEvent();
-        break;
-
-    case ObjectType::LIN_WAKEUP:
-        obj = new LinWakeupEvent();
-        break;
-
-    case ObjectType::MOST_SPY:
-        obj = new MostSpy();
-        break;
-
-    case ObjectType::MOST_CTRL:
-        obj = new MostCtrl();
-        break;
-
-    case ObjectType::MOST_LIGHTLOCK:
-        obj = new MostLightLock();
-        break;
-
-    case ObjectType::MOST_STATISTIC:
-        obj = new MostStatistic();
-        break;
-
-    case ObjectType::Reserved26:
-    case ObjectType::Reserved27:
-    case ObjectType::Reserved28:
-        break;
-
-    case ObjectType::FLEXRAY_DATA:
-        obj = new FlexRayData();
-        break;
-
-    case ObjectType::FLEXRAY_SYNC:
-        obj = new FlexRaySync();
-        break;
-
-    case ObjectType::CAN_DRIVER_ERROR:
-        obj = new CanDriverError();
-        break;
-
-    case ObjectType::MOST_PKT:
-        obj = new MostPkt();
-        break;
-
-    case ObjectType::MOST_PKT2:
-        obj = new MostPkt2();
-        break;
-
-    case ObjectType::MOST_HWMODE:
-        obj = new MostHwMode();
-        break;
-
-    case ObjectType::MOST_REG:
-        obj = new MostReg();
-        break;
-
-    case ObjectType::MOST_GENREG:
-        obj = new MostGenReg();
-        break;
-
-    case ObjectType::MOST_NETSTATE:
-        obj = new MostNetState();
-        break;
-
-    case ObjectType::MOST_DATALOST:
-        obj = new MostDataLost();
+    default:
         break;
+    }
 
-    case ObjectType::MOST_TRIGGER:
-        obj = new MostTrigger();
-        break;
+    return nullptr;
+}
 
-    case ObjectType::FLEXRAY_CYCLE:
-        obj = new FlexRayV6StartCycleEvent();
-        break;
+uint16_t File::objectChannel(const ObjectHeaderBase * ohb) {
+    /* raw objects are decoded to get their channel */
+    const RawObject * rawObject = dynamic_cast<const RawObject *>(ohb);
+    if (rawObject != nullptr) {
+        std::unique_ptr<ObjectHeaderBase> obj;
+        try {
+            obj.reset(rawObject->decode());
+        } catch (Vector::BLF::Exception &) {
+            return 0;
+        }
+        return obj ? objectChannel(obj.get()) : 0;
+    }
 
-    case ObjectType::FLEXRAY_MESSAGE:
-        obj = new FlexRayV6Message();
-        break;
+    switch (ohb->objectType) {
+#define VECTOR_BLF_OBJECT_TYPE(objectType, T) \
+    case ObjectType::objectType: \
+        return objectChannelOf<T>(ohb);
+    VECTOR_BLF_OBJECT_TYPES(VECTOR_BLF_OBJECT_TYPE)
+#undef VECTOR_BLF_OBJECT_TYPE
 
-    case ObjectType::LIN_CHECKSUM_INFO:
-        obj = new LinChecksumInfo();
+    default:
         break;
+    }
 
-    case ObjectType::LIN_SPIKE_EVENT:
-        obj = new LinSpikeEvent();
-        break;
+    return 0;
+}
 
-    case ObjectType::CAN_DRIVER_SYNC:
-        obj = new CanDriverHwSync();
-        break;
+void File::init(const std::ios_base::openmode mode) {
+    m_openMode = mode;
+    m_synchronous = synchronous;
+    m_executor = synchronous ? nullptr : executor;
 
-    case ObjectType::FLEXRAY_STATUS:
-        obj = new FlexRayStatusEvent();
-        break;
+    /* queue between calling thread and uncompressedFileThread */
+    createReadWriteQueue();
 
-    case ObjectType::GPS_EVENT:
-        obj = new GpsEvent();
-        break;
+    /* read */
+    if (mode & std::ios_base::in) {
+        /* objects to reuse */
+        m_objectPool.setMaxSize(objectPoolSize);
 
-    case ObjectType::FR_ERROR:
-        obj = new FlexRayVFrError();
-        break;
+        /* memory for reading ahead */
+        m_readAheadBudget = readAheadBudget;
+        applyReadAheadBudget();
 
-    case ObjectType::FR_STATUS:
-        obj = new FlexRayVFrStatus();
-        break;
+        /* read file statistics */
+        fileStatistics.read(*m_compressedFile);
 
-    case ObjectType::FR_STARTCYCLE:
-        obj = new FlexRayVFrStartCycle();
-        break;
+        /* drop file index of another file */
+        if (!fileIndex.matches(fileStatistics))
+            fileIndex.logContainers.clear();
 
-    case ObjectType::FR_RCVMESSAGE:
-        obj = new FlexRayVFrReceiveMsg();
-        break;
+        /* read restore points */
+        compressedFile2RestorePoints();
 
-    case ObjectType::REALTIMECLOCK:
-        obj = new RealtimeClock();
-        break;
+        /* fileStatistics done */
+        currentUncompressedFileSize += fileStatistics.statisticsSize;
 
-    case ObjectType::Reserved52:
-    case ObjectType::Reserved53:
-        break;
+        /* create read threads */
+        m_seekTimeStamp = 0;
+        startReadThreads();
+    } else
 
-    case ObjectType::LIN_STATISTIC:
-        obj = new LinStatisticEvent();
-        break;
+        /* write */
+        if (mode & std::ios_base::out) {
+            /* write file statistics */
+            fileStatistics.write(*m_compressedFile);
 
-    case ObjectType::J1708_MESSAGE:
-    case ObjectType::J1708_VIRTUAL_MSG:
-        obj = new J1708Message();
-        break;
+            /* fileStatistics done */
+            currentUncompressedFileSize += fileStatistics.statisticsSize;
 
-    case ObjectType::LIN_MESSAGE2:
-        obj = new LinMessage2();
-        break;
+            /* restore points are collected while writing */
+            restorePoints.restorePoints.clear();
+            m_pendingRestorePoints.clear();
+            m_logContainerFilePosition = 0;
 
-    case ObjectType::LIN_SND_ERROR2:
-        obj = new LinSendError2();
-        break;
+            /* prepare threads */
+            m_uncompressedFileThreadRunning = true;
+            m_compressedFileThreadRunning = true;
 
-    case ObjectType::LIN_SYN_ERROR2:
-        obj = new LinSyncError2();
-        break;
+            /* write inline in write, that doesn't block on uncompressedFile */
+            if (m_synchronous) {
+                m_uncompressedFile.setBufferSize(std::numeric_limits<std::streamsize>::max());
+                return;
+            }
 
-    case ObjectType::LIN_CRC_ERROR2:
-        obj = new LinCrcError2();
-        break;
+            /* run as task on executor, that doesn't block on uncompressedFile */
+            if (m_executor != nullptr) {
+                m_uncompressedFile.setBufferSize(std::numeric_limits<std::streamsize>::max());
+                startTask();
+                return;
+            }
 
-    case ObjectType::LIN_RCV_ERROR2:
-        obj = new LinReceiveError2();
-        break;
+            if (compressionThreads > 0) {
+                m_logContainerThreadPool.start(compressionThreads, [this](LogContainer & logContainer) {
+                    compressLogContainer(logContainer);
+                });
+            }
 
-    case ObjectType::LIN_WAKEUP2:
-        obj = new LinWakeupEvent2();
-        break;
+            /* create write threads */
+            m_uncompressedFileThread = std::thread(uncompressedFileWriteThread, this);
+            m_compressedFileThread = std::thread(compressedFileWriteThread, this);
+        }
+}
 
-    case ObjectType::LIN_SPIKE_EVENT2:
-        obj = new LinSpikeEvent2();
-        break;
+void File::createReadWriteQueue() {
+    if (lockFreeQueue)
+        m_readWriteQueue.reset(new RingObjectQueue<ObjectHeaderBase>);
+    else
+        m_readWriteQueue.reset(new ObjectQueue<ObjectHeaderBase>);
 
-    case ObjectType::LIN_LONG_DOM_SIG:
-        obj = new LinLongDomSignalEvent();
-        break;
+    /* set performance/memory values */
+    m_readWriteQueue->setBufferSize(readWriteQueueSize);
+}
 
-    case ObjectType::APP_TEXT:
-        obj = new AppText();
-        break;
+void File::applyReadAheadBudget() {
+    m_uncompressedFile.setBufferSize(uncompressedFileBufferSize());
+    if (m_readAheadBudget == 0)
+        return;
 
-    case ObjectType::FR_RCVMESSAGE_EX:
-        obj = new FlexRayVFrReceiveMsgEx();
-        break;
+    /* limit objects by size, the number of objects is only limited to what fits for objects of 16 bytes (ObjectHeaderBase) */
+    uint64_t readWriteQueueBytes = m_readAheadBudget / 4;
+    m_readWriteQueue->setMaxBufferedBytes(readWriteQueueBytes);
+    m_readWriteQueue->setBufferSize(static_cast<uint32_t>(std::min<uint64_t>(readWriteQueueBytes / 16 + 1, std::numeric_limits<uint32_t>::max())));
+}
 
-    case ObjectType::MOST_STATISTICEX:
-        obj = new MostStatisticEx();
-        break;
+std::streamsize File::uncompressedFileBufferSize() const {
+    if (m_readAheadBudget == 0)
+        return m_uncompressedFile.defaultLogContainerSize();
 
-    case ObjectType::MOST_TXLIGHT:
-        obj = new MostTxLight();
-        break;
+    return static_cast<std::streamsize>(m_readAheadBudget - m_readAheadBudget / 4);
+}
 
-    case ObjectType::MOST_ALLOCTAB:
-        obj = new MostAllocTab();
-        break;
+void File::startReadThreads() {
+    /* nothing selected yet */
+    m_logContainerRanges.clear();
+    m_previousLogContainerSelected = false;
 
-    case ObjectType::MOST_STRESS:
-        obj = new MostStress();
-        break;
+    /* prepare threads */
+    m_uncompressedFileThreadRunning = true;
+    m_compressedFileThreadRunning = true;
 
-    case ObjectType::ETHERNET_FRAME:
-        obj = new EthernetFrame();
-        break;
+    /* read inline in read, that inflates only as far as needed, see compressedFile2UncompressedFileAhead */
+    if (m_synchronous) {
+        m_uncompressedFile.setBufferSize(std::numeric_limits<std::streamsize>::max());
+        return;
+    }
 
-    case ObjectType::SYS_VARIABLE:
-        obj = new SystemVariable();
-        break;
+    /* run as task on executor, that inflates only as far as needed, see compressedFile2UncompressedFileAhead */
+    if (m_executor != nullptr) {
+        m_uncompressedFile.setBufferSize(std::numeric_limits<std::streamsize>::max());
+        startTask();
+        return;
+    }
 
-    case ObjectType::CAN_ERROR_EXT:
-        obj = new CanErrorFrameExt();
-        break;
+    if (compressionThreads > 0) {
+        m_logContainerThreadPool.start(compressionThreads, [](LogContainer & logContainer) {
+            logContainer.uncompress();
+        });
+    }
 
-    case ObjectType::CAN_DRIVER_ERROR_EXT:
-        obj = new CanDriverErrorExt();
-        break;
+    /* create read threads */
+    m_uncompressedFileThread = std::thread(uncompressedFileReadThread, this);
+    m_compressedFileThread = std::thread(compressedFileReadThread, this);
+}
 
-    case ObjectType::LIN_LONG_DOM_SIG2:
-        obj = new LinLongDomSignalEvent2();
-        break;
+void File::stopReadThreads() {
+    /* finalize compressedFileThread */
+    m_compressedFileThreadRunning = false;
 
-    case ObjectType::MOST_150_MESSAGE:
-        obj = new Most150Message();
-        break;
+    /* finalize uncompressedFileThread */
+    m_uncompressedFileThreadRunning = false;
+    m_uncompressedFile.abort();
 
-    case ObjectType::MOST_150_PKT:
-        obj = new Most150Pkt();
-        break;
+    /* abort readWriteQueue */
+    m_readWriteQueue->abort();
 
-    case ObjectType::MOST_ETHERNET_PKT:
-        obj = new MostEthernetPkt();
-        break;
-
-    case ObjectType::MOST_150_MESSAGE_FRAGMENT:
-        obj = new Most150MessageFragment();
-        break;
+    /* finalize task */
+    if (m_executor != nullptr)
+        waitTask();
+    if (m_synchronous || (m_executor != nullptr))
+        m_uncompressedFile.setBufferSize(uncompressedFileBufferSize());
 
-    case ObjectType::MOST_150_PKT_FRAGMENT:
-        obj = new Most150PktFragment();
-        break;
+    /* finalize compressedFileThread */
+    if (m_compressedFileThread.joinable())
+        m_compressedFileThread.join();
 
-    case ObjectType::MOST_ETHERNET_PKT_FRAGMENT:
-        obj = new MostEthernetPktFragment();
-        break;
+    /* finalize uncompressedFileThread */
+    if (m_uncompressedFileThread.joinable())
+        m_uncompressedFileThread.join();
 
-    case ObjectType::MOST_SYSTEM_EVENT:
-        obj = new MostSystemEvent();
-        break;
+    /* finalize logContainerThreadPool */
+    m_logContainerThreadPool.stop();
+}
 
-    case ObjectType::MOST_150_ALLOCTAB:
-        obj = new Most150AllocTab();
-        break;
+ObjectHeaderBase * File::compressedFile2Object() {
+    while (m_uncompressedFileThreadRunning) {
+        /* inflate, until the next object is completely in uncompressedFile */
+        if (compressedFile2UncompressedFileAhead())
+            continue;
+
+        /* decode next object */
+        ObjectHeaderBase * obj = nullptr;
+        try {
+            obj = uncompressedFile2Object();
+        } catch (Vector::BLF::Exception &) {
+            m_uncompressedFileThreadRunning = false;
+        }
 
-    case ObjectType::MOST_50_MESSAGE:
-        obj = new Most50Message();
-        break;
+        /* check for eof */
+        if (!m_uncompressedFile.good())
+            m_uncompressedFileThreadRunning = false;
 
-    case ObjectType::MOST_50_PKT:
-        obj = new Most50Pkt();
-        break;
+        /* continue after objects not selected */
+        if (obj != nullptr)
+            return obj;
+    }
 
-    case ObjectType::CAN_MESSAGE2:
-        obj = new CanMessage2();
-        break;
+    return nullptr;
+}
 
-    case ObjectType::LIN_UNEXPECTED_WAKEUP:
-        obj = new LinUnexpectedWakeup();
-        break;
+void File::object2CompressedFile(ObjectHeaderBase * ohb) {
+    /* encode object */
+    object2UncompressedFile(ohb);
 
-    case ObjectType::LIN_SHORT_OR_SLOW_RESPONSE:
-        obj = new LinShortOrSlowResponse();
-        break;
+    /* deflate full LogContainers */
+    while (m_uncompressedFile.tellp() - m_uncompressedFile.tellg() >= defaultLogContainerSize())
+        uncompressedFile2CompressedFile();
+}
 
-    case ObjectType::LIN_DISTURBANCE_EVENT:
-        obj = new LinDisturbanceEvent();
-        break;
+void File::startTask() {
+    {
+        /* mutex lock */
+        std::lock_guard<std::mutex> lock(m_taskMutex);
 
-    case ObjectType::SERIAL_EVENT:
-        obj = new SerialEvent();
-        break;
+        m_taskScheduled = true;
+        m_taskParked = false;
+    }
+    m_readWriteQueueClosed = false;
 
-    case ObjectType::OVERRUN_ERROR:
-        obj = new DriverOverrun();
-        break;
+    /* submit */
+    m_executor->execute([this]() {
+        runTask();
+    });
+}
 
-    case ObjectType::EVENT_COMMENT:
-        obj = new EventComment();
-        break;
+void File::resumeTask() {
+    {
+        /* mutex lock */
+        std::lock_guard<std::mutex> lock(m_taskMutex);
 
-    case ObjectType::WLAN_FRAME:
-        obj = new WlanFrame();
-        break;
+        if (!m_taskParked)
+            return;
+        m_taskParked = false;
+        m_taskScheduled = true;
+    }
 
-    case ObjectType::WLAN_STATISTIC:
-        obj = new WlanStatistic();
-        break;
+    /* resubmit */
+    m_executor->execute([this]() {
+        runTask();
+    });
+}
 
-    case ObjectType::MOST_ECL:
-        obj = new MostEcl();
-        break;
+void File::waitTask() {
+    /* mutex lock */
+    std::unique_lock<std::mutex> lock(m_taskMutex);
 
-    case ObjectType::GLOBAL_MARKER:
-        obj = new GlobalMarker();
-        break;
+    /* wait until task is parked or finished */
+    m_taskDone.wait(lock, [&] {
+        return !m_taskScheduled;
+    });
 
-    case ObjectType::AFDX_FRAME:
-        obj = new AfdxFrame();
-        break;
+    /* don't resume it anymore */
+    m_taskParked = false;
+}
 
-    case ObjectType::AFDX_STATISTIC:
-        obj = new AfdxStatistic();
-        break;
+void File::runTask() {
+    /* run some steps */
+    TaskState state = TaskState::Continue;
+    try {
+        for (unsigned int step = 0; (step < TaskSteps) && (state == TaskState::Continue); ++step)
+            state = (m_openMode & std::ios_base::in) ? readTaskStep() : writeTaskStep();
+    } catch (...) {
+        m_uncompressedFileThreadException = std::current_exception();
 
-    case ObjectType::KLINE_STATUSEVENT:
-        obj = new KLineStatusEvent();
-        break;
+        /* set end of file, so that read returns */
+        if (m_openMode & std::ios_base::in)
+            m_readWriteQueue->setFileSize(m_readWriteQueue->tellp());
+        state = TaskState::Finish;
+    }
 
-    case ObjectType::CAN_FD_MESSAGE:
-        obj = new CanFdMessage();
-        break;
+    {
+        /* mutex lock */
+        std::lock_guard<std::mutex> lock(m_taskMutex);
 
-    case ObjectType::CAN_FD_MESSAGE_64:
-        obj = new CanFdMessage64();
-        break;
+        /* wait for read/write, unless it happened meanwhile */
+        if ((state == TaskState::Park) && !taskCanContinue())
+            m_taskParked = true;
 
-    case ObjectType::ETHERNET_RX_ERROR:
-        obj = new EthernetRxError();
-        break;
+        /* return to executor */
+        if ((state == TaskState::Finish) || m_taskParked) {
+            m_taskScheduled = false;
+            m_taskDone.notify_all();
+            return;
+        }
+    }
 
-    case ObjectType::ETHERNET_STATUS:
-        obj = new EthernetStatus();
-        break;
+    /* resubmit, to give tasks of other files their turn */
+    m_executor->execute([this]() {
+        runTask();
+    });
+}
 
-    case ObjectType::CAN_FD_ERROR_64:
-        obj = new CanFdErrorFrame64();
-        break;
+bool File::taskCanContinue() const {
+    /* read: stopped, or free space in readWriteQueue */
+    if (m_openMode & std::ios_base::in)
+        return
+            !m_uncompressedFileThreadRunning ||
+            !m_readWriteQueue->full();
+
+    /* write: eof, or data in readWriteQueue */
+    return
+        m_readWriteQueueClosed ||
+        (m_readWriteQueue->tellp() != m_readWriteQueue->tellg());
+}
 
-    case ObjectType::LIN_SHORT_OR_SLOW_RESPONSE2:
-        obj = new LinShortOrSlowResponse2;
-        break;
+File::TaskState File::readTaskStep() {
+    /* check if stopped */
+    if (!m_uncompressedFileThreadRunning)
+        return TaskState::Finish;
 
-    case ObjectType::AFDX_STATUS:
-        obj = new AfdxStatus;
-        break;
+    /* wait for read, if readWriteQueue is full */
+    if (m_readWriteQueue->full())
+        return TaskState::Park;
 
-    case ObjectType::AFDX_BUS_STATISTIC:
-        obj = new AfdxBusStatistic;
-        break;
+    /* inflate, until the next object is completely in uncompressedFile, so that decoding doesn't block */
+    if (compressedFile2UncompressedFileAhead())
+        return TaskState::Continue;
 
-    case ObjectType::Reserved108:
-        break;
+    /* decode next object */
+    try {
+        uncompressedFile2ReadWriteQueue();
+    } catch (Vector::BLF::Exception &) {
+        m_uncompressedFileThreadRunning = false;
+    }
 
-    case ObjectType::AFDX_ERROR_EVENT:
-        obj = new AfdxErrorEvent;
-        break;
+    /* check for eof */
+    if (!m_uncompressedFile.good())
+        m_uncompressedFileThreadRunning = false;
+    if (m_uncompressedFileThreadRunning)
+        return TaskState::Continue;
 
-    case ObjectType::A429_ERROR:
-        obj = new A429Error;
-        break;
+    /* set end of file */
+    m_readWriteQueue->setFileSize(m_readWriteQueue->tellp());
+    return TaskState::Finish;
+}
 
-    case ObjectType::A429_STATUS:
-        obj = new A429Status;
-        break;
+File::TaskState File::writeTaskStep() {
+    /* deflate full LogContainers */
+    if (m_uncompressedFile.tellp() - m_uncompressedFile.tellg() >= defaultLogContainerSize()) {
+        uncompressedFile2CompressedFile();
+        return TaskState::Continue;
+    }
 
-    case ObjectType::A429_BUS_STATISTIC:
-        obj = new A429BusStatistic;
-        break;
+    /* encode objects, check eof before, as objects are written before it's set */
+    bool closed = m_readWriteQueueClosed;
+    if (m_readWriteQueue->tellp() != m_readWriteQueue->tellg()) {
+        readWriteQueue2UncompressedFile();
+        return TaskState::Continue;
+    }
 
-    case ObjectType::A429_MESSAGE:
-        obj = new A429Message;
-        break;
+    /* wait for write */
+    if (!closed)
+        return TaskState::Park;
 
-    case ObjectType::ETHERNET_STATISTIC:
-        obj = new EthernetStatistic;
-        break;
+    /* deflate the remaining data */
+    uncompressedFile2CompressedFileRemaining();
+    return TaskState::Finish;
+}
 
-    case ObjectType::Unknown115:
-        obj = new RestorePointContainer;
-        break;
+bool File::objectTypeSelected(const ObjectHeaderBase & ohb) const {
+    /* object types handled by readAll */
+    std::size_t type = static_cast<std::size_t>(ohb.objectType);
+    if ((type < m_objectTypeSelected.size()) && !m_objectTypeSelected[type])
+        return false;
 
-    case ObjectType::Reserved116:
-    case ObjectType::Reserved117:
-        break;
+    /* object types selected by objectFilter */
+    return objectFilter.matchesObjectType(ohb.objectType);
+}
 
-    case ObjectType::TEST_STRUCTURE:
-        obj = new TestStructure;
-        break;
+bool File::objectTimeStampSelected(const ObjectHeaderBase & ohb, AbstractFile & is) {
+    /* time stamps selected by objectFilter, peeked from the object header */
+    if (!objectFilter.hasTimeWindow())
+        return true;
+
+    uint64_t timeStamp = 0;
+    switch (ohb.headerVersion) {
+    case 1: {
+        ObjectHeader objectHeader(ObjectType::UNKNOWN);
+        objectHeader.read(is);
+        is.seekg(-objectHeader.calculateHeaderSize(), std::ios_base::cur);
+        timeStamp = objectHeader.objectTimeStampNs();
+    }
+    break;
 
-    case ObjectType::DIAG_REQUEST_INTERPRETATION:
-        obj = new DiagRequestInterpretation;
-        break;
+    case 2: {
+        ObjectHeader2 objectHeader(ObjectType::UNKNOWN);
+        objectHeader.read(is);
+        is.seekg(-objectHeader.calculateHeaderSize(), std::ios_base::cur);
+        timeStamp = objectHeader.objectTimeStampNs();
+    }
+    break;
 
-    case ObjectType::ETHERNET_FRAME_EX:
-        obj = new EthernetFrameEx;
-        break;
+    default:
+        return true;
+    }
 
-    case ObjectType::ETHERNET_FRAME_FORWARDED:
-        obj = new EthernetFrameForwarded;
-        break;
+    /* leave truncated objects to the object reader */
+    if (!is.good())
+        return true;
 
-    case ObjectType::ETHERNET_ERROR_EX:
-        obj = new EthernetErrorEx;
-        break;
+    return objectFilter.matchesTimeStamp(timeStamp);
+}
 
-    case ObjectType::ETHERNET_ERROR_FORWARDED:
-        obj = new EthernetErrorForwarded;
-        break;
+void File::uncompressedFile2ReadWriteQueue() {
+    /* read object */
+    ObjectHeaderBase * obj = uncompressedFile2Object();
+    if (obj == nullptr)
+        return;
 
-    case ObjectType::FUNCTION_BUS:
-        obj = new FunctionBus;
-        break;
+    /* push data into readWriteQueue */
+    m_readWriteQueue->write(obj);
+}
 
-    case ObjectType::DATA_LOST_BEGIN:
-        obj = new DataLostBegin;
-        break;
+ObjectHeaderBase * File::uncompressedFile2Object() {
+    /* peek header, stage object and padding, and drop old data, in one step */
+    ObjectHeaderBase ohb(0, ObjectType::UNKNOWN);
+    std::streamsize stagingSize = m_uncompressedFile.readObject(ohb, m_objectBuffer, lazyPayloads, [this](const ObjectHeaderBase & header) {
+        return objectTypeSelected(header);
+    });
+    if (stagingSize < 0) {
+        /* invalid headers, large objects or eof */
+        return uncompressedFile2ObjectUnstaged();
+    }
 
-    case ObjectType::DATA_LOST_END:
-        obj = new DataLostEnd;
-        break;
+    /* skip objects not selected, without constructing them */
+    if ((stagingSize == 0) || !objectTimeStampSelected(ohb, m_objectBuffer)) {
+        m_objectBuffer.clear();
+        return nullptr;
+    }
 
-    case ObjectType::WATER_MARK_EVENT:
-        obj = new WaterMarkEvent;
-        break;
+    /* create object, or reuse a recycled one */
+    ObjectHeaderBase * obj = createPooledObject(ohb.objectType);
+    if (obj == nullptr) {
+        /* in case of unknown objectType, continue behind objectSize */
+        m_objectBuffer.clear();
+        m_uncompressedFile.seekg(ohb.objectSize - stagingSize);
+        return nullptr;
+    }
 
-    case ObjectType::TRIGGER_CONDITION:
-        obj = new TriggerCondition;
-        break;
+    int32_t tmp = 0;
+    if (obj->calculateObjectSize() > ohb.objectSize) {
+        // we are about to read too much data
+        tmp = ohb.objectSize - obj->calculateObjectSize();
+    }
 
-    case ObjectType::CAN_SETTING_CHANGED:
-        obj = new CanSettingChanged;
-        break;
+    /* decode object from the staging buffer */
+    obj->read(m_objectBuffer);
+    if (m_objectBuffer.good()) {
+        /* continue behind the data used by the object */
+        tmp += static_cast<int32_t>(m_objectBuffer.tellg() - stagingSize);
+    } else {
+        /* objects using more data than their objectSize */
+        m_uncompressedFile.seekg(-stagingSize);
+        obj->read(m_uncompressedFile);
+        if (!m_uncompressedFile.good()) {
+            m_objectPool.recycle(obj);
+            throw Exception("File::uncompressedFile2ReadWriteQueue(): Read beyond end of file.");
+        }
+    }
 
-    case ObjectType::DISTRIBUTED_OBJECT_MEMBER:
-        obj = new DistributedObjectMember;
-        break;
+    /* only the payload views keep the LogContainer alive */
+    if (lazyPayloads)
+        m_objectBuffer.clear();
 
-    case ObjectType::ATTRIBUTE_EVENT:
-        obj = new AttributeEvent;
-        break;
+    if (tmp!=0) {
+        m_uncompressedFile.seekg(tmp);
     }
 
-    return obj;
+    return filterObject(obj);
 }
 
-void File::uncompressedFile2ReadWriteQueue() {
+ObjectHeaderBase * File::uncompressedFile2ObjectUnstaged() {
     /* identify type */
     ObjectHeaderBase ohb(0, ObjectType::UNKNOWN);
     ohb.read(m_uncompressedFile);
     if (!m_uncompressedFile.good()) {
         /* This is a normal eof. No objects ended abruptly. */
-        return;
+        return nullptr;
     }
     m_uncompressedFile.seekg(-ohb.calculateHeaderSize(), std::ios_base::cur);
 
-    /* create object */
-    ObjectHeaderBase * obj = createObject(ohb.objectType);
+    /* skip objects not selected, without constructing them */
+    if ((ohb.objectSize >= ohb.calculateHeaderSize()) &&
+            (!objectTypeSelected(ohb) || !objectTimeStampSelected(ohb, m_uncompressedFile))) {
+        m_uncompressedFile.seekg(ohb.objectSize + ohb.objectSize % 4, std::ios_base::cur);
+        m_uncompressedFile.dropOldData();
+        return nullptr;
+    }
+
+    /* create object, or reuse a recycled one */
+    ObjectHeaderBase * obj = createPooledObject(ohb.objectType);
     if (obj == nullptr) {
         /* in case of unknown objectType */
         m_uncompressedFile.seekg(ohb.objectSize, std::ios_base::cur);
-        return;
-    }
-
-    int32_t tmp = 0;
-    if (obj->calculateObjectSize() > ohb.objectSize) {
-        // we are about to read too much data
-        tmp = ohb.objectSize - obj->calculateObjectSize();
+        return nullptr;
     }
 
-    /* read object */
-    obj->read(m_uncompressedFile);
-    if (!m_uncompressedFile.good()) {
-        delete obj;
+    /* read object field by field */
+    if (!ObjectReader::readObject(m_uncompressedFile, *obj, ohb)) {
+        m_objectPool.recycle(obj);
         throw Exception("File::uncompressedFile2ReadWriteQueue(): Read beyond end of file.");
     }
 
-    if (tmp!=0) {
-        m_uncompressedFile.seekg(tmp);
+    /* drop old data */
+    m_uncompressedFile.dropOldData();
+
+    return filterObject(obj);
+}
+
+ObjectHeaderBase * File::createPooledObject(ObjectType type) {
+    ObjectHeaderBase * obj = nullptr;
+    if (rawObjects != RawObjectMode::All)
+        obj = m_objectPool.create(type);
+    if ((obj == nullptr) && (rawObjects != RawObjectMode::None))
+        obj = m_objectPool.createRawObject(type);
+    return obj;
+}
+
+ObjectHeaderBase * File::filterObject(ObjectHeaderBase * obj) {
+    /* skip objects of channels not selected */
+    if (!objectFilter.channels.empty() && !objectFilter.matchesChannel(objectChannel(obj))) {
+        m_objectPool.recycle(obj);
+        return nullptr;
     }
 
-    /* push data into readWriteQueue */
-    m_readWriteQueue.write(obj);
+    /* skip objects before seek position */
+    if (m_seekTimeStamp > 0) {
+        if (obj->objectTimeStampNs() < m_seekTimeStamp) {
+            m_objectPool.recycle(obj);
+            return nullptr;
+        }
+        m_seekTimeStamp = 0;
+    }
 
     /* statistics */
     if (obj->objectType != ObjectType::Unknown115)
         currentObjectCount++;
 
-    /* drop old data */
-    m_uncompressedFile.dropOldData();
+    return obj;
 }
 
 void File::readWriteQueue2UncompressedFile() {
-    /* get from readWriteQueue */
-    ObjectHeaderBase * ohb = m_readWriteQueue.read();
+    /* get all available objects from readWriteQueue */
+    std::vector<ObjectHeaderBase *> objects;
+    objects.reserve(readWriteQueueSize);
+    m_readWriteQueue->read(objects, readWriteQueueSize);
 
     /* process data */
-    if (ohb == nullptr) {
-        // Read intentionally returns, when the thread is aborted.
-        return;
+    // Read intentionally returns no objects, when the thread is aborted.
+    for (ObjectHeaderBase * ohb : objects)
+        object2UncompressedFile(ohb);
+}
+
+void File::object2UncompressedFile(ObjectHeaderBase * ohb) {
+    /* remember restore point for every (objectInterval + 1)th object */
+    if (writeRestorePoints && writeRestorePointData &&
+            (ohb->objectType != ObjectType::Unknown115) &&
+            (currentObjectCount % (restorePoints.objectInterval + 1) == restorePoints.objectInterval)) {
+        RestorePoint restorePoint;
+        restorePoint.timeStamp = ohb->objectTimeStampNs();
+
+        /* mutex lock */
+        std::lock_guard<std::mutex> lock(m_pendingRestorePointsMutex);
+
+        m_pendingRestorePoints.emplace_back(m_uncompressedFile.tellp(), restorePoint);
     }
 
-    /* write into uncompressedFile */
-    ohb->write(m_uncompressedFile);
+    /* encode into the staging buffer, and write it into uncompressedFile in one block */
+    m_objectBuffer.clear();
+    ohb->write(m_objectBuffer);
+    m_objectBuffer.save(m_uncompressedFile);
 
     /* statistics */
     if (ohb->objectType != ObjectType::Unknown115)
@@ -768,17 +1027,40 @@ void File::readWriteQueue2UncompressedFile() {
 void File::compressedFile2UncompressedFile() {
     /* read header to identify type */
     ObjectHeaderBase ohb(0, ObjectType::UNKNOWN);
-    ohb.read(m_compressedFile);
-    if (!m_compressedFile.good())
+    ohb.read(*m_compressedFile);
+    if (!m_compressedFile->good())
         throw Exception("File::compressedFile2UncompressedFile(): Read beyond end of file.");
-    m_compressedFile.seekg(-ohb.calculateHeaderSize(), std::ios_base::cur);
     if (ohb.objectType != ObjectType::LOG_CONTAINER)
         throw Exception("File::compressedFile2UncompressedFile(): Object read for inflation is not a log container.");
 
-    /* read LogContainer */
-    std::shared_ptr<LogContainer> logContainer(new LogContainer);
-    logContainer->read(m_compressedFile);
-    if (!m_compressedFile.good())
+    /* select range of LogContainer according to fileIndex */
+    std::pair<uint32_t, uint32_t> range(0, std::numeric_limits<uint32_t>::max());
+    std::streampos position = m_compressedFile->tellg() - static_cast<std::streamoff>(ohb.calculateHeaderSize());
+    const FileIndexEntry * fileIndexEntry = fileIndex.find(static_cast<uint64_t>(position));
+    if (fileIndexEntry != nullptr) {
+        if ((!logContainerFilter || logContainerFilter(*fileIndexEntry)) && objectFilter.matches(*fileIndexEntry)) {
+            /* skip the object continued from a LogContainer not selected */
+            if (!m_previousLogContainerSelected)
+                range.first = fileIndexEntry->uncompressedFileOffset;
+            range.second = fileIndexEntry->uncompressedFileSize;
+        } else {
+            /* complete the object continued from the previous LogContainer */
+            range.second = m_previousLogContainerSelected ? fileIndexEntry->uncompressedFileOffset : 0;
+        }
+        m_previousLogContainerSelected = (range.first < range.second) && (range.second == fileIndexEntry->uncompressedFileSize);
+
+        /* skip LogContainer without inflating it */
+        if (range.first >= range.second) {
+            m_compressedFile->seekg(ohb.objectSize - ohb.calculateHeaderSize() + ohb.objectSize % 4, std::ios_base::cur);
+            return;
+        }
+    }
+
+    /* read LogContainer behind the header already read, so the compressedFile is only read forward */
+    std::shared_ptr<LogContainer> logContainer = m_logContainerPool.create();
+    static_cast<ObjectHeaderBase &>(*logContainer) = ohb;
+    logContainer->readBehindHeader(*m_compressedFile);
+    if (!m_compressedFile->good())
         throw Exception("File::compressedFile2UncompressedFile(): Read beyond end of file.");
 
     /* statistics */
@@ -786,8 +1068,107 @@ void File::compressedFile2UncompressedFile() {
         logContainer->internalHeaderSize() +
         logContainer->uncompressedFileSize;
 
-    /* uncompress */
-    logContainer->uncompress();
+    /* remember selected range until LogContainer is inflated */
+    m_logContainerRanges.push_back(range);
+
+    /* uncompress in this thread */
+    if (m_logContainerThreadPool.threads() == 0) {
+        logContainer->uncompress();
+
+        /* copy into uncompressedFile */
+        logContainer2UncompressedFile(logContainer);
+        return;
+    }
+
+    /* uncompress in logContainerThreadPool */
+    m_logContainerThreadPool.write(logContainer);
+
+    /* copy into uncompressedFile in file order, but keep each worker thread busy */
+    logContainerThreadPool2UncompressedFile(2 * m_logContainerThreadPool.threads());
+}
+
+bool File::compressedFile2UncompressedFileAhead() {
+    /* end of compressedFile already reached */
+    if (!m_compressedFileThreadRunning)
+        return false;
+
+    /* data required for the next object */
+    std::streamsize available = m_uncompressedFile.tellp() - m_uncompressedFile.tellg();
+    std::streamsize required = ReadAhead;
+    char header[20];
+    if (available >= static_cast<std::streamsize>(sizeof(header))) {
+        /* peek object size, behind up to 3 bytes padding of the previous object */
+        m_uncompressedFile.read(header, sizeof(header));
+        m_uncompressedFile.seekg(-static_cast<std::streamoff>(sizeof(header)), std::ios_base::cur);
+        required = std::numeric_limits<std::streamsize>::max();
+        for (std::size_t offset = 0; offset < 4; ++offset) {
+            uint32_t signature;
+            std::memcpy(&signature, &header[offset], sizeof(signature));
+            if (signature == ObjectSignature) {
+                uint32_t objectSize;
+                std::memcpy(&objectSize, &header[offset + 8], sizeof(objectSize));
+                required = offset + objectSize + ReadAhead;
+                break;
+            }
+        }
+    }
+    if (available < required) {
+        /* process */
+        try {
+            compressedFile2UncompressedFile();
+        } catch (Vector::BLF::Exception &) {
+            m_compressedFileThreadRunning = false;
+        }
+
+        /* check for eof */
+        if (!m_compressedFile->good())
+            m_compressedFileThreadRunning = false;
+
+        /* set end of file */
+        if (!m_compressedFileThreadRunning)
+            m_uncompressedFile.setFileSize(m_uncompressedFile.tellp());
+        return true;
+    }
+
+    return false;
+}
+
+void File::logContainerThreadPool2UncompressedFile(std::size_t maxSize) {
+    while (m_logContainerThreadPool.size() > maxSize) {
+        /* get next LogContainer in file order */
+        std::shared_ptr<LogContainer> logContainer;
+        try {
+            logContainer = m_logContainerThreadPool.read();
+        } catch (...) {
+            /* drop all LogContainers behind the failed one */
+            m_logContainerThreadPool.stop();
+            throw;
+        }
+        if (!logContainer)
+            break;
+
+        /* copy into uncompressedFile */
+        logContainer2UncompressedFile(logContainer);
+    }
+}
+
+void File::logContainer2UncompressedFile(const std::shared_ptr<LogContainer> & logContainer) {
+    /* reduce to selected range */
+    std::pair<uint32_t, uint32_t> range = m_logContainerRanges.front();
+    m_logContainerRanges.pop_front();
+    if (range.second < logContainer->uncompressedFileSize) {
+        logContainer->uncompressedFile.resize(range.second);
+        logContainer->uncompressedFileSize = range.second;
+    }
+    if (range.first > 0) {
+        logContainer->uncompressedFile.erase(
+            logContainer->uncompressedFile.begin(),
+            logContainer->uncompressedFile.begin() + range.first);
+        logContainer->uncompressedFileSize -= range.first;
+    }
+
+    /* compressed data is no longer needed */
+    m_logContainerPool.releaseCompressedFile(*logContainer);
 
     /* copy into uncompressedFile */
     m_uncompressedFile.write(logContainer);
@@ -795,35 +1176,185 @@ void File::compressedFile2UncompressedFile() {
 
 void File::uncompressedFile2CompressedFile() {
     /* setup new log container */
-    LogContainer logContainer;
+    std::shared_ptr<LogContainer> logContainer = m_logContainerPool.create();
 
     /* copy data into LogContainer */
-    logContainer.uncompressedFile.resize(m_uncompressedFile.defaultLogContainerSize());
+    logContainer->uncompressedFile.resize(m_uncompressedFile.defaultLogContainerSize());
     m_uncompressedFile.read(
-        reinterpret_cast<char *>(logContainer.uncompressedFile.data()),
+        reinterpret_cast<char *>(logContainer->uncompressedFile.data()),
         m_uncompressedFile.defaultLogContainerSize());
-    logContainer.uncompressedFileSize = static_cast<uint32_t>(m_uncompressedFile.gcount());
-    logContainer.uncompressedFile.resize(logContainer.uncompressedFileSize);
+    logContainer->uncompressedFileSize = static_cast<uint32_t>(m_uncompressedFile.gcount());
+    logContainer->uncompressedFile.resize(logContainer->uncompressedFileSize);
 
-    /* compress */
-    if (compressionLevel == 0) {
-        /* no compression */
-        logContainer.compress(0, 0);
-    } else {
-        /* zlib compression */
-        logContainer.compress(2, compressionLevel);
+    /* drop old data */
+    m_uncompressedFile.dropOldData();
+
+    /* compress in this thread */
+    if (m_logContainerThreadPool.threads() == 0) {
+        compressLogContainer(*logContainer);
+
+        /* write log container */
+        logContainer2CompressedFile(*logContainer);
+        return;
+    }
+
+    /* compress in logContainerThreadPool */
+    m_logContainerThreadPool.write(logContainer);
+
+    /* write into compressedFile in file order, but keep each worker thread busy */
+    logContainerThreadPool2CompressedFile(2 * m_logContainerThreadPool.threads());
+}
+
+void File::uncompressedFile2CompressedFileRemaining() {
+    /* set end of file */
+    m_uncompressedFile.setFileSize(m_uncompressedFile.tellp());
+
+    /* process till end of file */
+    do {
+        uncompressedFile2CompressedFile();
+    } while (m_uncompressedFile.good());
+}
+
+void File::logContainerThreadPool2CompressedFile(std::size_t maxSize) {
+    while (m_logContainerThreadPool.size() > maxSize) {
+        /* get next LogContainer in file order */
+        std::shared_ptr<LogContainer> logContainer;
+        try {
+            logContainer = m_logContainerThreadPool.read();
+        } catch (...) {
+            /* drop all LogContainers behind the failed one */
+            m_logContainerThreadPool.stop();
+            throw;
+        }
+        if (!logContainer)
+            break;
+
+        /* write log container */
+        logContainer2CompressedFile(*logContainer);
+    }
+}
+
+void File::logContainer2CompressedFile(LogContainer & logContainer) {
+    /* assign pending restore points, which are located in this log container */
+    {
+        /* mutex lock */
+        std::lock_guard<std::mutex> lock(m_pendingRestorePointsMutex);
+
+        std::streampos nextLogContainerFilePosition = m_logContainerFilePosition + static_cast<std::streamoff>(logContainer.uncompressedFileSize);
+        while (!m_pendingRestorePoints.empty() && (m_pendingRestorePoints.front().first < nextLogContainerFilePosition)) {
+            RestorePoint & restorePoint = m_pendingRestorePoints.front().second;
+            restorePoint.compressedFilePosition = static_cast<uint64_t>(m_compressedFile->tellp());
+            restorePoint.uncompressedFileOffset = static_cast<uint32_t>(m_pendingRestorePoints.front().first - m_logContainerFilePosition);
+            restorePoints.restorePoints.push_back(restorePoint);
+            m_pendingRestorePoints.pop_front();
+        }
+        m_logContainerFilePosition = nextLogContainerFilePosition;
     }
 
     /* write log container */
-    logContainer.write(m_compressedFile);
+    logContainer.write(*m_compressedFile);
 
     /* statistics */
     currentUncompressedFileSize +=
         logContainer.internalHeaderSize() +
         logContainer.uncompressedFileSize;
+}
 
-    /* drop old data */
-    m_uncompressedFile.dropOldData();
+void File::compressedFile2RestorePoints() {
+    /* check */
+    restorePoints.restorePoints.clear();
+    if ((fileStatistics.restorePointsOffset == 0) || !m_compressedFile->seekable())
+        return;
+
+    /* remember position after fileStatistics */
+    std::streampos position = m_compressedFile->tellg();
+
+    try {
+        /* read and uncompress LogContainers behind restorePointsOffset */
+        UncompressedFile uncompressedFile;
+        m_compressedFile->seekg(static_cast<std::streamoff>(fileStatistics.restorePointsOffset), std::ios_base::beg);
+        while (static_cast<uint64_t>(m_compressedFile->tellg()) < fileStatistics.fileSize) {
+            /* read header to identify type */
+            ObjectHeaderBase ohb(0, ObjectType::UNKNOWN);
+            ohb.read(*m_compressedFile);
+            if (!m_compressedFile->good() || (ohb.objectType != ObjectType::LOG_CONTAINER))
+                break;
+
+            /* read LogContainer */
+            std::shared_ptr<LogContainer> logContainer = m_logContainerPool.create();
+            static_cast<ObjectHeaderBase &>(*logContainer) = ohb;
+            logContainer->readBehindHeader(*m_compressedFile);
+            if (!m_compressedFile->good())
+                break;
+            logContainer->uncompress();
+            m_logContainerPool.releaseCompressedFile(*logContainer);
+            uncompressedFile.write(logContainer);
+        }
+        uncompressedFile.setFileSize(uncompressedFile.tellp());
+
+        /* concatenate data of RestorePointContainers */
+        UncompressedFile restorePointData;
+        while (uncompressedFile.tellg() < uncompressedFile.fileSize()) {
+            /* read header to identify type */
+            ObjectHeaderBase ohb(0, ObjectType::UNKNOWN);
+            ohb.read(uncompressedFile);
+            if (!uncompressedFile.good())
+                break;
+            uncompressedFile.seekg(-ohb.calculateHeaderSize(), std::ios_base::cur);
+
+            /* skip other objects */
+            if (ohb.objectType != ObjectType::Unknown115) {
+                uncompressedFile.seekg(ohb.objectSize, std::ios_base::cur);
+                continue;
+            }
+
+            /* read RestorePointContainer */
+            RestorePointContainer restorePointContainer;
+            restorePointContainer.read(uncompressedFile);
+            if (!uncompressedFile.good())
+                break;
+            if (restorePointContainer.objectVersion == 0)
+                restorePointData.write(reinterpret_cast<char *>(restorePointContainer.data.data()), restorePointContainer.dataLength);
+        }
+        restorePointData.setFileSize(restorePointData.tellp());
+
+        /* read restore points */
+        restorePoints.read(restorePointData);
+    } catch (Vector::BLF::Exception &) {
+        /* file without (valid) restore points */
+    }
+
+    /* continue after fileStatistics */
+    m_compressedFile->clear();
+    m_compressedFile->seekg(position, std::ios_base::beg);
+}
+
+void File::restorePoints2UncompressedFile() {
+    /* serialize restore points */
+    UncompressedFile restorePointData;
+    restorePoints.write(restorePointData);
+    restorePointData.setFileSize(restorePointData.tellp());
+
+    /* split into RestorePointContainers with default data length */
+    while (restorePointData.good()) {
+        RestorePointContainer restorePointContainer;
+        restorePointContainer.data.resize(2000);
+        restorePointData.read(reinterpret_cast<char *>(restorePointContainer.data.data()), static_cast<std::streamsize>(restorePointContainer.data.size()));
+        restorePointContainer.data.resize(static_cast<std::size_t>(restorePointData.gcount()));
+        if (restorePointContainer.data.empty())
+            break;
+        restorePointContainer.write(m_uncompressedFile);
+    }
+}
+
+void File::compressLogContainer(LogContainer & logContainer) const {
+    if (compressionLevel == 0) {
+        /* no compression */
+        logContainer.compress(0, 0);
+    } else {
+        /* zlib compression */
+        logContainer.compress(2, compressionLevel);
+    }
 }
 
 void File::uncompressedFileReadThread(File * file) {
@@ -842,7 +1373,7 @@ void File::uncompressedFileReadThread(File * file) {
         }
 
         /* set end of file */
-        file->m_readWriteQueue.setFileSize(file->m_readWriteQueue.tellp());
+        file->m_readWriteQueue->setFileSize(file->m_readWriteQueue->tellp());
     } catch (...) {
         file->m_uncompressedFileThreadException = std::current_exception();
     }
@@ -855,7 +1386,7 @@ void File::uncompressedFileWriteThread(File * file) {
             file->readWriteQueue2UncompressedFile();
 
             /* check for eof */
-            if (!file->m_readWriteQueue.good())
+            if (!file->m_readWriteQueue->good())
                 file->m_uncompressedFileThreadRunning = false;
         }
 
@@ -877,10 +1408,17 @@ void File::compressedFileReadThread(File * file) {
             }
 
             /* check for eof */
-            if (!file->m_compressedFile.good())
+            if (!file->m_compressedFile->good())
                 file->m_compressedFileThreadRunning = false;
         }
 
+        /* flush LogContainers still being inflated */
+        try {
+            file->logContainerThreadPool2UncompressedFile(0);
+        } catch (Vector::BLF::Exception &) {
+            /* stop at the first LogContainer that failed to inflate */
+        }
+
         /* set end of file */
         file->m_uncompressedFile.setFileSize(file->m_uncompressedFile.tellp());
     } catch (...) {
@@ -899,6 +1437,9 @@ void File::compressedFileWriteThread(File * file) {
                 file->m_compressedFileThreadRunning = false;
         }
 
+        /* flush LogContainers still being deflated */
+        file->logContainerThreadPool2CompressedFile(0);
+
         /* set end of file */
         // There is no CompressedFile::setFileSize that need to be set. std::fstream handles this already.
     } catch (...) {
@@ -7,154 +7,63 @@
 #include <Vector/BLF/platform.h>
 
 #include <atomic>
+#include <condition_variable>
+#include <deque>
 #include <fstream>
+#include <functional>
+#include <list>
+#include <mutex>
 #include <thread>
+#include <utility>
+#include <vector>
 
+#include <Vector/BLF/AbstractCompressedFile.h>
+#include <Vector/BLF/AbstractExecutor.h>
+#include <Vector/BLF/AbstractObjectQueue.h>
 #include <Vector/BLF/CompressedFile.h>
+#include <Vector/BLF/FileIndex.h>
 #include <Vector/BLF/FileStatistics.h>
+#include <Vector/BLF/LogContainerPool.h>
+#include <Vector/BLF/LogContainerThreadPool.h>
+#include <Vector/BLF/MemoryFile.h>
+#include <Vector/BLF/MemoryMappedFile.h>
+#include <Vector/BLF/ObjectBuffer.h>
+#include <Vector/BLF/ObjectFilter.h>
 #include <Vector/BLF/ObjectHeaderBase.h>
+#include <Vector/BLF/ObjectPool.h>
 #include <Vector/BLF/ObjectQueue.h>
+#include <Vector/BLF/ObjectTypes.h>
+#include <Vector/BLF/ObjectVisitor.h>
+#include <Vector/BLF/RawObject.h>
 #include <Vector/BLF/RestorePoints.h>
+#include <Vector/BLF/RingObjectQueue.h>
+#include <Vector/BLF/StreamFile.h>
 #include <Vector/BLF/UncompressedFile.h>
 
-// UNKNOWN = 0
-#include <Vector/BLF/CanMessage.h> // CAN_MESSAGE = 1
-#include <Vector/BLF/CanErrorFrame.h> // CAN_ERROR = 2
-#include <Vector/BLF/CanOverloadFrame.h> // CAN_OVERLOAD = 3
-#include <Vector/BLF/CanDriverStatistic.h> // CAN_STATISTIC = 4
-#include <Vector/BLF/AppTrigger.h> // APP_TRIGGER = 5
-#include <Vector/BLF/EnvironmentVariable.h> // ENV_INTEGER = 6
-#include <Vector/BLF/EnvironmentVariable.h> // ENV_DOUBLE = 7
-#include <Vector/BLF/EnvironmentVariable.h> // ENV_STRING = 8
-#include <Vector/BLF/EnvironmentVariable.h> // ENV_DATA = 9
-#include <Vector/BLF/LogContainer.h> // LOG_CONTAINER = 10
-#include <Vector/BLF/LinMessage.h> // LIN_MESSAGE = 11
-#include <Vector/BLF/LinCrcError.h> // LIN_CRC_ERROR = 12
-#include <Vector/BLF/LinDlcInfo.h> // LIN_DLC_INFO = 13
-#include <Vector/BLF/LinReceiveError.h> // LIN_RCV_ERROR =  14
-#include <Vector/BLF/LinSendError.h> // LIN_SND_ERROR = 15
-#include <Vector/BLF/LinSlaveTimeout.h> // LIN_SLV_TIMEOUT = 16
-#include <Vector/BLF/LinSchedulerModeChange.h> // LIN_SCHED_MODCH = 17
-#include <Vector/BLF/LinSyncError.h> // LIN_SYN_ERROR = 18
-#include <Vector/BLF/LinBaudrateEvent.h> // LIN_BAUDRATE = 19
-#include <Vector/BLF/LinSleepModeEvent.h> // LIN_SLEEP = 20
-#include <Vector/BLF/LinWakeupEvent.h> // LIN_WAKEUP = 21
-#include <Vector/BLF/MostSpy.h> // MOST_SPY = 22
-#include <Vector/BLF/MostCtrl.h> // MOST_CTRL = 23
-#include <Vector/BLF/MostLightLock.h> // MOST_LIGHTLOCK = 24
-#include <Vector/BLF/MostStatistic.h> // MOST_STATISTIC = 25
-// Reserved26 = 26
-// Reserved27 = 27
-// Reserved28 = 28
-#include <Vector/BLF/FlexRayData.h> // FLEXRAY_DATA = 29
-#include <Vector/BLF/FlexRaySync.h> // FLEXRAY_SYNC = 30
-#include <Vector/BLF/CanDriverError.h> // CAN_DRIVER_ERROR = 31
-#include <Vector/BLF/MostPkt.h> // MOST_PKT  = 32
-#include <Vector/BLF/MostPkt2.h> // MOST_PKT2 = 33
-#include <Vector/BLF/MostHwMode.h> // MOST_HWMODE = 34
-#include <Vector/BLF/MostReg.h> // MOST_REG = 35
-#include <Vector/BLF/MostGenReg.h> // MOST_GENREG = 36
-#include <Vector/BLF/MostNetState.h> // MOST_NETSTATE = 37
-#include <Vector/BLF/MostDataLost.h> // MOST_DATALOST = 38
-#include <Vector/BLF/MostTrigger.h> // MOST_TRIGGER = 39
-#include <Vector/BLF/FlexRayV6StartCycleEvent.h> // FLEXRAY_CYCLE = 40
-#include <Vector/BLF/FlexRayV6Message.h> // FLEXRAY_MESSAGE = 41
-#include <Vector/BLF/LinChecksumInfo.h> // LIN_CHECKSUM_INFO = 42
-#include <Vector/BLF/LinSpikeEvent.h> // LIN_SPIKE_EVENT = 43
-#include <Vector/BLF/CanDriverHwSync.h> // CAN_DRIVER_SYNC = 44
-#include <Vector/BLF/FlexRayStatusEvent.h> // FLEXRAY_STATUS = 45
-#include <Vector/BLF/GpsEvent.h> // GPS_EVENT = 46
-#include <Vector/BLF/FlexRayVFrError.h> // FR_ERROR = 47
-#include <Vector/BLF/FlexRayVFrStatus.h> // FR_STATUS = 48
-#include <Vector/BLF/FlexRayVFrStartCycle.h> // FR_STARTCYCLE = 49
-#include <Vector/BLF/FlexRayVFrReceiveMsg.h> // FR_RCVMESSAGE = 50
-#include <Vector/BLF/RealtimeClock.h> // REALTIMECLOCK = 51
-// Reserved52 = 52
-// Reserved53 = 53
-#include <Vector/BLF/LinStatisticEvent.h> // LIN_STATISTIC = 54
-#include <Vector/BLF/J1708Message.h> // J1708_MESSAGE = 55
-#include <Vector/BLF/J1708Message.h> // J1708_VIRTUAL_MSG = 56
-#include <Vector/BLF/LinMessage2.h> // LIN_MESSAGE2 = 57
-#include <Vector/BLF/LinSendError2.h> // LIN_SND_ERROR2 = 58
-#include <Vector/BLF/LinSyncError2.h> // LIN_SYN_ERROR2 = 59
-#include <Vector/BLF/LinCrcError2.h> // LIN_CRC_ERROR2 = 60
-#include <Vector/BLF/LinReceiveError2.h> // LIN_RCV_ERROR2 = 61
-#include <Vector/BLF/LinWakeupEvent2.h> // LIN_WAKEUP2 = 62
-#include <Vector/BLF/LinSpikeEvent2.h> // LIN_SPIKE_EVENT2 = 63
-#include <Vector/BLF/LinLongDomSignalEvent.h> // LIN_LONG_DOM_SIG = 64
-#include <Vector/BLF/AppText.h> // APP_TEXT = 65
-#include <Vector/BLF/FlexRayVFrReceiveMsgEx.h> // FR_RCVMESSAGE_EX = 66
-#include <Vector/BLF/MostStatisticEx.h> // MOST_STATISTICEX = 67
-#include <Vector/BLF/MostTxLight.h> // MOST_TXLIGHT = 68
-#include <Vector/BLF/MostAllocTab.h> // MOST_ALLOCTAB = 69
-#include <Vector/BLF/MostStress.h> // MOST_STRESS = 70
-#include <Vector/BLF/EthernetFrame.h> // ETHERNET_FRAME = 71
-#include <Vector/BLF/SystemVariable.h> // SYS_VARIABLE = 72
-#include <Vector/BLF/CanErrorFrameExt.h> // CAN_ERROR_EXT = 73
-#include <Vector/BLF/CanDriverErrorExt.h> // CAN_DRIVER_ERROR_EXT = 74
-#include <Vector/BLF/LinLongDomSignalEvent2.h> // LIN_LONG_DOM_SIG2 = 75
-#include <Vector/BLF/Most150Message.h> // MOST_150_MESSAGE = 76
-#include <Vector/BLF/Most150Pkt.h> // MOST_150_PKT = 77
-#include <Vector/BLF/MostEthernetPkt.h> // MOST_ETHERNET_PKT = 78
-#include <Vector/BLF/Most150MessageFragment.h> // MOST_150_MESSAGE_FRAGMENT = 79
-#include <Vector/BLF/Most150PktFragment.h> // MOST_150_PKT_FRAGMENT = 80
-#include <Vector/BLF/MostEthernetPktFragment.h> // MOST_ETHERNET_PKT_FRAGMENT = 81
-#include <Vector/BLF/MostSystemEvent.h> // MOST_SYSTEM_EVENT = 82
-#include <Vector/BLF/Most150AllocTab.h> // MOST_150_ALLOCTAB = 83
-#include <Vector/BLF/Most50Message.h> // MOST_50_MESSAGE = 84
-#include <Vector/BLF/Most50Pkt.h> // MOST_50_PKT = 85
-#include <Vector/BLF/CanMessage2.h> // CAN_MESSAGE2 = 86
-#include <Vector/BLF/LinUnexpectedWakeup.h> // LIN_UNEXPECTED_WAKEUP = 87
-#include <Vector/BLF/LinShortOrSlowResponse.h> // LIN_SHORT_OR_SLOW_RESPONSE = 88
-#include <Vector/BLF/LinDisturbanceEvent.h> // LIN_DISTURBANCE_EVENT = 89
-#include <Vector/BLF/SerialEvent.h> // SERIAL_EVENT = 90
-#include <Vector/BLF/DriverOverrun.h> // OVERRUN_ERROR = 91
-#include <Vector/BLF/EventComment.h> // EVENT_COMMENT = 92
-#include <Vector/BLF/WlanFrame.h> // WLAN_FRAME = 93
-#include <Vector/BLF/WlanStatistic.h> // WLAN_STATISTIC = 94
-#include <Vector/BLF/MostEcl.h> // MOST_ECL = 95
-#include <Vector/BLF/GlobalMarker.h> // GLOBAL_MARKER = 96
-#include <Vector/BLF/AfdxFrame.h> // AFDX_FRAME = 97
-#include <Vector/BLF/AfdxStatistic.h> // AFDX_STATISTIC = 98
-#include <Vector/BLF/KLineStatusEvent.h> // KLINE_STATUSEVENT = 99
-#include <Vector/BLF/CanFdMessage.h> // CAN_FD_MESSAGE = 100
-#include <Vector/BLF/CanFdMessage64.h> // CAN_FD_MESSAGE_64 = 101
-#include <Vector/BLF/EthernetRxError.h> // ETHERNET_RX_ERROR = 102
-#include <Vector/BLF/EthernetStatus.h> // ETHERNET_STATUS = 103
-#include <Vector/BLF/CanFdErrorFrame64.h> // CAN_FD_ERROR_64 = 104
-#include <Vector/BLF/LinShortOrSlowResponse2.h> // LIN_SHORT_OR_SLOW_RESPONSE2 = 105
-#include <Vector/BLF/AfdxStatus.h> // AFDX_STATUS = 106
-#include <Vector/BLF/AfdxBusStatistic.h> // AFDX_BUS_STATISTIC = 107
-// Reserved108 = 108
-#include <Vector/BLF/AfdxErrorEvent.h> // AFDX_ERROR_EVENT = 109
-#include <Vector/BLF/A429Error.h> // A429_ERROR = 110
-#include <Vector/BLF/A429Status.h> // A429_STATUS = 111
-#include <Vector/BLF/A429BusStatistic.h> // A429_BUS_STATISTIC = 112
-#include <Vector/BLF/A429Message.h> // A429_MESSAGE = 113
-#include <Vector/BLF/EthernetStatistic.h> // ETHERNET_STATISTIC = 114
-#include <Vector/BLF/RestorePointContainer.h> // Unknown115 = 115
-// Reserved116 = 116
-// Reserved117 = 117
-#include <Vector/BLF/TestStructure.h> // TEST_STRUCTURE = 118
-#include <Vector/BLF/DiagRequestInterpretation.h> // DIAG_REQUEST_INTERPRETATION = 119
-#include <Vector/BLF/EthernetFrameEx.h> // ETHERNET_FRAME_EX = 120
-#include <Vector/BLF/EthernetFrameForwarded.h> // ETHERNET_FRAME_FORWARDED = 121
-#include <Vector/BLF/EthernetErrorEx.h> // ETHERNET_ERROR_EX = 122
-#include <Vector/BLF/EthernetErrorForwarded.h> // ETHERNET_ERROR_FORWARDED = 123
-#include <Vector/BLF/FunctionBus.h> // FUNCTION_BUS = 124
-#include <Vector/BLF/DataLostBegin.h> // DATA_LOST_BEGIN = 125
-#include <Vector/BLF/DataLostEnd.h> // DATA_LOST_END = 126
-#include <Vector/BLF/WaterMarkEvent.h> // WATER_MARK_EVENT = 127
-#include <Vector/BLF/TriggerCondition.h> // TRIGGER_CONDITION = 128
-#include <Vector/BLF/CanSettingChanged.h> // CAN_SETTING_CHANGED = 129
-#include <Vector/BLF/DistributedObjectMember.h> // DISTRIBUTED_OBJECT_MEMBER = 130
-#include <Vector/BLF/AttributeEvent.h> // ATTRIBUTE_EVENT = 131
-
 #include <Vector/BLF/vector_blf_export.h>
 
 namespace Vector {
 namespace BLF {
 
+/**
+ * Memory held by the stages of the read pipeline
+ *
+ * @see File::readAheadUsage
+ */
+struct VECTOR_BLF_EXPORT ReadAheadUsage {
+    /** objectSize of the objects in the readWriteQueue */
+    uint64_t readWriteQueueBytes {};
+
+    /** maximum of readWriteQueueBytes */
+    uint64_t readWriteQueuePeakBytes {};
+
+    /** uncompressed LogContainers in the uncompressedFile */
+    uint64_t uncompressedFileBytes {};
+
+    /** maximum of uncompressedFileBytes */
+    uint64_t uncompressedFilePeakBytes {};
+};
+
 /**
  * File
  *
@@ -170,6 +79,73 @@ class VECTOR_BLF_EXPORT File final {
      */
     FileStatistics fileStatistics {};
 
+    /**
+     * Restore points
+     *
+     * When reading, these are read from the end of the file on open.
+     * When writing, these are collected for every (objectInterval + 1)th object,
+     * and written at file close, if writeRestorePointData is set.
+     */
+    RestorePoints restorePoints {};
+
+    /**
+     * Sidecar index of the LogContainers
+     *
+     * It can be built or loaded (see FileIndex) before the file is opened.
+     * On open, it's dropped if it doesn't match the file statistics.
+     * If available, it's used by seek instead of the restore points,
+     * and together with logContainerFilter.
+     */
+    FileIndex fileIndex {};
+
+    /**
+     * Filter to select LogContainers for reading, based on fileIndex.
+     *
+     * LogContainers, for which this returns false, are not inflated.
+     * Objects continued from a selected LogContainer are still completed.
+     * The selection is done per LogContainer, so objects not matching the
+     * filter might still be read.
+     */
+    std::function<bool(const FileIndexEntry &)> logContainerFilter {};
+
+    /**
+     * Filter to select objects for reading.
+     *
+     * Object types and time stamps are checked on the object header, so
+     * objects not selected are skipped without constructing them. Channels
+     * are checked after the object is read. With fileIndex, LogContainers
+     * without selected objects are not inflated.
+     *
+     * This needs to be set before the file is opened, or before seek.
+     */
+    ObjectFilter objectFilter {};
+
+    /**
+     * Read payloads as views instead of copying them.
+     *
+     * Objects with large payloads, like EthernetFrameEx::frameData, then
+     * get a PayloadView (e.g. EthernetFrameEx::frameDataView) of the
+     * inflated LogContainer, and their payload vector stays empty.
+     * Each view keeps its LogContainer alive, so release or copy it, when
+     * keeping objects for longer.
+     *
+     * This needs to be set before the file is opened.
+     */
+    bool lazyPayloads {false};
+
+    /**
+     * Objects to read as RawObject, without decoding them.
+     *
+     * RawObjects are written as they were read, so this allows to copy
+     * objects between files without decoding and encoding them, and to
+     * keep objects of unknown type, which are skipped otherwise.
+     * objectFilter still selects by object type and time stamp, but needs
+     * to decode raw objects to select by channel.
+     *
+     * This needs to be set before the file is opened.
+     */
+    RawObjectMode rawObjects {RawObjectMode::None};
+
     /**
      * Current uncompressed file size
      *
@@ -201,9 +177,125 @@ class VECTOR_BLF_EXPORT File final {
 
     /**
      * Write restore points at file close.
+     *
+     * This appends a LogContainer behind fileStatistics.restorePointsOffset.
+     * It's empty, unless writeRestorePointData is set.
      */
     bool writeRestorePoints {true};
 
+    /**
+     * Write restore point data into the restore points LogContainer.
+     *
+     * The restore points are written as RestorePointContainers (Unknown115).
+     * Their format is derived from files written by Vector tools, and not
+     * documented. So this is off by default. It only takes effect, if
+     * writeRestorePoints is set.
+     *
+     * This needs to be set before the file is opened.
+     */
+    bool writeRestorePointData {false};
+
+    /**
+     * Number of threads to inflate/deflate LogContainers.
+     *
+     * - 0: LogContainers are inflated/deflated by the compressedFileThread
+     * - n: LogContainers are inflated/deflated by n worker threads in parallel
+     *
+     * This needs to be set before the file is opened.
+     */
+    uint32_t compressionThreads {0};
+
+    /**
+     * Executor to run the read/write pipeline on.
+     *
+     * By default each open file runs its pipeline on two threads of its own.
+     * If an executor is set, the pipeline runs as one cooperative task on it
+     * instead, so that many open files can share a fixed number of threads.
+     * The task doesn't block. It returns to the executor, when the
+     * readWriteQueue is full (read) or empty (write), and is resubmitted by
+     * read/write. LogContainers are inflated/deflated in the task, so
+     * compressionThreads is ignored.
+     *
+     * The executor needs to outlive the open file. read/write must not be
+     * called from tasks running on the executor.
+     *
+     * This needs to be set before the file is opened.
+     */
+    AbstractExecutor * executor {nullptr};
+
+    /**
+     * Read/write in the calling thread, without a pipeline.
+     *
+     * read inflates LogContainers and decodes the next object inline,
+     * and write encodes the object and deflates full LogContainers inline.
+     * Objects are not handed over through the readWriteQueue, and no
+     * threads are started at open. This is faster for small files, and
+     * keeps the whole processing on one stack. executor and
+     * compressionThreads are ignored.
+     *
+     * This needs to be set before the file is opened.
+     */
+    bool synchronous {false};
+
+    /**
+     * Access the file via a read-only memory mapping instead of a file stream.
+     *
+     * LogContainers are then inflated directly from the mapped file,
+     * without copying the compressed data first.
+     *
+     * This is only used for reading and needs to be set before the file is opened.
+     */
+    bool memoryMapped {false};
+
+    /**
+     * Maximum number of recycled objects kept per object type.
+     *
+     * Objects returned by read can be given back with recycle instead of
+     * deleting them. read then reuses them, so reading doesn't need heap
+     * allocations anymore, once enough objects were recycled.
+     *
+     * - 0: objects are not reused
+     *
+     * This needs to be set before the file is opened.
+     */
+    uint32_t objectPoolSize {1000};
+
+    /**
+     * Use a lock-free single-producer/single-consumer ring (RingObjectQueue)
+     * instead of the mutex protected ObjectQueue, to hand over objects
+     * between the calling thread and the uncompressedFileThread.
+     *
+     * This needs to be set before the file is opened.
+     */
+    bool lockFreeQueue {false};
+
+    /**
+     * Maximum number of objects in the queue between the calling thread
+     * and the uncompressedFileThread.
+     *
+     * This is also the maximum number of objects, that the
+     * uncompressedFileThread takes out of the queue at once, when writing.
+     *
+     * This needs to be set before the file is opened.
+     */
+    uint32_t readWriteQueueSize {10};
+
+    /**
+     * Memory budget in bytes for reading ahead of the calling thread.
+     *
+     * If set, reading ahead is limited by bytes, instead of by
+     * readWriteQueueSize objects and one LogContainer of uncompressed data.
+     * A quarter of the budget limits the objectSize of the objects in the
+     * readWriteQueue, the rest limits the uncompressed data inflated ahead.
+     * So small objects are queued deeper, and large objects don't exceed
+     * the budget. readAheadUsage shows, how much each stage holds.
+     *
+     * - 0: no budget
+     *
+     * This is only used for reading and needs to be set before the file is opened.
+     */
+    uint64_t readAheadBudget {0};
+
     /**
      * open file
      *
@@ -220,6 +312,41 @@ class VECTOR_BLF_EXPORT File final {
      */
     virtual void open(const std::string & filename, const std::ios_base::openmode mode = std::ios_base::in);
 
+    /**
+     * open memory block for reading
+     *
+     * The BLF data is read directly from memory, e.g. after receiving it,
+     * without storing it in a file first. The memory is owned by the
+     * caller and needs to stay valid until the file is closed.
+     *
+     * @param[in] data BLF data
+     * @param[in] size size of data
+     */
+    virtual void openMemory(const char * data, std::streamsize size);
+
+    /**
+     * open vector for writing
+     *
+     * The BLF data is written into the vector, which grows as needed. The
+     * vector is owned by the caller and contains the complete BLF data
+     * after close.
+     *
+     * @param[out] data vector, that receives the BLF data
+     */
+    virtual void openMemory(std::vector<char> & data);
+
+    /**
+     * open input stream for reading
+     *
+     * The BLF data is read forward only, e.g. from std::cin or a pipe, so
+     * it doesn't need to be stored in a file first. Restore points are not
+     * read and seek is not possible. The stream is owned by the caller and
+     * needs to stay valid until the file is closed.
+     *
+     * @param[in] stream input stream, opened in binary mode
+     */
+    virtual void openStream(std::istream & stream);
+
     /**
      * is file open?
      *
@@ -245,7 +372,7 @@ class VECTOR_BLF_EXPORT File final {
      * Read object from file.
      *
      * Ownership is taken over from the library to the user.
-     * The user has to take care to delete the object.
+     * The user has to take care to delete or recycle the object.
      *
      * @todo Use std::unique_ptr in future versions.
      *
@@ -253,6 +380,61 @@ class VECTOR_BLF_EXPORT File final {
      */
     virtual ObjectHeaderBase * read();
 
+    /**
+     * Read many objects from file at once.
+     *
+     * This waits until at least one object is available, and then takes
+     * all available objects, up to maxObjects, under a single synchronization.
+     *
+     * Ownership is taken over from the library to the user.
+     * The user has to take care to delete or recycle the objects.
+     *
+     * @param[out] objects read objects are appended here
+     * @param[in] maxObjects maximum number of objects to read
+     * @return number of read objects, or 0 at end of file
+     */
+    virtual std::size_t read(std::vector<ObjectHeaderBase *> & objects, std::size_t maxObjects);
+
+    /**
+     * Give object back to the library, so that read can reuse it.
+     *
+     * Ownership is taken over from the user to the library.
+     * The object should not be further accessed any more.
+     *
+     * @param[in] ohb object returned by read
+     */
+    virtual void recycle(ObjectHeaderBase * ohb);
+
+    /**
+     * Read all remaining objects and pass them to the visitor.
+     *
+     * The overload of the visitor is selected at compile time, see
+     * ObjectVisitor. Objects of types, that the visitor doesn't handle,
+     * are skipped by their objectSize, without constructing them.
+     *
+     * The objects are recycled after the visitor returns, so it must
+     * not keep references to them.
+     *
+     * @param[in] visitor visitor
+     */
+    template <typename Visitor>
+    void readAll(Visitor & visitor);
+
+    /**
+     * Seek to the first object with a time stamp not before the given one.
+     *
+     * Reading continues at the first LogContainer of the fileIndex with objects
+     * not before timeStamp. Without fileIndex, it continues at the LogContainer
+     * of the last restore point before timeStamp. So the LogContainers before it
+     * are not inflated. Remaining objects before timeStamp are skipped. Without
+     * fileIndex and restore points, reading continues from the beginning of the file.
+     *
+     * This assumes that the objects are stored in chronological order.
+     *
+     * @param[in] timeStamp time stamp (in ns)
+     */
+    virtual void seek(uint64_t timeStamp);
+
     /**
      * Write object to file.
      *
@@ -265,6 +447,19 @@ class VECTOR_BLF_EXPORT File final {
      */
     virtual void write(ObjectHeaderBase * ohb);
 
+    /**
+     * Write many objects to file at once.
+     *
+     * The objects are enqueued in chunks as large as the free space
+     * in the queue, each under a single synchronization.
+     *
+     * Ownership is taken over from the user to the library.
+     * The objects should not be further accessed any more.
+     *
+     * @param[in] objects write objects
+     */
+    virtual void write(const std::vector<ObjectHeaderBase *> & objects);
+
     /**
      * close file
      */
@@ -284,6 +479,15 @@ class VECTOR_BLF_EXPORT File final {
      */
     virtual void setDefaultLogContainerSize(uint32_t defaultLogContainerSize);
 
+    /**
+     * Get the memory held by the stages of the read pipeline.
+     *
+     * The maximums are taken since open resp. the last seek.
+     *
+     * @return read-ahead usage
+     */
+    virtual ReadAheadUsage readAheadUsage() const;
+
     /**
      * create object of given type
      *
@@ -292,12 +496,59 @@ class VECTOR_BLF_EXPORT File final {
      */
     static ObjectHeaderBase * createObject(ObjectType type);
 
+    /**
+     * get channel of object
+     *
+     * @param ohb object
+     * @return channel, or 0 if the object has no channel
+     */
+    static uint16_t objectChannel(const ObjectHeaderBase * ohb);
+
   private:
     /**
      * Open mode
      */
     std::ios_base::openmode m_openMode {};
 
+    /**
+     * Recycled objects, reused by read
+     */
+    ObjectPool m_objectPool {};
+
+    /**
+     * Object types to construct when reading, indexed by object type
+     *
+     * Objects of other types are skipped by their objectSize.
+     */
+    std::vector<std::atomic<bool>> m_objectTypeSelected;
+
+    /**
+     * Cleanup of readAll, also if the visitor throws
+     *
+     * It recycles the objects not visited yet, and selects all object
+     * types again.
+     */
+    class ReadAllGuard final {
+      public:
+        /**
+         * @param[in] file file
+         * @param[in] objects objects read, visited ones are set to nullptr
+         */
+        ReadAllGuard(File & file, std::vector<ObjectHeaderBase *> & objects);
+        ~ReadAllGuard();
+        ReadAllGuard(const ReadAllGuard &) = delete;
+        ReadAllGuard & operator=(const ReadAllGuard &) = delete;
+        ReadAllGuard(ReadAllGuard &&) = delete;
+        ReadAllGuard & operator=(ReadAllGuard &&) = delete;
+
+      private:
+        /** file */
+        File & m_file;
+
+        /** objects read */
+        std::vector<ObjectHeaderBase *> & m_objects;
+    };
+
     /* read/write queue */
 
     /**
@@ -310,7 +561,7 @@ class VECTOR_BLF_EXPORT File final {
      * application. If there are no objects in the queue, the methods waits for the readWriteThread to finish.
      * The readWriteThread reads objects from the compressedfile and puts them into the queue.
      */
-    ObjectQueue<ObjectHeaderBase> m_readWriteQueue {};
+    std::unique_ptr<AbstractObjectQueue<ObjectHeaderBase>> m_readWriteQueue {};
 
     /* uncompressed file */
 
@@ -323,6 +574,22 @@ class VECTOR_BLF_EXPORT File final {
      */
     UncompressedFile m_uncompressedFile {};
 
+    /**
+     * staging buffer of the uncompressedFileThread
+     *
+     * Objects are decoded from resp. encoded into this buffer, which is
+     * transferred from/to the uncompressedFile in one block.
+     */
+    ObjectBuffer m_objectBuffer {};
+
+    /**
+     * pool of LogContainers of the compressionThread
+     *
+     * LogContainers return into it, once they are dropped from the
+     * uncompressedFile resp. written into the compressedFile.
+     */
+    LogContainerPool m_logContainerPool {};
+
     /**
      * thread between readWriteQueue and uncompressedFile
      */
@@ -338,22 +605,35 @@ class VECTOR_BLF_EXPORT File final {
      */
     std::atomic<bool> m_uncompressedFileThreadRunning {};
 
+    /**
+     * Objects before this time stamp (in ns) are skipped, after seek.
+     */
+    uint64_t m_seekTimeStamp {};
+
     /* compressed file */
 
     /**
      * compressed file
      *
-     * This file is actually the fstream, so the actual BLF data.
+     * This file is actually the fstream (CompressedFile), memory mapping (MemoryMappedFile), memory (MemoryFile) or input stream (StreamFile), so the actual BLF data.
      * It mainly contains the FileStatistics and several LogContainers carrying the different objects.
      * The compressionThread transfers data from/to here into the compressedFile.
      */
-    CompressedFile m_compressedFile {};
+    std::unique_ptr<AbstractCompressedFile> m_compressedFile {};
 
     /**
      * thread between uncompressedFile and compressedFile
      */
     std::thread m_compressedFileThread {};
 
+    /**
+     * worker threads to inflate/deflate LogContainers
+     *
+     * The compressedFileThread hands the LogContainers over to these
+     * threads and gets them back in file order.
+     */
+    LogContainerThreadPool m_logContainerThreadPool {};
+
     /**
      * exceptions from compressedFileThread
      */
@@ -364,18 +644,252 @@ class VECTOR_BLF_EXPORT File final {
      */
     std::atomic<bool> m_compressedFileThreadRunning {};
 
+    /**
+     * Selected range (begin, end) of the uncompressed content of each LogContainer,
+     * that is still being inflated.
+     */
+    std::deque<std::pair<uint32_t, uint32_t>> m_logContainerRanges {};
+
+    /**
+     * The last LogContainer read was selected according to fileIndex,
+     * so the object continued from it needs to be completed.
+     */
+    bool m_previousLogContainerSelected {};
+
+    /**
+     * read-ahead budget, taken over from readAheadBudget at open
+     */
+    uint64_t m_readAheadBudget {0};
+
+    /**
+     * synchronous mode, taken over from synchronous at open
+     */
+    bool m_synchronous {false};
+
+    /* executor */
+
+    /** state of the task after a step */
+    enum class TaskState : uint8_t {
+        /** continue with the next step */
+        Continue,
+
+        /** wait for read/write */
+        Park,
+
+        /** done */
+        Finish
+    };
+
+    /**
+     * executor the task runs on, taken over from executor at open
+     */
+    AbstractExecutor * m_executor {nullptr};
+
+    /**
+     * mutex for task state
+     */
+    std::mutex m_taskMutex {};
+
+    /**
+     * task is no longer scheduled
+     */
+    std::condition_variable m_taskDone {};
+
+    /**
+     * task is submitted to the executor or running
+     */
+    bool m_taskScheduled {false};
+
+    /**
+     * task waits for read/write
+     */
+    bool m_taskParked {false};
+
+    /**
+     * eof was set in readWriteQueue, so the task writes the remaining data
+     */
+    std::atomic<bool> m_readWriteQueueClosed {};
+
+    /* restore points */
+
+    /**
+     * Restore points, that are not yet assigned to a LogContainer in compressedFile.
+     *
+     * The first element is the position of the object in uncompressedFile.
+     */
+    std::list<std::pair<std::streampos, RestorePoint>> m_pendingRestorePoints {};
+
+    /**
+     * mutex for pendingRestorePoints
+     */
+    std::mutex m_pendingRestorePointsMutex {};
+
+    /**
+     * Position in uncompressedFile of the next LogContainer written into compressedFile.
+     */
+    std::streampos m_logContainerFilePosition {};
+
     /* internal functions */
 
+    /**
+     * Set up reading/writing, after compressedFile was opened.
+     *
+     * @param[in] mode open mode, either in (read) or out (write)
+     */
+    void init(const std::ios_base::openmode mode);
+
+    /**
+     * Create readWriteQueue according to lockFreeQueue.
+     */
+    void createReadWriteQueue();
+
+    /**
+     * Limit readWriteQueue and uncompressedFile according to readAheadBudget.
+     */
+    void applyReadAheadBudget();
+
+    /**
+     * Buffer size of uncompressedFile, when reading with pipeline threads.
+     *
+     * @return buffer size
+     */
+    std::streamsize uncompressedFileBufferSize() const;
+
+    /**
+     * Start threads for reading.
+     */
+    void startReadThreads();
+
+    /**
+     * Stop threads for reading.
+     */
+    void stopReadThreads();
+
+    /**
+     * Read and decode the next object inline, for synchronous mode.
+     *
+     * @return read object or nullptr at the end of the file
+     */
+    ObjectHeaderBase * compressedFile2Object();
+
+    /**
+     * Encode the object and deflate full LogContainers inline, for synchronous mode.
+     *
+     * @param[in] ohb object, which is deleted
+     */
+    void object2CompressedFile(ObjectHeaderBase * ohb);
+
+    /**
+     * Submit the task to the executor.
+     */
+    void startTask();
+
+    /**
+     * Resubmit the task, if it waits for read/write.
+     */
+    void resumeTask();
+
+    /**
+     * Wait until the task is no longer scheduled.
+     */
+    void waitTask();
+
+    /**
+     * Run some steps of the task and resubmit it, unless it parks or finishes.
+     */
+    void runTask();
+
+    /**
+     * Check if the task can continue, instead of waiting for read/write.
+     *
+     * @return true if it can continue
+     */
+    bool taskCanContinue() const;
+
+    /**
+     * Transfer data from compressedFile via uncompressedFile to readWriteQueue, without blocking.
+     *
+     * @return task state
+     */
+    TaskState readTaskStep();
+
+    /**
+     * Transfer data from readWriteQueue via uncompressedFile to compressedFile, without blocking.
+     *
+     * @return task state
+     */
+    TaskState writeTaskStep();
+
     /**
      * Read data from uncompressedFile into readWriteQueue.
      */
     void uncompressedFile2ReadWriteQueue();
 
+    /**
+     * Read and decode the next object from uncompressedFile.
+     *
+     * The object is staged in objectBuffer by one UncompressedFile::readObject.
+     *
+     * @return object or nullptr if it was skipped or at the end of the file
+     */
+    ObjectHeaderBase * uncompressedFile2Object();
+
+    /**
+     * Read and decode the next object from uncompressedFile field by field.
+     *
+     * This handles the objects, that uncompressedFile2Object can't stage.
+     *
+     * @return object or nullptr if it was skipped or at the end of the file
+     */
+    ObjectHeaderBase * uncompressedFile2ObjectUnstaged();
+
+    /**
+     * Create object, or reuse a recycled one, as configured by rawObjects.
+     *
+     * @param[in] type object type
+     * @return object, or nullptr for unknown object types
+     */
+    ObjectHeaderBase * createPooledObject(ObjectType type);
+
+    /**
+     * Apply the filters, that need the decoded object, and count it.
+     *
+     * @param[in] obj object
+     * @return object, or nullptr if it was recycled
+     */
+    ObjectHeaderBase * filterObject(ObjectHeaderBase * obj);
+
+    /**
+     * Check if the object type is selected by readAll and objectFilter.
+     *
+     * @param[in] ohb object header base
+     * @return true if the object should be constructed
+     */
+    bool objectTypeSelected(const ObjectHeaderBase & ohb) const;
+
+    /**
+     * Check if the object time stamp is selected by objectFilter.
+     *
+     * The time stamp is peeked from the object header. The get position is kept.
+     *
+     * @param[in] ohb object header base
+     * @param[in] is file positioned at the object
+     * @return true if the object should be constructed
+     */
+    bool objectTimeStampSelected(const ObjectHeaderBase & ohb, AbstractFile & is);
+
     /**
      * Write data from readWriteQueue into uncompressedFile.
      */
     void readWriteQueue2UncompressedFile();
 
+    /**
+     * Encode object into uncompressedFile and remember its restore point.
+     *
+     * @param[in] ohb object, which is deleted
+     */
+    void object2UncompressedFile(ObjectHeaderBase * ohb);
+
     /**
      * Read/inflate/uncompress data from compressedFile into uncompressedFile.
      */
@@ -386,6 +900,65 @@ class VECTOR_BLF_EXPORT File final {
      */
     void uncompressedFile2CompressedFile();
 
+    /**
+     * Set end of uncompressedFile, and deflate the remaining data into compressedFile.
+     */
+    void uncompressedFile2CompressedFileRemaining();
+
+    /**
+     * Inflate the next LogContainer, unless the next object is completely in uncompressedFile.
+     *
+     * The object size is peeked, so that decoding the object doesn't wait for more data.
+     *
+     * @return true if a LogContainer was processed
+     */
+    bool compressedFile2UncompressedFileAhead();
+
+    /**
+     * Write inflated LogContainers from logContainerThreadPool into uncompressedFile.
+     *
+     * @param[in] maxSize number of LogContainers that may remain in logContainerThreadPool
+     */
+    void logContainerThreadPool2UncompressedFile(std::size_t maxSize);
+
+    /**
+     * Write inflated LogContainer into uncompressedFile, reduced to its selected range.
+     *
+     * @param[in] logContainer log container
+     */
+    void logContainer2UncompressedFile(const std::shared_ptr<LogContainer> & logContainer);
+
+    /**
+     * Write deflated LogContainers from logContainerThreadPool into compressedFile.
+     *
+     * @param[in] maxSize number of LogContainers that may remain in logContainerThreadPool
+     */
+    void logContainerThreadPool2CompressedFile(std::size_t maxSize);
+
+    /**
+     * Write deflated LogContainer into compressedFile and assign pending restore points to it.
+     *
+     * @param[in] logContainer log container
+     */
+    void logContainer2CompressedFile(LogContainer & logContainer);
+
+    /**
+     * Read restore points from the end of compressedFile.
+     */
+    void compressedFile2RestorePoints();
+
+    /**
+     * Write restore points as RestorePointContainers into uncompressedFile.
+     */
+    void restorePoints2UncompressedFile();
+
+    /**
+     * Deflate/compress LogContainer according to compressionLevel.
+     *
+     * @param[in,out] logContainer log container
+     */
+    void compressLogContainer(LogContainer & logContainer) const;
+
     /**
      * transfer data from uncompressedFile to readWriteQueue
      */
@@ -407,5 +980,28 @@ class VECTOR_BLF_EXPORT File final {
     static void compressedFileWriteThread(File * file);
 };
 
+template <typename Visitor>
+void File::readAll(Visitor & visitor) {
+    /* only construct the object types handled by the visitor */
+    bool handlesRawObjects = (rawObjects != RawObjectMode::None) && ObjectVisitor<Visitor>::handlesRawObjects();
+    for (std::size_t type = 0; type < m_objectTypeSelected.size(); ++type) {
+        m_objectTypeSelected[type] =
+            handlesRawObjects ||
+            ((rawObjects != RawObjectMode::All) && ObjectVisitor<Visitor>::handles(static_cast<ObjectType>(type)));
+    }
+
+    /* visit objects */
+    std::vector<ObjectHeaderBase *> objects;
+    ReadAllGuard guard(*this, objects);
+    while (read(objects, readWriteQueueSize) > 0) {
+        for (ObjectHeaderBase *& ohb : objects) {
+            ObjectVisitor<Visitor>::visit(visitor, ohb);
+            recycle(ohb);
+            ohb = nullptr;
+        }
+        objects.clear();
+    }
+}
+
 }
 }
@@ -0,0 +1,217 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <Vector/BLF/FileIndex.h>
+
+#include <algorithm>
+#include <memory>
+
+#include <Vector/BLF/CompressedFile.h>
+#include <Vector/BLF/Exceptions.h>
+#include <Vector/BLF/File.h>
+#include <Vector/BLF/FileStatistics.h>
+#include <Vector/BLF/LogContainer.h>
+#include <Vector/BLF/ObjectReader.h>
+
+namespace Vector {
+namespace BLF {
+
+void FileIndex::read(AbstractFile & is) {
+    is.read(reinterpret_cast<char *>(&signature), sizeof(signature));
+    if (signature != FileIndexSignature)
+        throw Exception("FileIndex::read(): File index signature doesn't match at this position.");
+    is.read(reinterpret_cast<char *>(&version), sizeof(version));
+    if (version != FileIndexVersion)
+        throw Exception("FileIndex::read(): File index version is not supported.");
+    is.read(reinterpret_cast<char *>(&fileSize), sizeof(fileSize));
+    is.read(reinterpret_cast<char *>(&uncompressedFileSize), sizeof(uncompressedFileSize));
+    is.read(reinterpret_cast<char *>(&objectCount), sizeof(objectCount));
+    is.read(reinterpret_cast<char *>(&measurementStartTime), sizeof(measurementStartTime));
+
+    /* entries */
+    uint32_t logContainersSize = 0;
+    is.read(reinterpret_cast<char *>(&logContainersSize), sizeof(logContainersSize));
+    logContainers.clear();
+    for (uint32_t i = 0; (i < logContainersSize) && is.good(); ++i) {
+        FileIndexEntry fileIndexEntry;
+        fileIndexEntry.read(is);
+        logContainers.push_back(fileIndexEntry);
+    }
+}
+
+void FileIndex::write(AbstractFile & os) {
+    os.write(reinterpret_cast<char *>(&signature), sizeof(signature));
+    os.write(reinterpret_cast<char *>(&version), sizeof(version));
+    os.write(reinterpret_cast<char *>(&fileSize), sizeof(fileSize));
+    os.write(reinterpret_cast<char *>(&uncompressedFileSize), sizeof(uncompressedFileSize));
+    os.write(reinterpret_cast<char *>(&objectCount), sizeof(objectCount));
+    os.write(reinterpret_cast<char *>(&measurementStartTime), sizeof(measurementStartTime));
+
+    /* entries */
+    uint32_t logContainersSize = static_cast<uint32_t>(logContainers.size());
+    os.write(reinterpret_cast<char *>(&logContainersSize), sizeof(logContainersSize));
+    for (FileIndexEntry & fileIndexEntry : logContainers)
+        fileIndexEntry.write(os);
+}
+
+void FileIndex::build(const char * filename) {
+    logContainers.clear();
+
+    /* open file */
+    CompressedFile compressedFile;
+    compressedFile.open(filename, std::ios_base::in | std::ios_base::binary);
+    if (!compressedFile.is_open())
+        throw Exception("FileIndex::build(): Unable to open file.");
+
+    /* read file statistics */
+    FileStatistics fileStatistics;
+    fileStatistics.read(compressedFile);
+    fileSize = fileStatistics.fileSize;
+    uncompressedFileSize = fileStatistics.uncompressedFileSize;
+    objectCount = fileStatistics.objectCount;
+    measurementStartTime = fileStatistics.measurementStartTime;
+
+    /* restore point containers at the end of the file are not indexed */
+    uint64_t endPosition = fileStatistics.fileSize;
+    if (fileStatistics.restorePointsOffset > 0)
+        endPosition = fileStatistics.restorePointsOffset;
+
+    /* objects are read LogContainer by LogContainer */
+    ObjectReader objectReader;
+    std::vector<std::streampos> logContainerFilePositions;
+    std::size_t current = 0;
+
+    /* read next LogContainer into objectReader */
+    auto readLogContainer = [&]() -> bool {
+        std::streampos compressedFilePosition = compressedFile.tellg();
+        if ((compressedFilePosition < 0) || (static_cast<uint64_t>(compressedFilePosition) >= endPosition))
+            return false;
+
+        /* read header to identify type */
+        ObjectHeaderBase ohb(0, ObjectType::UNKNOWN);
+        ohb.read(compressedFile);
+        if (!compressedFile.good() || (ohb.objectType != ObjectType::LOG_CONTAINER))
+            return false;
+        compressedFile.seekg(-ohb.calculateHeaderSize(), std::ios_base::cur);
+
+        /* read and uncompress LogContainer */
+        std::shared_ptr<LogContainer> logContainer(new LogContainer);
+        logContainer->read(compressedFile);
+        if (!compressedFile.good())
+            return false;
+        logContainer->uncompress();
+
+        /* new entry */
+        FileIndexEntry fileIndexEntry;
+        fileIndexEntry.compressedFilePosition = static_cast<uint64_t>(compressedFilePosition);
+        fileIndexEntry.uncompressedFileSize = logContainer->uncompressedFileSize;
+        fileIndexEntry.uncompressedFileOffset = logContainer->uncompressedFileSize;
+        logContainers.push_back(fileIndexEntry);
+        logContainerFilePositions.push_back(objectReader.append(logContainer));
+        return true;
+    };
+
+    try {
+        bool allDataAppended = false;
+        for (;;) {
+            /* make sure the next object is available */
+            ObjectHeaderBase ohb(0, ObjectType::UNKNOWN);
+            if (!objectReader.peek(ohb, allDataAppended)) {
+                if (allDataAppended)
+                    break;
+                allDataAppended = !readLogContainer();
+                continue;
+            }
+
+            /* find LogContainer, in which the object starts */
+            std::streampos position = objectReader.tellg();
+            while ((current + 1 < logContainerFilePositions.size()) && (logContainerFilePositions[current + 1] <= position))
+                current++;
+            FileIndexEntry & fileIndexEntry = logContainers[current];
+            uint32_t offset = static_cast<uint32_t>(position - logContainerFilePositions[current]);
+            fileIndexEntry.uncompressedFileOffset = std::min(fileIndexEntry.uncompressedFileOffset, offset);
+            fileIndexEntry.objectCounts[ohb.objectType]++;
+
+            /* create object */
+            std::unique_ptr<ObjectHeaderBase> obj(File::createObject(ohb.objectType));
+            if (!obj) {
+                /* in case of unknown objectType */
+                objectReader.skip(ohb.objectSize);
+                continue;
+            }
+
+            /* read object */
+            if (!objectReader.read(*obj, ohb))
+                break;
+
+            /* time stamp and channel */
+            uint64_t timeStamp = obj->objectTimeStampNs();
+            fileIndexEntry.minTimeStamp = std::min(fileIndexEntry.minTimeStamp, timeStamp);
+            fileIndexEntry.maxTimeStamp = std::max(fileIndexEntry.maxTimeStamp, timeStamp);
+            uint16_t channel = File::objectChannel(obj.get());
+            if (channel > 0)
+                fileIndexEntry.channels.insert(channel);
+        }
+    } catch (Vector::BLF::Exception &) {
+        /* index stops at the first invalid object */
+    }
+}
+
+bool FileIndex::load(const char * filename) {
+    /* open file */
+    CompressedFile compressedFile;
+    compressedFile.open(filename, std::ios_base::in | std::ios_base::binary);
+    if (!compressedFile.is_open())
+        return false;
+
+    /* read index */
+    try {
+        read(compressedFile);
+    } catch (Vector::BLF::Exception &) {
+        logContainers.clear();
+        return false;
+    }
+    if (!compressedFile.good()) {
+        logContainers.clear();
+        return false;
+    }
+    return true;
+}
+
+bool FileIndex::save(const char * filename) {
+    /* open file */
+    CompressedFile compressedFile;
+    compressedFile.open(filename, std::ios_base::out | std::ios_base::binary);
+    if (!compressedFile.is_open())
+        return false;
+
+    /* write index */
+    write(compressedFile);
+    return compressedFile.good();
+}
+
+const FileIndexEntry * FileIndex::find(uint64_t compressedFilePosition) const {
+    /* entries are sorted by compressedFilePosition */
+    std::vector<FileIndexEntry>::const_iterator fileIndexEntry = std::lower_bound(
+                logContainers.cbegin(),
+                logContainers.cend(),
+                compressedFilePosition,
+    [](const FileIndexEntry & fileIndexEntry, uint64_t compressedFilePosition) {
+        return fileIndexEntry.compressedFilePosition < compressedFilePosition;
+    });
+    if ((fileIndexEntry == logContainers.cend()) || (fileIndexEntry->compressedFilePosition != compressedFilePosition))
+        return nullptr;
+    return &*fileIndexEntry;
+}
+
+bool FileIndex::matches(const FileStatistics & fileStatistics) const {
+    return
+        (fileSize == fileStatistics.fileSize) &&
+        (uncompressedFileSize == fileStatistics.uncompressedFileSize) &&
+        (objectCount == fileStatistics.objectCount) &&
+        (measurementStartTime == fileStatistics.measurementStartTime);
+}
+
+}
+}
@@ -0,0 +1,120 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <Vector/BLF/platform.h>
+
+#include <cstdint>
+#include <vector>
+
+#include <Vector/BLF/AbstractFile.h>
+#include <Vector/BLF/FileIndexEntry.h>
+#include <Vector/BLF/FileStatistics.h>
+
+#include <Vector/BLF/vector_blf_export.h>
+
+namespace Vector {
+namespace BLF {
+
+/** signature of a file index */
+const uint32_t FileIndexSignature = 0x49464C42; /* BLFI */
+
+/** version of the file index format */
+const uint32_t FileIndexVersion = 1;
+
+/**
+ * File Index
+ *
+ * Sidecar index of a BLF file, with one FileIndexEntry per LogContainer.
+ * It is built by one pass over the BLF file and can then be saved next
+ * to it, so that it can be reused for files without restore points.
+ *
+ * File uses it to seek by time stamp and to skip LogContainers that
+ * are not selected by File::logContainerFilter.
+ */
+struct VECTOR_BLF_EXPORT FileIndex final {
+    /**
+     * Read the data of this object
+     *
+     * An Exception is thrown, if the signature doesn't match or
+     * the version is not FileIndexVersion.
+     *
+     * @param is input stream
+     */
+    virtual void read(AbstractFile & is);
+
+    /**
+     * Write the data of this object
+     *
+     * @param os output stream
+     */
+    virtual void write(AbstractFile & os);
+
+    /**
+     * Build index by reading all LogContainers of a BLF file.
+     *
+     * @param[in] filename file name of the BLF file
+     */
+    virtual void build(const char * filename);
+
+    /**
+     * Load index from a sidecar file.
+     *
+     * @param[in] filename file name of the index file
+     * @return true if index was loaded
+     */
+    virtual bool load(const char * filename);
+
+    /**
+     * Save index into a sidecar file.
+     *
+     * @param[in] filename file name of the index file
+     * @return true if index was saved
+     */
+    virtual bool save(const char * filename);
+
+    /**
+     * Find the entry of the LogContainer at the given position.
+     *
+     * @param[in] compressedFilePosition position of the LogContainer in the compressed file
+     * @return entry or nullptr
+     */
+    virtual const FileIndexEntry * find(uint64_t compressedFilePosition) const;
+
+    /**
+     * Check if this is the index of the file with the given statistics.
+     *
+     * The file size, uncompressed file size, object count and
+     * measurement start time have to match.
+     *
+     * @param[in] fileStatistics file statistics of the BLF file
+     * @return true if the index matches
+     */
+    virtual bool matches(const FileStatistics & fileStatistics) const;
+
+    /** signature (FileIndexSignature) */
+    uint32_t signature {FileIndexSignature};
+
+    /** version of the index format (FileIndexVersion) */
+    uint32_t version {FileIndexVersion};
+
+    /** file size of the indexed BLF file */
+    uint64_t fileSize {};
+
+    /** uncompressed file size of the indexed BLF file */
+    uint64_t uncompressedFileSize {};
+
+    /** object count of the indexed BLF file */
+    uint32_t objectCount {};
+
+    /** measurement start time of the indexed BLF file */
+    SYSTEMTIME measurementStartTime {};
+
+    /** entries in the order of the LogContainers */
+    std::vector<FileIndexEntry> logContainers {};
+};
+
+}
+}
@@ -0,0 +1,74 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <Vector/BLF/FileIndexEntry.h>
+
+#include <Vector/BLF/Fields.h>
+
+namespace Vector {
+namespace BLF {
+
+/** fields of FileIndexEntry from compressedFilePosition to maxTimeStamp */
+using FileIndexEntryFields = Fields<
+    VECTOR_BLF_FIELD(FileIndexEntry, compressedFilePosition),
+    VECTOR_BLF_FIELD(FileIndexEntry, uncompressedFileSize),
+    VECTOR_BLF_FIELD(FileIndexEntry, uncompressedFileOffset),
+    VECTOR_BLF_FIELD(FileIndexEntry, minTimeStamp),
+    VECTOR_BLF_FIELD(FileIndexEntry, maxTimeStamp)>;
+
+void FileIndexEntry::read(AbstractFile & is) {
+    FileIndexEntryFields::read(is, *this);
+
+    /* object counts */
+    uint32_t objectCountsSize = 0;
+    is.read(reinterpret_cast<char *>(&objectCountsSize), sizeof(objectCountsSize));
+    objectCounts.clear();
+    for (uint32_t i = 0; (i < objectCountsSize) && is.good(); ++i) {
+        uint32_t objectType = 0;
+        uint32_t objectCount = 0;
+        is.read(reinterpret_cast<char *>(&objectType), sizeof(objectType));
+        is.read(reinterpret_cast<char *>(&objectCount), sizeof(objectCount));
+        objectCounts[static_cast<ObjectType>(objectType)] = objectCount;
+    }
+
+    /* channels */
+    uint32_t channelsSize = 0;
+    is.read(reinterpret_cast<char *>(&channelsSize), sizeof(channelsSize));
+    channels.clear();
+    for (uint32_t i = 0; (i < channelsSize) && is.good(); ++i) {
+        uint16_t channel = 0;
+        is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
+        channels.insert(channel);
+    }
+}
+
+void FileIndexEntry::write(AbstractFile & os) {
+    FileIndexEntryFields::write(os, *this);
+
+    /* object counts */
+    uint32_t objectCountsSize = static_cast<uint32_t>(objectCounts.size());
+    os.write(reinterpret_cast<char *>(&objectCountsSize), sizeof(objectCountsSize));
+    for (const std::pair<const ObjectType, uint32_t> & objectCount : objectCounts) {
+        uint32_t objectType = static_cast<uint32_t>(objectCount.first);
+        uint32_t count = objectCount.second;
+        os.write(reinterpret_cast<char *>(&objectType), sizeof(objectType));
+        os.write(reinterpret_cast<char *>(&count), sizeof(count));
+    }
+
+    /* channels */
+    uint32_t channelsSize = static_cast<uint32_t>(channels.size());
+    os.write(reinterpret_cast<char *>(&channelsSize), sizeof(channelsSize));
+    for (uint16_t channel : channels)
+        os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
+}
+
+uint32_t FileIndexEntry::calculateObjectSize() const {
+    return
+        FileIndexEntryFields::size() +
+        sizeof(uint32_t) + objectCounts.size() * (sizeof(uint32_t) + sizeof(uint32_t)) +
+        sizeof(uint32_t) + channels.size() * sizeof(uint16_t);
+}
+
+}
+}
@@ -0,0 +1,98 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <Vector/BLF/platform.h>
+
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <set>
+
+#include <Vector/BLF/AbstractFile.h>
+#include <Vector/BLF/ObjectHeaderBase.h>
+
+#include <Vector/BLF/vector_blf_export.h>
+
+namespace Vector {
+namespace BLF {
+
+/**
+ * File Index Entry
+ *
+ * Summary of the objects, that start in one LogContainer.
+ */
+struct VECTOR_BLF_EXPORT FileIndexEntry final {
+    /**
+     * Read the data of this object
+     *
+     * @param is input stream
+     */
+    virtual void read(AbstractFile & is);
+
+    /**
+     * Write the data of this object
+     *
+     * @param os output stream
+     */
+    virtual void write(AbstractFile & os);
+
+    /**
+     * Calculates the objectSize
+     *
+     * @return object size
+     */
+    virtual uint32_t calculateObjectSize() const;
+
+    /**
+     * compressed file position
+     *
+     * This designates the position of the LogContainer in the compressed
+     * file.
+     */
+    uint64_t compressedFilePosition {};
+
+    /**
+     * uncompressed file size
+     *
+     * Size of the uncompressed content of the LogContainer.
+     */
+    uint32_t uncompressedFileSize {};
+
+    /**
+     * uncompressed file offset
+     *
+     * This designates the offset within the uncompressed content of
+     * the LogContainer, where the first Object starts. Data before
+     * belongs to an Object continued from the previous LogContainer.
+     * It's uncompressedFileSize, if no Object starts in this LogContainer.
+     */
+    uint32_t uncompressedFileOffset {};
+
+    /**
+     * minimum time stamp (in ns) of the Objects starting in this LogContainer
+     */
+    uint64_t minTimeStamp {std::numeric_limits<uint64_t>::max()};
+
+    /**
+     * maximum time stamp (in ns) of the Objects starting in this LogContainer
+     */
+    uint64_t maxTimeStamp {};
+
+    /**
+     * number of Objects per object type starting in this LogContainer
+     */
+    std::map<ObjectType, uint32_t> objectCounts {};
+
+    /**
+     * channels of the Objects starting in this LogContainer
+     *
+     * Objects without channel are not considered.
+     */
+    std::set<uint16_t> channels {};
+};
+
+}
+}
@@ -0,0 +1,206 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <Vector/BLF/FileMerger.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include <Vector/BLF/Exceptions.h>
+#include <Vector/BLF/ObjectHeader.h>
+#include <Vector/BLF/ObjectHeader2.h>
+#include <Vector/BLF/RawObject.h>
+
+namespace Vector {
+namespace BLF {
+
+namespace {
+
+/**
+ * Check if a system time is set.
+ *
+ * @param[in] systemTime system time
+ * @return true if set
+ */
+bool isSet(const SYSTEMTIME & systemTime) {
+    return (systemTime.month >= 1) && (systemTime.month <= 12) && (systemTime.day >= 1);
+}
+
+/**
+ * Convert system time into ns since 1970-01-01.
+ *
+ * @param[in] systemTime system time
+ * @return time in ns
+ */
+int64_t systemTimeNs(const SYSTEMTIME & systemTime) {
+    /* days since 1970-01-01 in the proleptic Gregorian calendar */
+    int64_t year = systemTime.year - ((systemTime.month <= 2) ? 1 : 0);
+    int64_t era = ((year >= 0) ? year : year - 399) / 400;
+    int64_t yearOfEra = year - era * 400;
+    int64_t dayOfYear = (153 * ((systemTime.month > 2) ? systemTime.month - 3 : systemTime.month + 9) + 2) / 5 + systemTime.day - 1;
+    int64_t dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    int64_t days = era * 146097 + dayOfEra - 719468;
+
+    /* time of day */
+    int64_t ms = ((days * 24 + systemTime.hour) * 60 + systemTime.minute) * 60000 + systemTime.second * 1000 + systemTime.milliseconds;
+    return ms * 1000000;
+}
+
+/**
+ * Shift the time stamp of an object.
+ *
+ * @param[in,out] ohb object
+ * @param[in] offset offset in ns
+ */
+void shiftObjectTimeStamp(ObjectHeaderBase * ohb, uint64_t offset) {
+    /* decoded objects */
+    ObjectHeader * objectHeader = dynamic_cast<ObjectHeader *>(ohb);
+    if (objectHeader != nullptr) {
+        objectHeader->objectTimeStamp += (objectHeader->objectFlags == ObjectHeader::ObjectFlags::TimeTenMics) ? offset / 10000 : offset;
+        return;
+    }
+    ObjectHeader2 * objectHeader2 = dynamic_cast<ObjectHeader2 *>(ohb);
+    if (objectHeader2 != nullptr) {
+        objectHeader2->objectTimeStamp += (objectHeader2->objectFlags == ObjectHeader2::ObjectFlags::TimeTenMics) ? offset / 10000 : offset;
+        return;
+    }
+
+    /* raw objects, objectFlags (offset 0) and objectTimeStamp (offset 8) are at the same offsets in ObjectHeader and ObjectHeader2 */
+    RawObject * rawObject = dynamic_cast<RawObject *>(ohb);
+    if ((rawObject != nullptr) && ((rawObject->headerVersion == 1) || (rawObject->headerVersion == 2)) && (rawObject->data.size() >= 16)) {
+        uint32_t objectFlags;
+        uint64_t objectTimeStamp;
+        std::memcpy(&objectFlags, &rawObject->data[0], sizeof(objectFlags));
+        std::memcpy(&objectTimeStamp, &rawObject->data[8], sizeof(objectTimeStamp));
+        objectTimeStamp += (objectFlags == ObjectHeader::ObjectFlags::TimeTenMics) ? offset / 10000 : offset;
+        std::memcpy(&rawObject->data[8], &objectTimeStamp, sizeof(objectTimeStamp));
+    }
+}
+
+}
+
+FileMerger::~FileMerger() {
+    close();
+}
+
+void FileMerger::open(const char * filename) {
+    /* check */
+    if (m_started)
+        throw Exception("FileMerger::open(): Files can only be opened before the first read.");
+
+    /* open file */
+    std::unique_ptr<File> file(new File);
+    file->compressionThreads = compressionThreads;
+    file->open(filename, std::ios_base::in);
+    if (!file->is_open())
+        return;
+    files.push_back(std::move(file));
+}
+
+void FileMerger::open(const std::string & filename) {
+    open(filename.c_str());
+}
+
+bool FileMerger::is_open() const {
+    return std::any_of(files.cbegin(), files.cend(), [](const std::unique_ptr<File> & file) {
+        return file->is_open();
+    });
+}
+
+ObjectHeaderBase * FileMerger::read() {
+    /* first objects */
+    if (!m_started)
+        start();
+
+    /* end of all files */
+    if (m_heap.empty())
+        return nullptr;
+
+    /* earliest object */
+    std::pop_heap(m_heap.begin(), m_heap.end(), &FileMerger::later);
+    Entry entry = m_heap.back();
+    m_heap.pop_back();
+    m_lastFile = entry.file;
+
+    /* next object of this file */
+    readNext(entry.file);
+
+    return entry.ohb;
+}
+
+std::size_t FileMerger::lastFile() const {
+    return m_lastFile;
+}
+
+void FileMerger::close() {
+    /* delete objects not read */
+    for (Entry & entry : m_heap)
+        delete entry.ohb;
+    m_heap.clear();
+
+    /* close files */
+    for (std::unique_ptr<File> & file : files)
+        file->close();
+    files.clear();
+    m_timeStampOffsets.clear();
+    m_started = false;
+    m_lastFile = 0;
+}
+
+bool FileMerger::later(const Entry & a, const Entry & b) {
+    return (a.timeStamp > b.timeStamp) || ((a.timeStamp == b.timeStamp) && (a.file > b.file));
+}
+
+void FileMerger::start() {
+    m_started = true;
+
+    /* earliest measurement start time */
+    bool measurementStartTimeSet = false;
+    int64_t measurementStartTimeNs = 0;
+    for (const std::unique_ptr<File> & file : files) {
+        const SYSTEMTIME & fileMeasurementStartTime = file->fileStatistics.measurementStartTime;
+        if (!isSet(fileMeasurementStartTime))
+            continue;
+        int64_t fileMeasurementStartTimeNs = systemTimeNs(fileMeasurementStartTime);
+        if (!measurementStartTimeSet || (fileMeasurementStartTimeNs < measurementStartTimeNs)) {
+            measurementStartTime = fileMeasurementStartTime;
+            measurementStartTimeNs = fileMeasurementStartTimeNs;
+            measurementStartTimeSet = true;
+        }
+    }
+
+    /* time stamp offsets */
+    m_timeStampOffsets.assign(files.size(), 0);
+    if (alignMeasurementStartTime) {
+        for (std::size_t file = 0; file < files.size(); ++file) {
+            const SYSTEMTIME & fileMeasurementStartTime = files[file]->fileStatistics.measurementStartTime;
+            if (isSet(fileMeasurementStartTime))
+                m_timeStampOffsets[file] = static_cast<uint64_t>(systemTimeNs(fileMeasurementStartTime) - measurementStartTimeNs);
+        }
+    }
+
+    /* first object of each file */
+    m_heap.reserve(files.size());
+    for (std::size_t file = 0; file < files.size(); ++file)
+        readNext(file);
+}
+
+void FileMerger::readNext(std::size_t file) {
+    /* read object */
+    ObjectHeaderBase * ohb = files[file]->read();
+    if (ohb == nullptr)
+        return;
+
+    /* shift time stamp */
+    uint64_t timeStampOffset = m_timeStampOffsets[file];
+    if (timeStampOffset > 0)
+        shiftObjectTimeStamp(ohb, timeStampOffset);
+
+    /* add to heap */
+    m_heap.push_back(Entry{ohb->objectTimeStampNs(), file, ohb});
+    std::push_heap(m_heap.begin(), m_heap.end(), &FileMerger::later);
+}
+
+}
+}
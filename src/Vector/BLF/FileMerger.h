@@ -0,0 +1,172 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <Vector/BLF/platform.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <Vector/BLF/File.h>
+#include <Vector/BLF/FileStatistics.h>
+#include <Vector/BLF/ObjectHeaderBase.h>
+
+#include <Vector/BLF/vector_blf_export.h>
+
+namespace Vector {
+namespace BLF {
+
+/**
+ * Merge of multiple BLF files
+ *
+ * The objects of all input files are read in the order of their time
+ * stamps (see ObjectHeaderBase::objectTimeStampNs), like from one file.
+ * Objects with equal time stamps are read in the order of the files,
+ * and objects of one file keep their order.
+ *
+ * Only the next object of each file is kept, so memory is bounded by the
+ * number of files and their File::readWriteQueueSize. Each File inflates
+ * its LogContainers in its own threads, so the input files are inflated
+ * in parallel.
+ *
+ * This class is not thread-safe. It should only be accessed by one thread.
+ */
+class VECTOR_BLF_EXPORT FileMerger final {
+  public:
+    FileMerger() = default;
+    virtual ~FileMerger();
+    FileMerger(const FileMerger &) = delete;
+    FileMerger & operator=(const FileMerger &) = delete;
+    FileMerger(FileMerger &&) = delete;
+    FileMerger & operator=(FileMerger &&) = delete;
+
+    /**
+     * Open input file.
+     *
+     * All input files need to be opened before the first read.
+     *
+     * @param[in] filename file name
+     */
+    virtual void open(const char * filename);
+
+    /** @copydoc open(const char *) */
+    virtual void open(const std::string & filename);
+
+    /**
+     * is any input file open?
+     *
+     * @return true if an input file is open
+     */
+    virtual bool is_open() const;
+
+    /**
+     * Read the next object of all input files.
+     *
+     * Ownership is taken over from the library to the user.
+     * The user has to take care to delete the object.
+     *
+     * @return read object or nullptr at the end of all files
+     */
+    virtual ObjectHeaderBase * read();
+
+    /**
+     * Get the input file of the object returned by the last read.
+     *
+     * @return index in files
+     */
+    virtual std::size_t lastFile() const;
+
+    /**
+     * Close all input files.
+     */
+    virtual void close();
+
+    /**
+     * input files, in the order they were opened
+     *
+     * File options and statistics can be accessed here.
+     */
+    std::vector<std::unique_ptr<File>> files {};
+
+    /**
+     * Number of threads per input file to inflate LogContainers.
+     *
+     * @see File::compressionThreads
+     *
+     * This needs to be set before the files are opened.
+     */
+    uint32_t compressionThreads {0};
+
+    /**
+     * Align the time stamps of all files to measurementStartTime.
+     *
+     * Object time stamps are relative to the measurementStartTime of their
+     * file. If this is set, the time stamps of files, which were started
+     * later, are shifted, so that all time stamps are relative to the
+     * earliest measurementStartTime. Files without measurementStartTime are
+     * not shifted.
+     *
+     * This needs to be set before the first read.
+     */
+    bool alignMeasurementStartTime {false};
+
+    /**
+     * earliest measurementStartTime of all input files
+     *
+     * This is set at the first read.
+     */
+    SYSTEMTIME measurementStartTime {};
+
+  private:
+    /** next object of a file */
+    struct Entry {
+        /** time stamp in ns, shifted by the file offset */
+        uint64_t timeStamp;
+
+        /** index in files */
+        std::size_t file;
+
+        /** object */
+        ObjectHeaderBase * ohb;
+    };
+
+    /** heap of the next object of each file, with the earliest one at the front */
+    std::vector<Entry> m_heap {};
+
+    /** time stamp offsets of the files in ns */
+    std::vector<uint64_t> m_timeStampOffsets {};
+
+    /** first read was done */
+    bool m_started {false};
+
+    /** input file of the object returned by the last read */
+    std::size_t m_lastFile {};
+
+    /**
+     * Heap order of entries.
+     *
+     * @param[in] a entry
+     * @param[in] b entry
+     * @return true if a is read after b
+     */
+    static bool later(const Entry & a, const Entry & b);
+
+    /**
+     * Compute time stamp offsets and read the first object of each file.
+     */
+    void start();
+
+    /**
+     * Read the next object of a file into the heap.
+     *
+     * @param[in] file index in files
+     */
+    void readNext(std::size_t file);
+};
+
+}
+}
@@ -0,0 +1,329 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <Vector/BLF/FileSplicer.h>
+
+#include <algorithm>
+#include <memory>
+
+#include <Vector/BLF/Exceptions.h>
+#include <Vector/BLF/MemoryMappedFile.h>
+
+namespace Vector {
+namespace BLF {
+
+FileSplicer::~FileSplicer() {
+    close();
+}
+
+void FileSplicer::open(const char * filename) {
+    /* check */
+    if (is_open())
+        return;
+
+    /* try to open file */
+    m_compressedFile.open(filename, std::ios_base::out | std::ios_base::binary);
+    if (!m_compressedFile.is_open())
+        return;
+
+    /* initial state */
+    m_fileStatisticsTakenOver = false;
+    m_objectBuffer.clear();
+    m_uncompressedFileSize = 0;
+    m_objectCount = 0;
+    passedLogContainers = 0;
+    inflatedLogContainers = 0;
+
+    /* write file statistics */
+    fileStatistics.write(m_compressedFile);
+
+    /* fileStatistics done */
+    m_uncompressedFileSize += fileStatistics.statisticsSize;
+}
+
+bool FileSplicer::is_open() const {
+    return m_compressedFile.is_open();
+}
+
+void FileSplicer::append(const char * filename) {
+    /* check */
+    if (!is_open())
+        throw Exception("FileSplicer::append(): Output file is not open.");
+
+    /* open file */
+    MemoryMappedFile inputFile;
+    inputFile.open(filename);
+    if (!inputFile.is_open())
+        throw Exception("FileSplicer::append(): Unable to open file.");
+
+    /* read file statistics */
+    FileStatistics inputFileStatistics;
+    inputFileStatistics.read(inputFile);
+    takeOverFileStatistics(inputFileStatistics);
+
+    /* restore point containers at the end of the file are not copied */
+    uint64_t endPosition = inputFileStatistics.fileSize;
+    if (inputFileStatistics.restorePointsOffset > 0)
+        endPosition = inputFileStatistics.restorePointsOffset;
+
+    /* objects of previous files */
+    flushObjectBuffer();
+
+    /* copy all LogContainers */
+    while (static_cast<uint64_t>(inputFile.tellg()) < endPosition) {
+        /* read header to identify type */
+        ObjectHeaderBase ohb(0, ObjectType::UNKNOWN);
+        ohb.read(inputFile);
+        if (!inputFile.good() || (ohb.objectType != ObjectType::LOG_CONTAINER))
+            break;
+        inputFile.seekg(-ohb.calculateHeaderSize(), std::ios_base::cur);
+
+        /* copy LogContainer */
+        LogContainer logContainer;
+        logContainer.read(inputFile);
+        if (!inputFile.good())
+            break;
+        writeLogContainer(logContainer);
+        passedLogContainers++;
+    }
+
+    /* statistics */
+    m_objectCount += inputFileStatistics.objectCount;
+}
+
+void FileSplicer::append(const char * filename, uint64_t startTimeStamp, uint64_t endTimeStamp) {
+    /* check */
+    if (!is_open())
+        throw Exception("FileSplicer::append(): Output file is not open.");
+
+    /* open file */
+    MemoryMappedFile inputFile;
+    inputFile.open(filename);
+    if (!inputFile.is_open())
+        throw Exception("FileSplicer::append(): Unable to open file.");
+
+    /* read file statistics */
+    FileStatistics inputFileStatistics;
+    inputFileStatistics.read(inputFile);
+    takeOverFileStatistics(inputFileStatistics);
+
+    /* build file index, if it's not the one of this file */
+    if (!fileIndex.matches(inputFileStatistics) || fileIndex.logContainers.empty())
+        fileIndex.build(filename);
+    const std::vector<FileIndexEntry> & logContainers = fileIndex.logContainers;
+    std::vector<LogContainerAction> actions = logContainerActions(startTimeStamp, endTimeStamp);
+
+    /* objects of the inflated LogContainers */
+    ObjectReader objectReader;
+
+    /* the object at the end of the previous LogContainer was passed through, and continues into this LogContainer */
+    bool objectContinued = false;
+
+    for (std::size_t i = 0; i < logContainers.size(); ++i) {
+        const FileIndexEntry & fileIndexEntry = logContainers[i];
+        std::streamsize objectOffset = std::min(fileIndexEntry.uncompressedFileOffset, fileIndexEntry.uncompressedFileSize);
+
+        /* skip LogContainer, and the object pending in objectReader, which isn't selected */
+        if (actions[i] == LogContainerAction::Skip) {
+            objectReader.skip(objectReader.available());
+            continue;
+        }
+
+        /* read LogContainer */
+        inputFile.seekg(static_cast<std::streamoff>(fileIndexEntry.compressedFilePosition), std::ios_base::beg);
+        std::shared_ptr<LogContainer> logContainer(new LogContainer);
+        logContainer->read(inputFile);
+        if (!inputFile.good())
+            break;
+
+        /* pass through */
+        if (actions[i] == LogContainerAction::PassThrough) {
+            /* objects of previous LogContainers */
+            copyObjects(objectReader, startTimeStamp, endTimeStamp, false);
+
+            /* the rest is the beginning of an object, that continues into this LogContainer */
+            std::streamsize remaining = objectReader.available();
+            if ((remaining > 0) && (objectOffset > 0)) {
+                objectReader.copy(m_objectBuffer, remaining);
+                m_objectCount++;
+            } else
+                objectReader.skip(remaining);
+            flushObjectBuffer();
+
+            /* copy LogContainer */
+            writeLogContainer(*logContainer);
+            passedLogContainers++;
+            for (const auto & objectCount : fileIndexEntry.objectCounts)
+                m_objectCount += objectCount.second;
+            objectContinued = (i + 1 < logContainers.size()) && (logContainers[i + 1].uncompressedFileOffset > 0);
+            continue;
+        }
+
+        /* uncompress and append to objectReader */
+        bool objectPending = (objectReader.available() > 0);
+        logContainer->uncompress();
+        inflatedLogContainers++;
+        objectReader.append(logContainer);
+
+        if (objectContinued) {
+            /* copy the end of an object, that was passed through */
+            objectReader.copy(m_objectBuffer, objectOffset);
+            objectContinued = (objectOffset == fileIndexEntry.uncompressedFileSize);
+        } else if (!objectPending) {
+            /* skip the end of an object, that started in a skipped LogContainer */
+            objectReader.skip(objectOffset);
+        }
+
+        copyObjects(objectReader, startTimeStamp, endTimeStamp, false);
+    }
+    copyObjects(objectReader, startTimeStamp, endTimeStamp, true);
+
+    /* the index is only valid for this file */
+    fileIndex.logContainers.clear();
+}
+
+void FileSplicer::close() {
+    /* check */
+    if (!is_open())
+        return;
+
+    /* write remaining objects */
+    flushObjectBuffer();
+
+    /* set file statistics */
+    fileStatistics.fileSize = static_cast<uint64_t>(m_compressedFile.tellp());
+    fileStatistics.uncompressedFileSize = m_uncompressedFileSize;
+    fileStatistics.objectCount = m_objectCount;
+    fileStatistics.restorePointsOffset = 0;
+
+    /* write fileStatistics and close compressedFile */
+    m_compressedFile.seekp(0);
+    fileStatistics.write(m_compressedFile);
+    m_compressedFile.close();
+}
+
+void FileSplicer::takeOverFileStatistics(const FileStatistics & inputFileStatistics) {
+    /* time stamps are relative to measurementStartTime, so it can't change */
+    if (m_fileStatisticsTakenOver && (fileStatistics.measurementStartTime != inputFileStatistics.measurementStartTime))
+        throw Exception("FileSplicer::append(): File has another measurementStartTime.");
+
+    if (!m_fileStatisticsTakenOver) {
+        fileStatistics.apiNumber = inputFileStatistics.apiNumber;
+        fileStatistics.applicationId = inputFileStatistics.applicationId;
+        fileStatistics.compressionLevel = inputFileStatistics.compressionLevel;
+        fileStatistics.applicationMajor = inputFileStatistics.applicationMajor;
+        fileStatistics.applicationMinor = inputFileStatistics.applicationMinor;
+        fileStatistics.applicationBuild = inputFileStatistics.applicationBuild;
+        fileStatistics.measurementStartTime = inputFileStatistics.measurementStartTime;
+        m_fileStatisticsTakenOver = true;
+    }
+    fileStatistics.lastObjectTime = inputFileStatistics.lastObjectTime;
+}
+
+std::vector<FileSplicer::LogContainerAction> FileSplicer::logContainerActions(uint64_t startTimeStamp, uint64_t endTimeStamp) const {
+    const std::vector<FileIndexEntry> & logContainers = fileIndex.logContainers;
+    std::vector<LogContainerAction> actions(logContainers.size(), LogContainerAction::Skip);
+
+    /* some objects starting in the LogContainer are selected */
+    auto someSelected = [&](const FileIndexEntry & fileIndexEntry) -> bool {
+        return
+            (fileIndexEntry.uncompressedFileOffset < fileIndexEntry.uncompressedFileSize) &&
+            (fileIndexEntry.maxTimeStamp >= startTimeStamp) &&
+            (fileIndexEntry.minTimeStamp <= endTimeStamp);
+    };
+
+    /* all objects starting in the LogContainer are selected, also if it's only the middle of an object */
+    auto allSelected = [&](const FileIndexEntry & fileIndexEntry) -> bool {
+        if (fileIndexEntry.uncompressedFileOffset >= fileIndexEntry.uncompressedFileSize)
+            return (fileIndexEntry.uncompressedFileSize > 0);
+        return
+            (fileIndexEntry.minTimeStamp >= startTimeStamp) &&
+            (fileIndexEntry.maxTimeStamp <= endTimeStamp);
+    };
+
+    /* LogContainer, in which the object continuing into the next LogContainer starts */
+    const FileIndexEntry * objectStart = nullptr;
+
+    for (std::size_t i = 0; i < logContainers.size(); ++i) {
+        const FileIndexEntry & fileIndexEntry = logContainers[i];
+        bool objectContinued =
+            ((fileIndexEntry.uncompressedFileOffset > 0) || (fileIndexEntry.uncompressedFileSize == 0)) &&
+            (objectStart != nullptr);
+
+        /*
+         * A LogContainer is passed through, if all objects starting in it are selected,
+         * and the object continued from the previous LogContainer is selected as well.
+         * It's inflated, if some objects are selected, or the continued object might be.
+         */
+        if (allSelected(fileIndexEntry) && (!objectContinued || allSelected(*objectStart)))
+            actions[i] = LogContainerAction::PassThrough;
+        else if (someSelected(fileIndexEntry) || (objectContinued && someSelected(*objectStart)))
+            actions[i] = LogContainerAction::Inflate;
+
+        if (fileIndexEntry.uncompressedFileOffset < fileIndexEntry.uncompressedFileSize)
+            objectStart = &fileIndexEntry;
+    }
+
+    return actions;
+}
+
+void FileSplicer::copyObjects(ObjectReader & objectReader, uint64_t startTimeStamp, uint64_t endTimeStamp, bool allDataAppended) {
+    try {
+        ObjectHeaderBase ohb(0, ObjectType::UNKNOWN);
+        while (objectReader.peek(ohb, allDataAppended)) {
+            /* read object, keep the memory of the raw object */
+            m_rawObject.data.clear();
+            if (!objectReader.read(m_rawObject, ohb))
+                break;
+
+            /* copy selected object */
+            uint64_t timeStamp = m_rawObject.objectTimeStampNs();
+            if ((timeStamp >= startTimeStamp) && (timeStamp <= endTimeStamp)) {
+                m_rawObject.write(m_objectBuffer);
+                m_objectCount++;
+                if (m_objectBuffer.size() >= defaultLogContainerSize)
+                    flushObjectBuffer();
+            }
+        }
+    } catch (Vector::BLF::Exception &) {
+        /* copy stops at the first invalid object */
+    }
+}
+
+void FileSplicer::writeLogContainer(LogContainer & logContainer) {
+    /* write log container */
+    logContainer.write(m_compressedFile);
+
+    /* statistics */
+    m_uncompressedFileSize +=
+        logContainer.internalHeaderSize() +
+        logContainer.uncompressedFileSize;
+}
+
+void FileSplicer::flushObjectBuffer() {
+    /* check */
+    if (m_objectBuffer.size() == 0)
+        return;
+
+    /* copy data into LogContainer */
+    LogContainer logContainer;
+    logContainer.uncompressedFile.assign(m_objectBuffer.data(), m_objectBuffer.data() + m_objectBuffer.size());
+    logContainer.uncompressedFileSize = static_cast<uint32_t>(m_objectBuffer.size());
+    m_objectBuffer.clear();
+
+    /* compress */
+    if (compressionLevel == 0) {
+        /* no compression */
+        logContainer.compress(0, 0);
+    } else {
+        /* zlib compression */
+        logContainer.compress(2, compressionLevel);
+    }
+
+    /* write log container */
+    writeLogContainer(logContainer);
+}
+
+}
+}
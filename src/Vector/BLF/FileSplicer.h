@@ -0,0 +1,205 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <Vector/BLF/platform.h>
+
+#include <cstdint>
+#include <vector>
+
+#include <Vector/BLF/CompressedFile.h>
+#include <Vector/BLF/FileIndex.h>
+#include <Vector/BLF/FileStatistics.h>
+#include <Vector/BLF/LogContainer.h>
+#include <Vector/BLF/ObjectBuffer.h>
+#include <Vector/BLF/ObjectReader.h>
+#include <Vector/BLF/RawObject.h>
+
+#include <Vector/BLF/vector_blf_export.h>
+
+namespace Vector {
+namespace BLF {
+
+/**
+ * Cut and concatenate BLF files
+ *
+ * The output file is opened, then files or time ranges of files are
+ * appended, and at close the FileStatistics are fixed up.
+ *
+ * LogContainers, whose objects are all selected, are copied compressed,
+ * as they are in the input file. Only the LogContainers at the boundaries
+ * of a time range are inflated. Their selected objects are copied as
+ * RawObject into new LogContainers, which are deflated again.
+ *
+ * Object time stamps are copied unchanged, and they are relative to the
+ * measurementStartTime of their file. So all appended files need to have
+ * the same measurementStartTime, e.g. the parts of one measurement, that
+ * was logged into several files. Files with another measurementStartTime
+ * are rejected.
+ *
+ * This class is not thread-safe. It should only be accessed by one thread.
+ */
+class VECTOR_BLF_EXPORT FileSplicer final {
+  public:
+    FileSplicer() = default;
+    virtual ~FileSplicer();
+    FileSplicer(const FileSplicer &) = delete;
+    FileSplicer & operator=(const FileSplicer &) = delete;
+    FileSplicer(FileSplicer &&) = delete;
+    FileSplicer & operator=(FileSplicer &&) = delete;
+
+    /**
+     * Open output file.
+     *
+     * @param[in] filename file name
+     */
+    virtual void open(const char * filename);
+
+    /**
+     * is file open?
+     *
+     * @return true if file is open
+     */
+    virtual bool is_open() const;
+
+    /**
+     * Append all objects of a file.
+     *
+     * All LogContainers are copied without inflating them.
+     *
+     * An Exception is thrown, if the measurementStartTime differs from
+     * the one of the first appended file.
+     *
+     * @param[in] filename file name of the input file
+     */
+    virtual void append(const char * filename);
+
+    /**
+     * Append the objects of a file within a time range.
+     *
+     * The LogContainers are classified by fileIndex. If fileIndex doesn't
+     * belong to the input file, it's built first, which inflates the whole
+     * file once. So load the index before, to only inflate the boundary
+     * LogContainers.
+     *
+     * An Exception is thrown, if the measurementStartTime differs from
+     * the one of the first appended file.
+     *
+     * @param[in] filename file name of the input file
+     * @param[in] startTimeStamp first time stamp in ns (inclusive)
+     * @param[in] endTimeStamp last time stamp in ns (inclusive)
+     */
+    virtual void append(const char * filename, uint64_t startTimeStamp, uint64_t endTimeStamp);
+
+    /**
+     * Write remaining objects, fix up fileStatistics and close output file.
+     */
+    virtual void close();
+
+    /**
+     * file statistics of the output file
+     *
+     * Application, measurementStartTime and compressionLevel are taken over
+     * from the first appended file, lastObjectTime from the last appended
+     * file. Sizes and objectCount are set at close. Restore points are not
+     * written, so restorePointsOffset is 0.
+     */
+    FileStatistics fileStatistics {};
+
+    /**
+     * index of the next file appended with a time range
+     *
+     * It can be loaded (see FileIndex) before append is called.
+     */
+    FileIndex fileIndex {};
+
+    /**
+     * compression level of new LogContainers
+     *
+     * @see File::compressionLevel
+     */
+    int compressionLevel {1};
+
+    /** uncompressed size of new LogContainers */
+    uint32_t defaultLogContainerSize {0x20000};
+
+    /** number of LogContainers copied without inflating them */
+    uint32_t passedLogContainers {};
+
+    /** number of LogContainers inflated */
+    uint32_t inflatedLogContainers {};
+
+  private:
+    /** output file */
+    CompressedFile m_compressedFile {};
+
+    /** file statistics were taken over from an input file */
+    bool m_fileStatisticsTakenOver {false};
+
+    /** objects of the next new LogContainer */
+    ObjectBuffer m_objectBuffer {};
+
+    /** raw object to copy objects */
+    RawObject m_rawObject {};
+
+    /** handling of a LogContainer, when appending a time range */
+    enum class LogContainerAction : uint8_t {
+        /** no object is selected, so it's not read */
+        Skip,
+
+        /** some objects are selected, so it's inflated */
+        Inflate,
+
+        /** all objects are selected, so it's copied as it is */
+        PassThrough
+    };
+
+    /** current uncompressed file size */
+    uint64_t m_uncompressedFileSize {};
+
+    /** current object count */
+    uint32_t m_objectCount {};
+
+    /**
+     * Take over file statistics of an input file.
+     *
+     * @param[in] inputFileStatistics file statistics of the input file
+     */
+    void takeOverFileStatistics(const FileStatistics & inputFileStatistics);
+
+    /**
+     * Classify the LogContainers in fileIndex for a time range.
+     *
+     * @param[in] startTimeStamp first time stamp in ns (inclusive)
+     * @param[in] endTimeStamp last time stamp in ns (inclusive)
+     * @return actions in the order of the LogContainers
+     */
+    std::vector<LogContainerAction> logContainerActions(uint64_t startTimeStamp, uint64_t endTimeStamp) const;
+
+    /**
+     * Copy the objects within a time range, that are available in an ObjectReader.
+     *
+     * @param[in] objectReader objects of the inflated LogContainers
+     * @param[in] startTimeStamp first time stamp in ns (inclusive)
+     * @param[in] endTimeStamp last time stamp in ns (inclusive)
+     * @param[in] allDataAppended no more LogContainers will be appended to objectReader
+     */
+    void copyObjects(ObjectReader & objectReader, uint64_t startTimeStamp, uint64_t endTimeStamp, bool allDataAppended);
+
+    /**
+     * Write a LogContainer, as it is, into the output file.
+     *
+     * @param[in] logContainer log container
+     */
+    void writeLogContainer(LogContainer & logContainer);
+
+    /**
+     * Write objects pending in m_objectBuffer as new LogContainer.
+     */
+    void flushObjectBuffer();
+};
+
+}
+}
@@ -12,6 +12,22 @@
 namespace Vector {
 namespace BLF {
 
+bool operator==(const SYSTEMTIME & lhs, const SYSTEMTIME & rhs) {
+    return
+        (lhs.year == rhs.year) &&
+        (lhs.month == rhs.month) &&
+        (lhs.dayOfWeek == rhs.dayOfWeek) &&
+        (lhs.day == rhs.day) &&
+        (lhs.hour == rhs.hour) &&
+        (lhs.minute == rhs.minute) &&
+        (lhs.second == rhs.second) &&
+        (lhs.milliseconds == rhs.milliseconds);
+}
+
+bool operator!=(const SYSTEMTIME & lhs, const SYSTEMTIME & rhs) {
+    return !(lhs == rhs);
+}
+
 void FileStatistics::read(AbstractFile & is) {
     is.read(reinterpret_cast<char *>(&signature), sizeof(signature));
     if (signature != FileSignature)
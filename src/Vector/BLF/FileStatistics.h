@@ -97,6 +97,24 @@ struct SYSTEMTIME {
     uint16_t milliseconds;
 };
 
+/**
+ * Compare system times.
+ *
+ * @param[in] lhs system time
+ * @param[in] rhs system time
+ * @return true if all fields are equal
+ */
+VECTOR_BLF_EXPORT bool operator==(const SYSTEMTIME & lhs, const SYSTEMTIME & rhs);
+
+/**
+ * Compare system times.
+ *
+ * @param[in] lhs system time
+ * @param[in] rhs system time
+ * @return true if any field differs
+ */
+VECTOR_BLF_EXPORT bool operator!=(const SYSTEMTIME & lhs, const SYSTEMTIME & rhs);
+
 /**
  * File statistics
  */
@@ -4,51 +4,41 @@
 
 #include <Vector/BLF/FlexRayData.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of FlexRayData from channel to dataBytes */
+using FlexRayDataFields = Fields<
+    VECTOR_BLF_FIELD(FlexRayData, channel),
+    VECTOR_BLF_FIELD(FlexRayData, mux),
+    VECTOR_BLF_FIELD(FlexRayData, len),
+    VECTOR_BLF_FIELD(FlexRayData, messageId),
+    VECTOR_BLF_FIELD(FlexRayData, crc),
+    VECTOR_BLF_FIELD(FlexRayData, dir),
+    VECTOR_BLF_FIELD(FlexRayData, reservedFlexRayData1),
+    VECTOR_BLF_FIELD(FlexRayData, reservedFlexRayData2),
+    VECTOR_BLF_FIELD(FlexRayData, dataBytes)>;
+
 FlexRayData::FlexRayData() :
     ObjectHeader(ObjectType::FLEXRAY_DATA) {
 }
 
 void FlexRayData::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&mux), sizeof(mux));
-    is.read(reinterpret_cast<char *>(&len), sizeof(len));
-    is.read(reinterpret_cast<char *>(&messageId), sizeof(messageId));
-    is.read(reinterpret_cast<char *>(&crc), sizeof(crc));
-    is.read(reinterpret_cast<char *>(&dir), sizeof(dir));
-    is.read(reinterpret_cast<char *>(&reservedFlexRayData1), sizeof(reservedFlexRayData1));
-    is.read(reinterpret_cast<char *>(&reservedFlexRayData2), sizeof(reservedFlexRayData2));
-    is.read(reinterpret_cast<char *>(dataBytes.data()), static_cast<std::streamsize>(dataBytes.size()));
+    FlexRayDataFields::read(is, *this);
 }
 
 void FlexRayData::write(AbstractFile & os) {
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&mux), sizeof(mux));
-    os.write(reinterpret_cast<char *>(&len), sizeof(len));
-    os.write(reinterpret_cast<char *>(&messageId), sizeof(messageId));
-    os.write(reinterpret_cast<char *>(&crc), sizeof(crc));
-    os.write(reinterpret_cast<char *>(&dir), sizeof(dir));
-    os.write(reinterpret_cast<char *>(&reservedFlexRayData1), sizeof(reservedFlexRayData1));
-    os.write(reinterpret_cast<char *>(&reservedFlexRayData2), sizeof(reservedFlexRayData2));
-    os.write(reinterpret_cast<char *>(dataBytes.data()), static_cast<std::streamsize>(dataBytes.size()));
+    FlexRayDataFields::write(os, *this);
 }
 
 uint32_t FlexRayData::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        sizeof(channel) +
-        sizeof(mux) +
-        sizeof(len) +
-        sizeof(messageId) +
-        sizeof(crc) +
-        sizeof(dir) +
-        sizeof(reservedFlexRayData1) +
-        sizeof(reservedFlexRayData2) +
-        static_cast<uint32_t>(dataBytes.size());
+        FlexRayDataFields::size();
 }
 
 }
@@ -4,54 +4,42 @@
 
 #include <Vector/BLF/FlexRaySync.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of FlexRaySync from channel to cycle */
+using FlexRaySyncFields = Fields<
+    VECTOR_BLF_FIELD(FlexRaySync, channel),
+    VECTOR_BLF_FIELD(FlexRaySync, mux),
+    VECTOR_BLF_FIELD(FlexRaySync, len),
+    VECTOR_BLF_FIELD(FlexRaySync, messageId),
+    VECTOR_BLF_FIELD(FlexRaySync, crc),
+    VECTOR_BLF_FIELD(FlexRaySync, dir),
+    VECTOR_BLF_FIELD(FlexRaySync, reservedFlexRaySync1),
+    VECTOR_BLF_FIELD(FlexRaySync, reservedFlexRaySync2),
+    VECTOR_BLF_FIELD(FlexRaySync, dataBytes),
+    VECTOR_BLF_FIELD(FlexRaySync, cycle)>;
+
 FlexRaySync::FlexRaySync() :
     ObjectHeader(ObjectType::FLEXRAY_SYNC) {
 }
 
 void FlexRaySync::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&mux), sizeof(mux));
-    is.read(reinterpret_cast<char *>(&len), sizeof(len));
-    is.read(reinterpret_cast<char *>(&messageId), sizeof(messageId));
-    is.read(reinterpret_cast<char *>(&crc), sizeof(crc));
-    is.read(reinterpret_cast<char *>(&dir), sizeof(dir));
-    is.read(reinterpret_cast<char *>(&reservedFlexRaySync1), sizeof(reservedFlexRaySync1));
-    is.read(reinterpret_cast<char *>(&reservedFlexRaySync2), sizeof(reservedFlexRaySync2));
-    is.read(reinterpret_cast<char *>(dataBytes.data()), static_cast<std::streamsize>(dataBytes.size()));
-    is.read(reinterpret_cast<char *>(&cycle), sizeof(cycle));
+    FlexRaySyncFields::read(is, *this);
 }
 
 void FlexRaySync::write(AbstractFile & os) {
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&mux), sizeof(mux));
-    os.write(reinterpret_cast<char *>(&len), sizeof(len));
-    os.write(reinterpret_cast<char *>(&messageId), sizeof(messageId));
-    os.write(reinterpret_cast<char *>(&crc), sizeof(crc));
-    os.write(reinterpret_cast<char *>(&dir), sizeof(dir));
-    os.write(reinterpret_cast<char *>(&reservedFlexRaySync1), sizeof(reservedFlexRaySync1));
-    os.write(reinterpret_cast<char *>(&reservedFlexRaySync2), sizeof(reservedFlexRaySync2));
-    os.write(reinterpret_cast<char *>(dataBytes.data()), static_cast<std::streamsize>(dataBytes.size()));
-    os.write(reinterpret_cast<char *>(&cycle), sizeof(cycle));
+    FlexRaySyncFields::write(os, *this);
 }
 
 uint32_t FlexRaySync::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        sizeof(channel) +
-        sizeof(mux) +
-        sizeof(len) +
-        sizeof(messageId) +
-        sizeof(crc) +
-        sizeof(dir) +
-        sizeof(reservedFlexRaySync1) +
-        sizeof(reservedFlexRaySync2) +
-        static_cast<uint32_t>(dataBytes.size()) +
-        sizeof(cycle);
+        FlexRaySyncFields::size();
 }
 
 }
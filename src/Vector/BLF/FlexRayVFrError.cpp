@@ -4,54 +4,42 @@
 
 #include <Vector/BLF/FlexRayVFrError.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of FlexRayVFrError from channel to reservedFlexRayVFrError2 */
+using FlexRayVFrErrorFields = Fields<
+    VECTOR_BLF_FIELD(FlexRayVFrError, channel),
+    VECTOR_BLF_FIELD(FlexRayVFrError, version),
+    VECTOR_BLF_FIELD(FlexRayVFrError, channelMask),
+    VECTOR_BLF_FIELD(FlexRayVFrError, cycle),
+    VECTOR_BLF_FIELD(FlexRayVFrError, reservedFlexRayVFrError1),
+    VECTOR_BLF_FIELD(FlexRayVFrError, clientIndexFlexRayVFrError),
+    VECTOR_BLF_FIELD(FlexRayVFrError, clusterNo),
+    VECTOR_BLF_FIELD(FlexRayVFrError, tag),
+    VECTOR_BLF_FIELD(FlexRayVFrError, data),
+    VECTOR_BLF_FIELD(FlexRayVFrError, reservedFlexRayVFrError2)>;
+
 FlexRayVFrError::FlexRayVFrError() :
     ObjectHeader(ObjectType::FR_ERROR) {
 }
 
 void FlexRayVFrError::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&version), sizeof(version));
-    is.read(reinterpret_cast<char *>(&channelMask), sizeof(channelMask));
-    is.read(reinterpret_cast<char *>(&cycle), sizeof(cycle));
-    is.read(reinterpret_cast<char *>(&reservedFlexRayVFrError1), sizeof(reservedFlexRayVFrError1));
-    is.read(reinterpret_cast<char *>(&clientIndexFlexRayVFrError), sizeof(clientIndexFlexRayVFrError));
-    is.read(reinterpret_cast<char *>(&clusterNo), sizeof(clusterNo));
-    is.read(reinterpret_cast<char *>(&tag), sizeof(tag));
-    is.read(reinterpret_cast<char *>(data.data()), static_cast<std::streamsize>(data.size() * sizeof(uint32_t)));
-    is.read(reinterpret_cast<char *>(&reservedFlexRayVFrError2), sizeof(reservedFlexRayVFrError2));
+    FlexRayVFrErrorFields::read(is, *this);
 }
 
 void FlexRayVFrError::write(AbstractFile & os) {
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&version), sizeof(version));
-    os.write(reinterpret_cast<char *>(&channelMask), sizeof(channelMask));
-    os.write(reinterpret_cast<char *>(&cycle), sizeof(cycle));
-    os.write(reinterpret_cast<char *>(&reservedFlexRayVFrError1), sizeof(reservedFlexRayVFrError1));
-    os.write(reinterpret_cast<char *>(&clientIndexFlexRayVFrError), sizeof(clientIndexFlexRayVFrError));
-    os.write(reinterpret_cast<char *>(&clusterNo), sizeof(clusterNo));
-    os.write(reinterpret_cast<char *>(&tag), sizeof(tag));
-    os.write(reinterpret_cast<char *>(data.data()), static_cast<std::streamsize>(data.size() * sizeof(uint32_t)));
-    os.write(reinterpret_cast<char *>(&reservedFlexRayVFrError2), sizeof(reservedFlexRayVFrError2));
+    FlexRayVFrErrorFields::write(os, *this);
 }
 
 uint32_t FlexRayVFrError::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        sizeof(channel) +
-        sizeof(version) +
-        sizeof(channelMask) +
-        sizeof(cycle) +
-        sizeof(reservedFlexRayVFrError1) +
-        sizeof(clientIndexFlexRayVFrError) +
-        sizeof(clusterNo) +
-        sizeof(tag) +
-        static_cast<uint32_t>(data.size() * sizeof(uint32_t)) +
-        sizeof(reservedFlexRayVFrError2);
+        FlexRayVFrErrorFields::size();
 }
 
 }
@@ -4,37 +4,43 @@
 
 #include <Vector/BLF/FlexRayVFrReceiveMsgEx.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of FlexRayVFrReceiveMsgEx from channel to reservedFlexRayVFrReceiveMsgEx1 */
+using FlexRayVFrReceiveMsgExFields = Fields<
+    VECTOR_BLF_FIELD(FlexRayVFrReceiveMsgEx, channel),
+    VECTOR_BLF_FIELD(FlexRayVFrReceiveMsgEx, version),
+    VECTOR_BLF_FIELD(FlexRayVFrReceiveMsgEx, channelMask),
+    VECTOR_BLF_FIELD(FlexRayVFrReceiveMsgEx, dir),
+    VECTOR_BLF_FIELD(FlexRayVFrReceiveMsgEx, clientIndexFlexRayVFrReceiveMsgEx),
+    VECTOR_BLF_FIELD(FlexRayVFrReceiveMsgEx, clusterNo),
+    VECTOR_BLF_FIELD(FlexRayVFrReceiveMsgEx, frameId),
+    VECTOR_BLF_FIELD(FlexRayVFrReceiveMsgEx, headerCrc1),
+    VECTOR_BLF_FIELD(FlexRayVFrReceiveMsgEx, headerCrc2),
+    VECTOR_BLF_FIELD(FlexRayVFrReceiveMsgEx, byteCount),
+    VECTOR_BLF_FIELD(FlexRayVFrReceiveMsgEx, dataCount),
+    VECTOR_BLF_FIELD(FlexRayVFrReceiveMsgEx, cycle),
+    VECTOR_BLF_FIELD(FlexRayVFrReceiveMsgEx, tag),
+    VECTOR_BLF_FIELD(FlexRayVFrReceiveMsgEx, data),
+    VECTOR_BLF_FIELD(FlexRayVFrReceiveMsgEx, frameFlags),
+    VECTOR_BLF_FIELD(FlexRayVFrReceiveMsgEx, appParameter),
+    VECTOR_BLF_FIELD(FlexRayVFrReceiveMsgEx, frameCrc),
+    VECTOR_BLF_FIELD(FlexRayVFrReceiveMsgEx, frameLengthNs),
+    VECTOR_BLF_FIELD(FlexRayVFrReceiveMsgEx, frameId1),
+    VECTOR_BLF_FIELD(FlexRayVFrReceiveMsgEx, pduOffset),
+    VECTOR_BLF_FIELD(FlexRayVFrReceiveMsgEx, blfLogMask),
+    VECTOR_BLF_FIELD(FlexRayVFrReceiveMsgEx, reservedFlexRayVFrReceiveMsgEx1)>;
+
 FlexRayVFrReceiveMsgEx::FlexRayVFrReceiveMsgEx() :
     ObjectHeader(ObjectType::FR_RCVMESSAGE_EX) {
 }
 
 void FlexRayVFrReceiveMsgEx::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&version), sizeof(version));
-    is.read(reinterpret_cast<char *>(&channelMask), sizeof(channelMask));
-    is.read(reinterpret_cast<char *>(&dir), sizeof(dir));
-    is.read(reinterpret_cast<char *>(&clientIndexFlexRayVFrReceiveMsgEx), sizeof(clientIndexFlexRayVFrReceiveMsgEx));
-    is.read(reinterpret_cast<char *>(&clusterNo), sizeof(clusterNo));
-    is.read(reinterpret_cast<char *>(&frameId), sizeof(frameId));
-    is.read(reinterpret_cast<char *>(&headerCrc1), sizeof(headerCrc1));
-    is.read(reinterpret_cast<char *>(&headerCrc2), sizeof(headerCrc2));
-    is.read(reinterpret_cast<char *>(&byteCount), sizeof(byteCount));
-    is.read(reinterpret_cast<char *>(&dataCount), sizeof(dataCount));
-    is.read(reinterpret_cast<char *>(&cycle), sizeof(cycle));
-    is.read(reinterpret_cast<char *>(&tag), sizeof(tag));
-    is.read(reinterpret_cast<char *>(&data), sizeof(data));
-    is.read(reinterpret_cast<char *>(&frameFlags), sizeof(frameFlags));
-    is.read(reinterpret_cast<char *>(&appParameter), sizeof(appParameter));
-    is.read(reinterpret_cast<char *>(&frameCrc), sizeof(frameCrc));
-    is.read(reinterpret_cast<char *>(&frameLengthNs), sizeof(frameLengthNs));
-    is.read(reinterpret_cast<char *>(&frameId1), sizeof(frameId1));
-    is.read(reinterpret_cast<char *>(&pduOffset), sizeof(pduOffset));
-    is.read(reinterpret_cast<char *>(&blfLogMask), sizeof(blfLogMask));
-    is.read(reinterpret_cast<char *>(reservedFlexRayVFrReceiveMsgEx1.data()), static_cast<std::streamsize>(reservedFlexRayVFrReceiveMsgEx1.size() * sizeof(uint16_t)));
+    FlexRayVFrReceiveMsgExFields::read(is, *this);
     dataBytes.resize(dataCount);
     is.read(reinterpret_cast<char *>(dataBytes.data()), static_cast<std::streamsize>(dataCount));
     reservedFlexRayVFrReceiveMsgEx2.resize(objectSize - calculateObjectSize()); // all remaining data
@@ -46,28 +52,7 @@ void FlexRayVFrReceiveMsgEx::write(AbstractFile & os) {
     dataCount = static_cast<uint16_t>(dataBytes.size());
 
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&version), sizeof(version));
-    os.write(reinterpret_cast<char *>(&channelMask), sizeof(channelMask));
-    os.write(reinterpret_cast<char *>(&dir), sizeof(dir));
-    os.write(reinterpret_cast<char *>(&clientIndexFlexRayVFrReceiveMsgEx), sizeof(clientIndexFlexRayVFrReceiveMsgEx));
-    os.write(reinterpret_cast<char *>(&clusterNo), sizeof(clusterNo));
-    os.write(reinterpret_cast<char *>(&frameId), sizeof(frameId));
-    os.write(reinterpret_cast<char *>(&headerCrc1), sizeof(headerCrc1));
-    os.write(reinterpret_cast<char *>(&headerCrc2), sizeof(headerCrc2));
-    os.write(reinterpret_cast<char *>(&byteCount), sizeof(byteCount));
-    os.write(reinterpret_cast<char *>(&dataCount), sizeof(dataCount));
-    os.write(reinterpret_cast<char *>(&cycle), sizeof(cycle));
-    os.write(reinterpret_cast<char *>(&tag), sizeof(tag));
-    os.write(reinterpret_cast<char *>(&data), sizeof(data));
-    os.write(reinterpret_cast<char *>(&frameFlags), sizeof(frameFlags));
-    os.write(reinterpret_cast<char *>(&appParameter), sizeof(appParameter));
-    os.write(reinterpret_cast<char *>(&frameCrc), sizeof(frameCrc));
-    os.write(reinterpret_cast<char *>(&frameLengthNs), sizeof(frameLengthNs));
-    os.write(reinterpret_cast<char *>(&frameId1), sizeof(frameId1));
-    os.write(reinterpret_cast<char *>(&pduOffset), sizeof(pduOffset));
-    os.write(reinterpret_cast<char *>(&blfLogMask), sizeof(blfLogMask));
-    os.write(reinterpret_cast<char *>(reservedFlexRayVFrReceiveMsgEx1.data()), static_cast<std::streamsize>(reservedFlexRayVFrReceiveMsgEx1.size() * sizeof(uint16_t)));
+    FlexRayVFrReceiveMsgExFields::write(os, *this);
     os.write(reinterpret_cast<char *>(dataBytes.data()), static_cast<std::streamsize>(dataCount));
     os.write(reinterpret_cast<char *>(reservedFlexRayVFrReceiveMsgEx2.data()), static_cast<std::streamsize>(reservedFlexRayVFrReceiveMsgEx2.size()));
 }
@@ -75,28 +60,7 @@ void FlexRayVFrReceiveMsgEx::write(AbstractFile & os) {
 uint32_t FlexRayVFrReceiveMsgEx::calculateObjectSize() const {
     uint32_t size =
         ObjectHeader::calculateObjectSize() +
-        sizeof(channel) +
-        sizeof(version) +
-        sizeof(channelMask) +
-        sizeof(dir) +
-        sizeof(clientIndexFlexRayVFrReceiveMsgEx) +
-        sizeof(clusterNo) +
-        sizeof(frameId) +
-        sizeof(headerCrc1) +
-        sizeof(headerCrc2) +
-        sizeof(byteCount) +
-        sizeof(dataCount) +
-        sizeof(cycle) +
-        sizeof(tag) +
-        sizeof(data) +
-        sizeof(frameFlags) +
-        sizeof(appParameter) +
-        sizeof(frameCrc) +
-        sizeof(frameLengthNs) +
-        sizeof(frameId1) +
-        sizeof(pduOffset) +
-        sizeof(blfLogMask) +
-        static_cast<uint32_t>(reservedFlexRayVFrReceiveMsgEx1.size() * sizeof(uint16_t)) +
+        FlexRayVFrReceiveMsgExFields::size() +
         dataCount +
         static_cast<uint32_t>(reservedFlexRayVFrReceiveMsgEx2.size());
 
@@ -10,6 +10,7 @@
 #include <vector>
 
 #include <Vector/BLF/AbstractFile.h>
+#include <Vector/BLF/InlineVector.h>
 #include <Vector/BLF/ObjectHeader.h>
 
 #include <Vector/BLF/vector_blf_export.h>
@@ -292,7 +293,7 @@ struct VECTOR_BLF_EXPORT FlexRayVFrReceiveMsgEx final : ObjectHeader {
      *
      * Payload
      */
-    std::vector<uint8_t> dataBytes {};
+    InlineVector<uint8_t, 254> dataBytes {};
 
     /** reserved */
     std::vector<uint8_t> reservedFlexRayVFrReceiveMsgEx2 {};
@@ -5,64 +5,45 @@
 #include <Vector/BLF/FlexRayVFrStartCycle.h>
 
 #include <Vector/BLF/AbstractFile.h>
+#include <Vector/BLF/Fields.h>
 
 namespace Vector {
 namespace BLF {
 
+/** fields of FlexRayVFrStartCycle from channel to reservedFlexRayVFrStartCycle2 */
+using FlexRayVFrStartCycleFields = Fields<
+    VECTOR_BLF_FIELD(FlexRayVFrStartCycle, channel),
+    VECTOR_BLF_FIELD(FlexRayVFrStartCycle, version),
+    VECTOR_BLF_FIELD(FlexRayVFrStartCycle, channelMask),
+    VECTOR_BLF_FIELD(FlexRayVFrStartCycle, dir),
+    VECTOR_BLF_FIELD(FlexRayVFrStartCycle, cycle),
+    VECTOR_BLF_FIELD(FlexRayVFrStartCycle, clientIndexFlexRayVFrStartCycle),
+    VECTOR_BLF_FIELD(FlexRayVFrStartCycle, clusterNo),
+    VECTOR_BLF_FIELD(FlexRayVFrStartCycle, nmSize),
+    VECTOR_BLF_FIELD(FlexRayVFrStartCycle, dataBytes),
+    VECTOR_BLF_FIELD(FlexRayVFrStartCycle, reservedFlexRayVFrStartCycle1),
+    VECTOR_BLF_FIELD(FlexRayVFrStartCycle, tag),
+    VECTOR_BLF_FIELD(FlexRayVFrStartCycle, data),
+    VECTOR_BLF_FIELD(FlexRayVFrStartCycle, reservedFlexRayVFrStartCycle2)>;
+
 FlexRayVFrStartCycle::FlexRayVFrStartCycle() :
     ObjectHeader(ObjectType::FR_STARTCYCLE) {
 }
 
 void FlexRayVFrStartCycle::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&version), sizeof(version));
-    is.read(reinterpret_cast<char *>(&channelMask), sizeof(channelMask));
-    is.read(reinterpret_cast<char *>(&dir), sizeof(dir));
-    is.read(reinterpret_cast<char *>(&cycle), sizeof(cycle));
-    is.read(reinterpret_cast<char *>(&clientIndexFlexRayVFrStartCycle), sizeof(clientIndexFlexRayVFrStartCycle));
-    is.read(reinterpret_cast<char *>(&clusterNo), sizeof(clusterNo));
-    is.read(reinterpret_cast<char *>(&nmSize), sizeof(nmSize));
-    is.read(reinterpret_cast<char *>(dataBytes.data()), static_cast<std::streamsize>(dataBytes.size()));
-    is.read(reinterpret_cast<char *>(&reservedFlexRayVFrStartCycle1), sizeof(reservedFlexRayVFrStartCycle1));
-    is.read(reinterpret_cast<char *>(&tag), sizeof(tag));
-    is.read(reinterpret_cast<char *>(data.data()), static_cast<std::streamsize>(data.size() * sizeof(uint32_t)));
-    is.read(reinterpret_cast<char *>(&reservedFlexRayVFrStartCycle2), sizeof(reservedFlexRayVFrStartCycle2));
+    FlexRayVFrStartCycleFields::read(is, *this);
 }
 
 void FlexRayVFrStartCycle::write(AbstractFile & os) {
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&version), sizeof(version));
-    os.write(reinterpret_cast<char *>(&channelMask), sizeof(channelMask));
-    os.write(reinterpret_cast<char *>(&dir), sizeof(dir));
-    os.write(reinterpret_cast<char *>(&cycle), sizeof(cycle));
-    os.write(reinterpret_cast<char *>(&clientIndexFlexRayVFrStartCycle), sizeof(clientIndexFlexRayVFrStartCycle));
-    os.write(reinterpret_cast<char *>(&clusterNo), sizeof(clusterNo));
-    os.write(reinterpret_cast<char *>(&nmSize), sizeof(nmSize));
-    os.write(reinterpret_cast<char *>(dataBytes.data()), static_cast<std::streamsize>(dataBytes.size()));
-    os.write(reinterpret_cast<char *>(&reservedFlexRayVFrStartCycle1), sizeof(reservedFlexRayVFrStartCycle1));
-    os.write(reinterpret_cast<char *>(&tag), sizeof(tag));
-    os.write(reinterpret_cast<char *>(data.data()), static_cast<std::streamsize>(data.size() * sizeof(uint32_t)));
-    os.write(reinterpret_cast<char *>(&reservedFlexRayVFrStartCycle2), sizeof(reservedFlexRayVFrStartCycle2));
+    FlexRayVFrStartCycleFields::write(os, *this);
 }
 
 uint32_t FlexRayVFrStartCycle::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        sizeof(channel) +
-        sizeof(version) +
-        sizeof(channelMask) +
-        sizeof(dir) +
-        sizeof(cycle) +
-        sizeof(clientIndexFlexRayVFrStartCycle) +
-        sizeof(clusterNo) +
-        sizeof(nmSize) +
-        static_cast<uint32_t>(dataBytes.size()) +
-        sizeof(reservedFlexRayVFrStartCycle1) +
-        sizeof(tag) +
-        static_cast<uint32_t>(data.size() * sizeof(uint32_t)) +
-        sizeof(reservedFlexRayVFrStartCycle2);
+        FlexRayVFrStartCycleFields::size();
 }
 
 }
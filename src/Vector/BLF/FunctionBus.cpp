@@ -4,46 +4,51 @@
 
 #include <Vector/BLF/FunctionBus.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of FunctionBus from functionBusObjectType to dataLength */
+using FunctionBusFields = Fields<
+    VECTOR_BLF_FIELD(FunctionBus, functionBusObjectType),
+    VECTOR_BLF_FIELD(FunctionBus, veType),
+    VECTOR_BLF_FIELD(FunctionBus, nameLength),
+    VECTOR_BLF_FIELD(FunctionBus, dataLength)>;
+
 FunctionBus::FunctionBus() :
     ObjectHeader(ObjectType::FUNCTION_BUS) {
 }
 
 void FunctionBus::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&functionBusObjectType), sizeof(functionBusObjectType));
-    is.read(reinterpret_cast<char *>(&veType), sizeof(veType));
-    is.read(reinterpret_cast<char *>(&nameLength), sizeof(nameLength));
-    is.read(reinterpret_cast<char *>(&dataLength), sizeof(dataLength));
+    FunctionBusFields::read(is, *this);
     name.resize(nameLength);
     is.read(const_cast<char *>(name.data()), nameLength);
-    data.resize(dataLength);
-    is.read(reinterpret_cast<char *>(data.data()), dataLength);
+    dataView = is.readPayload(dataLength);
+    if (dataView.data() == nullptr) {
+        data.resize(dataLength);
+        is.read(reinterpret_cast<char *>(data.data()), dataLength);
+    } else {
+        data.clear();
+    }
 }
 
 void FunctionBus::write(AbstractFile & os) {
     /* pre processing */
     nameLength = static_cast<uint32_t>(name.size());
-    dataLength = static_cast<uint32_t>(data.size());
+    dataLength = static_cast<uint32_t>(PayloadView::sizeOf(data, dataView));
 
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&functionBusObjectType), sizeof(functionBusObjectType));
-    os.write(reinterpret_cast<char *>(&veType), sizeof(veType));
-    os.write(reinterpret_cast<char *>(&nameLength), sizeof(nameLength));
-    os.write(reinterpret_cast<char *>(&dataLength), sizeof(dataLength));
+    FunctionBusFields::write(os, *this);
     os.write(const_cast<char *>(name.data()), nameLength);
-    os.write(reinterpret_cast<char *>(data.data()), dataLength);
+    os.write(reinterpret_cast<const char *>(PayloadView::dataOf(data, dataView)), dataLength);
 }
 
 uint32_t FunctionBus::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        sizeof(functionBusObjectType) +
-        sizeof(veType) +
-        sizeof(nameLength) +
-        sizeof(dataLength) +
+        FunctionBusFields::size() +
         nameLength +
         dataLength;
 }
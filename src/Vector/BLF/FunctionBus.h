@@ -10,6 +10,7 @@
 
 #include <Vector/BLF/AbstractFile.h>
 #include <Vector/BLF/ObjectHeader.h>
+#include <Vector/BLF/PayloadView.h>
 
 #include <Vector/BLF/vector_blf_export.h>
 
@@ -50,6 +51,13 @@ struct VECTOR_BLF_EXPORT FunctionBus final : ObjectHeader {
 
     /** variable data */
     std::vector<uint8_t> data {};
+
+    /**
+     * view of data, if read with File::lazyPayloads
+     *
+     * data is empty then. On write, data is used, unless it is empty.
+     */
+    PayloadView dataView {};
 };
 
 }
@@ -4,13 +4,19 @@
 
 #include <Vector/BLF/GeneralSerialEvent.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of GeneralSerialEvent from dataLength to reservedGeneralSerialEvent */
+using GeneralSerialEventFields = Fields<
+    VECTOR_BLF_FIELD(GeneralSerialEvent, dataLength),
+    VECTOR_BLF_FIELD(GeneralSerialEvent, timeStampsLength),
+    VECTOR_BLF_FIELD(GeneralSerialEvent, reservedGeneralSerialEvent)>;
+
 void GeneralSerialEvent::read(AbstractFile & is) {
-    is.read(reinterpret_cast<char *>(&dataLength), sizeof(dataLength));
-    is.read(reinterpret_cast<char *>(&timeStampsLength), sizeof(timeStampsLength));
-    is.read(reinterpret_cast<char *>(&reservedGeneralSerialEvent), sizeof(reservedGeneralSerialEvent));
+    GeneralSerialEventFields::read(is, *this);
     data.resize(dataLength);
     is.read(reinterpret_cast<char *>(data.data()), dataLength);
     timeStamps.resize(timeStampsLength / sizeof(int64_t));
@@ -23,18 +29,14 @@ void GeneralSerialEvent::write(AbstractFile & os) {
     dataLength = static_cast<uint32_t>(data.size());
     timeStampsLength = static_cast<uint32_t>(timeStamps.size() * sizeof(int64_t));
 
-    os.write(reinterpret_cast<char *>(&dataLength), sizeof(dataLength));
-    os.write(reinterpret_cast<char *>(&timeStampsLength), sizeof(timeStampsLength));
-    os.write(reinterpret_cast<char *>(&reservedGeneralSerialEvent), sizeof(reservedGeneralSerialEvent));
+    GeneralSerialEventFields::write(os, *this);
     os.write(reinterpret_cast<char *>(data.data()), dataLength);
     os.write(reinterpret_cast<char *>(timeStamps.data()), timeStampsLength);
 }
 
 uint32_t GeneralSerialEvent::calculateObjectSize() const {
     return
-        sizeof(dataLength) +
-        sizeof(timeStampsLength) +
-        sizeof(reservedGeneralSerialEvent) +
+        GeneralSerialEventFields::size() +
         dataLength +
         timeStampsLength;
 }
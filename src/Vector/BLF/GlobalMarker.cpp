@@ -6,26 +6,32 @@
 
 #include <Vector/BLF/GlobalMarker.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of GlobalMarker from commentedEventType to reservedGlobalMarker4 */
+using GlobalMarkerFields = Fields<
+    VECTOR_BLF_FIELD(GlobalMarker, commentedEventType),
+    VECTOR_BLF_FIELD(GlobalMarker, foregroundColor),
+    VECTOR_BLF_FIELD(GlobalMarker, backgroundColor),
+    VECTOR_BLF_FIELD(GlobalMarker, isRelocatable),
+    VECTOR_BLF_FIELD(GlobalMarker, reservedGlobalMarker1),
+    VECTOR_BLF_FIELD(GlobalMarker, reservedGlobalMarker2),
+    VECTOR_BLF_FIELD(GlobalMarker, groupNameLength),
+    VECTOR_BLF_FIELD(GlobalMarker, markerNameLength),
+    VECTOR_BLF_FIELD(GlobalMarker, descriptionLength),
+    VECTOR_BLF_FIELD(GlobalMarker, reservedGlobalMarker3),
+    VECTOR_BLF_FIELD(GlobalMarker, reservedGlobalMarker4)>;
+
 GlobalMarker::GlobalMarker() :
     ObjectHeader(ObjectType::GLOBAL_MARKER) {
 }
 
 void GlobalMarker::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&commentedEventType), sizeof(commentedEventType));
-    is.read(reinterpret_cast<char *>(&foregroundColor), sizeof(foregroundColor));
-    is.read(reinterpret_cast<char *>(&backgroundColor), sizeof(backgroundColor));
-    is.read(reinterpret_cast<char *>(&isRelocatable), sizeof(isRelocatable));
-    is.read(reinterpret_cast<char *>(&reservedGlobalMarker1), sizeof(reservedGlobalMarker1));
-    is.read(reinterpret_cast<char *>(&reservedGlobalMarker2), sizeof(reservedGlobalMarker2));
-    is.read(reinterpret_cast<char *>(&groupNameLength), sizeof(groupNameLength));
-    is.read(reinterpret_cast<char *>(&markerNameLength), sizeof(markerNameLength));
-    is.read(reinterpret_cast<char *>(&descriptionLength), sizeof(descriptionLength));
-    is.read(reinterpret_cast<char *>(&reservedGlobalMarker3), sizeof(reservedGlobalMarker3));
-    is.read(reinterpret_cast<char *>(&reservedGlobalMarker4), sizeof(reservedGlobalMarker4));
+    GlobalMarkerFields::read(is, *this);
     groupName.resize(groupNameLength);
     is.read(const_cast<char *>(groupName.data()), groupNameLength);
     markerName.resize(markerNameLength);
@@ -39,17 +45,7 @@ void GlobalMarker::read(AbstractFile & is) {
 
 void GlobalMarker::write(AbstractFile & os) {
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&commentedEventType), sizeof(commentedEventType));
-    os.write(reinterpret_cast<char *>(&foregroundColor), sizeof(foregroundColor));
-    os.write(reinterpret_cast<char *>(&backgroundColor), sizeof(backgroundColor));
-    os.write(reinterpret_cast<char *>(&isRelocatable), sizeof(isRelocatable));
-    os.write(reinterpret_cast<char *>(&reservedGlobalMarker1), sizeof(reservedGlobalMarker1));
-    os.write(reinterpret_cast<char *>(&reservedGlobalMarker2), sizeof(reservedGlobalMarker2));
-    os.write(reinterpret_cast<char *>(&groupNameLength), sizeof(groupNameLength));
-    os.write(reinterpret_cast<char *>(&markerNameLength), sizeof(markerNameLength));
-    os.write(reinterpret_cast<char *>(&descriptionLength), sizeof(descriptionLength));
-    os.write(reinterpret_cast<char *>(&reservedGlobalMarker3), sizeof(reservedGlobalMarker3));
-    os.write(reinterpret_cast<char *>(&reservedGlobalMarker4), sizeof(reservedGlobalMarker4));
+    GlobalMarkerFields::write(os, *this);
     os.write(const_cast<char *>(groupName.data()), groupNameLength);
     os.write(const_cast<char *>(markerName.data()), markerNameLength);
     os.write(const_cast<char *>(description.data()), descriptionLength);
@@ -61,17 +57,7 @@ void GlobalMarker::write(AbstractFile & os) {
 uint32_t GlobalMarker::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        sizeof(commentedEventType) +
-        sizeof(foregroundColor) +
-        sizeof(backgroundColor) +
-        sizeof(isRelocatable) +
-        sizeof(reservedGlobalMarker1) +
-        sizeof(reservedGlobalMarker2) +
-        sizeof(groupNameLength) +
-        sizeof(markerNameLength) +
-        sizeof(descriptionLength) +
-        sizeof(reservedGlobalMarker3) +
-        sizeof(reservedGlobalMarker4) +
+        GlobalMarkerFields::size() +
         groupNameLength +
         markerNameLength +
         descriptionLength;
@@ -0,0 +1,407 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <Vector/BLF/platform.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+#include <type_traits>
+#include <vector>
+
+#include <Vector/BLF/Exceptions.h>
+
+namespace Vector {
+namespace BLF {
+
+/**
+ * Vector with a fixed capacity, stored inline
+ *
+ * This is used for payloads, that are bounded by the bus protocol,
+ * e.g. the 64 data bytes of CAN FD. The elements are part of the object,
+ * so there is no separate heap allocation per object. The interface is
+ * the one of std::vector, except for the allocator, and it converts from
+ * and to std::vector. Exceeding the capacity throws an Exception.
+ *
+ * @tparam T element type
+ * @tparam N capacity
+ */
+template <typename T, std::size_t N>
+class InlineVector final {
+    static_assert(std::is_trivially_copyable<T>::value, "InlineVector: element type is not trivially copyable");
+
+  public:
+    /** element type */
+    using value_type = T;
+
+    /** size type */
+    using size_type = std::size_t;
+
+    /** reference */
+    using reference = T &;
+
+    /** const reference */
+    using const_reference = const T &;
+
+    /** iterator */
+    using iterator = T *;
+
+    /** const iterator */
+    using const_iterator = const T *;
+
+    InlineVector() = default;
+
+    /**
+     * Create vector with elements.
+     *
+     * @param[in] init elements
+     */
+    InlineVector(std::initializer_list<T> init) {
+        assign(init.begin(), init.end());
+    }
+
+    /**
+     * Create vector with elements.
+     *
+     * @param[in] other elements
+     */
+    InlineVector(const std::vector<T> & other) {
+        assign(other.cbegin(), other.cend());
+    }
+
+    /**
+     * Copy elements into a std::vector.
+     *
+     * @return elements
+     */
+    operator std::vector<T>() const {
+        return std::vector<T>(cbegin(), cend());
+    }
+
+    /**
+     * Get data.
+     *
+     * @return data
+     */
+    T * data() {
+        return m_data.data();
+    }
+
+    /** @copydoc data */
+    const T * data() const {
+        return m_data.data();
+    }
+
+    /**
+     * Get number of elements.
+     *
+     * @return number of elements
+     */
+    size_type size() const {
+        return m_size;
+    }
+
+    /**
+     * Check if there are no elements.
+     *
+     * @return true if empty
+     */
+    bool empty() const {
+        return m_size == 0;
+    }
+
+    /**
+     * Get capacity.
+     *
+     * @return capacity
+     */
+    static constexpr size_type capacity() {
+        return N;
+    }
+
+    /** @copydoc capacity */
+    static constexpr size_type max_size() {
+        return N;
+    }
+
+    /**
+     * Reserve capacity.
+     *
+     * The capacity is fixed, so this only checks it.
+     *
+     * @param[in] count number of elements
+     */
+    void reserve(size_type count) {
+        if (count > N)
+            throw Exception("InlineVector::reserve(): count exceeds capacity.");
+    }
+
+    /** @return iterator to first element */
+    iterator begin() {
+        return m_data.data();
+    }
+
+    /** @return iterator to first element */
+    const_iterator begin() const {
+        return m_data.data();
+    }
+
+    /** @return iterator to first element */
+    const_iterator cbegin() const {
+        return m_data.data();
+    }
+
+    /** @return iterator behind last element */
+    iterator end() {
+        return m_data.data() + m_size;
+    }
+
+    /** @return iterator behind last element */
+    const_iterator end() const {
+        return m_data.data() + m_size;
+    }
+
+    /** @return iterator behind last element */
+    const_iterator cend() const {
+        return m_data.data() + m_size;
+    }
+
+    /**
+     * Access element.
+     *
+     * @param[in] pos position
+     * @return element
+     */
+    reference operator[](size_type pos) {
+        return m_data[pos];
+    }
+
+    /** @copydoc operator[] */
+    const_reference operator[](size_type pos) const {
+        return m_data[pos];
+    }
+
+    /**
+     * Access element with bounds checking.
+     *
+     * An Exception is thrown, if pos is not less than size.
+     *
+     * @param[in] pos position
+     * @return element
+     */
+    reference at(size_type pos) {
+        if (pos >= m_size)
+            throw Exception("InlineVector::at(): pos out of range.");
+        return m_data[pos];
+    }
+
+    /** @copydoc at */
+    const_reference at(size_type pos) const {
+        if (pos >= m_size)
+            throw Exception("InlineVector::at(): pos out of range.");
+        return m_data[pos];
+    }
+
+    /** @return first element */
+    reference front() {
+        return m_data[0];
+    }
+
+    /** @return first element */
+    const_reference front() const {
+        return m_data[0];
+    }
+
+    /** @return last element */
+    reference back() {
+        return m_data[m_size - 1];
+    }
+
+    /** @return last element */
+    const_reference back() const {
+        return m_data[m_size - 1];
+    }
+
+    /**
+     * Remove all elements.
+     */
+    void clear() {
+        m_size = 0;
+    }
+
+    /**
+     * Change number of elements.
+     *
+     * New elements are value-initialized.
+     *
+     * @param[in] count number of elements
+     * @param[in] value value of new elements
+     */
+    void resize(size_type count, const T & value = T()) {
+        if (count > N)
+            throw Exception("InlineVector::resize(): count exceeds capacity.");
+        if (count > m_size)
+            std::fill(m_data.begin() + m_size, m_data.begin() + count, value);
+        m_size = count;
+    }
+
+    /**
+     * Replace elements.
+     *
+     * @param[in] count number of elements
+     * @param[in] value value of elements
+     */
+    void assign(size_type count, const T & value) {
+        clear();
+        resize(count, value);
+    }
+
+    /**
+     * Replace elements.
+     *
+     * @param[in] first first element
+     * @param[in] last behind last element
+     */
+    template <typename InputIt, typename = typename std::enable_if<!std::is_integral<InputIt>::value>::type>
+    void assign(InputIt first, InputIt last) {
+        clear();
+        for (; first != last; ++first)
+            push_back(*first);
+    }
+
+    /**
+     * Append element.
+     *
+     * @param[in] value value
+     */
+    void push_back(const T & value) {
+        if (m_size >= N)
+            throw Exception("InlineVector::push_back(): capacity exceeded.");
+        m_data[m_size++] = value;
+    }
+
+    /**
+     * Remove last element.
+     */
+    void pop_back() {
+        m_size--;
+    }
+
+    /**
+     * Insert elements.
+     *
+     * @param[in] pos position to insert before
+     * @param[in] count number of elements
+     * @param[in] value value of elements
+     * @return iterator to first inserted element
+     */
+    iterator insert(const_iterator pos, size_type count, const T & value) {
+        iterator first = makeRoom(pos, count);
+        std::fill(first, first + count, value);
+        return first;
+    }
+
+    /**
+     * Insert element.
+     *
+     * @param[in] pos position to insert before
+     * @param[in] value value
+     * @return iterator to inserted element
+     */
+    iterator insert(const_iterator pos, const T & value) {
+        return insert(pos, 1, value);
+    }
+
+    /**
+     * Insert elements.
+     *
+     * @param[in] pos position to insert before
+     * @param[in] first first element
+     * @param[in] last behind last element
+     * @return iterator to first inserted element
+     */
+    template <typename InputIt, typename = typename std::enable_if<!std::is_integral<InputIt>::value>::type>
+    iterator insert(const_iterator pos, InputIt first, InputIt last) {
+        /* append, then rotate into place */
+        size_type offset = static_cast<size_type>(pos - cbegin());
+        size_type oldSize = m_size;
+        for (; first != last; ++first)
+            push_back(*first);
+        std::rotate(begin() + offset, begin() + oldSize, end());
+        return begin() + offset;
+    }
+
+    /** @copydoc insert(const_iterator, InputIt, InputIt) */
+    iterator insert(const_iterator pos, std::initializer_list<T> init) {
+        return insert(pos, init.begin(), init.end());
+    }
+
+    /**
+     * Remove elements.
+     *
+     * @param[in] first first element
+     * @param[in] last behind last element
+     * @return iterator behind the removed elements
+     */
+    iterator erase(const_iterator first, const_iterator last) {
+        iterator dest = begin() + (first - cbegin());
+        std::copy(last, cend(), dest);
+        m_size -= static_cast<size_type>(last - first);
+        return dest;
+    }
+
+    /**
+     * Remove element.
+     *
+     * @param[in] pos element
+     * @return iterator behind the removed element
+     */
+    iterator erase(const_iterator pos) {
+        return erase(pos, pos + 1);
+    }
+
+    /**
+     * Compare elements.
+     *
+     * @param[in] other other vector
+     * @return true if equal
+     */
+    bool operator==(const InlineVector & other) const {
+        return (m_size == other.m_size) && std::equal(cbegin(), cend(), other.cbegin());
+    }
+
+    /** @copydoc operator== */
+    bool operator!=(const InlineVector & other) const {
+        return !(*this == other);
+    }
+
+  private:
+    /**
+     * Move elements to make room for new elements.
+     *
+     * @param[in] pos position to insert before
+     * @param[in] count number of elements
+     * @return iterator to the room
+     */
+    iterator makeRoom(const_iterator pos, size_type count) {
+        if (count > N - m_size)
+            throw Exception("InlineVector::insert(): capacity exceeded.");
+        iterator first = begin() + (pos - cbegin());
+        std::copy_backward(first, end(), end() + count);
+        m_size += count;
+        return first;
+    }
+
+    /** elements */
+    std::array<T, N> m_data {};
+
+    /** number of elements */
+    size_type m_size {};
+};
+
+}
+}
@@ -4,45 +4,39 @@
 
 #include <Vector/BLF/J1708Message.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of J1708Message from channel to reservedJ1708Message2 */
+using J1708MessageFields = Fields<
+    VECTOR_BLF_FIELD(J1708Message, channel),
+    VECTOR_BLF_FIELD(J1708Message, dir),
+    VECTOR_BLF_FIELD(J1708Message, reservedJ1708Message1),
+    VECTOR_BLF_FIELD(J1708Message, error),
+    VECTOR_BLF_FIELD(J1708Message, size),
+    VECTOR_BLF_FIELD(J1708Message, data),
+    VECTOR_BLF_FIELD(J1708Message, reservedJ1708Message2)>;
+
 J1708Message::J1708Message() :
     ObjectHeader(ObjectType::J1708_MESSAGE) { // or J1708_VIRTUAL_MSG
 }
 
 void J1708Message::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&dir), sizeof(dir));
-    is.read(reinterpret_cast<char *>(&reservedJ1708Message1), sizeof(reservedJ1708Message1));
-    is.read(reinterpret_cast<char *>(&error), sizeof(error));
-    is.read(reinterpret_cast<char *>(&size), sizeof(size));
-    is.read(reinterpret_cast<char *>(data.data()), static_cast<std::streamsize>(data.size()));
-    is.read(reinterpret_cast<char *>(&reservedJ1708Message2), sizeof(reservedJ1708Message2));
+    J1708MessageFields::read(is, *this);
 }
 
 void J1708Message::write(AbstractFile & os) {
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&dir), sizeof(dir));
-    os.write(reinterpret_cast<char *>(&reservedJ1708Message1), sizeof(reservedJ1708Message1));
-    os.write(reinterpret_cast<char *>(&error), sizeof(error));
-    os.write(reinterpret_cast<char *>(&size), sizeof(size));
-    os.write(reinterpret_cast<char *>(data.data()), static_cast<std::streamsize>(data.size()));
-    os.write(reinterpret_cast<char *>(&reservedJ1708Message2), sizeof(reservedJ1708Message2));
+    J1708MessageFields::write(os, *this);
 }
 
 uint32_t J1708Message::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        sizeof(channel) +
-        sizeof(dir) +
-        sizeof(reservedJ1708Message1) +
-        sizeof(error) +
-        sizeof(size) +
-        static_cast<uint32_t>(data.size()) +
-        sizeof(reservedJ1708Message2);
+        J1708MessageFields::size();
 }
 
 }
@@ -4,40 +4,38 @@
 
 #include <Vector/BLF/KLineStatusEvent.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of KLineStatusEvent from type to data */
+using KLineStatusEventFields = Fields<
+    VECTOR_BLF_FIELD(KLineStatusEvent, type),
+    VECTOR_BLF_FIELD(KLineStatusEvent, dataLen),
+    VECTOR_BLF_FIELD(KLineStatusEvent, port),
+    VECTOR_BLF_FIELD(KLineStatusEvent, reservedKLineStatusEvent),
+    VECTOR_BLF_FIELD(KLineStatusEvent, data)>;
+
 KLineStatusEvent::KLineStatusEvent() :
     ObjectHeader(ObjectType::KLINE_STATUSEVENT) {
 }
 
 void KLineStatusEvent::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&type), sizeof(type));
-    is.read(reinterpret_cast<char *>(&dataLen), sizeof(dataLen));
-    is.read(reinterpret_cast<char *>(&port), sizeof(port));
-    is.read(reinterpret_cast<char *>(&reservedKLineStatusEvent), sizeof(reservedKLineStatusEvent));
-    is.read(reinterpret_cast<char *>(data.data()), static_cast<std::streamsize>(data.size() * sizeof(uint64_t)));
+    KLineStatusEventFields::read(is, *this);
     // @note might be extended in future versions
 }
 
 void KLineStatusEvent::write(AbstractFile & os) {
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&type), sizeof(type));
-    os.write(reinterpret_cast<char *>(&dataLen), sizeof(dataLen));
-    os.write(reinterpret_cast<char *>(&port), sizeof(port));
-    os.write(reinterpret_cast<char *>(&reservedKLineStatusEvent), sizeof(reservedKLineStatusEvent));
-    os.write(reinterpret_cast<char *>(data.data()), static_cast<std::streamsize>(data.size() * sizeof(uint64_t)));
+    KLineStatusEventFields::write(os, *this);
 }
 
 uint32_t KLineStatusEvent::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        sizeof(type) +
-        sizeof(dataLen) +
-        sizeof(port) +
-        sizeof(reservedKLineStatusEvent) +
-        static_cast<uint32_t>(data.size() * sizeof(uint64_t));
+        KLineStatusEventFields::size();
 }
 
 }
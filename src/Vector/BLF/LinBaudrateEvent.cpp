@@ -4,33 +4,35 @@
 
 #include <Vector/BLF/LinBaudrateEvent.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of LinBaudrateEvent from channel to baudrate */
+using LinBaudrateEventFields = Fields<
+    VECTOR_BLF_FIELD(LinBaudrateEvent, channel),
+    VECTOR_BLF_FIELD(LinBaudrateEvent, reservedLinBaudrateEvent),
+    VECTOR_BLF_FIELD(LinBaudrateEvent, baudrate)>;
+
 LinBaudrateEvent::LinBaudrateEvent() :
     ObjectHeader(ObjectType::LIN_BAUDRATE) {
 }
 
 void LinBaudrateEvent::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&reservedLinBaudrateEvent), sizeof(reservedLinBaudrateEvent));
-    is.read(reinterpret_cast<char *>(&baudrate), sizeof(baudrate));
+    LinBaudrateEventFields::read(is, *this);
 }
 
 void LinBaudrateEvent::write(AbstractFile & os) {
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&reservedLinBaudrateEvent), sizeof(reservedLinBaudrateEvent));
-    os.write(reinterpret_cast<char *>(&baudrate), sizeof(baudrate));
+    LinBaudrateEventFields::write(os, *this);
 }
 
 uint32_t LinBaudrateEvent::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        sizeof(channel) +
-        sizeof(reservedLinBaudrateEvent) +
-        sizeof(baudrate);
+        LinBaudrateEventFields::size();
 }
 
 }
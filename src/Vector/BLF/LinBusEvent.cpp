@@ -4,29 +4,29 @@
 
 #include <Vector/BLF/LinBusEvent.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of LinBusEvent from sof to reservedLinBusEvent */
+using LinBusEventFields = Fields<
+    VECTOR_BLF_FIELD(LinBusEvent, sof),
+    VECTOR_BLF_FIELD(LinBusEvent, eventBaudrate),
+    VECTOR_BLF_FIELD(LinBusEvent, channel),
+    VECTOR_BLF_FIELD(LinBusEvent, reservedLinBusEvent)>;
+
 void LinBusEvent::read(AbstractFile & is) {
-    is.read(reinterpret_cast<char *>(&sof), sizeof(sof));
-    is.read(reinterpret_cast<char *>(&eventBaudrate), sizeof(eventBaudrate));
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&reservedLinBusEvent), sizeof(reservedLinBusEvent));
+    LinBusEventFields::read(is, *this);
 }
 
 void LinBusEvent::write(AbstractFile & os) {
-    os.write(reinterpret_cast<char *>(&sof), sizeof(sof));
-    os.write(reinterpret_cast<char *>(&eventBaudrate), sizeof(eventBaudrate));
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&reservedLinBusEvent), sizeof(reservedLinBusEvent));
+    LinBusEventFields::write(os, *this);
 }
 
 uint32_t LinBusEvent::calculateObjectSize() const {
     return
-        sizeof(sof) +
-        sizeof(eventBaudrate) +
-        sizeof(channel) +
-        sizeof(reservedLinBusEvent);
+        LinBusEventFields::size();
 }
 
 }
@@ -4,36 +4,36 @@
 
 #include <Vector/BLF/LinChecksumInfo.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of LinChecksumInfo from channel to reservedLinChecksumInfo */
+using LinChecksumInfoFields = Fields<
+    VECTOR_BLF_FIELD(LinChecksumInfo, channel),
+    VECTOR_BLF_FIELD(LinChecksumInfo, id),
+    VECTOR_BLF_FIELD(LinChecksumInfo, checksumModel),
+    VECTOR_BLF_FIELD(LinChecksumInfo, reservedLinChecksumInfo)>;
+
 LinChecksumInfo::LinChecksumInfo() :
     ObjectHeader(ObjectType::LIN_CHECKSUM_INFO) {
 }
 
 void LinChecksumInfo::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&id), sizeof(id));
-    is.read(reinterpret_cast<char *>(&checksumModel), sizeof(checksumModel));
-    is.read(reinterpret_cast<char *>(&reservedLinChecksumInfo), sizeof(reservedLinChecksumInfo));
+    LinChecksumInfoFields::read(is, *this);
 }
 
 void LinChecksumInfo::write(AbstractFile & os) {
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&id), sizeof(id));
-    os.write(reinterpret_cast<char *>(&checksumModel), sizeof(checksumModel));
-    os.write(reinterpret_cast<char *>(&reservedLinChecksumInfo), sizeof(reservedLinChecksumInfo));
+    LinChecksumInfoFields::write(os, *this);
 }
 
 uint32_t LinChecksumInfo::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        sizeof(channel) +
-        sizeof(id) +
-        sizeof(checksumModel) +
-        sizeof(reservedLinChecksumInfo);
+        LinChecksumInfoFields::size();
 }
 
 }
@@ -4,60 +4,44 @@
 
 #include <Vector/BLF/LinCrcError.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of LinCrcError from channel to reservedLinCrcError2 */
+using LinCrcErrorFields = Fields<
+    VECTOR_BLF_FIELD(LinCrcError, channel),
+    VECTOR_BLF_FIELD(LinCrcError, id),
+    VECTOR_BLF_FIELD(LinCrcError, dlc),
+    VECTOR_BLF_FIELD(LinCrcError, data),
+    VECTOR_BLF_FIELD(LinCrcError, fsmId),
+    VECTOR_BLF_FIELD(LinCrcError, fsmState),
+    VECTOR_BLF_FIELD(LinCrcError, headerTime),
+    VECTOR_BLF_FIELD(LinCrcError, fullTime),
+    VECTOR_BLF_FIELD(LinCrcError, crc),
+    VECTOR_BLF_FIELD(LinCrcError, dir),
+    VECTOR_BLF_FIELD(LinCrcError, reservedLinCrcError1),
+    VECTOR_BLF_FIELD(LinCrcError, reservedLinCrcError2)>;
+
 LinCrcError::LinCrcError() :
     ObjectHeader(ObjectType::LIN_CRC_ERROR) {
 }
 
 void LinCrcError::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&id), sizeof(id));
-    is.read(reinterpret_cast<char *>(&dlc), sizeof(dlc));
-    is.read(reinterpret_cast<char *>(data.data()), static_cast<std::streamsize>(data.size()));
-    is.read(reinterpret_cast<char *>(&fsmId), sizeof(fsmId));
-    is.read(reinterpret_cast<char *>(&fsmState), sizeof(fsmState));
-    is.read(reinterpret_cast<char *>(&headerTime), sizeof(headerTime));
-    is.read(reinterpret_cast<char *>(&fullTime), sizeof(fullTime));
-    is.read(reinterpret_cast<char *>(&crc), sizeof(crc));
-    is.read(reinterpret_cast<char *>(&dir), sizeof(dir));
-    is.read(reinterpret_cast<char *>(&reservedLinCrcError1), sizeof(reservedLinCrcError1));
-    is.read(reinterpret_cast<char *>(&reservedLinCrcError2), sizeof(reservedLinCrcError2));
+    LinCrcErrorFields::read(is, *this);
 }
 
 void LinCrcError::write(AbstractFile & os) {
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&id), sizeof(id));
-    os.write(reinterpret_cast<char *>(&dlc), sizeof(dlc));
-    os.write(reinterpret_cast<char *>(data.data()), static_cast<std::streamsize>(data.size()));
-    os.write(reinterpret_cast<char *>(&fsmId), sizeof(fsmId));
-    os.write(reinterpret_cast<char *>(&fsmState), sizeof(fsmState));
-    os.write(reinterpret_cast<char *>(&headerTime), sizeof(headerTime));
-    os.write(reinterpret_cast<char *>(&fullTime), sizeof(fullTime));
-    os.write(reinterpret_cast<char *>(&crc), sizeof(crc));
-    os.write(reinterpret_cast<char *>(&dir), sizeof(dir));
-    os.write(reinterpret_cast<char *>(&reservedLinCrcError1), sizeof(reservedLinCrcError1));
-    os.write(reinterpret_cast<char *>(&reservedLinCrcError2), sizeof(reservedLinCrcError2));
+    LinCrcErrorFields::write(os, *this);
 }
 
 uint32_t LinCrcError::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        sizeof(channel) +
-        sizeof(id) +
-        sizeof(dlc) +
-        static_cast<uint32_t>(data.size()) +
-        sizeof(fsmId) +
-        sizeof(fsmState) +
-        sizeof(headerTime) +
-        sizeof(fullTime) +
-        sizeof(crc) +
-        sizeof(dir) +
-        sizeof(reservedLinCrcError1) +
-        sizeof(reservedLinCrcError2);
+        LinCrcErrorFields::size();
 }
 
 }
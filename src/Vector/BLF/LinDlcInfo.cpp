@@ -4,36 +4,36 @@
 
 #include <Vector/BLF/LinDlcInfo.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of LinDlcInfo from channel to reservedLinDlcInfo */
+using LinDlcInfoFields = Fields<
+    VECTOR_BLF_FIELD(LinDlcInfo, channel),
+    VECTOR_BLF_FIELD(LinDlcInfo, id),
+    VECTOR_BLF_FIELD(LinDlcInfo, dlc),
+    VECTOR_BLF_FIELD(LinDlcInfo, reservedLinDlcInfo)>;
+
 LinDlcInfo::LinDlcInfo() :
     ObjectHeader(ObjectType::LIN_DLC_INFO) {
 }
 
 void LinDlcInfo::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&id), sizeof(id));
-    is.read(reinterpret_cast<char *>(&dlc), sizeof(dlc));
-    is.read(reinterpret_cast<char *>(&reservedLinDlcInfo), sizeof(reservedLinDlcInfo));
+    LinDlcInfoFields::read(is, *this);
 }
 
 void LinDlcInfo::write(AbstractFile & os) {
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&id), sizeof(id));
-    os.write(reinterpret_cast<char *>(&dlc), sizeof(dlc));
-    os.write(reinterpret_cast<char *>(&reservedLinDlcInfo), sizeof(reservedLinDlcInfo));
+    LinDlcInfoFields::write(os, *this);
 }
 
 uint32_t LinDlcInfo::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        sizeof(channel) +
-        sizeof(id) +
-        sizeof(dlc) +
-        sizeof(reservedLinDlcInfo);
+        LinDlcInfoFields::size();
 }
 
 }
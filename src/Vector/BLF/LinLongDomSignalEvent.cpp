@@ -4,9 +4,18 @@
 
 #include <Vector/BLF/LinLongDomSignalEvent.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of LinLongDomSignalEvent from type to reservedLinLongDomSignalEvent3 */
+using LinLongDomSignalEventFields = Fields<
+    VECTOR_BLF_FIELD(LinLongDomSignalEvent, type),
+    VECTOR_BLF_FIELD(LinLongDomSignalEvent, reservedLinLongDomSignalEvent1),
+    VECTOR_BLF_FIELD(LinLongDomSignalEvent, reservedLinLongDomSignalEvent2),
+    VECTOR_BLF_FIELD(LinLongDomSignalEvent, reservedLinLongDomSignalEvent3)>;
+
 LinLongDomSignalEvent::LinLongDomSignalEvent() :
     ObjectHeader(ObjectType::LIN_LONG_DOM_SIG) {
 }
@@ -14,29 +23,20 @@ LinLongDomSignalEvent::LinLongDomSignalEvent() :
 void LinLongDomSignalEvent::read(AbstractFile & is) {
     ObjectHeader::read(is);
     LinBusEvent::read(is);
-    is.read(reinterpret_cast<char *>(&type), sizeof(type));
-    is.read(reinterpret_cast<char *>(&reservedLinLongDomSignalEvent1), sizeof(reservedLinLongDomSignalEvent1));
-    is.read(reinterpret_cast<char *>(&reservedLinLongDomSignalEvent2), sizeof(reservedLinLongDomSignalEvent2));
-    is.read(reinterpret_cast<char *>(&reservedLinLongDomSignalEvent3), sizeof(reservedLinLongDomSignalEvent3));
+    LinLongDomSignalEventFields::read(is, *this);
 }
 
 void LinLongDomSignalEvent::write(AbstractFile & os) {
     ObjectHeader::write(os);
     LinBusEvent::write(os);
-    os.write(reinterpret_cast<char *>(&type), sizeof(type));
-    os.write(reinterpret_cast<char *>(&reservedLinLongDomSignalEvent1), sizeof(reservedLinLongDomSignalEvent1));
-    os.write(reinterpret_cast<char *>(&reservedLinLongDomSignalEvent2), sizeof(reservedLinLongDomSignalEvent2));
-    os.write(reinterpret_cast<char *>(&reservedLinLongDomSignalEvent3), sizeof(reservedLinLongDomSignalEvent3));
+    LinLongDomSignalEventFields::write(os, *this);
 }
 
 uint32_t LinLongDomSignalEvent::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
         LinBusEvent::calculateObjectSize() +
-        sizeof(type) +
-        sizeof(reservedLinLongDomSignalEvent1) +
-        sizeof(reservedLinLongDomSignalEvent2) +
-        sizeof(reservedLinLongDomSignalEvent3);
+        LinLongDomSignalEventFields::size();
 }
 
 }
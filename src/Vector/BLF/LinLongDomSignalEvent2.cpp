@@ -4,9 +4,19 @@
 
 #include <Vector/BLF/LinLongDomSignalEvent2.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of LinLongDomSignalEvent2 from type to length */
+using LinLongDomSignalEvent2Fields = Fields<
+    VECTOR_BLF_FIELD(LinLongDomSignalEvent2, type),
+    VECTOR_BLF_FIELD(LinLongDomSignalEvent2, reservedLinLongDomSignalEvent1),
+    VECTOR_BLF_FIELD(LinLongDomSignalEvent2, reservedLinLongDomSignalEvent2),
+    VECTOR_BLF_FIELD(LinLongDomSignalEvent2, reservedLinLongDomSignalEvent3),
+    VECTOR_BLF_FIELD(LinLongDomSignalEvent2, length)>;
+
 LinLongDomSignalEvent2::LinLongDomSignalEvent2() :
     ObjectHeader(ObjectType::LIN_LONG_DOM_SIG2) {
 }
@@ -14,33 +24,21 @@ LinLongDomSignalEvent2::LinLongDomSignalEvent2() :
 void LinLongDomSignalEvent2::read(AbstractFile & is) {
     ObjectHeader::read(is);
     LinBusEvent::read(is);
-    is.read(reinterpret_cast<char *>(&type), sizeof(type));
-    is.read(reinterpret_cast<char *>(&reservedLinLongDomSignalEvent1), sizeof(reservedLinLongDomSignalEvent1));
-    is.read(reinterpret_cast<char *>(&reservedLinLongDomSignalEvent2), sizeof(reservedLinLongDomSignalEvent2));
-    is.read(reinterpret_cast<char *>(&reservedLinLongDomSignalEvent3), sizeof(reservedLinLongDomSignalEvent3));
-    is.read(reinterpret_cast<char *>(&length), sizeof(length));
+    LinLongDomSignalEvent2Fields::read(is, *this);
     // @note might be extended in future versions
 }
 
 void LinLongDomSignalEvent2::write(AbstractFile & os) {
     ObjectHeader::write(os);
     LinBusEvent::write(os);
-    os.write(reinterpret_cast<char *>(&type), sizeof(type));
-    os.write(reinterpret_cast<char *>(&reservedLinLongDomSignalEvent1), sizeof(reservedLinLongDomSignalEvent1));
-    os.write(reinterpret_cast<char *>(&reservedLinLongDomSignalEvent2), sizeof(reservedLinLongDomSignalEvent2));
-    os.write(reinterpret_cast<char *>(&reservedLinLongDomSignalEvent3), sizeof(reservedLinLongDomSignalEvent3));
-    os.write(reinterpret_cast<char *>(&length), sizeof(length));
+    LinLongDomSignalEvent2Fields::write(os, *this);
 }
 
 uint32_t LinLongDomSignalEvent2::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
         LinBusEvent::calculateObjectSize() +
-        sizeof(type) +
-        sizeof(reservedLinLongDomSignalEvent1) +
-        sizeof(reservedLinLongDomSignalEvent2) +
-        sizeof(reservedLinLongDomSignalEvent3) +
-        sizeof(length);
+        LinLongDomSignalEvent2Fields::size();
 }
 
 }
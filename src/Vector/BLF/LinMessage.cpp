@@ -4,26 +4,32 @@
 
 #include <Vector/BLF/LinMessage.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of LinMessage from channel to reservedLinMessage1 */
+using LinMessageFields = Fields<
+    VECTOR_BLF_FIELD(LinMessage, channel),
+    VECTOR_BLF_FIELD(LinMessage, id),
+    VECTOR_BLF_FIELD(LinMessage, dlc),
+    VECTOR_BLF_FIELD(LinMessage, data),
+    VECTOR_BLF_FIELD(LinMessage, fsmId),
+    VECTOR_BLF_FIELD(LinMessage, fsmState),
+    VECTOR_BLF_FIELD(LinMessage, headerTime),
+    VECTOR_BLF_FIELD(LinMessage, fullTime),
+    VECTOR_BLF_FIELD(LinMessage, crc),
+    VECTOR_BLF_FIELD(LinMessage, dir),
+    VECTOR_BLF_FIELD(LinMessage, reservedLinMessage1)>;
+
 LinMessage::LinMessage() :
     ObjectHeader(ObjectType::LIN_MESSAGE) {
 }
 
 void LinMessage::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&id), sizeof(id));
-    is.read(reinterpret_cast<char *>(&dlc), sizeof(dlc));
-    is.read(reinterpret_cast<char *>(data.data()), static_cast<std::streamsize>(data.size()));
-    is.read(reinterpret_cast<char *>(&fsmId), sizeof(fsmId));
-    is.read(reinterpret_cast<char *>(&fsmState), sizeof(fsmState));
-    is.read(reinterpret_cast<char *>(&headerTime), sizeof(headerTime));
-    is.read(reinterpret_cast<char *>(&fullTime), sizeof(fullTime));
-    is.read(reinterpret_cast<char *>(&crc), sizeof(crc));
-    is.read(reinterpret_cast<char *>(&dir), sizeof(dir));
-    is.read(reinterpret_cast<char *>(&reservedLinMessage1), sizeof(reservedLinMessage1));
+    LinMessageFields::read(is, *this);
 
     reservedLinMessage2_present = false;
     if (this->objectSize >= calculateObjectSize() + sizeof(reservedLinMessage2)) {
@@ -34,34 +40,14 @@ void LinMessage::read(AbstractFile & is) {
 
 void LinMessage::write(AbstractFile & os) {
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&id), sizeof(id));
-    os.write(reinterpret_cast<char *>(&dlc), sizeof(dlc));
-    os.write(reinterpret_cast<char *>(data.data()), static_cast<std::streamsize>(data.size()));
-    os.write(reinterpret_cast<char *>(&fsmId), sizeof(fsmId));
-    os.write(reinterpret_cast<char *>(&fsmState), sizeof(fsmState));
-    os.write(reinterpret_cast<char *>(&headerTime), sizeof(headerTime));
-    os.write(reinterpret_cast<char *>(&fullTime), sizeof(fullTime));
-    os.write(reinterpret_cast<char *>(&crc), sizeof(crc));
-    os.write(reinterpret_cast<char *>(&dir), sizeof(dir));
-    os.write(reinterpret_cast<char *>(&reservedLinMessage1), sizeof(reservedLinMessage1));
+    LinMessageFields::write(os, *this);
     os.write(reinterpret_cast<char *>(&reservedLinMessage2), sizeof(reservedLinMessage2));
 }
 
 uint32_t LinMessage::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        sizeof(channel) +
-        sizeof(id) +
-        sizeof(dlc) +
-        static_cast<uint32_t>(data.size()) +
-        sizeof(fsmId) +
-        sizeof(fsmState) +
-        sizeof(headerTime) +
-        sizeof(fullTime) +
-        sizeof(crc) +
-        sizeof(dir) +
-        sizeof(reservedLinMessage1) +
+        LinMessageFields::size() +
         (reservedLinMessage2_present ? sizeof(reservedLinMessage2) : 0);
 }
 
@@ -4,9 +4,31 @@
 
 #include <Vector/BLF/LinMessage2.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of LinMessage2 from data to reservedLinMessage2 */
+using LinMessage2Fields = Fields<
+    VECTOR_BLF_FIELD(LinMessage2, data),
+    VECTOR_BLF_FIELD(LinMessage2, crc),
+    VECTOR_BLF_FIELD(LinMessage2, dir),
+    VECTOR_BLF_FIELD(LinMessage2, simulated),
+    VECTOR_BLF_FIELD(LinMessage2, isEtf),
+    VECTOR_BLF_FIELD(LinMessage2, etfAssocIndex),
+    VECTOR_BLF_FIELD(LinMessage2, etfAssocEtfId),
+    VECTOR_BLF_FIELD(LinMessage2, fsmId),
+    VECTOR_BLF_FIELD(LinMessage2, fsmState),
+    VECTOR_BLF_FIELD(LinMessage2, reservedLinMessage1),
+    VECTOR_BLF_FIELD(LinMessage2, reservedLinMessage2)>;
+
+/** fields of LinMessage2 from exactHeaderBaudrate to earlyStopbitOffsetResponse, only available in Version 3 and above */
+using LinMessage2V3Fields = Fields<
+    VECTOR_BLF_FIELD(LinMessage2, exactHeaderBaudrate),
+    VECTOR_BLF_FIELD(LinMessage2, earlyStopbitOffset),
+    VECTOR_BLF_FIELD(LinMessage2, earlyStopbitOffsetResponse)>;
+
 LinMessage2::LinMessage2() :
     ObjectHeader(ObjectType::LIN_MESSAGE2, 1) {
 }
@@ -15,17 +37,7 @@ void LinMessage2::read(AbstractFile & is) {
     apiMajor = 1;
     ObjectHeader::read(is);
     LinDatabyteTimestampEvent::read(is);
-    is.read(reinterpret_cast<char *>(data.data()), static_cast<std::streamsize>(data.size()));
-    is.read(reinterpret_cast<char *>(&crc), sizeof(crc));
-    is.read(reinterpret_cast<char *>(&dir), sizeof(dir));
-    is.read(reinterpret_cast<char *>(&simulated), sizeof(simulated));
-    is.read(reinterpret_cast<char *>(&isEtf), sizeof(isEtf));
-    is.read(reinterpret_cast<char *>(&etfAssocIndex), sizeof(etfAssocIndex));
-    is.read(reinterpret_cast<char *>(&etfAssocEtfId), sizeof(etfAssocEtfId));
-    is.read(reinterpret_cast<char *>(&fsmId), sizeof(fsmId));
-    is.read(reinterpret_cast<char *>(&fsmState), sizeof(fsmState));
-    is.read(reinterpret_cast<char *>(&reservedLinMessage1), sizeof(reservedLinMessage1));
-    is.read(reinterpret_cast<char *>(&reservedLinMessage2), sizeof(reservedLinMessage2));
+    LinMessage2Fields::read(is, *this);
 
     /* the following variables are only available in Version 2 and above */
     if (objectSize > calculateObjectSize()) {
@@ -36,9 +48,7 @@ void LinMessage2::read(AbstractFile & is) {
     /* the following variables are only available in Version 3 and above */
     if (objectSize > calculateObjectSize()) {
         apiMajor = 3;
-        is.read(reinterpret_cast<char *>(&exactHeaderBaudrate), sizeof(exactHeaderBaudrate));
-        is.read(reinterpret_cast<char *>(&earlyStopbitOffset), sizeof(earlyStopbitOffset));
-        is.read(reinterpret_cast<char *>(&earlyStopbitOffsetResponse), sizeof(earlyStopbitOffsetResponse));
+        LinMessage2V3Fields::read(is, *this);
     }
 
     // @note might be extended in future versions
@@ -47,17 +57,7 @@ void LinMessage2::read(AbstractFile & is) {
 void LinMessage2::write(AbstractFile & os) {
     ObjectHeader::write(os);
     LinDatabyteTimestampEvent::write(os);
-    os.write(reinterpret_cast<char *>(data.data()), static_cast<std::streamsize>(data.size()));
-    os.write(reinterpret_cast<char *>(&crc), sizeof(crc));
-    os.write(reinterpret_cast<char *>(&dir), sizeof(dir));
-    os.write(reinterpret_cast<char *>(&simulated), sizeof(simulated));
-    os.write(reinterpret_cast<char *>(&isEtf), sizeof(isEtf));
-    os.write(reinterpret_cast<char *>(&etfAssocIndex), sizeof(etfAssocIndex));
-    os.write(reinterpret_cast<char *>(&etfAssocEtfId), sizeof(etfAssocEtfId));
-    os.write(reinterpret_cast<char *>(&fsmId), sizeof(fsmId));
-    os.write(reinterpret_cast<char *>(&fsmState), sizeof(fsmState));
-    os.write(reinterpret_cast<char *>(&reservedLinMessage1), sizeof(reservedLinMessage1));
-    os.write(reinterpret_cast<char *>(&reservedLinMessage2), sizeof(reservedLinMessage2));
+    LinMessage2Fields::write(os, *this);
 
     /* the following variables are only available in Version 2 and above */
     if (apiMajor < 2)
@@ -67,26 +67,14 @@ void LinMessage2::write(AbstractFile & os) {
     /* the following variables are only available in Version 3 and above */
     if (apiMajor < 3)
         return;
-    os.write(reinterpret_cast<char *>(&exactHeaderBaudrate), sizeof(exactHeaderBaudrate));
-    os.write(reinterpret_cast<char *>(&earlyStopbitOffset), sizeof(earlyStopbitOffset));
-    os.write(reinterpret_cast<char *>(&earlyStopbitOffsetResponse), sizeof(earlyStopbitOffsetResponse));
+    LinMessage2V3Fields::write(os, *this);
 }
 
 uint32_t LinMessage2::calculateObjectSize() const {
     uint32_t size =
         ObjectHeader::calculateObjectSize() +
         LinDatabyteTimestampEvent::calculateObjectSize() +
-        static_cast<uint32_t>(data.size()) +
-        sizeof(crc) +
-        sizeof(dir) +
-        sizeof(simulated) +
-        sizeof(isEtf) +
-        sizeof(etfAssocIndex) +
-        sizeof(etfAssocEtfId) +
-        sizeof(fsmId) +
-        sizeof(fsmState) +
-        sizeof(reservedLinMessage1) +
-        sizeof(reservedLinMessage2);
+        LinMessage2Fields::size();
 
     /* the following variables are only available in Version 2 and above */
     if (apiMajor < 2)
@@ -98,9 +86,7 @@ uint32_t LinMessage2::calculateObjectSize() const {
     if (apiMajor < 3)
         return size;
     size +=
-        sizeof(exactHeaderBaudrate) +
-        sizeof(earlyStopbitOffset) +
-        sizeof(earlyStopbitOffsetResponse);
+        LinMessage2V3Fields::size();
 
     return size;
 }
@@ -4,38 +4,34 @@
 
 #include <Vector/BLF/LinMessageDescriptor.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of LinMessageDescriptor from supplierId to checksumModel */
+using LinMessageDescriptorFields = Fields<
+    VECTOR_BLF_FIELD(LinMessageDescriptor, supplierId),
+    VECTOR_BLF_FIELD(LinMessageDescriptor, messageId),
+    VECTOR_BLF_FIELD(LinMessageDescriptor, nad),
+    VECTOR_BLF_FIELD(LinMessageDescriptor, id),
+    VECTOR_BLF_FIELD(LinMessageDescriptor, dlc),
+    VECTOR_BLF_FIELD(LinMessageDescriptor, checksumModel)>;
+
 void LinMessageDescriptor::read(AbstractFile & is) {
     LinSynchFieldEvent::read(is);
-    is.read(reinterpret_cast<char *>(&supplierId), sizeof(supplierId));
-    is.read(reinterpret_cast<char *>(&messageId), sizeof(messageId));
-    is.read(reinterpret_cast<char *>(&nad), sizeof(nad));
-    is.read(reinterpret_cast<char *>(&id), sizeof(id));
-    is.read(reinterpret_cast<char *>(&dlc), sizeof(dlc));
-    is.read(reinterpret_cast<char *>(&checksumModel), sizeof(checksumModel));
+    LinMessageDescriptorFields::read(is, *this);
 }
 
 void LinMessageDescriptor::write(AbstractFile & os) {
     LinSynchFieldEvent::write(os);
-    os.write(reinterpret_cast<char *>(&supplierId), sizeof(supplierId));
-    os.write(reinterpret_cast<char *>(&messageId), sizeof(messageId));
-    os.write(reinterpret_cast<char *>(&nad), sizeof(nad));
-    os.write(reinterpret_cast<char *>(&id), sizeof(id));
-    os.write(reinterpret_cast<char *>(&dlc), sizeof(dlc));
-    os.write(reinterpret_cast<char *>(&checksumModel), sizeof(checksumModel));
+    LinMessageDescriptorFields::write(os, *this);
 }
 
 uint32_t LinMessageDescriptor::calculateObjectSize() const {
     return
         LinSynchFieldEvent::calculateObjectSize() +
-        sizeof(supplierId) +
-        sizeof(messageId) +
-        sizeof(nad) +
-        sizeof(id) +
-        sizeof(dlc) +
-        sizeof(checksumModel);
+        LinMessageDescriptorFields::size();
 }
 
 }
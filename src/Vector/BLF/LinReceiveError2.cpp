@@ -4,9 +4,28 @@
 
 #include <Vector/BLF/LinReceiveError2.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of LinReceiveError2 from data to earlyStopbitOffsetResponse */
+using LinReceiveError2Fields = Fields<
+    VECTOR_BLF_FIELD(LinReceiveError2, data),
+    VECTOR_BLF_FIELD(LinReceiveError2, fsmId),
+    VECTOR_BLF_FIELD(LinReceiveError2, fsmState),
+    VECTOR_BLF_FIELD(LinReceiveError2, stateReason),
+    VECTOR_BLF_FIELD(LinReceiveError2, offendingByte),
+    VECTOR_BLF_FIELD(LinReceiveError2, shortError),
+    VECTOR_BLF_FIELD(LinReceiveError2, timeoutDuringDlcDetection),
+    VECTOR_BLF_FIELD(LinReceiveError2, isEtf),
+    VECTOR_BLF_FIELD(LinReceiveError2, hasDatabytes),
+    VECTOR_BLF_FIELD(LinReceiveError2, respBaudrate),
+    VECTOR_BLF_FIELD(LinReceiveError2, reservedLinReceiveError),
+    VECTOR_BLF_FIELD(LinReceiveError2, exactHeaderBaudrate),
+    VECTOR_BLF_FIELD(LinReceiveError2, earlyStopbitOffset),
+    VECTOR_BLF_FIELD(LinReceiveError2, earlyStopbitOffsetResponse)>;
+
 LinReceiveError2::LinReceiveError2() :
     ObjectHeader(ObjectType::LIN_RCV_ERROR2, 1) {
 }
@@ -14,60 +33,21 @@ LinReceiveError2::LinReceiveError2() :
 void LinReceiveError2::read(AbstractFile & is) {
     ObjectHeader::read(is);
     LinDatabyteTimestampEvent::read(is);
-    is.read(reinterpret_cast<char *>(data.data()), static_cast<std::streamsize>(data.size()));
-    is.read(reinterpret_cast<char *>(&fsmId), sizeof(fsmId));
-    is.read(reinterpret_cast<char *>(&fsmState), sizeof(fsmState));
-    is.read(reinterpret_cast<char *>(&stateReason), sizeof(stateReason));
-    is.read(reinterpret_cast<char *>(&offendingByte), sizeof(offendingByte));
-    is.read(reinterpret_cast<char *>(&shortError), sizeof(shortError));
-    is.read(reinterpret_cast<char *>(&timeoutDuringDlcDetection), sizeof(timeoutDuringDlcDetection));
-    is.read(reinterpret_cast<char *>(&isEtf), sizeof(isEtf));
-    is.read(reinterpret_cast<char *>(&hasDatabytes), sizeof(hasDatabytes));
-    is.read(reinterpret_cast<char *>(&respBaudrate), sizeof(respBaudrate));
-    is.read(reinterpret_cast<char *>(&reservedLinReceiveError), sizeof(reservedLinReceiveError));
-    is.read(reinterpret_cast<char *>(&exactHeaderBaudrate), sizeof(exactHeaderBaudrate));
-    is.read(reinterpret_cast<char *>(&earlyStopbitOffset), sizeof(earlyStopbitOffset));
-    is.read(reinterpret_cast<char *>(&earlyStopbitOffsetResponse), sizeof(earlyStopbitOffsetResponse));
+    LinReceiveError2Fields::read(is, *this);
     // @note might be extended in future versions
 }
 
 void LinReceiveError2::write(AbstractFile & os) {
     ObjectHeader::write(os);
     LinDatabyteTimestampEvent::write(os);
-    os.write(reinterpret_cast<char *>(data.data()), static_cast<std::streamsize>(data.size()));
-    os.write(reinterpret_cast<char *>(&fsmId), sizeof(fsmId));
-    os.write(reinterpret_cast<char *>(&fsmState), sizeof(fsmState));
-    os.write(reinterpret_cast<char *>(&stateReason), sizeof(stateReason));
-    os.write(reinterpret_cast<char *>(&offendingByte), sizeof(offendingByte));
-    os.write(reinterpret_cast<char *>(&shortError), sizeof(shortError));
-    os.write(reinterpret_cast<char *>(&timeoutDuringDlcDetection), sizeof(timeoutDuringDlcDetection));
-    os.write(reinterpret_cast<char *>(&isEtf), sizeof(isEtf));
-    os.write(reinterpret_cast<char *>(&hasDatabytes), sizeof(hasDatabytes));
-    os.write(reinterpret_cast<char *>(&respBaudrate), sizeof(respBaudrate));
-    os.write(reinterpret_cast<char *>(&reservedLinReceiveError), sizeof(reservedLinReceiveError));
-    os.write(reinterpret_cast<char *>(&exactHeaderBaudrate), sizeof(exactHeaderBaudrate));
-    os.write(reinterpret_cast<char *>(&earlyStopbitOffset), sizeof(earlyStopbitOffset));
-    os.write(reinterpret_cast<char *>(&earlyStopbitOffsetResponse), sizeof(earlyStopbitOffsetResponse));
+    LinReceiveError2Fields::write(os, *this);
 }
 
 uint32_t LinReceiveError2::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
         LinDatabyteTimestampEvent::calculateObjectSize() +
-        static_cast<uint32_t>(data.size()) +
-        sizeof(fsmId) +
-        sizeof(fsmState) +
-        sizeof(stateReason) +
-        sizeof(offendingByte) +
-        sizeof(shortError) +
-        sizeof(timeoutDuringDlcDetection) +
-        sizeof(isEtf) +
-        sizeof(hasDatabytes) +
-        sizeof(respBaudrate) +
-        sizeof(reservedLinReceiveError) +
-        sizeof(exactHeaderBaudrate) +
-        sizeof(earlyStopbitOffset) +
-        sizeof(earlyStopbitOffsetResponse);
+        LinReceiveError2Fields::size();
 }
 
 }
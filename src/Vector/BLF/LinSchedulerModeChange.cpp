@@ -4,36 +4,36 @@
 
 #include <Vector/BLF/LinSchedulerModeChange.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of LinSchedulerModeChange from channel to reservedLinSchedulerModeChange */
+using LinSchedulerModeChangeFields = Fields<
+    VECTOR_BLF_FIELD(LinSchedulerModeChange, channel),
+    VECTOR_BLF_FIELD(LinSchedulerModeChange, oldMode),
+    VECTOR_BLF_FIELD(LinSchedulerModeChange, newMode),
+    VECTOR_BLF_FIELD(LinSchedulerModeChange, reservedLinSchedulerModeChange)>;
+
 LinSchedulerModeChange::LinSchedulerModeChange() :
     ObjectHeader(ObjectType::LIN_SCHED_MODCH) {
 }
 
 void LinSchedulerModeChange::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&oldMode), sizeof(oldMode));
-    is.read(reinterpret_cast<char *>(&newMode), sizeof(newMode));
-    is.read(reinterpret_cast<char *>(&reservedLinSchedulerModeChange), sizeof(reservedLinSchedulerModeChange));
+    LinSchedulerModeChangeFields::read(is, *this);
 }
 
 void LinSchedulerModeChange::write(AbstractFile & os) {
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&oldMode), sizeof(oldMode));
-    os.write(reinterpret_cast<char *>(&newMode), sizeof(newMode));
-    os.write(reinterpret_cast<char *>(&reservedLinSchedulerModeChange), sizeof(reservedLinSchedulerModeChange));
+    LinSchedulerModeChangeFields::write(os, *this);
 }
 
 uint32_t LinSchedulerModeChange::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        sizeof(channel) +
-        sizeof(oldMode) +
-        sizeof(newMode) +
-        sizeof(reservedLinSchedulerModeChange);
+        LinSchedulerModeChangeFields::size();
 
 }
 
@@ -4,45 +4,39 @@
 
 #include <Vector/BLF/LinSendError.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of LinSendError from channel to fullTime */
+using LinSendErrorFields = Fields<
+    VECTOR_BLF_FIELD(LinSendError, channel),
+    VECTOR_BLF_FIELD(LinSendError, id),
+    VECTOR_BLF_FIELD(LinSendError, dlc),
+    VECTOR_BLF_FIELD(LinSendError, fsmId),
+    VECTOR_BLF_FIELD(LinSendError, fsmState),
+    VECTOR_BLF_FIELD(LinSendError, headerTime),
+    VECTOR_BLF_FIELD(LinSendError, fullTime)>;
+
 LinSendError::LinSendError() :
     ObjectHeader(ObjectType::LIN_SND_ERROR) {
 }
 
 void LinSendError::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&id), sizeof(id));
-    is.read(reinterpret_cast<char *>(&dlc), sizeof(dlc));
-    is.read(reinterpret_cast<char *>(&fsmId), sizeof(fsmId));
-    is.read(reinterpret_cast<char *>(&fsmState), sizeof(fsmState));
-    is.read(reinterpret_cast<char *>(&headerTime), sizeof(headerTime));
-    is.read(reinterpret_cast<char *>(&fullTime), sizeof(fullTime));
+    LinSendErrorFields::read(is, *this);
 }
 
 void LinSendError::write(AbstractFile & os) {
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&id), sizeof(id));
-    os.write(reinterpret_cast<char *>(&dlc), sizeof(dlc));
-    os.write(reinterpret_cast<char *>(&fsmId), sizeof(fsmId));
-    os.write(reinterpret_cast<char *>(&fsmState), sizeof(fsmState));
-    os.write(reinterpret_cast<char *>(&headerTime), sizeof(headerTime));
-    os.write(reinterpret_cast<char *>(&fullTime), sizeof(fullTime));
+    LinSendErrorFields::write(os, *this);
 }
 
 uint32_t LinSendError::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        sizeof(channel) +
-        sizeof(id) +
-        sizeof(dlc) +
-        sizeof(fsmId) +
-        sizeof(fsmState) +
-        sizeof(headerTime) +
-        sizeof(fullTime);
+        LinSendErrorFields::size();
 }
 
 }
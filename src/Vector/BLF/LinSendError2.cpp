@@ -4,9 +4,22 @@
 
 #include <Vector/BLF/LinSendError2.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of LinSendError2 from eoh to earlyStopbitOffset */
+using LinSendError2Fields = Fields<
+    VECTOR_BLF_FIELD(LinSendError2, eoh),
+    VECTOR_BLF_FIELD(LinSendError2, isEtf),
+    VECTOR_BLF_FIELD(LinSendError2, fsmId),
+    VECTOR_BLF_FIELD(LinSendError2, fsmState),
+    VECTOR_BLF_FIELD(LinSendError2, reservedLinSendError1),
+    VECTOR_BLF_FIELD(LinSendError2, reservedLinSendError2),
+    VECTOR_BLF_FIELD(LinSendError2, exactHeaderBaudrate),
+    VECTOR_BLF_FIELD(LinSendError2, earlyStopbitOffset)>;
+
 LinSendError2::LinSendError2() :
     ObjectHeader(ObjectType::LIN_SND_ERROR2, 1) {
 }
@@ -14,14 +27,7 @@ LinSendError2::LinSendError2() :
 void LinSendError2::read(AbstractFile & is) {
     ObjectHeader::read(is);
     LinMessageDescriptor::read(is);
-    is.read(reinterpret_cast<char *>(&eoh), sizeof(eoh));
-    is.read(reinterpret_cast<char *>(&isEtf), sizeof(isEtf));
-    is.read(reinterpret_cast<char *>(&fsmId), sizeof(fsmId));
-    is.read(reinterpret_cast<char *>(&fsmState), sizeof(fsmState));
-    is.read(reinterpret_cast<char *>(&reservedLinSendError1), sizeof(reservedLinSendError1));
-    is.read(reinterpret_cast<char *>(&reservedLinSendError2), sizeof(reservedLinSendError2));
-    is.read(reinterpret_cast<char *>(&exactHeaderBaudrate), sizeof(exactHeaderBaudrate));
-    is.read(reinterpret_cast<char *>(&earlyStopbitOffset), sizeof(earlyStopbitOffset));
+    LinSendError2Fields::read(is, *this);
 
     reservedLinSendError3_present = false;
     if (this->objectSize >= calculateObjectSize() + sizeof(reservedLinSendError3)) {
@@ -34,14 +40,7 @@ void LinSendError2::read(AbstractFile & is) {
 void LinSendError2::write(AbstractFile & os) {
     ObjectHeader::write(os);
     LinMessageDescriptor::write(os);
-    os.write(reinterpret_cast<char *>(&eoh), sizeof(eoh));
-    os.write(reinterpret_cast<char *>(&isEtf), sizeof(isEtf));
-    os.write(reinterpret_cast<char *>(&fsmId), sizeof(fsmId));
-    os.write(reinterpret_cast<char *>(&fsmState), sizeof(fsmState));
-    os.write(reinterpret_cast<char *>(&reservedLinSendError1), sizeof(reservedLinSendError1));
-    os.write(reinterpret_cast<char *>(&reservedLinSendError2), sizeof(reservedLinSendError2));
-    os.write(reinterpret_cast<char *>(&exactHeaderBaudrate), sizeof(exactHeaderBaudrate));
-    os.write(reinterpret_cast<char *>(&earlyStopbitOffset), sizeof(earlyStopbitOffset));
+    LinSendError2Fields::write(os, *this);
     os.write(reinterpret_cast<char *>(&reservedLinSendError3), sizeof(reservedLinSendError3));
 }
 
@@ -49,14 +48,7 @@ uint32_t LinSendError2::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
         LinMessageDescriptor::calculateObjectSize() +
-        sizeof(eoh) +
-        sizeof(isEtf) +
-        sizeof(fsmId) +
-        sizeof(fsmState) +
-        sizeof(reservedLinSendError1) +
-        sizeof(reservedLinSendError2) +
-        sizeof(exactHeaderBaudrate) +
-        sizeof(earlyStopbitOffset) +
+        LinSendError2Fields::size() +
         (reservedLinSendError3_present ? sizeof(reservedLinSendError3) : 0);
 }
 
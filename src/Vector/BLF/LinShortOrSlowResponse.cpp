@@ -4,9 +4,19 @@
 
 #include <Vector/BLF/LinShortOrSlowResponse.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of LinShortOrSlowResponse from numberOfRespBytes to reservedLinShortOrSlowResponse */
+using LinShortOrSlowResponseFields = Fields<
+    VECTOR_BLF_FIELD(LinShortOrSlowResponse, numberOfRespBytes),
+    VECTOR_BLF_FIELD(LinShortOrSlowResponse, respBytes),
+    VECTOR_BLF_FIELD(LinShortOrSlowResponse, slowResponse),
+    VECTOR_BLF_FIELD(LinShortOrSlowResponse, interruptedByBreak),
+    VECTOR_BLF_FIELD(LinShortOrSlowResponse, reservedLinShortOrSlowResponse)>;
+
 LinShortOrSlowResponse::LinShortOrSlowResponse() :
     ObjectHeader(ObjectType::LIN_SHORT_OR_SLOW_RESPONSE) {
 }
@@ -14,33 +24,21 @@ LinShortOrSlowResponse::LinShortOrSlowResponse() :
 void LinShortOrSlowResponse::read(AbstractFile & is) {
     ObjectHeader::read(is);
     LinDatabyteTimestampEvent::read(is);
-    is.read(reinterpret_cast<char *>(&numberOfRespBytes), sizeof(numberOfRespBytes));
-    is.read(reinterpret_cast<char *>(respBytes.data()), static_cast<std::streamsize>(respBytes.size()));
-    is.read(reinterpret_cast<char *>(&slowResponse), sizeof(slowResponse));
-    is.read(reinterpret_cast<char *>(&interruptedByBreak), sizeof(interruptedByBreak));
-    is.read(reinterpret_cast<char *>(&reservedLinShortOrSlowResponse), sizeof(reservedLinShortOrSlowResponse));
+    LinShortOrSlowResponseFields::read(is, *this);
     // @note might be extended in future versions
 }
 
 void LinShortOrSlowResponse::write(AbstractFile & os) {
     ObjectHeader::write(os);
     LinDatabyteTimestampEvent::write(os);
-    os.write(reinterpret_cast<char *>(&numberOfRespBytes), sizeof(numberOfRespBytes));
-    os.write(reinterpret_cast<char *>(respBytes.data()), static_cast<std::streamsize>(respBytes.size()));
-    os.write(reinterpret_cast<char *>(&slowResponse), sizeof(slowResponse));
-    os.write(reinterpret_cast<char *>(&interruptedByBreak), sizeof(interruptedByBreak));
-    os.write(reinterpret_cast<char *>(&reservedLinShortOrSlowResponse), sizeof(reservedLinShortOrSlowResponse));
+    LinShortOrSlowResponseFields::write(os, *this);
 }
 
 uint32_t LinShortOrSlowResponse::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
         LinDatabyteTimestampEvent::calculateObjectSize() +
-        sizeof(numberOfRespBytes) +
-        static_cast<uint32_t>(respBytes.size()) +
-        sizeof(slowResponse) +
-        sizeof(interruptedByBreak) +
-        sizeof(reservedLinShortOrSlowResponse);
+        LinShortOrSlowResponseFields::size();
 }
 
 }
@@ -4,36 +4,36 @@
 
 #include <Vector/BLF/LinSlaveTimeout.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of LinSlaveTimeout from channel to followStateId */
+using LinSlaveTimeoutFields = Fields<
+    VECTOR_BLF_FIELD(LinSlaveTimeout, channel),
+    VECTOR_BLF_FIELD(LinSlaveTimeout, slaveId),
+    VECTOR_BLF_FIELD(LinSlaveTimeout, stateId),
+    VECTOR_BLF_FIELD(LinSlaveTimeout, followStateId)>;
+
 LinSlaveTimeout::LinSlaveTimeout() :
     ObjectHeader(ObjectType::LIN_SLV_TIMEOUT) {
 }
 
 void LinSlaveTimeout::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&slaveId), sizeof(slaveId));
-    is.read(reinterpret_cast<char *>(&stateId), sizeof(stateId));
-    is.read(reinterpret_cast<char *>(&followStateId), sizeof(followStateId));
+    LinSlaveTimeoutFields::read(is, *this);
 }
 
 void LinSlaveTimeout::write(AbstractFile & os) {
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&slaveId), sizeof(slaveId));
-    os.write(reinterpret_cast<char *>(&stateId), sizeof(stateId));
-    os.write(reinterpret_cast<char *>(&followStateId), sizeof(followStateId));
+    LinSlaveTimeoutFields::write(os, *this);
 }
 
 uint32_t LinSlaveTimeout::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        sizeof(channel) +
-        sizeof(slaveId) +
-        sizeof(stateId) +
-        sizeof(followStateId);
+        LinSlaveTimeoutFields::size();
 }
 
 }
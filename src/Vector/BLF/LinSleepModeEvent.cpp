@@ -4,36 +4,36 @@
 
 #include <Vector/BLF/LinSleepModeEvent.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of LinSleepModeEvent from channel to reservedLinSleepModeEvent */
+using LinSleepModeEventFields = Fields<
+    VECTOR_BLF_FIELD(LinSleepModeEvent, channel),
+    VECTOR_BLF_FIELD(LinSleepModeEvent, reason),
+    VECTOR_BLF_FIELD(LinSleepModeEvent, flags),
+    VECTOR_BLF_FIELD(LinSleepModeEvent, reservedLinSleepModeEvent)>;
+
 LinSleepModeEvent::LinSleepModeEvent() :
     ObjectHeader(ObjectType::LIN_SLEEP) {
 }
 
 void LinSleepModeEvent::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&reason), sizeof(reason));
-    is.read(reinterpret_cast<char *>(&flags), sizeof(flags));
-    is.read(reinterpret_cast<char *>(&reservedLinSleepModeEvent), sizeof(reservedLinSleepModeEvent));
+    LinSleepModeEventFields::read(is, *this);
 }
 
 void LinSleepModeEvent::write(AbstractFile & os) {
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&reason), sizeof(reason));
-    os.write(reinterpret_cast<char *>(&flags), sizeof(flags));
-    os.write(reinterpret_cast<char *>(&reservedLinSleepModeEvent), sizeof(reservedLinSleepModeEvent));
+    LinSleepModeEventFields::write(os, *this);
 }
 
 uint32_t LinSleepModeEvent::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        sizeof(channel) +
-        sizeof(reason) +
-        sizeof(flags) +
-        sizeof(reservedLinSleepModeEvent);
+        LinSleepModeEventFields::size();
 }
 
 }
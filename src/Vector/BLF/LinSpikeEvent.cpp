@@ -4,33 +4,35 @@
 
 #include <Vector/BLF/LinSpikeEvent.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of LinSpikeEvent from channel to width */
+using LinSpikeEventFields = Fields<
+    VECTOR_BLF_FIELD(LinSpikeEvent, channel),
+    VECTOR_BLF_FIELD(LinSpikeEvent, reservedLinSpikeEvent),
+    VECTOR_BLF_FIELD(LinSpikeEvent, width)>;
+
 LinSpikeEvent::LinSpikeEvent() :
     ObjectHeader(ObjectType::LIN_SPIKE_EVENT) {
 }
 
 void LinSpikeEvent::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&reservedLinSpikeEvent), sizeof(reservedLinSpikeEvent));
-    is.read(reinterpret_cast<char *>(&width), sizeof(width));
+    LinSpikeEventFields::read(is, *this);
 }
 
 void LinSpikeEvent::write(AbstractFile & os) {
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&reservedLinSpikeEvent), sizeof(reservedLinSpikeEvent));
-    os.write(reinterpret_cast<char *>(&width), sizeof(width));
+    LinSpikeEventFields::write(os, *this);
 }
 
 uint32_t LinSpikeEvent::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        sizeof(channel) +
-        sizeof(reservedLinSpikeEvent) +
-        sizeof(width);
+        LinSpikeEventFields::size();
 }
 
 }
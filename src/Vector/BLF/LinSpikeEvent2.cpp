@@ -4,9 +4,18 @@
 
 #include <Vector/BLF/LinSpikeEvent2.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of LinSpikeEvent2 from width to reservedLinSpikeEvent2 */
+using LinSpikeEvent2Fields = Fields<
+    VECTOR_BLF_FIELD(LinSpikeEvent2, width),
+    VECTOR_BLF_FIELD(LinSpikeEvent2, internal),
+    VECTOR_BLF_FIELD(LinSpikeEvent2, reservedLinSpikeEvent1),
+    VECTOR_BLF_FIELD(LinSpikeEvent2, reservedLinSpikeEvent2)>;
+
 LinSpikeEvent2::LinSpikeEvent2() :
     ObjectHeader(ObjectType::LIN_SPIKE_EVENT2) {
 }
@@ -14,30 +23,21 @@ LinSpikeEvent2::LinSpikeEvent2() :
 void LinSpikeEvent2::read(AbstractFile & is) {
     ObjectHeader::read(is);
     LinBusEvent::read(is);
-    is.read(reinterpret_cast<char *>(&width), sizeof(width));
-    is.read(reinterpret_cast<char *>(&internal), sizeof(internal));
-    is.read(reinterpret_cast<char *>(&reservedLinSpikeEvent1), sizeof(reservedLinSpikeEvent1));
-    is.read(reinterpret_cast<char *>(&reservedLinSpikeEvent2), sizeof(reservedLinSpikeEvent2));
+    LinSpikeEvent2Fields::read(is, *this);
     // @note might be extended in future versions
 }
 
 void LinSpikeEvent2::write(AbstractFile & os) {
     ObjectHeader::write(os);
     LinBusEvent::write(os);
-    os.write(reinterpret_cast<char *>(&width), sizeof(width));
-    os.write(reinterpret_cast<char *>(&internal), sizeof(internal));
-    os.write(reinterpret_cast<char *>(&reservedLinSpikeEvent1), sizeof(reservedLinSpikeEvent1));
-    os.write(reinterpret_cast<char *>(&reservedLinSpikeEvent2), sizeof(reservedLinSpikeEvent2));
+    LinSpikeEvent2Fields::write(os, *this);
 }
 
 uint32_t LinSpikeEvent2::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
         LinBusEvent::calculateObjectSize() +
-        sizeof(width) +
-        sizeof(internal) +
-        sizeof(reservedLinSpikeEvent1) +
-        sizeof(reservedLinSpikeEvent2);
+        LinSpikeEvent2Fields::size();
 }
 
 }
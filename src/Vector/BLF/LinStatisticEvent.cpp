@@ -4,54 +4,42 @@
 
 #include <Vector/BLF/LinStatisticEvent.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of LinStatisticEvent from channel to reservedLinStatisticEvent3 */
+using LinStatisticEventFields = Fields<
+    VECTOR_BLF_FIELD(LinStatisticEvent, channel),
+    VECTOR_BLF_FIELD(LinStatisticEvent, reservedLinStatisticEvent1),
+    VECTOR_BLF_FIELD(LinStatisticEvent, reservedLinStatisticEvent2),
+    VECTOR_BLF_FIELD(LinStatisticEvent, busLoad),
+    VECTOR_BLF_FIELD(LinStatisticEvent, burstsTotal),
+    VECTOR_BLF_FIELD(LinStatisticEvent, burstsOverrun),
+    VECTOR_BLF_FIELD(LinStatisticEvent, framesSent),
+    VECTOR_BLF_FIELD(LinStatisticEvent, framesReceived),
+    VECTOR_BLF_FIELD(LinStatisticEvent, framesUnanswered),
+    VECTOR_BLF_FIELD(LinStatisticEvent, reservedLinStatisticEvent3)>;
+
 LinStatisticEvent::LinStatisticEvent() :
     ObjectHeader(ObjectType::LIN_STATISTIC) {
 }
 
 void LinStatisticEvent::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&reservedLinStatisticEvent1), sizeof(reservedLinStatisticEvent1));
-    is.read(reinterpret_cast<char *>(&reservedLinStatisticEvent2), sizeof(reservedLinStatisticEvent2));
-    is.read(reinterpret_cast<char *>(&busLoad), sizeof(busLoad));
-    is.read(reinterpret_cast<char *>(&burstsTotal), sizeof(burstsTotal));
-    is.read(reinterpret_cast<char *>(&burstsOverrun), sizeof(burstsOverrun));
-    is.read(reinterpret_cast<char *>(&framesSent), sizeof(framesSent));
-    is.read(reinterpret_cast<char *>(&framesReceived), sizeof(framesReceived));
-    is.read(reinterpret_cast<char *>(&framesUnanswered), sizeof(framesUnanswered));
-    is.read(reinterpret_cast<char *>(&reservedLinStatisticEvent3), sizeof(reservedLinStatisticEvent3));
+    LinStatisticEventFields::read(is, *this);
 }
 
 void LinStatisticEvent::write(AbstractFile & os) {
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&reservedLinStatisticEvent1), sizeof(reservedLinStatisticEvent1));
-    os.write(reinterpret_cast<char *>(&reservedLinStatisticEvent2), sizeof(reservedLinStatisticEvent2));
-    os.write(reinterpret_cast<char *>(&busLoad), sizeof(busLoad));
-    os.write(reinterpret_cast<char *>(&burstsTotal), sizeof(burstsTotal));
-    os.write(reinterpret_cast<char *>(&burstsOverrun), sizeof(burstsOverrun));
-    os.write(reinterpret_cast<char *>(&framesSent), sizeof(framesSent));
-    os.write(reinterpret_cast<char *>(&framesReceived), sizeof(framesReceived));
-    os.write(reinterpret_cast<char *>(&framesUnanswered), sizeof(framesUnanswered));
-    os.write(reinterpret_cast<char *>(&reservedLinStatisticEvent3), sizeof(reservedLinStatisticEvent3));
+    LinStatisticEventFields::write(os, *this);
 }
 
 uint32_t LinStatisticEvent::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        sizeof(channel) +
-        sizeof(reservedLinStatisticEvent1) +
-        sizeof(reservedLinStatisticEvent2) +
-        sizeof(busLoad) +
-        sizeof(burstsTotal) +
-        sizeof(burstsOverrun) +
-        sizeof(framesSent) +
-        sizeof(framesReceived) +
-        sizeof(framesUnanswered) +
-        sizeof(reservedLinStatisticEvent3);
+        LinStatisticEventFields::size();
 }
 
 }
@@ -4,36 +4,36 @@
 
 #include <Vector/BLF/LinSyncError.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of LinSyncError from channel to reservedLinSyncError2 */
+using LinSyncErrorFields = Fields<
+    VECTOR_BLF_FIELD(LinSyncError, channel),
+    VECTOR_BLF_FIELD(LinSyncError, reservedLinSyncError1),
+    VECTOR_BLF_FIELD(LinSyncError, timeDiff),
+    VECTOR_BLF_FIELD(LinSyncError, reservedLinSyncError2)>;
+
 LinSyncError::LinSyncError() :
     ObjectHeader(ObjectType::LIN_SYN_ERROR) {
 }
 
 void LinSyncError::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&reservedLinSyncError1), sizeof(reservedLinSyncError1));
-    is.read(reinterpret_cast<char *>(timeDiff.data()), static_cast<std::streamsize>(timeDiff.size() * sizeof(uint16_t)));
-    is.read(reinterpret_cast<char *>(&reservedLinSyncError2), sizeof(reservedLinSyncError2));
+    LinSyncErrorFields::read(is, *this);
 }
 
 void LinSyncError::write(AbstractFile & os) {
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&reservedLinSyncError1), sizeof(reservedLinSyncError1));
-    os.write(reinterpret_cast<char *>(timeDiff.data()), static_cast<std::streamsize>(timeDiff.size() * sizeof(uint16_t)));
-    os.write(reinterpret_cast<char *>(&reservedLinSyncError2), sizeof(reservedLinSyncError2));
+    LinSyncErrorFields::write(os, *this);
 }
 
 uint32_t LinSyncError::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        sizeof(channel) +
-        sizeof(reservedLinSyncError1) +
-        static_cast<uint32_t>(timeDiff.size() * sizeof(uint16_t)) +
-        sizeof(reservedLinSyncError2);
+        LinSyncErrorFields::size();
 }
 
 }
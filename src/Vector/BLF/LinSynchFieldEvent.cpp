@@ -4,26 +4,30 @@
 
 #include <Vector/BLF/LinSynchFieldEvent.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of LinSynchFieldEvent from synchBreakLength to synchDelLength */
+using LinSynchFieldEventFields = Fields<
+    VECTOR_BLF_FIELD(LinSynchFieldEvent, synchBreakLength),
+    VECTOR_BLF_FIELD(LinSynchFieldEvent, synchDelLength)>;
+
 void LinSynchFieldEvent::read(AbstractFile & is) {
     LinBusEvent::read(is);
-    is.read(reinterpret_cast<char *>(&synchBreakLength), sizeof(synchBreakLength));
-    is.read(reinterpret_cast<char *>(&synchDelLength), sizeof(synchDelLength));
+    LinSynchFieldEventFields::read(is, *this);
 }
 
 void LinSynchFieldEvent::write(AbstractFile & os) {
     LinBusEvent::write(os);
-    os.write(reinterpret_cast<char *>(&synchBreakLength), sizeof(synchBreakLength));
-    os.write(reinterpret_cast<char *>(&synchDelLength), sizeof(synchDelLength));
+    LinSynchFieldEventFields::write(os, *this);
 }
 
 uint32_t LinSynchFieldEvent::calculateObjectSize() const {
     return
         LinBusEvent::calculateObjectSize() +
-        sizeof(synchBreakLength) +
-        sizeof(synchDelLength);
+        LinSynchFieldEventFields::size();
 }
 
 }
@@ -4,9 +4,19 @@
 
 #include <Vector/BLF/LinUnexpectedWakeup.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of LinUnexpectedWakeup from width to reservedLinUnexpectedWakeup3 */
+using LinUnexpectedWakeupFields = Fields<
+    VECTOR_BLF_FIELD(LinUnexpectedWakeup, width),
+    VECTOR_BLF_FIELD(LinUnexpectedWakeup, signal),
+    VECTOR_BLF_FIELD(LinUnexpectedWakeup, reservedLinUnexpectedWakeup1),
+    VECTOR_BLF_FIELD(LinUnexpectedWakeup, reservedLinUnexpectedWakeup2),
+    VECTOR_BLF_FIELD(LinUnexpectedWakeup, reservedLinUnexpectedWakeup3)>;
+
 LinUnexpectedWakeup::LinUnexpectedWakeup() :
     ObjectHeader(ObjectType::LIN_UNEXPECTED_WAKEUP) {
 }
@@ -14,33 +24,21 @@ LinUnexpectedWakeup::LinUnexpectedWakeup() :
 void LinUnexpectedWakeup::read(AbstractFile & is) {
     ObjectHeader::read(is);
     LinBusEvent::read(is);
-    is.read(reinterpret_cast<char *>(&width), sizeof(width));
-    is.read(reinterpret_cast<char *>(&signal), sizeof(signal));
-    is.read(reinterpret_cast<char *>(&reservedLinUnexpectedWakeup1), sizeof(reservedLinUnexpectedWakeup1));
-    is.read(reinterpret_cast<char *>(&reservedLinUnexpectedWakeup2), sizeof(reservedLinUnexpectedWakeup2));
-    is.read(reinterpret_cast<char *>(&reservedLinUnexpectedWakeup3), sizeof(reservedLinUnexpectedWakeup3));
+    LinUnexpectedWakeupFields::read(is, *this);
     // @note might be extended in future versions
 }
 
 void LinUnexpectedWakeup::write(AbstractFile & os) {
     ObjectHeader::write(os);
     LinBusEvent::write(os);
-    os.write(reinterpret_cast<char *>(&width), sizeof(width));
-    os.write(reinterpret_cast<char *>(&signal), sizeof(signal));
-    os.write(reinterpret_cast<char *>(&reservedLinUnexpectedWakeup1), sizeof(reservedLinUnexpectedWakeup1));
-    os.write(reinterpret_cast<char *>(&reservedLinUnexpectedWakeup2), sizeof(reservedLinUnexpectedWakeup2));
-    os.write(reinterpret_cast<char *>(&reservedLinUnexpectedWakeup3), sizeof(reservedLinUnexpectedWakeup3));
+    LinUnexpectedWakeupFields::write(os, *this);
 }
 
 uint32_t LinUnexpectedWakeup::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
         LinBusEvent::calculateObjectSize() +
-        sizeof(width) +
-        sizeof(signal) +
-        sizeof(reservedLinUnexpectedWakeup1) +
-        sizeof(reservedLinUnexpectedWakeup2) +
-        sizeof(reservedLinUnexpectedWakeup3);
+        LinUnexpectedWakeupFields::size();
 }
 
 }
@@ -4,36 +4,36 @@
 
 #include <Vector/BLF/LinWakeupEvent.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of LinWakeupEvent from channel to reservedLinWakeupEvent */
+using LinWakeupEventFields = Fields<
+    VECTOR_BLF_FIELD(LinWakeupEvent, channel),
+    VECTOR_BLF_FIELD(LinWakeupEvent, signal),
+    VECTOR_BLF_FIELD(LinWakeupEvent, external),
+    VECTOR_BLF_FIELD(LinWakeupEvent, reservedLinWakeupEvent)>;
+
 LinWakeupEvent::LinWakeupEvent() :
     ObjectHeader(ObjectType::LIN_WAKEUP) {
 }
 
 void LinWakeupEvent::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&signal), sizeof(signal));
-    is.read(reinterpret_cast<char *>(&external), sizeof(external));
-    is.read(reinterpret_cast<char *>(&reservedLinWakeupEvent), sizeof(reservedLinWakeupEvent));
+    LinWakeupEventFields::read(is, *this);
 }
 
 void LinWakeupEvent::write(AbstractFile & os) {
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&signal), sizeof(signal));
-    os.write(reinterpret_cast<char *>(&external), sizeof(external));
-    os.write(reinterpret_cast<char *>(&reservedLinWakeupEvent), sizeof(reservedLinWakeupEvent));
+    LinWakeupEventFields::write(os, *this);
 }
 
 uint32_t LinWakeupEvent::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        sizeof(channel) +
-        sizeof(signal) +
-        sizeof(external) +
-        sizeof(reservedLinWakeupEvent);
+        LinWakeupEventFields::size();
 }
 
 }
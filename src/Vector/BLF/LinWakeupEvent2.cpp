@@ -4,9 +4,19 @@
 
 #include <Vector/BLF/LinWakeupEvent2.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of LinWakeupEvent2 from lengthInfo to reservedLinWakeupEvent2 */
+using LinWakeupEvent2Fields = Fields<
+    VECTOR_BLF_FIELD(LinWakeupEvent2, lengthInfo),
+    VECTOR_BLF_FIELD(LinWakeupEvent2, signal),
+    VECTOR_BLF_FIELD(LinWakeupEvent2, external),
+    VECTOR_BLF_FIELD(LinWakeupEvent2, reservedLinWakeupEvent1),
+    VECTOR_BLF_FIELD(LinWakeupEvent2, reservedLinWakeupEvent2)>;
+
 LinWakeupEvent2::LinWakeupEvent2() :
     ObjectHeader(ObjectType::LIN_WAKEUP2) {
 }
@@ -14,33 +24,21 @@ LinWakeupEvent2::LinWakeupEvent2() :
 void LinWakeupEvent2::read(AbstractFile & is) {
     ObjectHeader::read(is);
     LinBusEvent::read(is);
-    is.read(reinterpret_cast<char *>(&lengthInfo), sizeof(lengthInfo));
-    is.read(reinterpret_cast<char *>(&signal), sizeof(signal));
-    is.read(reinterpret_cast<char *>(&external), sizeof(external));
-    is.read(reinterpret_cast<char *>(&reservedLinWakeupEvent1), sizeof(reservedLinWakeupEvent1));
-    is.read(reinterpret_cast<char *>(&reservedLinWakeupEvent2), sizeof(reservedLinWakeupEvent2));
+    LinWakeupEvent2Fields::read(is, *this);
     // @note might be extended in future versions
 }
 
 void LinWakeupEvent2::write(AbstractFile & os) {
     ObjectHeader::write(os);
     LinBusEvent::write(os);
-    os.write(reinterpret_cast<char *>(&lengthInfo), sizeof(lengthInfo));
-    os.write(reinterpret_cast<char *>(&signal), sizeof(signal));
-    os.write(reinterpret_cast<char *>(&external), sizeof(external));
-    os.write(reinterpret_cast<char *>(&reservedLinWakeupEvent1), sizeof(reservedLinWakeupEvent1));
-    os.write(reinterpret_cast<char *>(&reservedLinWakeupEvent2), sizeof(reservedLinWakeupEvent2));
+    LinWakeupEvent2Fields::write(os, *this);
 }
 
 uint32_t LinWakeupEvent2::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
         LinBusEvent::calculateObjectSize() +
-        sizeof(lengthInfo) +
-        sizeof(signal) +
-        sizeof(external) +
-        sizeof(reservedLinWakeupEvent1) +
-        sizeof(reservedLinWakeupEvent2);
+        LinWakeupEvent2Fields::size();
 }
 
 }
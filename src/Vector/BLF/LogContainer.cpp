@@ -5,26 +5,201 @@
 #include <Vector/BLF/LogContainer.h>
 
 #include <zlib.h>
+#if defined(OPTION_USE_LIBDEFLATE_INFLATE)
+#include <libdeflate.h>
+#endif
 
 #include <Vector/BLF/Exceptions.h>
+#include <Vector/BLF/Fields.h>
 
 namespace Vector {
 namespace BLF {
 
+/** fields of LogContainer from compressionMethod to reservedLogContainer3 */
+using LogContainerFields = Fields<
+    VECTOR_BLF_FIELD(LogContainer, compressionMethod),
+    VECTOR_BLF_FIELD(LogContainer, reservedLogContainer1),
+    VECTOR_BLF_FIELD(LogContainer, reservedLogContainer2),
+    VECTOR_BLF_FIELD(LogContainer, uncompressedFileSize),
+    VECTOR_BLF_FIELD(LogContainer, reservedLogContainer3)>;
+
+/**
+ * zlib streams of a thread
+ *
+ * The streams are reset and reused for all LogContainers, instead of
+ * allocating and initializing the inflate/deflate state each time.
+ */
+struct ZStreams final {
+    ZStreams() = default;
+    ~ZStreams();
+    ZStreams(const ZStreams &) = delete;
+    ZStreams & operator=(const ZStreams &) = delete;
+    ZStreams(ZStreams &&) = delete;
+    ZStreams & operator=(ZStreams &&) = delete;
+
+    /** inflate stream */
+    z_stream inflateStream {};
+
+    /** inflate stream is initialized */
+    bool inflateInitialized {false};
+
+    /** deflate stream */
+    z_stream deflateStream {};
+
+    /** deflate stream is initialized */
+    bool deflateInitialized {false};
+
+    /** compression level of deflate stream */
+    int deflateLevel {};
+
+#if defined(OPTION_USE_LIBDEFLATE_INFLATE)
+    /** libdeflate decompressor */
+    libdeflate_decompressor * decompressor {nullptr};
+#endif
+};
+
+ZStreams::~ZStreams() {
+    if (inflateInitialized)
+        inflateEnd(&inflateStream);
+    if (deflateInitialized)
+        deflateEnd(&deflateStream);
+#if defined(OPTION_USE_LIBDEFLATE_INFLATE)
+    if (decompressor != nullptr)
+        libdeflate_free_decompressor(decompressor);
+#endif
+}
+
+/** zlib streams of this thread */
+static thread_local ZStreams zStreams;
+
+/**
+ * Inflate zlib data, same as ::uncompress.
+ *
+ * @param[out] dest uncompressed data
+ * @param[in,out] destLen size of dest, resp. uncompressed size
+ * @param[in] source compressed data
+ * @param[in] sourceLen compressed size
+ * @return zlib error code
+ */
+static int inflateZlib(Byte * dest, uLong * destLen, const Byte * source, uLong sourceLen) {
+#if defined(OPTION_USE_LIBDEFLATE_INFLATE)
+    /* allocate decompressor once per thread */
+    if (zStreams.decompressor == nullptr) {
+        zStreams.decompressor = libdeflate_alloc_decompressor();
+        if (zStreams.decompressor == nullptr)
+            return Z_MEM_ERROR;
+    }
+
+    /* inflate */
+    std::size_t size = 0;
+    switch (libdeflate_zlib_decompress(zStreams.decompressor, source, sourceLen, dest, *destLen, &size)) {
+    case LIBDEFLATE_SUCCESS:
+        *destLen = static_cast<uLong>(size);
+        return Z_OK;
+    case LIBDEFLATE_INSUFFICIENT_SPACE:
+        return Z_BUF_ERROR;
+    default:
+        return Z_DATA_ERROR;
+    }
+#else
+    z_stream & stream = zStreams.inflateStream;
+
+    /* initialize once per thread, afterwards only reset */
+    if (!zStreams.inflateInitialized) {
+        int retVal = inflateInit(&stream);
+        if (retVal != Z_OK)
+            return retVal;
+        zStreams.inflateInitialized = true;
+    } else {
+        inflateReset(&stream);
+    }
+
+    /* inflate */
+    stream.next_in = const_cast<Byte *>(source);
+    stream.avail_in = static_cast<uInt>(sourceLen);
+    stream.next_out = dest;
+    stream.avail_out = static_cast<uInt>(*destLen);
+    int retVal = inflate(&stream, Z_FINISH);
+    *destLen = stream.total_out;
+
+    /* same return values as ::uncompress */
+    switch (retVal) {
+    case Z_STREAM_END:
+        return Z_OK;
+    case Z_NEED_DICT:
+        return Z_DATA_ERROR;
+    case Z_BUF_ERROR:
+        return (stream.avail_out == 0) ? Z_BUF_ERROR : Z_DATA_ERROR;
+    default:
+        return retVal;
+    }
+#endif
+}
+
+/**
+ * Deflate zlib data, same as ::compress2.
+ *
+ * @param[out] dest compressed data
+ * @param[in,out] destLen size of dest, resp. compressed size
+ * @param[in] source uncompressed data
+ * @param[in] sourceLen uncompressed size
+ * @param[in] level compression level
+ * @return zlib error code
+ */
+static int deflateZlib(Byte * dest, uLong * destLen, const Byte * source, uLong sourceLen, int level) {
+    z_stream & stream = zStreams.deflateStream;
+
+    /* initialize once per thread and compression level, afterwards only reset */
+    if (zStreams.deflateInitialized && (zStreams.deflateLevel != level)) {
+        deflateEnd(&stream);
+        zStreams.deflateInitialized = false;
+    }
+    if (!zStreams.deflateInitialized) {
+        int retVal = deflateInit(&stream, level);
+        if (retVal != Z_OK)
+            return retVal;
+        zStreams.deflateInitialized = true;
+        zStreams.deflateLevel = level;
+    } else {
+        deflateReset(&stream);
+    }
+
+    /* deflate */
+    stream.next_in = const_cast<Byte *>(source);
+    stream.avail_in = static_cast<uInt>(sourceLen);
+    stream.next_out = dest;
+    stream.avail_out = static_cast<uInt>(*destLen);
+    int retVal = deflate(&stream, Z_FINISH);
+    *destLen = stream.total_out;
+
+    /* same return values as ::compress2 */
+    switch (retVal) {
+    case Z_STREAM_END:
+        return Z_OK;
+    case Z_OK:
+        return Z_BUF_ERROR;
+    default:
+        return retVal;
+    }
+}
+
 LogContainer::LogContainer() :
     ObjectHeaderBase(1, ObjectType::LOG_CONTAINER) {
 }
 
 void LogContainer::read(AbstractFile & is) {
     ObjectHeaderBase::read(is);
-    is.read(reinterpret_cast<char *>(&compressionMethod), sizeof(compressionMethod));
-    is.read(reinterpret_cast<char *>(&reservedLogContainer1), sizeof(reservedLogContainer1));
-    is.read(reinterpret_cast<char *>(&reservedLogContainer2), sizeof(reservedLogContainer2));
-    is.read(reinterpret_cast<char *>(&uncompressedFileSize), sizeof(uncompressedFileSize));
-    is.read(reinterpret_cast<char *>(&reservedLogContainer3), sizeof(reservedLogContainer3));
+    readBehindHeader(is);
+}
+
+void LogContainer::readBehindHeader(AbstractFile & is) {
+    LogContainerFields::read(is, *this);
     compressedFileSize = objectSize - internalHeaderSize();
-    compressedFile.resize(compressedFileSize);
-    is.read(reinterpret_cast<char *>(compressedFile.data()), compressedFileSize);
+    compressedFileView = reinterpret_cast<const uint8_t *>(is.readView(compressedFileSize));
+    if (compressedFileView == nullptr) {
+        compressedFile.resize(compressedFileSize);
+        is.read(reinterpret_cast<char *>(compressedFile.data()), compressedFileSize);
+    }
 
     /* skip padding */
     is.seekg(objectSize % 4, std::ios_base::cur);
@@ -32,15 +207,12 @@ void LogContainer::read(AbstractFile & is) {
 
 void LogContainer::write(AbstractFile & os) {
     /* pre processing */
-    compressedFileSize = static_cast<uint32_t>(compressedFile.size());
+    if (compressedFileView == nullptr)
+        compressedFileSize = static_cast<uint32_t>(compressedFile.size());
 
     ObjectHeaderBase::write(os);
-    os.write(reinterpret_cast<char *>(&compressionMethod), sizeof(compressionMethod));
-    os.write(reinterpret_cast<char *>(&reservedLogContainer1), sizeof(reservedLogContainer1));
-    os.write(reinterpret_cast<char *>(&reservedLogContainer2), sizeof(reservedLogContainer2));
-    os.write(reinterpret_cast<char *>(&uncompressedFileSize), sizeof(uncompressedFileSize));
-    os.write(reinterpret_cast<char *>(&reservedLogContainer3), sizeof(reservedLogContainer3));
-    os.write(reinterpret_cast<char *>(compressedFile.data()), compressedFileSize);
+    LogContainerFields::write(os, *this);
+    os.write(reinterpret_cast<const char *>(compressedFileData()), compressedFileSize);
 
     /* skip padding */
     os.skipp(objectSize % 4);
@@ -49,23 +221,28 @@ void LogContainer::write(AbstractFile & os) {
 uint32_t LogContainer::calculateObjectSize() const {
     return
         internalHeaderSize() +
-        static_cast<uint32_t>(compressedFile.size());
+        ((compressedFileView != nullptr) ? compressedFileSize : static_cast<uint32_t>(compressedFile.size()));
 }
 
 uint16_t LogContainer::internalHeaderSize() const {
     return
         ObjectHeaderBase::calculateHeaderSize() +
-        sizeof(compressionMethod) +
-        sizeof(reservedLogContainer1) +
-        sizeof(reservedLogContainer2) +
-        sizeof(uncompressedFileSize) +
-        sizeof(reservedLogContainer3);
+        LogContainerFields::size();
+}
+
+const uint8_t * LogContainer::compressedFileData() const {
+    if (compressedFileView != nullptr)
+        return compressedFileView;
+    return compressedFile.data();
 }
 
 void LogContainer::uncompress() {
     switch (compressionMethod) {
     case 0: /* no compression */
-        uncompressedFile = compressedFile;
+        if (compressedFileView != nullptr)
+            uncompressedFile.assign(compressedFileView, compressedFileView + compressedFileSize);
+        else
+            uncompressedFile = compressedFile;
         break;
 
     case 2: { /* zlib compress */
@@ -74,10 +251,10 @@ void LogContainer::uncompress() {
         uncompressedFile.resize(size);
 
         /* inflate */
-        int retVal = ::uncompress(
+        int retVal = inflateZlib(
                          reinterpret_cast<Byte *>(uncompressedFile.data()),
                          &size,
-                         reinterpret_cast<Byte *>(compressedFile.data()),
+                         reinterpret_cast<const Byte *>(compressedFileData()),
                          static_cast<uLong>(compressedFileSize));
         if (size != uncompressedFileSize)
             throw Exception("LogContainer::uncompress(): unexpected uncompressedSize");
@@ -98,22 +275,24 @@ void LogContainer::compress(const uint16_t compressionMethod, const int compress
     case 0: /* no compression */
         compressedFile = uncompressedFile;
         compressedFileSize = uncompressedFileSize;
+        compressedFileView = nullptr;
         break;
 
     case 2: { /* zlib compress */
         /* deflate/compress data */
         uLong compressedBufferSize = compressBound(uncompressedFileSize);
         compressedFile.resize(compressedBufferSize); // extend
-        int retVal = ::compress2(
+        int retVal = deflateZlib(
                          reinterpret_cast<Byte *>(compressedFile.data()),
                          &compressedBufferSize,
-                         reinterpret_cast<Byte *>(uncompressedFile.data()),
+                         reinterpret_cast<const Byte *>(uncompressedFile.data()),
                          uncompressedFileSize,
                          compressionLevel);
         if (retVal != Z_OK)
             throw Exception("File::uncompressedFile2CompressedFile(): compress2 error");
         compressedFileSize = static_cast<uint32_t>(compressedBufferSize);
         compressedFile.resize(compressedFileSize); // shrink
+        compressedFileView = nullptr;
     }
     break;
 
@@ -26,6 +26,14 @@ struct VECTOR_BLF_EXPORT LogContainer final : ObjectHeaderBase {
     void write(AbstractFile & os) override;
     uint32_t calculateObjectSize() const override;
 
+    /**
+     * Read the LogContainer behind its ObjectHeaderBase, which was already
+     * read, e.g. to identify the object type without seeking back.
+     *
+     * @param[in] is input stream
+     */
+    virtual void readBehindHeader(AbstractFile & is);
+
     /**
      * compression method
      *
@@ -55,6 +63,14 @@ struct VECTOR_BLF_EXPORT LogContainer final : ObjectHeaderBase {
     /** compressed file content */
     std::vector<uint8_t> compressedFile {};
 
+    /**
+     * compressed file content, directly accessed in the underlying file
+     *
+     * If the file supports AbstractFile::readView, read sets this instead of
+     * copying the data into compressedFile. It is valid as long as the file is open.
+     */
+    const uint8_t * compressedFileView {nullptr};
+
     /* following data is calculated */
 
     /** uncompressed file content */
@@ -75,6 +91,13 @@ struct VECTOR_BLF_EXPORT LogContainer final : ObjectHeaderBase {
      */
     uint16_t internalHeaderSize() const;
 
+    /**
+     * Returns the compressed file content.
+     *
+     * @return compressedFileView if set, otherwise compressedFile
+     */
+    const uint8_t * compressedFileData() const;
+
     /**
      * uncompress data
      */
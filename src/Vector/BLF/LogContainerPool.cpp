@@ -0,0 +1,136 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <Vector/BLF/LogContainerPool.h>
+
+namespace Vector {
+namespace BLF {
+
+LogContainerPool::Storage::~Storage() {
+    for (LogContainer * logContainer : logContainers)
+        delete logContainer;
+}
+
+LogContainerPool::LogContainerPool() :
+    m_storage(std::make_shared<Storage>()) {
+}
+
+std::shared_ptr<LogContainer> LogContainerPool::create() {
+    LogContainer * logContainer = nullptr;
+    std::vector<uint8_t> compressedFile;
+
+    {
+        /* mutex lock */
+        std::lock_guard<std::mutex> lock(m_storage->mutex);
+
+        /* take recycled LogContainer */
+        if (!m_storage->logContainers.empty()) {
+            logContainer = m_storage->logContainers.back();
+            m_storage->logContainers.pop_back();
+        }
+
+        /* take released compressedFile buffer */
+        if (!m_storage->compressedFiles.empty()) {
+            compressedFile.swap(m_storage->compressedFiles.back());
+            m_storage->compressedFiles.pop_back();
+        }
+    }
+
+    /* create new LogContainer */
+    if (logContainer == nullptr)
+        logContainer = new LogContainer;
+
+    /* use the larger compressedFile buffer */
+    if (compressedFile.capacity() > logContainer->compressedFile.capacity())
+        logContainer->compressedFile.swap(compressedFile);
+
+    /* return into pool on release */
+    std::weak_ptr<Storage> storage = m_storage;
+    return std::shared_ptr<LogContainer>(logContainer, [storage](LogContainer * logContainer) {
+        recycle(storage, logContainer);
+    });
+}
+
+void LogContainerPool::releaseCompressedFile(LogContainer & logContainer) {
+    logContainer.compressedFileView = nullptr;
+
+    /* take over buffer */
+    std::vector<uint8_t> compressedFile;
+    compressedFile.swap(logContainer.compressedFile);
+    if (compressedFile.capacity() == 0)
+        return;
+    compressedFile.clear();
+
+    /* mutex lock */
+    std::lock_guard<std::mutex> lock(m_storage->mutex);
+
+    /* keep buffer */
+    if (m_storage->compressedFiles.size() < m_storage->maxSize)
+        m_storage->compressedFiles.push_back(std::move(compressedFile));
+}
+
+void LogContainerPool::clear() {
+    /* mutex lock */
+    std::lock_guard<std::mutex> lock(m_storage->mutex);
+
+    /* delete LogContainers and buffers */
+    for (LogContainer * logContainer : m_storage->logContainers)
+        delete logContainer;
+    m_storage->logContainers.clear();
+    m_storage->compressedFiles.clear();
+}
+
+std::size_t LogContainerPool::size() const {
+    /* mutex lock */
+    std::lock_guard<std::mutex> lock(m_storage->mutex);
+
+    return m_storage->logContainers.size();
+}
+
+std::size_t LogContainerPool::maxSize() const {
+    /* mutex lock */
+    std::lock_guard<std::mutex> lock(m_storage->mutex);
+
+    return m_storage->maxSize;
+}
+
+void LogContainerPool::setMaxSize(std::size_t maxSize) {
+    /* mutex lock */
+    std::lock_guard<std::mutex> lock(m_storage->mutex);
+
+    /* set max size */
+    m_storage->maxSize = maxSize;
+
+    /* delete LogContainers and buffers exceeding it */
+    while (m_storage->logContainers.size() > maxSize) {
+        delete m_storage->logContainers.back();
+        m_storage->logContainers.pop_back();
+    }
+    if (m_storage->compressedFiles.size() > maxSize)
+        m_storage->compressedFiles.resize(maxSize);
+}
+
+void LogContainerPool::recycle(const std::weak_ptr<Storage> & storage, LogContainer * logContainer) {
+    /* reset LogContainer outside of the lock, but keep the memory of the buffers */
+    static const LogContainer defaultLogContainer;
+    *logContainer = defaultLogContainer;
+
+    /* keep LogContainer, if the pool still exists */
+    std::shared_ptr<Storage> lockedStorage = storage.lock();
+    if (lockedStorage) {
+        /* mutex lock */
+        std::lock_guard<std::mutex> lock(lockedStorage->mutex);
+
+        if (lockedStorage->logContainers.size() < lockedStorage->maxSize) {
+            lockedStorage->logContainers.push_back(logContainer);
+            return;
+        }
+    }
+
+    /* pool is full or gone */
+    delete logContainer;
+}
+
+}
+}
@@ -0,0 +1,119 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <Vector/BLF/platform.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <Vector/BLF/LogContainer.h>
+
+#include <Vector/BLF/vector_blf_export.h>
+
+namespace Vector {
+namespace BLF {
+
+/**
+ * Thread-safe pool of LogContainers
+ *
+ * LogContainers created by this pool return into it, when the last
+ * shared_ptr to them is released, e.g. in UncompressedFile::dropOldData.
+ * They are reset to their default values, but keep the memory of their
+ * compressedFile and uncompressedFile buffers. So reading or writing
+ * doesn't need large heap allocations per LogContainer once the pool is
+ * filled.
+ *
+ * LogContainers can outlive the pool. They are deleted then.
+ */
+class VECTOR_BLF_EXPORT LogContainerPool final {
+  public:
+    LogContainerPool();
+    ~LogContainerPool() = default;
+    LogContainerPool(const LogContainerPool &) = delete;
+    LogContainerPool & operator=(const LogContainerPool &) = delete;
+    LogContainerPool(LogContainerPool &&) = delete;
+    LogContainerPool & operator=(LogContainerPool &&) = delete;
+
+    /**
+     * Create LogContainer, preferably a recycled one.
+     *
+     * @return LogContainer, that returns into the pool
+     */
+    std::shared_ptr<LogContainer> create();
+
+    /**
+     * Take over the compressedFile buffer of an inflated LogContainer.
+     *
+     * The LogContainer keeps only its uncompressedFile then. The buffer
+     * is reused by the next LogContainer created.
+     *
+     * @param[in,out] logContainer inflated LogContainer
+     */
+    void releaseCompressedFile(LogContainer & logContainer);
+
+    /**
+     * Delete all LogContainers and buffers in the pool.
+     */
+    void clear();
+
+    /**
+     * Get number of LogContainers in the pool.
+     *
+     * @return number of LogContainers
+     */
+    std::size_t size() const;
+
+    /**
+     * Get maximum number of LogContainers resp. buffers kept.
+     *
+     * @return maximum number of LogContainers
+     */
+    std::size_t maxSize() const;
+
+    /**
+     * Set maximum number of LogContainers resp. buffers kept.
+     *
+     * 0 disables the pool.
+     *
+     * @param[in] maxSize maximum number of LogContainers
+     */
+    void setMaxSize(std::size_t maxSize);
+
+  private:
+    /** storage shared with the LogContainers created */
+    struct Storage final {
+        ~Storage();
+
+        /** recycled LogContainers */
+        std::vector<LogContainer *> logContainers {};
+
+        /** released compressedFile buffers */
+        std::vector<std::vector<uint8_t>> compressedFiles {};
+
+        /** maximum number of LogContainers resp. buffers */
+        std::size_t maxSize {16};
+
+        /** mutex */
+        std::mutex mutex {};
+    };
+
+    /** storage */
+    std::shared_ptr<Storage> m_storage;
+
+    /**
+     * Return LogContainer into the pool, or delete it.
+     *
+     * @param[in] storage storage of the pool, if it still exists
+     * @param[in] logContainer LogContainer
+     */
+    static void recycle(const std::weak_ptr<Storage> & storage, LogContainer * logContainer);
+};
+
+}
+}
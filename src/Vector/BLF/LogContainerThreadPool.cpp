@@ -0,0 +1,156 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <Vector/BLF/LogContainerThreadPool.h>
+
+namespace Vector {
+namespace BLF {
+
+LogContainerThreadPool::~LogContainerThreadPool() {
+    stop();
+}
+
+void LogContainerThreadPool::start(uint32_t threads, Task task) {
+    /* stop previous worker threads */
+    stop();
+
+    /* mutex lock */
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    /* start worker threads */
+    m_abort = false;
+    m_task = task;
+    for (uint32_t i = 0; i < threads; ++i)
+        m_threads.emplace_back(workerThread, this);
+}
+
+void LogContainerThreadPool::stop() {
+    /* stop */
+    {
+        /* mutex lock */
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_abort = true;
+
+        /* trigger blocked threads */
+        m_jobWritten.notify_all();
+        m_jobDone.notify_all();
+    }
+
+    /* finalize worker threads */
+    for (std::thread & thread : m_threads)
+        if (thread.joinable())
+            thread.join();
+    m_threads.clear();
+
+    /* mutex lock */
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    /* drop remaining jobs */
+    m_jobs.clear();
+    m_pendingJobs.clear();
+}
+
+void LogContainerThreadPool::write(const std::shared_ptr<LogContainer> & logContainer) {
+    /* create job */
+    std::shared_ptr<Job> job = std::make_shared<Job>();
+    job->logContainer = logContainer;
+
+    /* mutex lock */
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    /* enqueue job */
+    m_jobs.push_back(job);
+    m_pendingJobs.push_back(job);
+
+    /* notify */
+    m_jobWritten.notify_one();
+}
+
+std::shared_ptr<LogContainer> LogContainerThreadPool::read() {
+    /* mutex lock */
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    /* check for data */
+    if (m_jobs.empty())
+        return nullptr;
+
+    /* wait until oldest job is done */
+    m_jobDone.wait(lock, [&] {
+        return
+        m_abort ||
+        m_jobs.front()->done;
+    });
+    if (m_abort)
+        return nullptr;
+
+    /* dequeue job */
+    std::shared_ptr<Job> job = m_jobs.front();
+    m_jobs.pop_front();
+
+    /* forward exceptions */
+    if (job->exception)
+        std::rethrow_exception(job->exception);
+
+    return job->logContainer;
+}
+
+std::size_t LogContainerThreadPool::size() const {
+    /* mutex lock */
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_jobs.size();
+}
+
+uint32_t LogContainerThreadPool::threads() const {
+    /* mutex lock */
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return static_cast<uint32_t>(m_threads.size());
+}
+
+void LogContainerThreadPool::workerThread(LogContainerThreadPool * threadPool) {
+    for (;;) {
+        std::shared_ptr<Job> job;
+
+        /* get pending job */
+        {
+            /* mutex lock */
+            std::unique_lock<std::mutex> lock(threadPool->m_mutex);
+
+            /* wait for job */
+            threadPool->m_jobWritten.wait(lock, [&] {
+                return
+                threadPool->m_abort ||
+                !threadPool->m_pendingJobs.empty();
+            });
+            if (threadPool->m_abort)
+                return;
+
+            job = threadPool->m_pendingJobs.front();
+            threadPool->m_pendingJobs.pop_front();
+        }
+
+        /* process job */
+        try {
+            threadPool->m_task(*job->logContainer);
+        } catch (...) {
+            job->exception = std::current_exception();
+        }
+
+        /* mark job as done */
+        {
+            /* mutex lock */
+            std::lock_guard<std::mutex> lock(threadPool->m_mutex);
+
+            job->done = true;
+
+            /* notify */
+            threadPool->m_jobDone.notify_all();
+        }
+    }
+}
+
+}
+}
@@ -0,0 +1,136 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <Vector/BLF/platform.h>
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <Vector/BLF/LogContainer.h>
+
+#include <Vector/BLF/vector_blf_export.h>
+
+namespace Vector {
+namespace BLF {
+
+/**
+ * Thread pool to process LogContainers in parallel.
+ *
+ * LogContainers are processed (e.g. inflated) by several worker threads
+ * concurrently, but they are returned in the same order as they were written.
+ * So this class is a queue with a reorder buffer at its end.
+ *
+ * This class is thread-safe.
+ */
+class VECTOR_BLF_EXPORT LogContainerThreadPool final {
+  public:
+    /** task that is executed on each LogContainer */
+    using Task = std::function<void(LogContainer &)>;
+
+    LogContainerThreadPool() = default;
+    ~LogContainerThreadPool();
+    LogContainerThreadPool(const LogContainerThreadPool &) = delete;
+    LogContainerThreadPool & operator=(const LogContainerThreadPool &) = delete;
+    LogContainerThreadPool(LogContainerThreadPool &&) = delete;
+    LogContainerThreadPool & operator=(LogContainerThreadPool &&) = delete;
+
+    /**
+     * Start worker threads.
+     *
+     * @param[in] threads number of worker threads
+     * @param[in] task task executed on each LogContainer
+     */
+    void start(uint32_t threads, Task task);
+
+    /**
+     * Stop worker threads.
+     *
+     * LogContainers that were not read yet are dropped.
+     */
+    void stop();
+
+    /**
+     * Enqueue a LogContainer for processing.
+     *
+     * @param[in] logContainer log container
+     */
+    void write(const std::shared_ptr<LogContainer> & logContainer);
+
+    /**
+     * Dequeue the oldest LogContainer.
+     *
+     * This blocks until the LogContainer is processed.
+     * Exceptions thrown by the task are rethrown here.
+     *
+     * @return log container (or nullptr if empty or stopped)
+     */
+    std::shared_ptr<LogContainer> read();
+
+    /**
+     * Number of LogContainers written, but not read yet.
+     *
+     * @return number of log containers
+     */
+    std::size_t size() const;
+
+    /**
+     * Number of worker threads.
+     *
+     * @return number of worker threads
+     */
+    uint32_t threads() const;
+
+  private:
+    /** LogContainer with its processing state */
+    struct Job {
+        /** log container */
+        std::shared_ptr<LogContainer> logContainer {};
+
+        /** task finished */
+        bool done {false};
+
+        /** exception thrown by task */
+        std::exception_ptr exception {nullptr};
+    };
+
+    /** abort further operations */
+    bool m_abort {};
+
+    /** task */
+    Task m_task {};
+
+    /** all jobs in write order */
+    std::deque<std::shared_ptr<Job>> m_jobs {};
+
+    /** jobs not yet taken by a worker thread */
+    std::deque<std::shared_ptr<Job>> m_pendingJobs {};
+
+    /** worker threads */
+    std::vector<std::thread> m_threads {};
+
+    /** mutex */
+    mutable std::mutex m_mutex {};
+
+    /** job was written */
+    std::condition_variable m_jobWritten {};
+
+    /** job was done */
+    std::condition_variable m_jobDone {};
+
+    /**
+     * process pending jobs
+     */
+    static void workerThread(LogContainerThreadPool * threadPool);
+};
+
+}
+}
@@ -0,0 +1,195 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <Vector/BLF/MemoryFile.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace Vector {
+namespace BLF {
+
+MemoryFile::~MemoryFile() {
+    close();
+}
+
+std::streamsize MemoryFile::gcount() const {
+    return m_gcount;
+}
+
+void MemoryFile::read(char * s, std::streamsize n) {
+    m_gcount = 0;
+
+    /* check state */
+    if (!m_isOpen || (m_rdstate != std::ios_base::goodbit)) {
+        m_rdstate |= std::ios_base::failbit;
+        return;
+    }
+
+    /* handle read behind eof */
+    std::streamsize available = std::max(m_fileSize - m_tellg, std::streamsize(0));
+    if (n > available) {
+        n = available;
+        m_rdstate = std::ios_base::eofbit | std::ios_base::failbit;
+    }
+
+    /* read data */
+    if (n > 0)
+        std::memcpy(s, data() + m_tellg, static_cast<std::size_t>(n));
+    m_gcount = n;
+    m_tellg += n;
+}
+
+const char * MemoryFile::readView(std::streamsize n) {
+    /* check state and available data */
+    if (!m_isOpen || (m_rdstate != std::ios_base::goodbit) || (n + m_tellg > m_fileSize))
+        return nullptr;
+
+    /* read data */
+    const char * s = data() + m_tellg;
+    m_gcount = n;
+    m_tellg += n;
+    return s;
+}
+
+std::streampos MemoryFile::tellg() {
+    /* in case of failure return -1 */
+    if (!m_isOpen || (m_rdstate & (std::ios_base::failbit | std::ios_base::badbit)))
+        return -1;
+    return m_tellg;
+}
+
+void MemoryFile::seekg(std::streamoff off, const std::ios_base::seekdir way) {
+    /* check state */
+    if (!m_isOpen || (m_rdstate & (std::ios_base::failbit | std::ios_base::badbit))) {
+        m_rdstate |= std::ios_base::failbit;
+        return;
+    }
+
+    /* calculate new get position */
+    std::streamoff pos = off;
+    if (way == std::ios_base::cur)
+        pos += m_tellg;
+    else if (way == std::ios_base::end)
+        pos += m_fileSize;
+    if (pos < 0) {
+        m_rdstate |= std::ios_base::failbit;
+        return;
+    }
+
+    /* new get position */
+    m_tellg = pos;
+    m_rdstate = std::ios_base::goodbit;
+}
+
+void MemoryFile::write(const char * s, std::streamsize n) {
+    /* check state */
+    if (!m_isOpen || (m_buffer == nullptr)) {
+        m_rdstate |= std::ios_base::badbit;
+        return;
+    }
+    if (n <= 0)
+        return;
+
+    /* grow vector */
+    std::size_t end = static_cast<std::size_t>(m_tellp + n);
+    if (end > m_buffer->size()) {
+        m_buffer->resize(end);
+        m_fileSize = static_cast<std::streamsize>(end);
+    }
+
+    /* write data */
+    std::memcpy(m_buffer->data() + m_tellp, s, static_cast<std::size_t>(n));
+    m_tellp += n;
+}
+
+std::streampos MemoryFile::tellp() {
+    /* in case of failure or reading return -1 */
+    if (!m_isOpen || (m_buffer == nullptr))
+        return -1;
+    return m_tellp;
+}
+
+bool MemoryFile::good() const {
+    return m_isOpen && (m_rdstate == std::ios_base::goodbit);
+}
+
+bool MemoryFile::eof() const {
+    return (m_rdstate & std::ios_base::eofbit);
+}
+
+void MemoryFile::open(const char * data, std::streamsize size) {
+    /* check */
+    if (m_isOpen)
+        return;
+
+    /* reset state */
+    m_isOpen = true;
+    m_data = data;
+    m_buffer = nullptr;
+    m_fileSize = size;
+    m_tellg = 0;
+    m_tellp = 0;
+    m_gcount = 0;
+    m_rdstate = std::ios_base::goodbit;
+}
+
+void MemoryFile::open(std::vector<char> & data) {
+    /* check */
+    if (m_isOpen)
+        return;
+
+    /* reset state */
+    data.clear();
+    m_isOpen = true;
+    m_data = nullptr;
+    m_buffer = &data;
+    m_fileSize = 0;
+    m_tellg = 0;
+    m_tellp = 0;
+    m_gcount = 0;
+    m_rdstate = std::ios_base::goodbit;
+}
+
+bool MemoryFile::is_open() const {
+    return m_isOpen;
+}
+
+void MemoryFile::close() {
+    /* the memory is owned by the caller */
+    m_isOpen = false;
+    m_data = nullptr;
+    m_buffer = nullptr;
+    m_fileSize = 0;
+}
+
+void MemoryFile::seekp(std::streampos pos) {
+    /* check state */
+    if (!m_isOpen || (m_buffer == nullptr) || (pos < 0)) {
+        m_rdstate |= std::ios_base::badbit;
+        return;
+    }
+
+    /* new put position */
+    m_tellp = pos;
+}
+
+void MemoryFile::clear() {
+    m_rdstate = std::ios_base::goodbit;
+}
+
+bool MemoryFile::seekable() const {
+    return true;
+}
+
+std::streamsize MemoryFile::fileSize() const {
+    return m_fileSize;
+}
+
+const char * MemoryFile::data() const {
+    return (m_buffer != nullptr) ? m_buffer->data() : m_data;
+}
+
+}
+}
@@ -0,0 +1,115 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <Vector/BLF/platform.h>
+
+#include <ios>
+#include <vector>
+
+#include <Vector/BLF/AbstractCompressedFile.h>
+
+#include <Vector/BLF/vector_blf_export.h>
+
+namespace Vector {
+namespace BLF {
+
+/**
+ * MemoryFile (BLF data in memory)
+ *
+ * For reading, the file is opened over a memory block owned by the
+ * caller. readView gives direct access to it, so e.g. LogContainers can be
+ * inflated without copying the compressed data first.
+ *
+ * For writing, the file is opened over a vector owned by the caller,
+ * which grows with the written data.
+ *
+ * The memory needs to stay valid as long as the file is open.
+ *
+ * This class is not thread-safe. It should only be accessed by one thread.
+ */
+class VECTOR_BLF_EXPORT MemoryFile final : public AbstractCompressedFile {
+  public:
+    MemoryFile() = default;
+    ~MemoryFile() override;
+    MemoryFile(const MemoryFile &) = delete;
+    MemoryFile & operator=(const MemoryFile &) = delete;
+    MemoryFile(MemoryFile &&) = delete;
+    MemoryFile & operator=(MemoryFile &&) = delete;
+
+    std::streamsize gcount() const override;
+    void read(char * s, std::streamsize n) override;
+    const char * readView(std::streamsize n) override;
+    std::streampos tellg() override;
+    void seekg(std::streamoff off, const std::ios_base::seekdir way = std::ios_base::cur) override;
+    void write(const char * s, std::streamsize n) override;
+    std::streampos tellp() override;
+    bool good() const override;
+    bool eof() const override;
+    bool is_open() const override;
+    void close() override;
+    void seekp(std::streampos pos) override;
+    void clear() override;
+    bool seekable() const override;
+
+    /**
+     * open memory block for reading
+     *
+     * @param[in] data data
+     * @param[in] size size of data
+     */
+    virtual void open(const char * data, std::streamsize size);
+
+    /**
+     * open vector for writing
+     *
+     * The vector is cleared at open.
+     *
+     * @param[out] data vector, that receives the written data
+     */
+    virtual void open(std::vector<char> & data);
+
+    /**
+     * Return file size.
+     *
+     * @return file size
+     */
+    virtual std::streamsize fileSize() const;
+
+  private:
+    /** file is open */
+    bool m_isOpen {};
+
+    /** data for reading */
+    const char * m_data {nullptr};
+
+    /** data for writing */
+    std::vector<char> * m_buffer {nullptr};
+
+    /** file size */
+    std::streamsize m_fileSize {};
+
+    /** get position */
+    std::streamoff m_tellg {};
+
+    /** put position */
+    std::streamoff m_tellp {};
+
+    /** last read size */
+    std::streamsize m_gcount {};
+
+    /** error state */
+    std::ios_base::iostate m_rdstate {std::ios_base::goodbit};
+
+    /**
+     * Return data, either of the memory block or the vector.
+     *
+     * @return data
+     */
+    const char * data() const;
+};
+
+}
+}
@@ -0,0 +1,227 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <Vector/BLF/MemoryMappedFile.h>
+
+#include <algorithm>
+#include <cstring>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Vector {
+namespace BLF {
+
+MemoryMappedFile::~MemoryMappedFile() {
+    close();
+}
+
+std::streamsize MemoryMappedFile::gcount() const {
+    return m_gcount;
+}
+
+void MemoryMappedFile::read(char * s, std::streamsize n) {
+    m_gcount = 0;
+
+    /* check state */
+    if (!m_isOpen || (m_rdstate != std::ios_base::goodbit)) {
+        m_rdstate |= std::ios_base::failbit;
+        return;
+    }
+
+    /* handle read behind eof */
+    std::streamsize available = std::max(m_fileSize - m_tellg, std::streamsize(0));
+    if (n > available) {
+        n = available;
+        m_rdstate = std::ios_base::eofbit | std::ios_base::failbit;
+    }
+
+    /* read data */
+    if (n > 0)
+        std::memcpy(s, m_data + m_tellg, static_cast<std::size_t>(n));
+    m_gcount = n;
+    m_tellg += n;
+}
+
+const char * MemoryMappedFile::readView(std::streamsize n) {
+    /* check state and available data */
+    if (!m_isOpen || (m_rdstate != std::ios_base::goodbit) || (n + m_tellg > m_fileSize))
+        return nullptr;
+
+    /* read data */
+    const char * s = m_data + m_tellg;
+    m_gcount = n;
+    m_tellg += n;
+    return s;
+}
+
+std::streampos MemoryMappedFile::tellg() {
+    /* in case of failure return -1 */
+    if (!m_isOpen || (m_rdstate & (std::ios_base::failbit | std::ios_base::badbit)))
+        return -1;
+    return m_tellg;
+}
+
+void MemoryMappedFile::seekg(std::streamoff off, const std::ios_base::seekdir way) {
+    /* check state */
+    if (!m_isOpen || (m_rdstate & (std::ios_base::failbit | std::ios_base::badbit))) {
+        m_rdstate |= std::ios_base::failbit;
+        return;
+    }
+
+    /* calculate new get position */
+    std::streamoff pos = off;
+    if (way == std::ios_base::cur)
+        pos += m_tellg;
+    else if (way == std::ios_base::end)
+        pos += m_fileSize;
+    if (pos < 0) {
+        m_rdstate |= std::ios_base::failbit;
+        return;
+    }
+
+    /* new get position */
+    m_tellg = pos;
+    m_rdstate = std::ios_base::goodbit;
+}
+
+void MemoryMappedFile::write(const char * /*s*/, std::streamsize /*n*/) {
+    /* read-only */
+    m_rdstate |= std::ios_base::badbit;
+}
+
+std::streampos MemoryMappedFile::tellp() {
+    /* read-only */
+    return -1;
+}
+
+bool MemoryMappedFile::good() const {
+    return m_isOpen && (m_rdstate == std::ios_base::goodbit);
+}
+
+bool MemoryMappedFile::eof() const {
+    return (m_rdstate & std::ios_base::eofbit);
+}
+
+void MemoryMappedFile::open(const char * filename) {
+    /* check */
+    if (m_isOpen)
+        return;
+
+#ifdef _WIN32
+    /* open file */
+    HANDLE fileHandle = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (fileHandle == INVALID_HANDLE_VALUE)
+        return;
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(fileHandle, &fileSize)) {
+        CloseHandle(fileHandle);
+        return;
+    }
+
+    /* map file */
+    if (fileSize.QuadPart > 0) {
+        HANDLE mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mappingHandle == nullptr) {
+            CloseHandle(fileHandle);
+            return;
+        }
+        LPVOID data = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+        if (data == nullptr) {
+            CloseHandle(mappingHandle);
+            CloseHandle(fileHandle);
+            return;
+        }
+        m_mappingHandle = mappingHandle;
+        m_data = static_cast<const char *>(data);
+    }
+    m_fileHandle = fileHandle;
+    m_fileSize = static_cast<std::streamsize>(fileSize.QuadPart);
+#else
+    /* open file */
+    int fd = ::open(filename, O_RDONLY);
+    if (fd < 0)
+        return;
+    struct stat st;
+    if (::fstat(fd, &st) != 0) {
+        ::close(fd);
+        return;
+    }
+
+    /* map file */
+    if (st.st_size > 0) {
+        void * data = ::mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED) {
+            ::close(fd);
+            return;
+        }
+        ::madvise(data, static_cast<std::size_t>(st.st_size), MADV_SEQUENTIAL);
+        m_data = static_cast<const char *>(data);
+    }
+
+    /* the mapping stays valid after closing the file descriptor */
+    ::close(fd);
+    m_fileSize = static_cast<std::streamsize>(st.st_size);
+#endif
+
+    /* reset state */
+    m_isOpen = true;
+    m_tellg = 0;
+    m_gcount = 0;
+    m_rdstate = std::ios_base::goodbit;
+}
+
+bool MemoryMappedFile::is_open() const {
+    return m_isOpen;
+}
+
+void MemoryMappedFile::close() {
+    /* check */
+    if (!m_isOpen)
+        return;
+
+#ifdef _WIN32
+    if (m_data != nullptr)
+        UnmapViewOfFile(m_data);
+    if (m_mappingHandle != nullptr)
+        CloseHandle(m_mappingHandle);
+    if (m_fileHandle != nullptr)
+        CloseHandle(m_fileHandle);
+    m_mappingHandle = nullptr;
+    m_fileHandle = nullptr;
+#else
+    if (m_data != nullptr)
+        ::munmap(const_cast<char *>(m_data), static_cast<std::size_t>(m_fileSize));
+#endif
+
+    m_isOpen = false;
+    m_data = nullptr;
+    m_fileSize = 0;
+}
+
+void MemoryMappedFile::seekp(std::streampos /*pos*/) {
+    /* read-only */
+    m_rdstate |= std::ios_base::badbit;
+}
+
+void MemoryMappedFile::clear() {
+    m_rdstate = std::ios_base::goodbit;
+}
+
+bool MemoryMappedFile::seekable() const {
+    return true;
+}
+
+std::streamsize MemoryMappedFile::fileSize() const {
+    return m_fileSize;
+}
+
+}
+}
@@ -0,0 +1,96 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <Vector/BLF/platform.h>
+
+#include <ios>
+
+#include <Vector/BLF/AbstractCompressedFile.h>
+
+#include <Vector/BLF/vector_blf_export.h>
+
+namespace Vector {
+namespace BLF {
+
+/**
+ * MemoryMappedFile (Input file mapped into memory)
+ *
+ * The file is mapped read-only into memory. readView gives direct
+ * access to the mapped data, so e.g. LogContainers can be inflated
+ * without copying the compressed data first.
+ *
+ * This class is not thread-safe. It should only be accessed by one thread.
+ */
+class VECTOR_BLF_EXPORT MemoryMappedFile final : public AbstractCompressedFile {
+  public:
+    MemoryMappedFile() = default;
+    ~MemoryMappedFile() override;
+    MemoryMappedFile(const MemoryMappedFile &) = delete;
+    MemoryMappedFile & operator=(const MemoryMappedFile &) = delete;
+    MemoryMappedFile(MemoryMappedFile &&) = delete;
+    MemoryMappedFile & operator=(MemoryMappedFile &&) = delete;
+
+    std::streamsize gcount() const override;
+    void read(char * s, std::streamsize n) override;
+    const char * readView(std::streamsize n) override;
+    std::streampos tellg() override;
+    void seekg(std::streamoff off, const std::ios_base::seekdir way = std::ios_base::cur) override;
+    void write(const char * s, std::streamsize n) override;
+    std::streampos tellp() override;
+    bool good() const override;
+    bool eof() const override;
+    bool is_open() const override;
+    void close() override;
+    void seekp(std::streampos pos) override;
+    void clear() override;
+    bool seekable() const override;
+
+    /**
+     * open file
+     *
+     * The file can only be opened for reading.
+     *
+     * @param filename file name
+     */
+    virtual void open(const char * filename);
+
+    /**
+     * Return file size.
+     *
+     * @return file size
+     */
+    virtual std::streamsize fileSize() const;
+
+  private:
+    /** file is open */
+    bool m_isOpen {};
+
+    /** mapped data */
+    const char * m_data {nullptr};
+
+    /** file size */
+    std::streamsize m_fileSize {};
+
+    /** get position */
+    std::streamoff m_tellg {};
+
+    /** last read size */
+    std::streamsize m_gcount {};
+
+    /** error state */
+    std::ios_base::iostate m_rdstate {std::ios_base::goodbit};
+
+#ifdef _WIN32
+    /** file handle */
+    void * m_fileHandle {nullptr};
+
+    /** file mapping handle */
+    void * m_mappingHandle {nullptr};
+#endif
+};
+
+}
+}
@@ -4,20 +4,26 @@
 
 #include <Vector/BLF/Most150AllocTab.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of Most150AllocTab from channel to reservedMost150AllocTab */
+using Most150AllocTabFields = Fields<
+    VECTOR_BLF_FIELD(Most150AllocTab, channel),
+    VECTOR_BLF_FIELD(Most150AllocTab, eventModeFlags),
+    VECTOR_BLF_FIELD(Most150AllocTab, freeBytes),
+    VECTOR_BLF_FIELD(Most150AllocTab, length),
+    VECTOR_BLF_FIELD(Most150AllocTab, reservedMost150AllocTab)>;
+
 Most150AllocTab::Most150AllocTab() :
     ObjectHeader2(ObjectType::MOST_150_ALLOCTAB) {
 }
 
 void Most150AllocTab::read(AbstractFile & is) {
     ObjectHeader2::read(is);
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&eventModeFlags), sizeof(eventModeFlags));
-    is.read(reinterpret_cast<char *>(&freeBytes), sizeof(freeBytes));
-    is.read(reinterpret_cast<char *>(&length), sizeof(length));
-    is.read(reinterpret_cast<char *>(&reservedMost150AllocTab), sizeof(reservedMost150AllocTab));
+    Most150AllocTabFields::read(is, *this);
     tableData.resize(length);
     is.read(reinterpret_cast<char *>(tableData.data()), length);
 
@@ -30,11 +36,7 @@ void Most150AllocTab::write(AbstractFile & os) {
     length = static_cast<uint16_t>(tableData.size());
 
     ObjectHeader2::write(os);
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&eventModeFlags), sizeof(eventModeFlags));
-    os.write(reinterpret_cast<char *>(&freeBytes), sizeof(freeBytes));
-    os.write(reinterpret_cast<char *>(&length), sizeof(length));
-    os.write(reinterpret_cast<char *>(&reservedMost150AllocTab), sizeof(reservedMost150AllocTab));
+    Most150AllocTabFields::write(os, *this);
     os.write(reinterpret_cast<char *>(tableData.data()), length);
 
     /* skip padding */
@@ -44,11 +46,7 @@ void Most150AllocTab::write(AbstractFile & os) {
 uint32_t Most150AllocTab::calculateObjectSize() const {
     return
         ObjectHeader2::calculateObjectSize() +
-        sizeof(channel) +
-        sizeof(eventModeFlags) +
-        sizeof(freeBytes) +
-        sizeof(length) +
-        sizeof(reservedMost150AllocTab) +
+        Most150AllocTabFields::size() +
         length;
 }
 
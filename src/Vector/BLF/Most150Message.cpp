@@ -4,31 +4,37 @@
 
 #include <Vector/BLF/Most150Message.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of Most150Message from channel to reservedMost150Message3 */
+using Most150MessageFields = Fields<
+    VECTOR_BLF_FIELD(Most150Message, channel),
+    VECTOR_BLF_FIELD(Most150Message, dir),
+    VECTOR_BLF_FIELD(Most150Message, reservedMost150Message1),
+    VECTOR_BLF_FIELD(Most150Message, sourceAdr),
+    VECTOR_BLF_FIELD(Most150Message, destAdr),
+    VECTOR_BLF_FIELD(Most150Message, transferType),
+    VECTOR_BLF_FIELD(Most150Message, state),
+    VECTOR_BLF_FIELD(Most150Message, ackNack),
+    VECTOR_BLF_FIELD(Most150Message, reservedMost150Message2),
+    VECTOR_BLF_FIELD(Most150Message, crc),
+    VECTOR_BLF_FIELD(Most150Message, pAck),
+    VECTOR_BLF_FIELD(Most150Message, cAck),
+    VECTOR_BLF_FIELD(Most150Message, priority),
+    VECTOR_BLF_FIELD(Most150Message, pIndex),
+    VECTOR_BLF_FIELD(Most150Message, msgLen),
+    VECTOR_BLF_FIELD(Most150Message, reservedMost150Message3)>;
+
 Most150Message::Most150Message() :
     ObjectHeader2(ObjectType::MOST_150_MESSAGE) {
 }
 
 void Most150Message::read(AbstractFile & is) {
     ObjectHeader2::read(is);
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&dir), sizeof(dir));
-    is.read(reinterpret_cast<char *>(&reservedMost150Message1), sizeof(reservedMost150Message1));
-    is.read(reinterpret_cast<char *>(&sourceAdr), sizeof(sourceAdr));
-    is.read(reinterpret_cast<char *>(&destAdr), sizeof(destAdr));
-    is.read(reinterpret_cast<char *>(&transferType), sizeof(transferType));
-    is.read(reinterpret_cast<char *>(&state), sizeof(state));
-    is.read(reinterpret_cast<char *>(&ackNack), sizeof(ackNack));
-    is.read(reinterpret_cast<char *>(&reservedMost150Message2), sizeof(reservedMost150Message2));
-    is.read(reinterpret_cast<char *>(&crc), sizeof(crc));
-    is.read(reinterpret_cast<char *>(&pAck), sizeof(pAck));
-    is.read(reinterpret_cast<char *>(&cAck), sizeof(cAck));
-    is.read(reinterpret_cast<char *>(&priority), sizeof(priority));
-    is.read(reinterpret_cast<char *>(&pIndex), sizeof(pIndex));
-    is.read(reinterpret_cast<char *>(&msgLen), sizeof(msgLen));
-    is.read(reinterpret_cast<char *>(&reservedMost150Message3), sizeof(reservedMost150Message3));
+    Most150MessageFields::read(is, *this);
     msg.resize(msgLen);
     is.read(reinterpret_cast<char *>(msg.data()), msgLen);
 
@@ -41,22 +47,7 @@ void Most150Message::write(AbstractFile & os) {
     msgLen = static_cast<uint32_t>(msg.size());
 
     ObjectHeader2::write(os);
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&dir), sizeof(dir));
-    os.write(reinterpret_cast<char *>(&reservedMost150Message1), sizeof(reservedMost150Message1));
-    os.write(reinterpret_cast<char *>(&sourceAdr), sizeof(sourceAdr));
-    os.write(reinterpret_cast<char *>(&destAdr), sizeof(destAdr));
-    os.write(reinterpret_cast<char *>(&transferType), sizeof(transferType));
-    os.write(reinterpret_cast<char *>(&state), sizeof(state));
-    os.write(reinterpret_cast<char *>(&ackNack), sizeof(ackNack));
-    os.write(reinterpret_cast<char *>(&reservedMost150Message2), sizeof(reservedMost150Message2));
-    os.write(reinterpret_cast<char *>(&crc), sizeof(crc));
-    os.write(reinterpret_cast<char *>(&pAck), sizeof(pAck));
-    os.write(reinterpret_cast<char *>(&cAck), sizeof(cAck));
-    os.write(reinterpret_cast<char *>(&priority), sizeof(priority));
-    os.write(reinterpret_cast<char *>(&pIndex), sizeof(pIndex));
-    os.write(reinterpret_cast<char *>(&msgLen), sizeof(msgLen));
-    os.write(reinterpret_cast<char *>(&reservedMost150Message3), sizeof(reservedMost150Message3));
+    Most150MessageFields::write(os, *this);
     os.write(reinterpret_cast<char *>(msg.data()), msgLen);
 
     /* skip padding */
@@ -66,22 +57,7 @@ void Most150Message::write(AbstractFile & os) {
 uint32_t Most150Message::calculateObjectSize() const {
     return
         ObjectHeader2::calculateObjectSize() +
-        sizeof(channel) +
-        sizeof(dir) +
-        sizeof(reservedMost150Message1) +
-        sizeof(sourceAdr) +
-        sizeof(destAdr) +
-        sizeof(transferType) +
-        sizeof(state) +
-        sizeof(ackNack) +
-        sizeof(reservedMost150Message2) +
-        sizeof(crc) +
-        sizeof(pAck) +
-        sizeof(cAck) +
-        sizeof(priority) +
-        sizeof(pIndex) +
-        sizeof(msgLen) +
-        sizeof(reservedMost150Message3) +
+        Most150MessageFields::size() +
         msgLen;
 }
 
@@ -4,31 +4,37 @@
 
 #include <Vector/BLF/Most150Pkt.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of Most150Pkt from channel to reservedMost150Pkt3 */
+using Most150PktFields = Fields<
+    VECTOR_BLF_FIELD(Most150Pkt, channel),
+    VECTOR_BLF_FIELD(Most150Pkt, dir),
+    VECTOR_BLF_FIELD(Most150Pkt, reservedMost150Pkt1),
+    VECTOR_BLF_FIELD(Most150Pkt, sourceAdr),
+    VECTOR_BLF_FIELD(Most150Pkt, destAdr),
+    VECTOR_BLF_FIELD(Most150Pkt, transferType),
+    VECTOR_BLF_FIELD(Most150Pkt, state),
+    VECTOR_BLF_FIELD(Most150Pkt, ackNack),
+    VECTOR_BLF_FIELD(Most150Pkt, reservedMost150Pkt2),
+    VECTOR_BLF_FIELD(Most150Pkt, crc),
+    VECTOR_BLF_FIELD(Most150Pkt, pAck),
+    VECTOR_BLF_FIELD(Most150Pkt, cAck),
+    VECTOR_BLF_FIELD(Most150Pkt, priority),
+    VECTOR_BLF_FIELD(Most150Pkt, pIndex),
+    VECTOR_BLF_FIELD(Most150Pkt, pktDataLength),
+    VECTOR_BLF_FIELD(Most150Pkt, reservedMost150Pkt3)>;
+
 Most150Pkt::Most150Pkt() :
     ObjectHeader2(ObjectType::MOST_150_PKT) {
 }
 
 void Most150Pkt::read(AbstractFile & is) {
     ObjectHeader2::read(is);
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&dir), sizeof(dir));
-    is.read(reinterpret_cast<char *>(&reservedMost150Pkt1), sizeof(reservedMost150Pkt1));
-    is.read(reinterpret_cast<char *>(&sourceAdr), sizeof(sourceAdr));
-    is.read(reinterpret_cast<char *>(&destAdr), sizeof(destAdr));
-    is.read(reinterpret_cast<char *>(&transferType), sizeof(transferType));
-    is.read(reinterpret_cast<char *>(&state), sizeof(state));
-    is.read(reinterpret_cast<char *>(&ackNack), sizeof(ackNack));
-    is.read(reinterpret_cast<char *>(&reservedMost150Pkt2), sizeof(reservedMost150Pkt2));
-    is.read(reinterpret_cast<char *>(&crc), sizeof(crc));
-    is.read(reinterpret_cast<char *>(&pAck), sizeof(pAck));
-    is.read(reinterpret_cast<char *>(&cAck), sizeof(cAck));
-    is.read(reinterpret_cast<char *>(&priority), sizeof(priority));
-    is.read(reinterpret_cast<char *>(&pIndex), sizeof(pIndex));
-    is.read(reinterpret_cast<char *>(&pktDataLength), sizeof(pktDataLength));
-    is.read(reinterpret_cast<char *>(&reservedMost150Pkt3), sizeof(reservedMost150Pkt3));
+    Most150PktFields::read(is, *this);
     pktData.resize(pktDataLength);
     is.read(reinterpret_cast<char *>(pktData.data()), pktDataLength);
 
@@ -41,22 +47,7 @@ void Most150Pkt::write(AbstractFile & os) {
     pktDataLength = static_cast<uint32_t>(pktData.size());
 
     ObjectHeader2::write(os);
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&dir), sizeof(dir));
-    os.write(reinterpret_cast<char *>(&reservedMost150Pkt1), sizeof(reservedMost150Pkt1));
-    os.write(reinterpret_cast<char *>(&sourceAdr), sizeof(sourceAdr));
-    os.write(reinterpret_cast<char *>(&destAdr), sizeof(destAdr));
-    os.write(reinterpret_cast<char *>(&transferType), sizeof(transferType));
-    os.write(reinterpret_cast<char *>(&state), sizeof(state));
-    os.write(reinterpret_cast<char *>(&ackNack), sizeof(ackNack));
-    os.write(reinterpret_cast<char *>(&reservedMost150Pkt2), sizeof(reservedMost150Pkt2));
-    os.write(reinterpret_cast<char *>(&crc), sizeof(crc));
-    os.write(reinterpret_cast<char *>(&pAck), sizeof(pAck));
-    os.write(reinterpret_cast<char *>(&cAck), sizeof(cAck));
-    os.write(reinterpret_cast<char *>(&priority), sizeof(priority));
-    os.write(reinterpret_cast<char *>(&pIndex), sizeof(pIndex));
-    os.write(reinterpret_cast<char *>(&pktDataLength), sizeof(pktDataLength));
-    os.write(reinterpret_cast<char *>(&reservedMost150Pkt3), sizeof(reservedMost150Pkt3));
+    Most150PktFields::write(os, *this);
     os.write(reinterpret_cast<char *>(pktData.data()), pktDataLength);
 
     /* skip padding */
@@ -66,22 +57,7 @@ void Most150Pkt::write(AbstractFile & os) {
 uint32_t Most150Pkt::calculateObjectSize() const {
     return
         ObjectHeader2::calculateObjectSize() +
-        sizeof(channel) +
-        sizeof(dir) +
-        sizeof(reservedMost150Pkt1) +
-        sizeof(sourceAdr) +
-        sizeof(destAdr) +
-        sizeof(transferType) +
-        sizeof(state) +
-        sizeof(ackNack) +
-        sizeof(reservedMost150Pkt2) +
-        sizeof(crc) +
-        sizeof(pAck) +
-        sizeof(cAck) +
-        sizeof(priority) +
-        sizeof(pIndex) +
-        sizeof(pktDataLength) +
-        sizeof(reservedMost150Pkt3) +
+        Most150PktFields::size() +
         pktDataLength;
 }
 
@@ -4,30 +4,36 @@
 
 #include <Vector/BLF/Most150PktFragment.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of Most150PktFragment from channel to reservedMost150PktFragment2 */
+using Most150PktFragmentFields = Fields<
+    VECTOR_BLF_FIELD(Most150PktFragment, channel),
+    VECTOR_BLF_FIELD(Most150PktFragment, reservedMost150PktFragment1),
+    VECTOR_BLF_FIELD(Most150PktFragment, ackNack),
+    VECTOR_BLF_FIELD(Most150PktFragment, validMask),
+    VECTOR_BLF_FIELD(Most150PktFragment, sourceAdr),
+    VECTOR_BLF_FIELD(Most150PktFragment, destAdr),
+    VECTOR_BLF_FIELD(Most150PktFragment, pAck),
+    VECTOR_BLF_FIELD(Most150PktFragment, cAck),
+    VECTOR_BLF_FIELD(Most150PktFragment, priority),
+    VECTOR_BLF_FIELD(Most150PktFragment, pIndex),
+    VECTOR_BLF_FIELD(Most150PktFragment, crc),
+    VECTOR_BLF_FIELD(Most150PktFragment, dataLen),
+    VECTOR_BLF_FIELD(Most150PktFragment, dataLenAnnounced),
+    VECTOR_BLF_FIELD(Most150PktFragment, firstDataLen),
+    VECTOR_BLF_FIELD(Most150PktFragment, reservedMost150PktFragment2)>;
+
 Most150PktFragment::Most150PktFragment() :
     ObjectHeader2(ObjectType::MOST_150_PKT_FRAGMENT) {
 }
 
 void Most150PktFragment::read(AbstractFile & is) {
     ObjectHeader2::read(is);
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&reservedMost150PktFragment1), sizeof(reservedMost150PktFragment1));
-    is.read(reinterpret_cast<char *>(&ackNack), sizeof(ackNack));
-    is.read(reinterpret_cast<char *>(&validMask), sizeof(validMask));
-    is.read(reinterpret_cast<char *>(&sourceAdr), sizeof(sourceAdr));
-    is.read(reinterpret_cast<char *>(&destAdr), sizeof(destAdr));
-    is.read(reinterpret_cast<char *>(&pAck), sizeof(pAck));
-    is.read(reinterpret_cast<char *>(&cAck), sizeof(cAck));
-    is.read(reinterpret_cast<char *>(&priority), sizeof(priority));
-    is.read(reinterpret_cast<char *>(&pIndex), sizeof(pIndex));
-    is.read(reinterpret_cast<char *>(&crc), sizeof(crc));
-    is.read(reinterpret_cast<char *>(&dataLen), sizeof(dataLen));
-    is.read(reinterpret_cast<char *>(&dataLenAnnounced), sizeof(dataLenAnnounced));
-    is.read(reinterpret_cast<char *>(&firstDataLen), sizeof(firstDataLen));
-    is.read(reinterpret_cast<char *>(&reservedMost150PktFragment2), sizeof(reservedMost150PktFragment2));
+    Most150PktFragmentFields::read(is, *this);
     firstData.resize(firstDataLen);
     is.read(reinterpret_cast<char *>(firstData.data()), firstDataLen);
 
@@ -40,21 +46,7 @@ void Most150PktFragment::write(AbstractFile & os) {
     firstDataLen = static_cast<uint32_t>(firstData.size());
 
     ObjectHeader2::write(os);
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&reservedMost150PktFragment1), sizeof(reservedMost150PktFragment1));
-    os.write(reinterpret_cast<char *>(&ackNack), sizeof(ackNack));
-    os.write(reinterpret_cast<char *>(&validMask), sizeof(validMask));
-    os.write(reinterpret_cast<char *>(&sourceAdr), sizeof(sourceAdr));
-    os.write(reinterpret_cast<char *>(&destAdr), sizeof(destAdr));
-    os.write(reinterpret_cast<char *>(&pAck), sizeof(pAck));
-    os.write(reinterpret_cast<char *>(&cAck), sizeof(cAck));
-    os.write(reinterpret_cast<char *>(&priority), sizeof(priority));
-    os.write(reinterpret_cast<char *>(&pIndex), sizeof(pIndex));
-    os.write(reinterpret_cast<char *>(&crc), sizeof(crc));
-    os.write(reinterpret_cast<char *>(&dataLen), sizeof(dataLen));
-    os.write(reinterpret_cast<char *>(&dataLenAnnounced), sizeof(dataLenAnnounced));
-    os.write(reinterpret_cast<char *>(&firstDataLen), sizeof(firstDataLen));
-    os.write(reinterpret_cast<char *>(&reservedMost150PktFragment2), sizeof(reservedMost150PktFragment2));
+    Most150PktFragmentFields::write(os, *this);
     os.write(reinterpret_cast<char *>(firstData.data()), firstDataLen);
 
     /* skip padding */
@@ -64,21 +56,7 @@ void Most150PktFragment::write(AbstractFile & os) {
 uint32_t Most150PktFragment::calculateObjectSize() const {
     return
         ObjectHeader2::calculateObjectSize() +
-        sizeof(channel) +
-        sizeof(reservedMost150PktFragment1) +
-        sizeof(ackNack) +
-        sizeof(validMask) +
-        sizeof(sourceAdr) +
-        sizeof(destAdr) +
-        sizeof(pAck) +
-        sizeof(cAck) +
-        sizeof(priority) +
-        sizeof(pIndex) +
-        sizeof(crc) +
-        sizeof(dataLen) +
-        sizeof(dataLenAnnounced) +
-        sizeof(firstDataLen) +
-        sizeof(reservedMost150PktFragment2) +
+        Most150PktFragmentFields::size() +
         firstDataLen;
 }
 
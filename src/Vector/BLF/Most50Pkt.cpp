@@ -4,30 +4,36 @@
 
 #include <Vector/BLF/Most50Pkt.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of Most50Pkt from channel to reservedMost50Pkt5 */
+using Most50PktFields = Fields<
+    VECTOR_BLF_FIELD(Most50Pkt, channel),
+    VECTOR_BLF_FIELD(Most50Pkt, dir),
+    VECTOR_BLF_FIELD(Most50Pkt, reservedMost50Pkt1),
+    VECTOR_BLF_FIELD(Most50Pkt, sourceAdr),
+    VECTOR_BLF_FIELD(Most50Pkt, destAdr),
+    VECTOR_BLF_FIELD(Most50Pkt, transferType),
+    VECTOR_BLF_FIELD(Most50Pkt, state),
+    VECTOR_BLF_FIELD(Most50Pkt, ackNack),
+    VECTOR_BLF_FIELD(Most50Pkt, reservedMost50Pkt2),
+    VECTOR_BLF_FIELD(Most50Pkt, crc),
+    VECTOR_BLF_FIELD(Most50Pkt, reservedMost50Pkt3),
+    VECTOR_BLF_FIELD(Most50Pkt, priority),
+    VECTOR_BLF_FIELD(Most50Pkt, reservedMost50Pkt4),
+    VECTOR_BLF_FIELD(Most50Pkt, pktDataLength),
+    VECTOR_BLF_FIELD(Most50Pkt, reservedMost50Pkt5)>;
+
 Most50Pkt::Most50Pkt() :
     ObjectHeader2(ObjectType::MOST_50_PKT) {
 }
 
 void Most50Pkt::read(AbstractFile & is) {
     ObjectHeader2::read(is);
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&dir), sizeof(dir));
-    is.read(reinterpret_cast<char *>(&reservedMost50Pkt1), sizeof(reservedMost50Pkt1));
-    is.read(reinterpret_cast<char *>(&sourceAdr), sizeof(sourceAdr));
-    is.read(reinterpret_cast<char *>(&destAdr), sizeof(destAdr));
-    is.read(reinterpret_cast<char *>(&transferType), sizeof(transferType));
-    is.read(reinterpret_cast<char *>(&state), sizeof(state));
-    is.read(reinterpret_cast<char *>(&ackNack), sizeof(ackNack));
-    is.read(reinterpret_cast<char *>(&reservedMost50Pkt2), sizeof(reservedMost50Pkt2));
-    is.read(reinterpret_cast<char *>(&crc), sizeof(crc));
-    is.read(reinterpret_cast<char *>(&reservedMost50Pkt3), sizeof(reservedMost50Pkt3));
-    is.read(reinterpret_cast<char *>(&priority), sizeof(priority));
-    is.read(reinterpret_cast<char *>(&reservedMost50Pkt4), sizeof(reservedMost50Pkt4));
-    is.read(reinterpret_cast<char *>(&pktDataLength), sizeof(pktDataLength));
-    is.read(reinterpret_cast<char *>(&reservedMost50Pkt5), sizeof(reservedMost50Pkt5));
+    Most50PktFields::read(is, *this);
     pktData.resize(pktDataLength);
     is.read(reinterpret_cast<char *>(pktData.data()), pktDataLength);
 
@@ -40,21 +46,7 @@ void Most50Pkt::write(AbstractFile & os) {
     pktDataLength = static_cast<uint32_t>(pktData.size());
 
     ObjectHeader2::write(os);
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&dir), sizeof(dir));
-    os.write(reinterpret_cast<char *>(&reservedMost50Pkt1), sizeof(reservedMost50Pkt1));
-    os.write(reinterpret_cast<char *>(&sourceAdr), sizeof(sourceAdr));
-    os.write(reinterpret_cast<char *>(&destAdr), sizeof(destAdr));
-    os.write(reinterpret_cast<char *>(&transferType), sizeof(transferType));
-    os.write(reinterpret_cast<char *>(&state), sizeof(state));
-    os.write(reinterpret_cast<char *>(&ackNack), sizeof(ackNack));
-    os.write(reinterpret_cast<char *>(&reservedMost50Pkt2), sizeof(reservedMost50Pkt2));
-    os.write(reinterpret_cast<char *>(&crc), sizeof(crc));
-    os.write(reinterpret_cast<char *>(&reservedMost50Pkt3), sizeof(reservedMost50Pkt3));
-    os.write(reinterpret_cast<char *>(&priority), sizeof(priority));
-    os.write(reinterpret_cast<char *>(&reservedMost50Pkt4), sizeof(reservedMost50Pkt4));
-    os.write(reinterpret_cast<char *>(&pktDataLength), sizeof(pktDataLength));
-    os.write(reinterpret_cast<char *>(&reservedMost50Pkt5), sizeof(reservedMost50Pkt5));
+    Most50PktFields::write(os, *this);
     os.write(reinterpret_cast<char *>(pktData.data()), pktDataLength);
 
     /* skip padding */
@@ -64,21 +56,7 @@ void Most50Pkt::write(AbstractFile & os) {
 uint32_t Most50Pkt::calculateObjectSize() const {
     return
         ObjectHeader2::calculateObjectSize() +
-        sizeof(channel) +
-        sizeof(dir) +
-        sizeof(reservedMost50Pkt1) +
-        sizeof(sourceAdr) +
-        sizeof(destAdr) +
-        sizeof(transferType) +
-        sizeof(state) +
-        sizeof(ackNack) +
-        sizeof(reservedMost50Pkt2) +
-        sizeof(crc) +
-        sizeof(reservedMost50Pkt3) +
-        sizeof(priority) +
-        sizeof(reservedMost50Pkt4) +
-        sizeof(pktDataLength) +
-        sizeof(reservedMost50Pkt5) +
+        Most50PktFields::size() +
         pktDataLength;
 }
 
@@ -4,18 +4,24 @@
 
 #include <Vector/BLF/MostAllocTab.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of MostAllocTab from channel to reservedMostAllocTab */
+using MostAllocTabFields = Fields<
+    VECTOR_BLF_FIELD(MostAllocTab, channel),
+    VECTOR_BLF_FIELD(MostAllocTab, length),
+    VECTOR_BLF_FIELD(MostAllocTab, reservedMostAllocTab)>;
+
 MostAllocTab::MostAllocTab() :
     ObjectHeader2(ObjectType::MOST_ALLOCTAB) {
 }
 
 void MostAllocTab::read(AbstractFile & is) {
     ObjectHeader2::read(is);
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&length), sizeof(length));
-    is.read(reinterpret_cast<char *>(&reservedMostAllocTab), sizeof(reservedMostAllocTab));
+    MostAllocTabFields::read(is, *this);
     tableData.resize(length);
     is.read(reinterpret_cast<char *>(tableData.data()), length);
 
@@ -28,9 +34,7 @@ void MostAllocTab::write(AbstractFile & os) {
     length = static_cast<uint16_t>(tableData.size());
 
     ObjectHeader2::write(os);
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&length), sizeof(length));
-    os.write(reinterpret_cast<char *>(&reservedMostAllocTab), sizeof(reservedMostAllocTab));
+    MostAllocTabFields::write(os, *this);
     os.write(reinterpret_cast<char *>(tableData.data()), length);
 
     /* skip padding */
@@ -40,9 +44,7 @@ void MostAllocTab::write(AbstractFile & os) {
 uint32_t MostAllocTab::calculateObjectSize() const {
     return
         ObjectHeader2::calculateObjectSize() +
-        sizeof(channel) +
-        sizeof(length) +
-        sizeof(reservedMostAllocTab) +
+        MostAllocTabFields::size() +
         length;
 }
 
@@ -4,63 +4,45 @@
 
 #include <Vector/BLF/MostCtrl.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of MostCtrl from channel to reservedMostCtrl4 */
+using MostCtrlFields = Fields<
+    VECTOR_BLF_FIELD(MostCtrl, channel),
+    VECTOR_BLF_FIELD(MostCtrl, dir),
+    VECTOR_BLF_FIELD(MostCtrl, reservedMostCtrl1),
+    VECTOR_BLF_FIELD(MostCtrl, sourceAdr),
+    VECTOR_BLF_FIELD(MostCtrl, destAdr),
+    VECTOR_BLF_FIELD(MostCtrl, msg),
+    VECTOR_BLF_FIELD(MostCtrl, reservedMostCtrl2),
+    VECTOR_BLF_FIELD(MostCtrl, rTyp),
+    VECTOR_BLF_FIELD(MostCtrl, rTypAdr),
+    VECTOR_BLF_FIELD(MostCtrl, state),
+    VECTOR_BLF_FIELD(MostCtrl, reservedMostCtrl3),
+    VECTOR_BLF_FIELD(MostCtrl, ackNack),
+    VECTOR_BLF_FIELD(MostCtrl, reservedMostCtrl4)>;
+
 MostCtrl::MostCtrl() :
     ObjectHeader(ObjectType::MOST_CTRL) {
 }
 
 void MostCtrl::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&dir), sizeof(dir));
-    is.read(reinterpret_cast<char *>(&reservedMostCtrl1), sizeof(reservedMostCtrl1));
-    is.read(reinterpret_cast<char *>(&sourceAdr), sizeof(sourceAdr));
-    is.read(reinterpret_cast<char *>(&destAdr), sizeof(destAdr));
-    is.read(reinterpret_cast<char *>(msg.data()), static_cast<std::streamsize>(msg.size()));
-    is.read(reinterpret_cast<char *>(&reservedMostCtrl2), sizeof(reservedMostCtrl2));
-    is.read(reinterpret_cast<char *>(&rTyp), sizeof(rTyp));
-    is.read(reinterpret_cast<char *>(&rTypAdr), sizeof(rTypAdr));
-    is.read(reinterpret_cast<char *>(&state), sizeof(state));
-    is.read(reinterpret_cast<char *>(&reservedMostCtrl3), sizeof(reservedMostCtrl3));
-    is.read(reinterpret_cast<char *>(&ackNack), sizeof(ackNack));
-    is.read(reinterpret_cast<char *>(&reservedMostCtrl4), sizeof(reservedMostCtrl4));
+    MostCtrlFields::read(is, *this);
 }
 
 void MostCtrl::write(AbstractFile & os) {
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&dir), sizeof(dir));
-    os.write(reinterpret_cast<char *>(&reservedMostCtrl1), sizeof(reservedMostCtrl1));
-    os.write(reinterpret_cast<char *>(&sourceAdr), sizeof(sourceAdr));
-    os.write(reinterpret_cast<char *>(&destAdr), sizeof(destAdr));
-    os.write(reinterpret_cast<char *>(msg.data()), static_cast<std::streamsize>(msg.size()));
-    os.write(reinterpret_cast<char *>(&reservedMostCtrl2), sizeof(reservedMostCtrl2));
-    os.write(reinterpret_cast<char *>(&rTyp), sizeof(rTyp));
-    os.write(reinterpret_cast<char *>(&rTypAdr), sizeof(rTypAdr));
-    os.write(reinterpret_cast<char *>(&state), sizeof(state));
-    os.write(reinterpret_cast<char *>(&reservedMostCtrl3), sizeof(reservedMostCtrl3));
-    os.write(reinterpret_cast<char *>(&ackNack), sizeof(ackNack));
-    os.write(reinterpret_cast<char *>(&reservedMostCtrl4), sizeof(reservedMostCtrl4));
+    MostCtrlFields::write(os, *this);
 }
 
 uint32_t MostCtrl::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        sizeof(channel) +
-        sizeof(dir) +
-        sizeof(reservedMostCtrl1) +
-        sizeof(sourceAdr) +
-        sizeof(destAdr) +
-        static_cast<uint32_t>(msg.size()) +
-        sizeof(reservedMostCtrl2) +
-        sizeof(rTyp) +
-        sizeof(rTypAdr) +
-        sizeof(state) +
-        sizeof(reservedMostCtrl3) +
-        sizeof(ackNack) +
-        sizeof(reservedMostCtrl4);
+        MostCtrlFields::size();
 }
 
 }
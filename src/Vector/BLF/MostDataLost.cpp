@@ -4,45 +4,39 @@
 
 #include <Vector/BLF/MostDataLost.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of MostDataLost from channel to nextGoodTimeStampNs */
+using MostDataLostFields = Fields<
+    VECTOR_BLF_FIELD(MostDataLost, channel),
+    VECTOR_BLF_FIELD(MostDataLost, reservedMostDataLost),
+    VECTOR_BLF_FIELD(MostDataLost, info),
+    VECTOR_BLF_FIELD(MostDataLost, lostMsgsCtrl),
+    VECTOR_BLF_FIELD(MostDataLost, lostMsgsAsync),
+    VECTOR_BLF_FIELD(MostDataLost, lastGoodTimeStampNs),
+    VECTOR_BLF_FIELD(MostDataLost, nextGoodTimeStampNs)>;
+
 MostDataLost::MostDataLost() :
     ObjectHeader2(ObjectType::MOST_DATALOST) {
 }
 
 void MostDataLost::read(AbstractFile & is) {
     ObjectHeader2::read(is);
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&reservedMostDataLost), sizeof(reservedMostDataLost));
-    is.read(reinterpret_cast<char *>(&info), sizeof(info));
-    is.read(reinterpret_cast<char *>(&lostMsgsCtrl), sizeof(lostMsgsCtrl));
-    is.read(reinterpret_cast<char *>(&lostMsgsAsync), sizeof(lostMsgsAsync));
-    is.read(reinterpret_cast<char *>(&lastGoodTimeStampNs), sizeof(lastGoodTimeStampNs));
-    is.read(reinterpret_cast<char *>(&nextGoodTimeStampNs), sizeof(nextGoodTimeStampNs));
+    MostDataLostFields::read(is, *this);
 }
 
 void MostDataLost::write(AbstractFile & os) {
     ObjectHeader2::write(os);
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&reservedMostDataLost), sizeof(reservedMostDataLost));
-    os.write(reinterpret_cast<char *>(&info), sizeof(info));
-    os.write(reinterpret_cast<char *>(&lostMsgsCtrl), sizeof(lostMsgsCtrl));
-    os.write(reinterpret_cast<char *>(&lostMsgsAsync), sizeof(lostMsgsAsync));
-    os.write(reinterpret_cast<char *>(&lastGoodTimeStampNs), sizeof(lastGoodTimeStampNs));
-    os.write(reinterpret_cast<char *>(&nextGoodTimeStampNs), sizeof(nextGoodTimeStampNs));
+    MostDataLostFields::write(os, *this);
 }
 
 uint32_t MostDataLost::calculateObjectSize() const {
     return
         ObjectHeader2::calculateObjectSize() +
-        sizeof(channel) +
-        sizeof(reservedMostDataLost) +
-        sizeof(info) +
-        sizeof(lostMsgsCtrl) +
-        sizeof(lostMsgsAsync) +
-        sizeof(lastGoodTimeStampNs) +
-        sizeof(nextGoodTimeStampNs);
+        MostDataLostFields::size();
 }
 
 }
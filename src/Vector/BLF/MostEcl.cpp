@@ -4,37 +4,37 @@
 
 #include <Vector/BLF/MostEcl.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of MostEcl from channel to reservedMostEcl */
+using MostEclFields = Fields<
+    VECTOR_BLF_FIELD(MostEcl, channel),
+    VECTOR_BLF_FIELD(MostEcl, mode),
+    VECTOR_BLF_FIELD(MostEcl, eclState),
+    VECTOR_BLF_FIELD(MostEcl, reservedMostEcl)>;
+
 MostEcl::MostEcl() :
     ObjectHeader2(ObjectType::MOST_ECL) {
 }
 
 void MostEcl::read(AbstractFile & is) {
     ObjectHeader2::read(is);
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&mode), sizeof(mode));
-    is.read(reinterpret_cast<char *>(&eclState), sizeof(eclState));
-    is.read(reinterpret_cast<char *>(&reservedMostEcl), sizeof(reservedMostEcl));
+    MostEclFields::read(is, *this);
     // @note might be extended in future versions
 }
 
 void MostEcl::write(AbstractFile & os) {
     ObjectHeader2::write(os);
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&mode), sizeof(mode));
-    os.write(reinterpret_cast<char *>(&eclState), sizeof(eclState));
-    os.write(reinterpret_cast<char *>(&reservedMostEcl), sizeof(reservedMostEcl));
+    MostEclFields::write(os, *this);
 }
 
 uint32_t MostEcl::calculateObjectSize() const {
     return
         ObjectHeader2::calculateObjectSize() +
-        sizeof(channel) +
-        sizeof(mode) +
-        sizeof(eclState) +
-        sizeof(reservedMostEcl);
+        MostEclFields::size();
 }
 
 }
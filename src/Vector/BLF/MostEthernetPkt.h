@@ -10,6 +10,7 @@
 
 #include <Vector/BLF/AbstractFile.h>
 #include <Vector/BLF/ObjectHeader2.h>
+#include <Vector/BLF/PayloadView.h>
 
 #include <Vector/BLF/vector_blf_export.h>
 
@@ -200,6 +201,13 @@ struct VECTOR_BLF_EXPORT MostEthernetPkt final : ObjectHeader2 {
      * Variable data
      */
     std::vector<uint8_t> pktData {};
+
+    /**
+     * view of pktData, if read with File::lazyPayloads
+     *
+     * pktData is empty then. On write, pktData is used, unless it is empty.
+     */
+    PayloadView pktDataView {};
 };
 
 }
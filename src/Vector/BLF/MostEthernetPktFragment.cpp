@@ -4,29 +4,35 @@
 
 #include <Vector/BLF/MostEthernetPktFragment.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of MostEthernetPktFragment from channel to reservedMostEthernetPktFragment3 */
+using MostEthernetPktFragmentFields = Fields<
+    VECTOR_BLF_FIELD(MostEthernetPktFragment, channel),
+    VECTOR_BLF_FIELD(MostEthernetPktFragment, reservedMostEthernetPktFragment1),
+    VECTOR_BLF_FIELD(MostEthernetPktFragment, ackNack),
+    VECTOR_BLF_FIELD(MostEthernetPktFragment, validMask),
+    VECTOR_BLF_FIELD(MostEthernetPktFragment, sourceMacAdr),
+    VECTOR_BLF_FIELD(MostEthernetPktFragment, destMacAdr),
+    VECTOR_BLF_FIELD(MostEthernetPktFragment, pAck),
+    VECTOR_BLF_FIELD(MostEthernetPktFragment, cAck),
+    VECTOR_BLF_FIELD(MostEthernetPktFragment, reservedMostEthernetPktFragment2),
+    VECTOR_BLF_FIELD(MostEthernetPktFragment, crc),
+    VECTOR_BLF_FIELD(MostEthernetPktFragment, dataLen),
+    VECTOR_BLF_FIELD(MostEthernetPktFragment, dataLenAnnounced),
+    VECTOR_BLF_FIELD(MostEthernetPktFragment, firstDataLen),
+    VECTOR_BLF_FIELD(MostEthernetPktFragment, reservedMostEthernetPktFragment3)>;
+
 MostEthernetPktFragment::MostEthernetPktFragment() :
     ObjectHeader2(ObjectType::MOST_ETHERNET_PKT_FRAGMENT) {
 }
 
 void MostEthernetPktFragment::read(AbstractFile & is) {
     ObjectHeader2::read(is);
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&reservedMostEthernetPktFragment1), sizeof(reservedMostEthernetPktFragment1));
-    is.read(reinterpret_cast<char *>(&ackNack), sizeof(ackNack));
-    is.read(reinterpret_cast<char *>(&validMask), sizeof(validMask));
-    is.read(reinterpret_cast<char *>(&sourceMacAdr), sizeof(sourceMacAdr));
-    is.read(reinterpret_cast<char *>(&destMacAdr), sizeof(destMacAdr));
-    is.read(reinterpret_cast<char *>(&pAck), sizeof(pAck));
-    is.read(reinterpret_cast<char *>(&cAck), sizeof(cAck));
-    is.read(reinterpret_cast<char *>(&reservedMostEthernetPktFragment2), sizeof(reservedMostEthernetPktFragment2));
-    is.read(reinterpret_cast<char *>(&crc), sizeof(crc));
-    is.read(reinterpret_cast<char *>(&dataLen), sizeof(dataLen));
-    is.read(reinterpret_cast<char *>(&dataLenAnnounced), sizeof(dataLenAnnounced));
-    is.read(reinterpret_cast<char *>(&firstDataLen), sizeof(firstDataLen));
-    is.read(reinterpret_cast<char *>(&reservedMostEthernetPktFragment3), sizeof(reservedMostEthernetPktFragment3));
+    MostEthernetPktFragmentFields::read(is, *this);
     firstData.resize(firstDataLen);
     is.read(reinterpret_cast<char *>(firstData.data()), firstDataLen);
 
@@ -39,20 +45,7 @@ void MostEthernetPktFragment::write(AbstractFile & os) {
     firstDataLen = static_cast<uint32_t>(firstData.size());
 
     ObjectHeader2::write(os);
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&reservedMostEthernetPktFragment1), sizeof(reservedMostEthernetPktFragment1));
-    os.write(reinterpret_cast<char *>(&ackNack), sizeof(ackNack));
-    os.write(reinterpret_cast<char *>(&validMask), sizeof(validMask));
-    os.write(reinterpret_cast<char *>(&sourceMacAdr), sizeof(sourceMacAdr));
-    os.write(reinterpret_cast<char *>(&destMacAdr), sizeof(destMacAdr));
-    os.write(reinterpret_cast<char *>(&pAck), sizeof(pAck));
-    os.write(reinterpret_cast<char *>(&cAck), sizeof(cAck));
-    os.write(reinterpret_cast<char *>(&reservedMostEthernetPktFragment2), sizeof(reservedMostEthernetPktFragment2));
-    os.write(reinterpret_cast<char *>(&crc), sizeof(crc));
-    os.write(reinterpret_cast<char *>(&dataLen), sizeof(dataLen));
-    os.write(reinterpret_cast<char *>(&dataLenAnnounced), sizeof(dataLenAnnounced));
-    os.write(reinterpret_cast<char *>(&firstDataLen), sizeof(firstDataLen));
-    os.write(reinterpret_cast<char *>(&reservedMostEthernetPktFragment3), sizeof(reservedMostEthernetPktFragment3));
+    MostEthernetPktFragmentFields::write(os, *this);
     os.write(reinterpret_cast<char *>(firstData.data()), firstDataLen);
 
     /* skip padding */
@@ -62,20 +55,7 @@ void MostEthernetPktFragment::write(AbstractFile & os) {
 uint32_t MostEthernetPktFragment::calculateObjectSize() const {
     return
         ObjectHeader2::calculateObjectSize() +
-        sizeof(channel) +
-        sizeof(reservedMostEthernetPktFragment1) +
-        sizeof(ackNack) +
-        sizeof(validMask) +
-        sizeof(sourceMacAdr) +
-        sizeof(destMacAdr) +
-        sizeof(pAck) +
-        sizeof(cAck) +
-        sizeof(reservedMostEthernetPktFragment2) +
-        sizeof(crc) +
-        sizeof(dataLen) +
-        sizeof(dataLenAnnounced) +
-        sizeof(firstDataLen) +
-        sizeof(reservedMostEthernetPktFragment3) +
+        MostEthernetPktFragmentFields::size() +
         firstDataLen;
 }
 
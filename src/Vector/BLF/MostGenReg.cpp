@@ -4,48 +4,40 @@
 
 #include <Vector/BLF/MostGenReg.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of MostGenReg from channel to regValue */
+using MostGenRegFields = Fields<
+    VECTOR_BLF_FIELD(MostGenReg, channel),
+    VECTOR_BLF_FIELD(MostGenReg, subType),
+    VECTOR_BLF_FIELD(MostGenReg, reservedMostGenReg1),
+    VECTOR_BLF_FIELD(MostGenReg, handle),
+    VECTOR_BLF_FIELD(MostGenReg, regId),
+    VECTOR_BLF_FIELD(MostGenReg, reservedMostGenReg2),
+    VECTOR_BLF_FIELD(MostGenReg, reservedMostGenReg3),
+    VECTOR_BLF_FIELD(MostGenReg, regValue)>;
+
 MostGenReg::MostGenReg() :
     ObjectHeader2(ObjectType::MOST_GENREG) {
 }
 
 void MostGenReg::read(AbstractFile & is) {
     ObjectHeader2::read(is);
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&subType), sizeof(subType));
-    is.read(reinterpret_cast<char *>(&reservedMostGenReg1), sizeof(reservedMostGenReg1));
-    is.read(reinterpret_cast<char *>(&handle), sizeof(handle));
-    is.read(reinterpret_cast<char *>(&regId), sizeof(regId));
-    is.read(reinterpret_cast<char *>(&reservedMostGenReg2), sizeof(reservedMostGenReg2));
-    is.read(reinterpret_cast<char *>(&reservedMostGenReg3), sizeof(reservedMostGenReg3));
-    is.read(reinterpret_cast<char *>(&regValue), sizeof(regValue));
+    MostGenRegFields::read(is, *this);
 }
 
 void MostGenReg::write(AbstractFile & os) {
     ObjectHeader2::write(os);
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&subType), sizeof(subType));
-    os.write(reinterpret_cast<char *>(&reservedMostGenReg1), sizeof(reservedMostGenReg1));
-    os.write(reinterpret_cast<char *>(&handle), sizeof(handle));
-    os.write(reinterpret_cast<char *>(&regId), sizeof(regId));
-    os.write(reinterpret_cast<char *>(&reservedMostGenReg2), sizeof(reservedMostGenReg2));
-    os.write(reinterpret_cast<char *>(&reservedMostGenReg3), sizeof(reservedMostGenReg3));
-    os.write(reinterpret_cast<char *>(&regValue), sizeof(regValue));
+    MostGenRegFields::write(os, *this);
 }
 
 uint32_t MostGenReg::calculateObjectSize() const {
     return
         ObjectHeader2::calculateObjectSize() +
-        sizeof(channel) +
-        sizeof(subType) +
-        sizeof(reservedMostGenReg1) +
-        sizeof(handle) +
-        sizeof(regId) +
-        sizeof(reservedMostGenReg2) +
-        sizeof(reservedMostGenReg3) +
-        sizeof(regValue);
+        MostGenRegFields::size();
 }
 
 }
@@ -4,36 +4,36 @@
 
 #include <Vector/BLF/MostHwMode.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of MostHwMode from channel to hwModeMask */
+using MostHwModeFields = Fields<
+    VECTOR_BLF_FIELD(MostHwMode, channel),
+    VECTOR_BLF_FIELD(MostHwMode, reservedMostHwMode),
+    VECTOR_BLF_FIELD(MostHwMode, hwMode),
+    VECTOR_BLF_FIELD(MostHwMode, hwModeMask)>;
+
 MostHwMode::MostHwMode() :
     ObjectHeader2(ObjectType::MOST_HWMODE) {
 }
 
 void MostHwMode::read(AbstractFile & is) {
     ObjectHeader2::read(is);
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&reservedMostHwMode), sizeof(reservedMostHwMode));
-    is.read(reinterpret_cast<char *>(&hwMode), sizeof(hwMode));
-    is.read(reinterpret_cast<char *>(&hwModeMask), sizeof(hwModeMask));
+    MostHwModeFields::read(is, *this);
 }
 
 void MostHwMode::write(AbstractFile & os) {
     ObjectHeader2::write(os);
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&reservedMostHwMode), sizeof(reservedMostHwMode));
-    os.write(reinterpret_cast<char *>(&hwMode), sizeof(hwMode));
-    os.write(reinterpret_cast<char *>(&hwModeMask), sizeof(hwModeMask));
+    MostHwModeFields::write(os, *this);
 }
 
 uint32_t MostHwMode::calculateObjectSize() const {
     return
         ObjectHeader2::calculateObjectSize() +
-        sizeof(channel) +
-        sizeof(reservedMostHwMode) +
-        sizeof(hwMode) +
-        sizeof(hwModeMask);
+        MostHwModeFields::size();
 }
 
 }
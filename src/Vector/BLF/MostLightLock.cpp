@@ -4,33 +4,35 @@
 
 #include <Vector/BLF/MostLightLock.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of MostLightLock from channel to reservedMostLightLock */
+using MostLightLockFields = Fields<
+    VECTOR_BLF_FIELD(MostLightLock, channel),
+    VECTOR_BLF_FIELD(MostLightLock, state),
+    VECTOR_BLF_FIELD(MostLightLock, reservedMostLightLock)>;
+
 MostLightLock::MostLightLock() :
     ObjectHeader(ObjectType::MOST_LIGHTLOCK) {
 }
 
 void MostLightLock::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&state), sizeof(state));
-    is.read(reinterpret_cast<char *>(&reservedMostLightLock), sizeof(reservedMostLightLock));
+    MostLightLockFields::read(is, *this);
 }
 
 void MostLightLock::write(AbstractFile & os) {
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&state), sizeof(state));
-    os.write(reinterpret_cast<char *>(&reservedMostLightLock), sizeof(reservedMostLightLock));
+    MostLightLockFields::write(os, *this);
 }
 
 uint32_t MostLightLock::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        sizeof(channel) +
-        sizeof(state) +
-        sizeof(reservedMostLightLock);
+        MostLightLockFields::size();
 }
 
 }
@@ -4,36 +4,36 @@
 
 #include <Vector/BLF/MostNetState.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of MostNetState from channel to reservedMostNetState */
+using MostNetStateFields = Fields<
+    VECTOR_BLF_FIELD(MostNetState, channel),
+    VECTOR_BLF_FIELD(MostNetState, stateNew),
+    VECTOR_BLF_FIELD(MostNetState, stateOld),
+    VECTOR_BLF_FIELD(MostNetState, reservedMostNetState)>;
+
 MostNetState::MostNetState() :
     ObjectHeader2(ObjectType::MOST_NETSTATE) {
 }
 
 void MostNetState::read(AbstractFile & is) {
     ObjectHeader2::read(is);
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&stateNew), sizeof(stateNew));
-    is.read(reinterpret_cast<char *>(&stateOld), sizeof(stateOld));
-    is.read(reinterpret_cast<char *>(&reservedMostNetState), sizeof(reservedMostNetState));
+    MostNetStateFields::read(is, *this);
 }
 
 void MostNetState::write(AbstractFile & os) {
     ObjectHeader2::write(os);
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&stateNew), sizeof(stateNew));
-    os.write(reinterpret_cast<char *>(&stateOld), sizeof(stateOld));
-    os.write(reinterpret_cast<char *>(&reservedMostNetState), sizeof(reservedMostNetState));
+    MostNetStateFields::write(os, *this);
 }
 
 uint32_t MostNetState::calculateObjectSize() const {
     return
         ObjectHeader2::calculateObjectSize() +
-        sizeof(channel) +
-        sizeof(stateNew) +
-        sizeof(stateOld) +
-        sizeof(reservedMostNetState);
+        MostNetStateFields::size();
 }
 
 }
@@ -4,32 +4,38 @@
 
 #include <Vector/BLF/MostPkt.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of MostPkt from channel to reservedMostPkt5 */
+using MostPktFields = Fields<
+    VECTOR_BLF_FIELD(MostPkt, channel),
+    VECTOR_BLF_FIELD(MostPkt, dir),
+    VECTOR_BLF_FIELD(MostPkt, reservedMostPkt1),
+    VECTOR_BLF_FIELD(MostPkt, sourceAdr),
+    VECTOR_BLF_FIELD(MostPkt, destAdr),
+    VECTOR_BLF_FIELD(MostPkt, arbitration),
+    VECTOR_BLF_FIELD(MostPkt, timeRes),
+    VECTOR_BLF_FIELD(MostPkt, quadsToFollow),
+    VECTOR_BLF_FIELD(MostPkt, reservedMostPkt2),
+    VECTOR_BLF_FIELD(MostPkt, crc),
+    VECTOR_BLF_FIELD(MostPkt, priority),
+    VECTOR_BLF_FIELD(MostPkt, transferType),
+    VECTOR_BLF_FIELD(MostPkt, state),
+    VECTOR_BLF_FIELD(MostPkt, reservedMostPkt3),
+    VECTOR_BLF_FIELD(MostPkt, reservedMostPkt4),
+    VECTOR_BLF_FIELD(MostPkt, pktDataLength),
+    VECTOR_BLF_FIELD(MostPkt, reservedMostPkt5)>;
+
 MostPkt::MostPkt() :
     ObjectHeader(ObjectType::MOST_PKT) {
 }
 
 void MostPkt::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&dir), sizeof(dir));
-    is.read(reinterpret_cast<char *>(&reservedMostPkt1), sizeof(reservedMostPkt1));
-    is.read(reinterpret_cast<char *>(&sourceAdr), sizeof(sourceAdr));
-    is.read(reinterpret_cast<char *>(&destAdr), sizeof(destAdr));
-    is.read(reinterpret_cast<char *>(&arbitration), sizeof(arbitration));
-    is.read(reinterpret_cast<char *>(&timeRes), sizeof(timeRes));
-    is.read(reinterpret_cast<char *>(&quadsToFollow), sizeof(quadsToFollow));
-    is.read(reinterpret_cast<char *>(&reservedMostPkt2), sizeof(reservedMostPkt2));
-    is.read(reinterpret_cast<char *>(&crc), sizeof(crc));
-    is.read(reinterpret_cast<char *>(&priority), sizeof(priority));
-    is.read(reinterpret_cast<char *>(&transferType), sizeof(transferType));
-    is.read(reinterpret_cast<char *>(&state), sizeof(state));
-    is.read(reinterpret_cast<char *>(&reservedMostPkt3), sizeof(reservedMostPkt3));
-    is.read(reinterpret_cast<char *>(&reservedMostPkt4), sizeof(reservedMostPkt4));
-    is.read(reinterpret_cast<char *>(&pktDataLength), sizeof(pktDataLength));
-    is.read(reinterpret_cast<char *>(&reservedMostPkt5), sizeof(reservedMostPkt5));
+    MostPktFields::read(is, *this);
     pktData.resize(pktDataLength);
     is.read(reinterpret_cast<char *>(pktData.data()), pktDataLength);
 
@@ -42,23 +48,7 @@ void MostPkt::write(AbstractFile & os) {
     pktDataLength = static_cast<uint32_t>(pktData.size());
 
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&dir), sizeof(dir));
-    os.write(reinterpret_cast<char *>(&reservedMostPkt1), sizeof(reservedMostPkt1));
-    os.write(reinterpret_cast<char *>(&sourceAdr), sizeof(sourceAdr));
-    os.write(reinterpret_cast<char *>(&destAdr), sizeof(destAdr));
-    os.write(reinterpret_cast<char *>(&arbitration), sizeof(arbitration));
-    os.write(reinterpret_cast<char *>(&timeRes), sizeof(timeRes));
-    os.write(reinterpret_cast<char *>(&quadsToFollow), sizeof(quadsToFollow));
-    os.write(reinterpret_cast<char *>(&reservedMostPkt2), sizeof(reservedMostPkt2));
-    os.write(reinterpret_cast<char *>(&crc), sizeof(crc));
-    os.write(reinterpret_cast<char *>(&priority), sizeof(priority));
-    os.write(reinterpret_cast<char *>(&transferType), sizeof(transferType));
-    os.write(reinterpret_cast<char *>(&state), sizeof(state));
-    os.write(reinterpret_cast<char *>(&reservedMostPkt3), sizeof(reservedMostPkt3));
-    os.write(reinterpret_cast<char *>(&reservedMostPkt4), sizeof(reservedMostPkt4));
-    os.write(reinterpret_cast<char *>(&pktDataLength), sizeof(pktDataLength));
-    os.write(reinterpret_cast<char *>(&reservedMostPkt5), sizeof(reservedMostPkt5));
+    MostPktFields::write(os, *this);
     os.write(reinterpret_cast<char *>(pktData.data()), pktDataLength);
 
     /* skip padding */
@@ -68,23 +58,7 @@ void MostPkt::write(AbstractFile & os) {
 uint32_t MostPkt::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        sizeof(channel) +
-        sizeof(dir) +
-        sizeof(reservedMostPkt1) +
-        sizeof(sourceAdr) +
-        sizeof(destAdr) +
-        sizeof(arbitration) +
-        sizeof(timeRes) +
-        sizeof(quadsToFollow) +
-        sizeof(reservedMostPkt2) +
-        sizeof(crc) +
-        sizeof(priority) +
-        sizeof(transferType) +
-        sizeof(state) +
-        sizeof(reservedMostPkt3) +
-        sizeof(reservedMostPkt4) +
-        sizeof(pktDataLength) +
-        sizeof(reservedMostPkt5) +
+        MostPktFields::size() +
         pktDataLength;
 }
 
@@ -4,39 +4,37 @@
 
 #include <Vector/BLF/MostStatistic.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of MostStatistic from channel to bufferLevel */
+using MostStatisticFields = Fields<
+    VECTOR_BLF_FIELD(MostStatistic, channel),
+    VECTOR_BLF_FIELD(MostStatistic, pktCnt),
+    VECTOR_BLF_FIELD(MostStatistic, frmCnt),
+    VECTOR_BLF_FIELD(MostStatistic, lightCnt),
+    VECTOR_BLF_FIELD(MostStatistic, bufferLevel)>;
+
 MostStatistic::MostStatistic() :
     ObjectHeader(ObjectType::MOST_STATISTIC) {
 }
 
 void MostStatistic::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&pktCnt), sizeof(pktCnt));
-    is.read(reinterpret_cast<char *>(&frmCnt), sizeof(frmCnt));
-    is.read(reinterpret_cast<char *>(&lightCnt), sizeof(lightCnt));
-    is.read(reinterpret_cast<char *>(&bufferLevel), sizeof(bufferLevel));
+    MostStatisticFields::read(is, *this);
 }
 
 void MostStatistic::write(AbstractFile & os) {
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&pktCnt), sizeof(pktCnt));
-    os.write(reinterpret_cast<char *>(&frmCnt), sizeof(frmCnt));
-    os.write(reinterpret_cast<char *>(&lightCnt), sizeof(lightCnt));
-    os.write(reinterpret_cast<char *>(&bufferLevel), sizeof(bufferLevel));
+    MostStatisticFields::write(os, *this);
 }
 
 uint32_t MostStatistic::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        sizeof(channel) +
-        sizeof(pktCnt) +
-        sizeof(frmCnt) +
-        sizeof(lightCnt) +
-        sizeof(bufferLevel);
+        MostStatisticFields::size();
 }
 
 }
@@ -4,39 +4,37 @@
 
 #include <Vector/BLF/MostStatisticEx.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of MostStatisticEx from channel to reservedMostStatisticEx2 */
+using MostStatisticExFields = Fields<
+    VECTOR_BLF_FIELD(MostStatisticEx, channel),
+    VECTOR_BLF_FIELD(MostStatisticEx, reservedMostStatisticEx1),
+    VECTOR_BLF_FIELD(MostStatisticEx, codingErrors),
+    VECTOR_BLF_FIELD(MostStatisticEx, frameCounter),
+    VECTOR_BLF_FIELD(MostStatisticEx, reservedMostStatisticEx2)>;
+
 MostStatisticEx::MostStatisticEx() :
     ObjectHeader2(ObjectType::MOST_STATISTICEX) {
 }
 
 void MostStatisticEx::read(AbstractFile & is) {
     ObjectHeader2::read(is);
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&reservedMostStatisticEx1), sizeof(reservedMostStatisticEx1));
-    is.read(reinterpret_cast<char *>(&codingErrors), sizeof(codingErrors));
-    is.read(reinterpret_cast<char *>(&frameCounter), sizeof(frameCounter));
-    is.read(reinterpret_cast<char *>(&reservedMostStatisticEx2), sizeof(reservedMostStatisticEx2));
+    MostStatisticExFields::read(is, *this);
 }
 
 void MostStatisticEx::write(AbstractFile & os) {
     ObjectHeader2::write(os);
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&reservedMostStatisticEx1), sizeof(reservedMostStatisticEx1));
-    os.write(reinterpret_cast<char *>(&codingErrors), sizeof(codingErrors));
-    os.write(reinterpret_cast<char *>(&frameCounter), sizeof(frameCounter));
-    os.write(reinterpret_cast<char *>(&reservedMostStatisticEx2), sizeof(reservedMostStatisticEx2));
+    MostStatisticExFields::write(os, *this);
 }
 
 uint32_t MostStatisticEx::calculateObjectSize() const {
     return
         ObjectHeader2::calculateObjectSize() +
-        sizeof(channel) +
-        sizeof(reservedMostStatisticEx1) +
-        sizeof(codingErrors) +
-        sizeof(frameCounter) +
-        sizeof(reservedMostStatisticEx2);
+        MostStatisticExFields::size();
 }
 
 }
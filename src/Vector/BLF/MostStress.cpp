@@ -4,36 +4,36 @@
 
 #include <Vector/BLF/MostStress.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of MostStress from channel to reservedMostStress */
+using MostStressFields = Fields<
+    VECTOR_BLF_FIELD(MostStress, channel),
+    VECTOR_BLF_FIELD(MostStress, state),
+    VECTOR_BLF_FIELD(MostStress, mode),
+    VECTOR_BLF_FIELD(MostStress, reservedMostStress)>;
+
 MostStress::MostStress() :
     ObjectHeader2(ObjectType::MOST_STRESS) {
 }
 
 void MostStress::read(AbstractFile & is) {
     ObjectHeader2::read(is);
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&state), sizeof(state));
-    is.read(reinterpret_cast<char *>(&mode), sizeof(mode));
-    is.read(reinterpret_cast<char *>(&reservedMostStress), sizeof(reservedMostStress));
+    MostStressFields::read(is, *this);
 }
 
 void MostStress::write(AbstractFile & os) {
     ObjectHeader2::write(os);
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&state), sizeof(state));
-    os.write(reinterpret_cast<char *>(&mode), sizeof(mode));
-    os.write(reinterpret_cast<char *>(&reservedMostStress), sizeof(reservedMostStress));
+    MostStressFields::write(os, *this);
 }
 
 uint32_t MostStress::calculateObjectSize() const {
     return
         ObjectHeader2::calculateObjectSize() +
-        sizeof(channel) +
-        sizeof(state) +
-        sizeof(mode) +
-        sizeof(reservedMostStress);
+        MostStressFields::size();
 }
 
 }
@@ -4,39 +4,37 @@
 
 #include <Vector/BLF/MostSystemEvent.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of MostSystemEvent from channel to reservedMostSystemEvent */
+using MostSystemEventFields = Fields<
+    VECTOR_BLF_FIELD(MostSystemEvent, channel),
+    VECTOR_BLF_FIELD(MostSystemEvent, id),
+    VECTOR_BLF_FIELD(MostSystemEvent, value),
+    VECTOR_BLF_FIELD(MostSystemEvent, valueOld),
+    VECTOR_BLF_FIELD(MostSystemEvent, reservedMostSystemEvent)>;
+
 MostSystemEvent::MostSystemEvent() :
     ObjectHeader2(ObjectType::MOST_SYSTEM_EVENT) {
 }
 
 void MostSystemEvent::read(AbstractFile & is) {
     ObjectHeader2::read(is);
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&id), sizeof(id));
-    is.read(reinterpret_cast<char *>(&value), sizeof(value));
-    is.read(reinterpret_cast<char *>(&valueOld), sizeof(valueOld));
-    is.read(reinterpret_cast<char *>(&reservedMostSystemEvent), sizeof(reservedMostSystemEvent));
+    MostSystemEventFields::read(is, *this);
 }
 
 void MostSystemEvent::write(AbstractFile & os) {
     ObjectHeader2::write(os);
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&id), sizeof(id));
-    os.write(reinterpret_cast<char *>(&value), sizeof(value));
-    os.write(reinterpret_cast<char *>(&valueOld), sizeof(valueOld));
-    os.write(reinterpret_cast<char *>(&reservedMostSystemEvent), sizeof(reservedMostSystemEvent));
+    MostSystemEventFields::write(os, *this);
 }
 
 uint32_t MostSystemEvent::calculateObjectSize() const {
     return
         ObjectHeader2::calculateObjectSize() +
-        sizeof(channel) +
-        sizeof(id) +
-        sizeof(value) +
-        sizeof(valueOld) +
-        sizeof(reservedMostSystemEvent);
+        MostSystemEventFields::size();
 }
 
 }
@@ -4,42 +4,38 @@
 
 #include <Vector/BLF/MostTrigger.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of MostTrigger from channel to currentTriggerValue */
+using MostTriggerFields = Fields<
+    VECTOR_BLF_FIELD(MostTrigger, channel),
+    VECTOR_BLF_FIELD(MostTrigger, reservedMostTrigger),
+    VECTOR_BLF_FIELD(MostTrigger, mode),
+    VECTOR_BLF_FIELD(MostTrigger, hw),
+    VECTOR_BLF_FIELD(MostTrigger, previousTriggerValue),
+    VECTOR_BLF_FIELD(MostTrigger, currentTriggerValue)>;
+
 MostTrigger::MostTrigger() :
     ObjectHeader2(ObjectType::MOST_TRIGGER) {
 }
 
 void MostTrigger::read(AbstractFile & is) {
     ObjectHeader2::read(is);
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&reservedMostTrigger), sizeof(reservedMostTrigger));
-    is.read(reinterpret_cast<char *>(&mode), sizeof(mode));
-    is.read(reinterpret_cast<char *>(&hw), sizeof(hw));
-    is.read(reinterpret_cast<char *>(&previousTriggerValue), sizeof(previousTriggerValue));
-    is.read(reinterpret_cast<char *>(&currentTriggerValue), sizeof(currentTriggerValue));
+    MostTriggerFields::read(is, *this);
 }
 
 void MostTrigger::write(AbstractFile & os) {
     ObjectHeader2::write(os);
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&reservedMostTrigger), sizeof(reservedMostTrigger));
-    os.write(reinterpret_cast<char *>(&mode), sizeof(mode));
-    os.write(reinterpret_cast<char *>(&hw), sizeof(hw));
-    os.write(reinterpret_cast<char *>(&previousTriggerValue), sizeof(previousTriggerValue));
-    os.write(reinterpret_cast<char *>(&currentTriggerValue), sizeof(currentTriggerValue));
+    MostTriggerFields::write(os, *this);
 }
 
 uint32_t MostTrigger::calculateObjectSize() const {
     return
         ObjectHeader2::calculateObjectSize() +
-        sizeof(channel) +
-        sizeof(reservedMostTrigger) +
-        sizeof(mode) +
-        sizeof(hw) +
-        sizeof(previousTriggerValue) +
-        sizeof(currentTriggerValue);
+        MostTriggerFields::size();
 }
 
 }
@@ -4,33 +4,35 @@
 
 #include <Vector/BLF/MostTxLight.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of MostTxLight from channel to reservedMostTxLight */
+using MostTxLightFields = Fields<
+    VECTOR_BLF_FIELD(MostTxLight, channel),
+    VECTOR_BLF_FIELD(MostTxLight, state),
+    VECTOR_BLF_FIELD(MostTxLight, reservedMostTxLight)>;
+
 MostTxLight::MostTxLight() :
     ObjectHeader2(ObjectType::MOST_TXLIGHT) {
 }
 
 void MostTxLight::read(AbstractFile & is) {
     ObjectHeader2::read(is);
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&state), sizeof(state));
-    is.read(reinterpret_cast<char *>(&reservedMostTxLight), sizeof(reservedMostTxLight));
+    MostTxLightFields::read(is, *this);
 }
 
 void MostTxLight::write(AbstractFile & os) {
     ObjectHeader2::write(os);
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&state), sizeof(state));
-    os.write(reinterpret_cast<char *>(&reservedMostTxLight), sizeof(reservedMostTxLight));
+    MostTxLightFields::write(os, *this);
 }
 
 uint32_t MostTxLight::calculateObjectSize() const {
     return
         ObjectHeader2::calculateObjectSize() +
-        sizeof(channel) +
-        sizeof(state) +
-        sizeof(reservedMostTxLight);
+        MostTxLightFields::size();
 }
 
 }
@@ -0,0 +1,182 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <Vector/BLF/ObjectBuffer.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace Vector {
+namespace BLF {
+
+std::streamsize ObjectBuffer::gcount() const {
+    return m_gcount;
+}
+
+void ObjectBuffer::read(char * s, std::streamsize n) {
+    m_gcount = 0;
+
+    /* check state */
+    if (m_rdstate != std::ios_base::goodbit) {
+        m_rdstate |= std::ios_base::failbit;
+        return;
+    }
+
+    /* handle read behind eof */
+    std::streamsize available = std::max(size() - m_tellg, std::streamsize(0));
+    if (n > available) {
+        n = available;
+        m_rdstate = std::ios_base::eofbit | std::ios_base::failbit;
+    }
+
+    /* read data */
+    if (n > 0)
+        std::memcpy(s, data() + m_tellg, static_cast<std::size_t>(n));
+    m_gcount = n;
+    m_tellg += n;
+}
+
+const char * ObjectBuffer::readView(std::streamsize n) {
+    /* check state and available data */
+    if ((m_rdstate != std::ios_base::goodbit) || (n + m_tellg > size()))
+        return nullptr;
+
+    /* read data */
+    const char * s = data() + m_tellg;
+    m_gcount = n;
+    m_tellg += n;
+    return s;
+}
+
+PayloadView ObjectBuffer::readPayload(std::streamsize n) {
+    /* only shared data can be referred to */
+    if (!m_sharedLogContainer)
+        return PayloadView();
+
+    /* read data */
+    const char * s = readView(n);
+    if (s == nullptr)
+        return PayloadView();
+    return PayloadView(m_sharedLogContainer, reinterpret_cast<const uint8_t *>(s), static_cast<std::size_t>(n));
+}
+
+std::streampos ObjectBuffer::tellg() {
+    /* in case of failure return -1 */
+    if (m_rdstate & (std::ios_base::failbit | std::ios_base::badbit))
+        return -1;
+    return m_tellg;
+}
+
+void ObjectBuffer::seekg(std::streamoff off, const std::ios_base::seekdir way) {
+    /* check state */
+    if (m_rdstate & (std::ios_base::failbit | std::ios_base::badbit)) {
+        m_rdstate |= std::ios_base::failbit;
+        return;
+    }
+
+    /* calculate new get position */
+    std::streamoff pos = off;
+    if (way == std::ios_base::cur)
+        pos += m_tellg;
+    else if (way == std::ios_base::end)
+        pos += size();
+    if (pos < 0) {
+        m_rdstate |= std::ios_base::failbit;
+        return;
+    }
+
+    /* new get position */
+    m_tellg = pos;
+    m_rdstate = std::ios_base::goodbit;
+}
+
+void ObjectBuffer::write(const char * s, std::streamsize n) {
+    /* copy shared data, before it's modified */
+    if (m_sharedData != nullptr) {
+        m_data.assign(m_sharedData, m_sharedData + m_sharedSize);
+        m_sharedLogContainer.reset();
+        m_sharedData = nullptr;
+        m_sharedSize = 0;
+    }
+
+    /* append data */
+    m_data.insert(m_data.end(), s, s + n);
+}
+
+std::streampos ObjectBuffer::tellp() {
+    return size();
+}
+
+bool ObjectBuffer::good() const {
+    return (m_rdstate == std::ios_base::goodbit);
+}
+
+bool ObjectBuffer::eof() const {
+    return (m_rdstate & std::ios_base::eofbit);
+}
+
+void ObjectBuffer::clear() {
+    /* drop data, but keep memory */
+    m_data.clear();
+    m_sharedLogContainer.reset();
+    m_sharedData = nullptr;
+    m_sharedSize = 0;
+
+    /* initial state */
+    m_tellg = 0;
+    m_gcount = 0;
+    m_rdstate = std::ios_base::goodbit;
+}
+
+void ObjectBuffer::load(AbstractFile & is, std::streamsize n) {
+    clear();
+
+    /* read data */
+    m_data.resize(static_cast<std::size_t>(n));
+    is.read(m_data.data(), n);
+    m_data.resize(static_cast<std::size_t>(is.gcount()));
+}
+
+void ObjectBuffer::loadShared(UncompressedFile & is, std::streamsize n) {
+    clear();
+
+    /* refer to data */
+    m_sharedData = is.readShared(n, m_sharedLogContainer);
+    if (m_sharedData != nullptr) {
+        m_sharedSize = n;
+        return;
+    }
+
+    /* copy data */
+    load(is, n);
+}
+
+void ObjectBuffer::loadShared(const std::shared_ptr<LogContainer> & logContainer, const char * data, std::streamsize n) {
+    clear();
+
+    /* refer to data */
+    m_sharedLogContainer = logContainer;
+    m_sharedData = data;
+    m_sharedSize = n;
+}
+
+void ObjectBuffer::save(AbstractFile & os) const {
+    /* write data */
+    os.write(data(), size());
+}
+
+const char * ObjectBuffer::data() const {
+    if (m_sharedData != nullptr)
+        return m_sharedData;
+    return m_data.data();
+}
+
+std::streamsize ObjectBuffer::size() const {
+    if (m_sharedData != nullptr)
+        return m_sharedSize;
+    return static_cast<std::streamsize>(m_data.size());
+}
+
+}
+}
@@ -0,0 +1,141 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <Vector/BLF/platform.h>
+
+#include <ios>
+#include <memory>
+#include <vector>
+
+#include <Vector/BLF/AbstractFile.h>
+#include <Vector/BLF/LogContainer.h>
+#include <Vector/BLF/UncompressedFile.h>
+
+#include <Vector/BLF/vector_blf_export.h>
+
+namespace Vector {
+namespace BLF {
+
+/**
+ * Staging buffer for the data of one object
+ *
+ * Objects read and write their data field by field. Doing this directly
+ * on UncompressedFile means a mutex lock and notify per field. Instead
+ * the object data is transferred between the UncompressedFile and this
+ * buffer in one block, and the object is decoded from resp. encoded
+ * into this buffer.
+ *
+ * The memory is kept over clear, so it's allocated only once for all
+ * objects.
+ *
+ * This class is not thread-safe. It should only be accessed by one thread.
+ */
+class VECTOR_BLF_EXPORT ObjectBuffer final : public AbstractFile {
+  public:
+    std::streamsize gcount() const override;
+    void read(char * s, std::streamsize n) override;
+    const char * readView(std::streamsize n) override;
+
+    /**
+     * @copydoc AbstractFile::readPayload
+     *
+     * Views are only returned after loadShared.
+     */
+    PayloadView readPayload(std::streamsize n) override;
+    std::streampos tellg() override;
+    void seekg(std::streamoff off, const std::ios_base::seekdir way = std::ios_base::cur) override;
+    void write(const char * s, std::streamsize n) override;
+    std::streampos tellp() override;
+    bool good() const override;
+    bool eof() const override;
+
+    /**
+     * Drop data and reset positions and state.
+     */
+    virtual void clear();
+
+    /**
+     * Replace data by a block of data read from another file.
+     *
+     * The get position is set to the beginning of the data.
+     *
+     * @param[in] is input file
+     * @param[in] n Requested size of data
+     */
+    virtual void load(AbstractFile & is, std::streamsize n);
+
+    /**
+     * Replace data by a block of data in an UncompressedFile, without copying it.
+     *
+     * If the block is contained in one LogContainer, the buffer refers to
+     * it, and readPayload returns views that keep the LogContainer alive.
+     * Otherwise the block is copied as in load.
+     *
+     * The buffer is read-only then, until the next clear or load.
+     *
+     * @param[in] is input file
+     * @param[in] n Requested size of data
+     */
+    virtual void loadShared(UncompressedFile & is, std::streamsize n);
+
+    /**
+     * Replace data by a block of data in a LogContainer, without copying it.
+     *
+     * This is loadShared for callers, that already found the block, e.g.
+     * UncompressedFile::readObject.
+     *
+     * @param[in] logContainer LogContainer containing the data
+     * @param[in] data data
+     * @param[in] n size of data
+     */
+    virtual void loadShared(const std::shared_ptr<LogContainer> & logContainer, const char * data, std::streamsize n);
+
+    /**
+     * Write all data into another file.
+     *
+     * @param[in] os output file
+     */
+    virtual void save(AbstractFile & os) const;
+
+    /**
+     * Get data.
+     *
+     * @return data
+     */
+    virtual const char * data() const;
+
+    /**
+     * Get size of data.
+     *
+     * @return size of data
+     */
+    virtual std::streamsize size() const;
+
+  private:
+    /** data */
+    std::vector<char> m_data {};
+
+    /** LogContainer containing the shared data, after loadShared */
+    std::shared_ptr<LogContainer> m_sharedLogContainer {};
+
+    /** shared data, after loadShared */
+    const char * m_sharedData {nullptr};
+
+    /** size of shared data */
+    std::streamsize m_sharedSize {};
+
+    /** get position */
+    std::streamoff m_tellg {};
+
+    /** last read size */
+    std::streamsize m_gcount {};
+
+    /** error state */
+    std::ios_base::iostate m_rdstate {std::ios_base::goodbit};
+};
+
+}
+}
@@ -0,0 +1,83 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <Vector/BLF/ObjectFilter.h>
+
+#include <algorithm>
+
+#include <Vector/BLF/File.h>
+
+namespace Vector {
+namespace BLF {
+
+bool ObjectFilter::empty() const {
+    return
+        objectTypes.empty() &&
+        channels.empty() &&
+        !hasTimeWindow();
+}
+
+bool ObjectFilter::matchesObjectType(ObjectType objectType) const {
+    return
+        objectTypes.empty() ||
+        (objectTypes.find(objectType) != objectTypes.cend());
+}
+
+bool ObjectFilter::matchesChannel(uint16_t channel) const {
+    if (channels.empty())
+        return true;
+
+    /* objects without channel */
+    if (channel == 0)
+        return false;
+
+    return std::any_of(channels.cbegin(), channels.cend(), [channel](const std::pair<uint16_t, uint16_t> & range) {
+        return (channel >= range.first) && (channel <= range.second);
+    });
+}
+
+bool ObjectFilter::matchesTimeStamp(uint64_t timeStamp) const {
+    return
+        (timeStamp >= minTimeStamp) &&
+        (timeStamp <= maxTimeStamp);
+}
+
+bool ObjectFilter::hasTimeWindow() const {
+    return
+        (minTimeStamp > 0) ||
+        (maxTimeStamp < std::numeric_limits<uint64_t>::max());
+}
+
+bool ObjectFilter::matches(const ObjectHeaderBase * ohb) const {
+    return
+        matchesObjectType(ohb->objectType) &&
+        matchesChannel(File::objectChannel(ohb)) &&
+        matchesTimeStamp(ohb->objectTimeStampNs());
+}
+
+bool ObjectFilter::matches(const FileIndexEntry & fileIndexEntry) const {
+    /* any selected object type */
+    if (!objectTypes.empty() &&
+            std::none_of(fileIndexEntry.objectCounts.cbegin(), fileIndexEntry.objectCounts.cend(), [this](const std::pair<const ObjectType, uint32_t> & objectCount) {
+            return matchesObjectType(objectCount.first);
+        }))
+        return false;
+
+    /* any selected channel */
+    if (!channels.empty() &&
+            std::none_of(fileIndexEntry.channels.cbegin(), fileIndexEntry.channels.cend(), [this](uint16_t channel) {
+            return matchesChannel(channel);
+        }))
+        return false;
+
+    /* overlapping time stamps */
+    if (hasTimeWindow() &&
+            ((fileIndexEntry.minTimeStamp > maxTimeStamp) || (fileIndexEntry.maxTimeStamp < minTimeStamp)))
+        return false;
+
+    return true;
+}
+
+}
+}
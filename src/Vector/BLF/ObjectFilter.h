@@ -0,0 +1,113 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <Vector/BLF/platform.h>
+
+#include <cstdint>
+#include <limits>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include <Vector/BLF/FileIndexEntry.h>
+#include <Vector/BLF/ObjectHeaderBase.h>
+
+#include <Vector/BLF/vector_blf_export.h>
+
+namespace Vector {
+namespace BLF {
+
+/**
+ * Object Filter
+ *
+ * Selects objects by object type, channel and time stamp.
+ * Each criterion selects all objects, if it's left at its default.
+ */
+struct VECTOR_BLF_EXPORT ObjectFilter final {
+    /**
+     * object types to select
+     *
+     * All object types are selected, if this is empty.
+     */
+    std::set<ObjectType> objectTypes {};
+
+    /**
+     * channel ranges to select, as pairs of first and last channel
+     *
+     * All channels are selected, if this is empty. Otherwise objects
+     * without a channel are not selected.
+     */
+    std::vector<std::pair<uint16_t, uint16_t>> channels {};
+
+    /**
+     * minimum time stamp (in ns) to select
+     */
+    uint64_t minTimeStamp {0};
+
+    /**
+     * maximum time stamp (in ns) to select
+     */
+    uint64_t maxTimeStamp {std::numeric_limits<uint64_t>::max()};
+
+    /**
+     * Check if the filter selects all objects.
+     *
+     * @return true if all criteria are at their defaults
+     */
+    bool empty() const;
+
+    /**
+     * Check if the object type is selected.
+     *
+     * @param[in] objectType object type
+     * @return true if selected
+     */
+    bool matchesObjectType(ObjectType objectType) const;
+
+    /**
+     * Check if the channel is selected.
+     *
+     * @param[in] channel channel, or 0 if the object has no channel
+     * @return true if selected
+     */
+    bool matchesChannel(uint16_t channel) const;
+
+    /**
+     * Check if the time stamp is selected.
+     *
+     * @param[in] timeStamp time stamp (in ns)
+     * @return true if selected
+     */
+    bool matchesTimeStamp(uint64_t timeStamp) const;
+
+    /**
+     * Check if the time stamps are restricted.
+     *
+     * @return true if minTimeStamp or maxTimeStamp is set
+     */
+    bool hasTimeWindow() const;
+
+    /**
+     * Check if the object is selected.
+     *
+     * @param[in] ohb object
+     * @return true if selected
+     */
+    bool matches(const ObjectHeaderBase * ohb) const;
+
+    /**
+     * Check if a LogContainer might contain selected objects.
+     *
+     * This can be used as File::logContainerFilter.
+     *
+     * @param[in] fileIndexEntry summary of the LogContainer
+     * @return true if the LogContainer might contain selected objects
+     */
+    bool matches(const FileIndexEntry & fileIndexEntry) const;
+};
+
+}
+}
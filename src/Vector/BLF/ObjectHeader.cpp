@@ -4,9 +4,18 @@
 
 #include <Vector/BLF/ObjectHeader.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of ObjectHeader from objectFlags to objectTimeStamp */
+using ObjectHeaderFields = Fields<
+    VECTOR_BLF_FIELD(ObjectHeader, objectFlags),
+    VECTOR_BLF_FIELD(ObjectHeader, clientIndex),
+    VECTOR_BLF_FIELD(ObjectHeader, objectVersion),
+    VECTOR_BLF_FIELD(ObjectHeader, objectTimeStamp)>;
+
 ObjectHeader::ObjectHeader(const ObjectType objectType, const uint16_t objectVersion) :
     ObjectHeaderBase(1, objectType),
     objectVersion(objectVersion) {
@@ -14,32 +23,32 @@ ObjectHeader::ObjectHeader(const ObjectType objectType, const uint16_t objectVer
 
 void ObjectHeader::read(AbstractFile & is) {
     ObjectHeaderBase::read(is);
-    is.read(reinterpret_cast<char *>(&objectFlags), sizeof(objectFlags));
-    is.read(reinterpret_cast<char *>(&clientIndex), sizeof(clientIndex));
-    is.read(reinterpret_cast<char *>(&objectVersion), sizeof(objectVersion));
-    is.read(reinterpret_cast<char *>(&objectTimeStamp), sizeof(objectTimeStamp));
+    ObjectHeaderFields::read(is, *this);
 }
 
 void ObjectHeader::write(AbstractFile & os) {
     ObjectHeaderBase::write(os);
-    os.write(reinterpret_cast<char *>(&objectFlags), sizeof(objectFlags));
-    os.write(reinterpret_cast<char *>(&clientIndex), sizeof(clientIndex));
-    os.write(reinterpret_cast<char *>(&objectVersion), sizeof(objectVersion));
-    os.write(reinterpret_cast<char *>(&objectTimeStamp), sizeof(objectTimeStamp));
+    ObjectHeaderFields::write(os, *this);
 }
 
 uint16_t ObjectHeader::calculateHeaderSize() const {
     return
         ObjectHeaderBase::calculateHeaderSize() +
-        sizeof(objectFlags) +
-        sizeof(clientIndex) +
-        sizeof(objectVersion) +
-        sizeof(objectTimeStamp);
+        ObjectHeaderFields::size();
 }
 
 uint32_t ObjectHeader::calculateObjectSize() const {
     return calculateHeaderSize();
 }
 
+uint64_t ObjectHeader::objectTimeStampNs() const {
+    /* 10 micro-second resolution */
+    if (objectFlags == ObjectFlags::TimeTenMics)
+        return objectTimeStamp * 10000;
+
+    /* 1 nano-second resolution */
+    return objectTimeStamp;
+}
+
 }
 }
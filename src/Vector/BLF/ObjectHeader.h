@@ -26,6 +26,7 @@ struct VECTOR_BLF_EXPORT ObjectHeader : ObjectHeaderBase {
     void write(AbstractFile & os) override;
     uint16_t calculateHeaderSize() const override;
     uint32_t calculateObjectSize() const override;
+    uint64_t objectTimeStampNs() const override;
 
     /** enumeration for objectFlags */
     enum ObjectFlags : uint32_t {
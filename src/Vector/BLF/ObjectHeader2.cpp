@@ -4,47 +4,52 @@
 
 #include <Vector/BLF/ObjectHeader2.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of ObjectHeader2 from objectFlags to originalTimeStamp */
+using ObjectHeader2Fields = Fields<
+    VECTOR_BLF_FIELD(ObjectHeader2, objectFlags),
+    VECTOR_BLF_FIELD(ObjectHeader2, timeStampStatus),
+    VECTOR_BLF_FIELD(ObjectHeader2, reservedObjectHeader),
+    VECTOR_BLF_FIELD(ObjectHeader2, objectVersion),
+    VECTOR_BLF_FIELD(ObjectHeader2, objectTimeStamp),
+    VECTOR_BLF_FIELD(ObjectHeader2, originalTimeStamp)>;
+
 ObjectHeader2::ObjectHeader2(const ObjectType objectType) :
     ObjectHeaderBase(2, objectType) {
 }
 
 void ObjectHeader2::read(AbstractFile & is) {
     ObjectHeaderBase::read(is);
-    is.read(reinterpret_cast<char *>(&objectFlags), sizeof(objectFlags));
-    is.read(reinterpret_cast<char *>(&timeStampStatus), sizeof(timeStampStatus));
-    is.read(reinterpret_cast<char *>(&reservedObjectHeader), sizeof(reservedObjectHeader));
-    is.read(reinterpret_cast<char *>(&objectVersion), sizeof(objectVersion));
-    is.read(reinterpret_cast<char *>(&objectTimeStamp), sizeof(objectTimeStamp));
-    is.read(reinterpret_cast<char *>(&originalTimeStamp), sizeof(originalTimeStamp));
+    ObjectHeader2Fields::read(is, *this);
 }
 
 void ObjectHeader2::write(AbstractFile & os) {
     ObjectHeaderBase::write(os);
-    os.write(reinterpret_cast<char *>(&objectFlags), sizeof(objectFlags));
-    os.write(reinterpret_cast<char *>(&timeStampStatus), sizeof(timeStampStatus));
-    os.write(reinterpret_cast<char *>(&reservedObjectHeader), sizeof(reservedObjectHeader));
-    os.write(reinterpret_cast<char *>(&objectVersion), sizeof(objectVersion));
-    os.write(reinterpret_cast<char *>(&objectTimeStamp), sizeof(objectTimeStamp));
-    os.write(reinterpret_cast<char *>(&originalTimeStamp), sizeof(originalTimeStamp));
+    ObjectHeader2Fields::write(os, *this);
 }
 
 uint16_t ObjectHeader2::calculateHeaderSize() const {
     return
         ObjectHeaderBase::calculateHeaderSize() +
-        sizeof(objectFlags) +
-        sizeof(timeStampStatus) +
-        sizeof(reservedObjectHeader) +
-        sizeof(objectVersion) +
-        sizeof(objectTimeStamp) +
-        sizeof(originalTimeStamp);
+        ObjectHeader2Fields::size();
 }
 
 uint32_t ObjectHeader2::calculateObjectSize() const {
     return calculateHeaderSize();
 }
 
+uint64_t ObjectHeader2::objectTimeStampNs() const {
+    /* 10 micro-second resolution */
+    if (objectFlags == ObjectFlags::TimeTenMics)
+        return objectTimeStamp * 10000;
+
+    /* 1 nano-second resolution */
+    return objectTimeStamp;
+}
+
 }
 }
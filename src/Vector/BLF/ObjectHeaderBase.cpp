@@ -6,10 +6,18 @@
 
 #include <Vector/BLF/AbstractFile.h>
 #include <Vector/BLF/Exceptions.h>
+#include <Vector/BLF/Fields.h>
 
 namespace Vector {
 	namespace BLF {
 
+		/** fields of ObjectHeaderBase from headerSize to objectType */
+		using ObjectHeaderBaseFields = Fields<
+			VECTOR_BLF_FIELD(ObjectHeaderBase, headerSize),
+			VECTOR_BLF_FIELD(ObjectHeaderBase, headerVersion),
+			VECTOR_BLF_FIELD(ObjectHeaderBase, objectSize),
+			VECTOR_BLF_FIELD(ObjectHeaderBase, objectType)>;
+
 		ObjectHeaderBase::ObjectHeaderBase(const uint16_t headerVersion, const ObjectType objectType) :
 			headerVersion(headerVersion),
 			objectType(objectType) {
@@ -18,30 +26,19 @@ namespace Vector {
 		void ObjectHeaderBase::read(AbstractFile& is) {
 			/* let us be more robust, when reading */
 			uint32_t tmp = 0;
+			is.read(reinterpret_cast<char *>(&tmp), sizeof(tmp));
 			while (tmp != ObjectSignature) {
-				is.read(reinterpret_cast<char *>(&tmp), sizeof(tmp));
-				if (tmp == ObjectSignature) {
-					signature = tmp;
-				} else {
-					if (is.eof()) {
-						throw Exception("ObjectHeaderBase::read(): End of File.");
-					}
-
-					if ((0xffffff00 & tmp) == 0x424f4c00) {
-						is.seekg(-3, std::ios_base::cur);
-					} else if ((0xffff0000 & tmp) == 0x4f4c0000) {
-						is.seekg(-2, std::ios_base::cur);
-					} else if ((0xff000000 & tmp) == 0x4c000000) {
-						is.seekg(-1, std::ios_base::cur);
-					} else {
-						/* do not seek as we did not find a single char */
-					}
+				if (is.eof()) {
+					throw Exception("ObjectHeaderBase::read(): End of File.");
 				}
+
+				/* shift in the next byte, so the stream is only read forward */
+				uint8_t next = 0;
+				is.read(reinterpret_cast<char *>(&next), sizeof(next));
+				tmp = (tmp >> 8) | (static_cast<uint32_t>(next) << 24);
 			}
-			is.read(reinterpret_cast<char*>(&headerSize), sizeof(headerSize));
-			is.read(reinterpret_cast<char*>(&headerVersion), sizeof(headerVersion));
-			is.read(reinterpret_cast<char*>(&objectSize), sizeof(objectSize));
-			is.read(reinterpret_cast<char*>(&objectType), sizeof(objectType));
+			signature = tmp;
+			ObjectHeaderBaseFields::read(is, *this);
 		}
 
 		void ObjectHeaderBase::write(AbstractFile& os) {
@@ -50,24 +47,22 @@ namespace Vector {
 			objectSize = calculateObjectSize();
 
 			os.write(reinterpret_cast<char*>(&signature), sizeof(signature));
-			os.write(reinterpret_cast<char*>(&headerSize), sizeof(headerSize));
-			os.write(reinterpret_cast<char*>(&headerVersion), sizeof(headerVersion));
-			os.write(reinterpret_cast<char*>(&objectSize), sizeof(objectSize));
-			os.write(reinterpret_cast<char*>(&objectType), sizeof(objectType));
+			ObjectHeaderBaseFields::write(os, *this);
 		}
 
 		uint16_t ObjectHeaderBase::calculateHeaderSize() const {
 			return
 				sizeof(signature) +
-				sizeof(headerSize) +
-				sizeof(headerVersion) +
-				sizeof(objectSize) +
-				sizeof(objectType);
+				ObjectHeaderBaseFields::size();
 		}
 
 		uint32_t ObjectHeaderBase::calculateObjectSize() const {
 			return calculateHeaderSize();
 		}
 
+		uint64_t ObjectHeaderBase::objectTimeStampNs() const {
+			return 0;
+		}
+
 	}
 }
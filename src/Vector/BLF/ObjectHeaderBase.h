@@ -197,6 +197,15 @@ struct VECTOR_BLF_EXPORT ObjectHeaderBase {
      */
     virtual uint32_t calculateObjectSize() const;
 
+    /**
+     * Returns the object time stamp in nanoseconds.
+     *
+     * Objects without time stamp return 0.
+     *
+     * @return object time stamp (in ns)
+     */
+    virtual uint64_t objectTimeStampNs() const;
+
     /**
      * @brief signature (ObjectSignature)
      *
@@ -0,0 +1,214 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <Vector/BLF/ObjectPool.h>
+
+#include <typeinfo>
+
+#include <Vector/BLF/File.h>
+#include <Vector/BLF/ObjectTypes.h>
+
+namespace Vector {
+namespace BLF {
+
+namespace {
+
+/**
+ * Reset object by copying a default object into it.
+ *
+ * In contrast to moving a new object into it, the vectors keep their memory.
+ * The object type can be changed by the caller, so the class of the object
+ * is checked before the cast.
+ *
+ * @param[in,out] ohb object
+ * @return false if the object is not of class T
+ */
+template <typename T>
+bool resetObject(ObjectHeaderBase * ohb) {
+    if (typeid(*ohb) != typeid(T))
+        return false;
+    static const T defaultObject;
+    *static_cast<T *>(ohb) = defaultObject;
+    return true;
+}
+
+}
+
+ObjectPool::~ObjectPool() {
+    clear();
+}
+
+ObjectHeaderBase * ObjectPool::create(ObjectType type) {
+    ObjectHeaderBase * ohb = nullptr;
+
+    {
+        /* mutex lock */
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        /* take recycled object */
+        std::size_t index = static_cast<std::size_t>(type);
+        if ((index < m_objects.size()) && !m_objects[index].empty()) {
+            ohb = m_objects[index].back();
+            m_objects[index].pop_back();
+        }
+    }
+
+    /* create new object */
+    if (ohb == nullptr) {
+        ohb = File::createObject(type);
+        if (ohb == nullptr)
+            return nullptr;
+    }
+
+    /* the default object type of a class might be another one, e.g. for ENV_DOUBLE */
+    ohb->objectType = type;
+    return ohb;
+}
+
+RawObject * ObjectPool::createRawObject(ObjectType type) {
+    RawObject * rawObject = nullptr;
+
+    {
+        /* mutex lock */
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        /* take recycled raw object */
+        if (!m_rawObjects.empty()) {
+            rawObject = m_rawObjects.back();
+            m_rawObjects.pop_back();
+        }
+    }
+
+    /* create new raw object */
+    if (rawObject == nullptr)
+        rawObject = new RawObject;
+
+    rawObject->objectType = type;
+    return rawObject;
+}
+
+void ObjectPool::recycle(ObjectHeaderBase * ohb) {
+    /* check */
+    if (ohb == nullptr)
+        return;
+
+    /* raw objects of any object type */
+    RawObject * rawObject = dynamic_cast<RawObject *>(ohb);
+    if (rawObject != nullptr) {
+        reset(rawObject);
+
+        {
+            /* mutex lock */
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            /* keep raw object */
+            if (m_rawObjects.size() < m_maxSize) {
+                m_rawObjects.push_back(rawObject);
+                return;
+            }
+        }
+
+        /* pool is full */
+        delete rawObject;
+        return;
+    }
+
+    /* reset object outside of the lock, objects of another class than their object type are not kept */
+    std::size_t index = static_cast<std::size_t>(ohb->objectType);
+    if (!reset(ohb)) {
+        delete ohb;
+        return;
+    }
+
+    {
+        /* mutex lock */
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        /* keep object */
+        if (index >= m_objects.size())
+            m_objects.resize(index + 1);
+        if (m_objects[index].size() < m_maxSize) {
+            m_objects[index].push_back(ohb);
+            return;
+        }
+    }
+
+    /* pool is full */
+    delete ohb;
+}
+
+void ObjectPool::clear() {
+    /* mutex lock */
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    /* delete objects */
+    for (std::vector<ObjectHeaderBase *> & objects : m_objects) {
+        for (ObjectHeaderBase * ohb : objects)
+            delete ohb;
+        objects.clear();
+    }
+    for (RawObject * rawObject : m_rawObjects)
+        delete rawObject;
+    m_rawObjects.clear();
+}
+
+std::size_t ObjectPool::size() const {
+    /* mutex lock */
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    std::size_t size = 0;
+    for (const std::vector<ObjectHeaderBase *> & objects : m_objects)
+        size += objects.size();
+    size += m_rawObjects.size();
+    return size;
+}
+
+std::size_t ObjectPool::maxSize() const {
+    /* mutex lock */
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_maxSize;
+}
+
+void ObjectPool::setMaxSize(std::size_t maxSize) {
+    /* mutex lock */
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    /* set max size */
+    m_maxSize = maxSize;
+
+    /* delete objects exceeding it */
+    for (std::vector<ObjectHeaderBase *> & objects : m_objects) {
+        while (objects.size() > m_maxSize) {
+            delete objects.back();
+            objects.pop_back();
+        }
+    }
+    while (m_rawObjects.size() > m_maxSize) {
+        delete m_rawObjects.back();
+        m_rawObjects.pop_back();
+    }
+}
+
+bool ObjectPool::reset(ObjectHeaderBase * ohb) {
+    /* raw objects of any object type */
+    if (dynamic_cast<RawObject *>(ohb) != nullptr)
+        return resetObject<RawObject>(ohb);
+
+    switch (ohb->objectType) {
+#define VECTOR_BLF_OBJECT_TYPE(objectType, T) \
+    case ObjectType::objectType: \
+        return resetObject<T>(ohb);
+    VECTOR_BLF_OBJECT_TYPES(VECTOR_BLF_OBJECT_TYPE)
+#undef VECTOR_BLF_OBJECT_TYPE
+
+    default:
+        break;
+    }
+
+    return false;
+}
+
+}
+}
@@ -0,0 +1,123 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <Vector/BLF/platform.h>
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+#include <Vector/BLF/ObjectHeaderBase.h>
+#include <Vector/BLF/RawObject.h>
+
+#include <Vector/BLF/vector_blf_export.h>
+
+namespace Vector {
+namespace BLF {
+
+/**
+ * Thread-safe pool of objects per object type
+ *
+ * Objects, that are no longer needed, can be recycled into the pool.
+ * They are reset to their default values, but keep the memory of their
+ * vectors. create returns recycled objects before it allocates new ones,
+ * so reading with recycling does not need heap allocations once the pool
+ * is filled.
+ */
+class VECTOR_BLF_EXPORT ObjectPool final {
+  public:
+    ObjectPool() = default;
+    ~ObjectPool();
+    ObjectPool(const ObjectPool &) = delete;
+    ObjectPool & operator=(const ObjectPool &) = delete;
+    ObjectPool(ObjectPool &&) = delete;
+    ObjectPool & operator=(ObjectPool &&) = delete;
+
+    /**
+     * Create object of given type, preferably a recycled one.
+     *
+     * @param[in] type object type
+     * @return object, or nullptr for unknown object types
+     */
+    ObjectHeaderBase * create(ObjectType type);
+
+    /**
+     * Create RawObject of given type, preferably a recycled one.
+     *
+     * @param[in] type object type
+     * @return raw object
+     */
+    RawObject * createRawObject(ObjectType type);
+
+    /**
+     * Return object into the pool.
+     *
+     * Ownership is taken over from the user to the pool.
+     * If the pool of this object type is full, the object is deleted.
+     * The same happens to objects, whose class doesn't match their object
+     * type. RawObjects are kept separately, independent of their object type.
+     *
+     * @param[in] ohb object
+     */
+    void recycle(ObjectHeaderBase * ohb);
+
+    /**
+     * Delete all objects in the pool.
+     */
+    void clear();
+
+    /**
+     * Get number of objects in the pool.
+     *
+     * @return number of objects
+     */
+    std::size_t size() const;
+
+    /**
+     * Get maximum number of objects kept per object type.
+     *
+     * @return maximum number of objects
+     */
+    std::size_t maxSize() const;
+
+    /**
+     * Set maximum number of objects kept per object type.
+     *
+     * 0 disables the pool.
+     *
+     * @param[in] maxSize maximum number of objects
+     */
+    void setMaxSize(std::size_t maxSize);
+
+    /**
+     * Reset object to the default values of its type.
+     *
+     * Vectors are emptied, but keep their memory.
+     * The class is determined from the object itself, the object type is
+     * only used to look it up. Objects, whose class doesn't match their
+     * object type, are left unchanged.
+     *
+     * @param[in,out] ohb object
+     * @return true if the object was reset
+     */
+    static bool reset(ObjectHeaderBase * ohb);
+
+  private:
+    /** recycled objects, indexed by object type */
+    std::vector<std::vector<ObjectHeaderBase *>> m_objects {};
+
+    /** recycled raw objects */
+    std::vector<RawObject *> m_rawObjects {};
+
+    /** maximum number of objects per object type */
+    std::size_t m_maxSize {1000};
+
+    /** mutex */
+    mutable std::mutex m_mutex {};
+};
+
+}
+}
@@ -4,6 +4,8 @@
 
 #include <Vector/BLF/ObjectQueue.h>
 
+#include <algorithm>
+
 #include <Vector/BLF/Exceptions.h>
 #include <Vector/BLF/LogContainer.h>
 
@@ -41,6 +43,7 @@ T * ObjectQueue<T>::read() {
     else {
         ohb = m_queue.front();
         m_queue.pop();
+        m_bufferedBytes -= AbstractObjectQueue<T>::objectBytes(ohb);
 
         /* set state */
         m_rdstate = std::ios_base::goodbit;
@@ -55,6 +58,47 @@ T * ObjectQueue<T>::read() {
     return ohb;
 }
 
+template<typename T>
+std::size_t ObjectQueue<T>::read(std::vector<T *> & objects, std::size_t maxObjects) {
+    if (maxObjects == 0)
+        return 0;
+
+    /* mutex lock */
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    /* wait for data */
+    tellpChanged.wait(lock, [&] {
+        return
+        m_abort ||
+        !m_queue.empty() ||
+        (m_tellg >= m_fileSize);
+    });
+
+    /* get all available entries */
+    std::size_t count = 0;
+    if (m_queue.empty())
+        m_rdstate = std::ios_base::eofbit | std::ios_base::failbit;
+    else {
+        while (!m_queue.empty() && (count < maxObjects)) {
+            objects.push_back(m_queue.front());
+            m_queue.pop();
+            m_bufferedBytes -= AbstractObjectQueue<T>::objectBytes(objects.back());
+            count++;
+        }
+
+        /* set state */
+        m_rdstate = std::ios_base::goodbit;
+
+        /* increase get count */
+        m_tellg += static_cast<uint32_t>(count);
+    }
+
+    /* notify */
+    tellgChanged.notify_all();
+
+    return count;
+}
+
 template<typename T>
 uint32_t ObjectQueue<T>::tellg() const {
     /* mutex lock */
@@ -72,11 +116,19 @@ void ObjectQueue<T>::write(T * obj) {
     tellgChanged.wait(lock, [&] {
         return
         m_abort ||
-        static_cast<uint32_t>(m_queue.size()) < m_bufferSize;
+        hasFreeSpace();
     });
 
+    /* after abort, there might be no space to keep the object */
+    if (!hasFreeSpace()) {
+        delete obj;
+        return;
+    }
+
     /* push data */
     m_queue.push(obj);
+    m_bufferedBytes += AbstractObjectQueue<T>::objectBytes(obj);
+    m_peakBufferedBytes = std::max(m_peakBufferedBytes, m_bufferedBytes);
 
     /* increase put count */
     m_tellp++;
@@ -89,6 +141,46 @@ void ObjectQueue<T>::write(T * obj) {
     tellpChanged.notify_all();
 }
 
+template<typename T>
+void ObjectQueue<T>::write(const std::vector<T *> & objects) {
+    /* mutex lock */
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    for (std::size_t i = 0; i < objects.size(); ) {
+        /* wait for free space */
+        tellgChanged.wait(lock, [&] {
+            return
+            m_abort ||
+            hasFreeSpace();
+        });
+
+        /* after abort, there might be no space to keep the objects */
+        if (!hasFreeSpace()) {
+            for (; i < objects.size(); ++i)
+                delete objects[i];
+            return;
+        }
+
+        /* push as much data as fits */
+        while ((i < objects.size()) && hasFreeSpace()) {
+            m_queue.push(objects[i]);
+            m_bufferedBytes += AbstractObjectQueue<T>::objectBytes(objects[i]);
+            m_peakBufferedBytes = std::max(m_peakBufferedBytes, m_bufferedBytes);
+            i++;
+
+            /* increase put count */
+            m_tellp++;
+        }
+
+        /* shift eof */
+        if (m_tellp > m_fileSize)
+            m_fileSize = m_tellp;
+
+        /* notify */
+        tellpChanged.notify_all();
+    }
+}
+
 template<typename T>
 uint32_t ObjectQueue<T>::tellp() const {
     /* mutex lock */
@@ -126,6 +218,31 @@ void ObjectQueue<T>::abort() {
     tellpChanged.notify_all();
 }
 
+template<typename T>
+void ObjectQueue<T>::reset() {
+    /* mutex lock */
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    /* delete elements in queue */
+    while (!m_queue.empty()) {
+        delete m_queue.front();
+        m_queue.pop();
+    }
+
+    /* initial state */
+    m_abort = false;
+    m_tellg = 0;
+    m_tellp = 0;
+    m_bufferedBytes = 0;
+    m_peakBufferedBytes = 0;
+    m_fileSize = std::numeric_limits<uint32_t>::max();
+    m_rdstate = std::ios_base::goodbit;
+
+    /* notify */
+    tellgChanged.notify_all();
+    tellpChanged.notify_all();
+}
+
 template<typename T>
 void ObjectQueue<T>::setFileSize(uint32_t fileSize) {
     /* mutex lock */
@@ -138,6 +255,14 @@ void ObjectQueue<T>::setFileSize(uint32_t fileSize) {
     tellpChanged.notify_all();
 }
 
+template<typename T>
+uint32_t ObjectQueue<T>::bufferSize() const {
+    /* mutex lock */
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_bufferSize;
+}
+
 template<typename T>
 void ObjectQueue<T>::setBufferSize(uint32_t bufferSize) {
     /* mutex lock */
@@ -147,6 +272,46 @@ void ObjectQueue<T>::setBufferSize(uint32_t bufferSize) {
     m_bufferSize = bufferSize;
 }
 
+template<typename T>
+uint64_t ObjectQueue<T>::bufferedBytes() const {
+    /* mutex lock */
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_bufferedBytes;
+}
+
+template<typename T>
+uint64_t ObjectQueue<T>::peakBufferedBytes() const {
+    /* mutex lock */
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_peakBufferedBytes;
+}
+
+template<typename T>
+void ObjectQueue<T>::setMaxBufferedBytes(uint64_t maxBufferedBytes) {
+    /* mutex lock */
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    /* set max size */
+    m_maxBufferedBytes = maxBufferedBytes;
+}
+
+template<typename T>
+bool ObjectQueue<T>::full() const {
+    /* mutex lock */
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return !hasFreeSpace();
+}
+
+template<typename T>
+bool ObjectQueue<T>::hasFreeSpace() const {
+    return
+        (static_cast<uint32_t>(m_queue.size()) < m_bufferSize) &&
+        (m_queue.empty() || (m_bufferedBytes < m_maxBufferedBytes));
+}
+
 template class ObjectQueue<ObjectHeaderBase>;
 
 }
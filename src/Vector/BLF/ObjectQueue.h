@@ -10,7 +10,9 @@
 #include <limits>
 #include <mutex>
 #include <queue>
+#include <vector>
 
+#include <Vector/BLF/AbstractObjectQueue.h>
 #include <Vector/BLF/ObjectHeaderBase.h>
 #include <Vector/BLF/LogContainer.h>
 
@@ -23,19 +25,22 @@ namespace BLF {
  * Thread-safe queue for ObjectHeaderBase
  */
 template <typename T>
-class VECTOR_BLF_EXPORT ObjectQueue final {
+class VECTOR_BLF_EXPORT ObjectQueue final : public AbstractObjectQueue<T> {
   public:
-    ~ObjectQueue();
+    ~ObjectQueue() override;
 
     /**
      * Get access to front of queue.
      *
      * @return object (or nullptr if empty)
      */
-    T * read();
+    T * read() override;
+
+    /** @copydoc AbstractObjectQueue::read(std::vector<T *> &, std::size_t) */
+    std::size_t read(std::vector<T *> & objects, std::size_t maxObjects) override;
 
     /** @copydoc AbstractFile::tellg */
-    uint32_t tellg() const;
+    uint32_t tellg() const override;
 
     /**
      * Enqueue an object to end of queue.
@@ -44,25 +49,46 @@ class VECTOR_BLF_EXPORT ObjectQueue final {
      *
      * @param[in] obj object
      */
-    void write(T * obj);
+    void write(T * obj) override;
+
+    /** @copydoc AbstractObjectQueue::write(const std::vector<T *> &) */
+    void write(const std::vector<T *> & objects) override;
 
     /** @copydoc AbstractFile::tellp */
-    uint32_t tellp() const;
+    uint32_t tellp() const override;
 
     /** @copydoc AbstractFile::good */
-    bool good() const;
+    bool good() const override;
 
     /** @copydoc AbstractFile::eof */
-    bool eof() const;
+    bool eof() const override;
 
     /** @copydoc UncompressedFile::abort */
-    void abort();
+    void abort() override;
+
+    /** @copydoc UncompressedFile::reset */
+    void reset() override;
 
     /** @copydoc UncompressedFile::setFileSize */
-    void setFileSize(uint32_t fileSize);
+    void setFileSize(uint32_t fileSize) override;
+
+    /** @copydoc UncompressedFile::bufferSize */
+    uint32_t bufferSize() const override;
 
     /** @copydoc UncompressedFile::setBufferSize */
-    void setBufferSize(uint32_t bufferSize);
+    void setBufferSize(uint32_t bufferSize) override;
+
+    /** @copydoc AbstractObjectQueue::bufferedBytes */
+    uint64_t bufferedBytes() const override;
+
+    /** @copydoc AbstractObjectQueue::peakBufferedBytes */
+    uint64_t peakBufferedBytes() const override;
+
+    /** @copydoc AbstractObjectQueue::setMaxBufferedBytes */
+    void setMaxBufferedBytes(uint64_t maxBufferedBytes) override;
+
+    /** @copydoc AbstractObjectQueue::full */
+    bool full() const override;
 
     /** data was dequeued */
     std::condition_variable tellgChanged {};
@@ -86,6 +112,15 @@ class VECTOR_BLF_EXPORT ObjectQueue final {
     /** max size */
     uint32_t m_bufferSize {std::numeric_limits<uint32_t>::max()};
 
+    /** size of the enqueued objects */
+    uint64_t m_bufferedBytes {};
+
+    /** maximum of m_bufferedBytes */
+    uint64_t m_peakBufferedBytes {};
+
+    /** max size of the enqueued objects */
+    uint64_t m_maxBufferedBytes {std::numeric_limits<uint64_t>::max()};
+
     /** eof position */
     uint32_t m_fileSize {std::numeric_limits<uint32_t>::max()};
 
@@ -94,6 +129,13 @@ class VECTOR_BLF_EXPORT ObjectQueue final {
 
     /** mutex */
     mutable std::mutex m_mutex {};
+
+    /**
+     * Check for free space, with m_mutex locked.
+     *
+     * @return true if an object can be enqueued
+     */
+    bool hasFreeSpace() const;
 };
 
 /* explicit template instantiation */
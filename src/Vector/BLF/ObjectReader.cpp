@@ -0,0 +1,92 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <Vector/BLF/ObjectReader.h>
+
+#include <limits>
+
+#include <Vector/BLF/RawObject.h>
+
+namespace Vector {
+namespace BLF {
+
+ObjectReader::ObjectReader() {
+    /* the end of file is always set to the data appended, so reads never wait */
+    m_uncompressedFile.setBufferSize(std::numeric_limits<std::streamsize>::max());
+    m_uncompressedFile.setFileSize(0);
+}
+
+std::streampos ObjectReader::append(const std::shared_ptr<LogContainer> & logContainer) {
+    std::streampos position = m_uncompressedFile.tellp();
+    m_uncompressedFile.write(logContainer);
+    m_uncompressedFile.setFileSize(m_uncompressedFile.tellp());
+    return position;
+}
+
+bool ObjectReader::peek(ObjectHeaderBase & ohb, bool allDataAppended) {
+    /* make sure the object header is available */
+    if (available() < ohb.calculateHeaderSize())
+        return false;
+
+    /* read header to identify type and size */
+    ohb.read(m_uncompressedFile);
+    if (!m_uncompressedFile.good())
+        return false;
+    m_uncompressedFile.seekg(-ohb.calculateHeaderSize(), std::ios_base::cur);
+
+    /* make sure the object is available */
+    std::streamsize size = ohb.objectSize;
+    if (!allDataAppended)
+        size += RawObject::paddingSize(ohb);
+    return available() >= size;
+}
+
+bool ObjectReader::read(ObjectHeaderBase & obj, const ObjectHeaderBase & ohb) {
+    /* read object */
+    if (!readObject(m_uncompressedFile, obj, ohb))
+        return false;
+
+    /* drop old data */
+    m_uncompressedFile.dropOldData();
+    return true;
+}
+
+bool ObjectReader::readObject(AbstractFile & is, ObjectHeaderBase & obj, const ObjectHeaderBase & ohb) {
+    int32_t tmp = 0;
+    if (obj.calculateObjectSize() > ohb.objectSize) {
+        // we are about to read too much data
+        tmp = ohb.objectSize - obj.calculateObjectSize();
+    }
+
+    /* read object */
+    obj.read(is);
+    if (!is.good())
+        return false;
+    if (tmp != 0)
+        is.seekg(tmp, std::ios_base::cur);
+    return true;
+}
+
+void ObjectReader::copy(AbstractFile & os, std::streamsize n) {
+    m_data.resize(static_cast<std::size_t>(n));
+    m_uncompressedFile.read(m_data.data(), n);
+    os.write(m_data.data(), m_uncompressedFile.gcount());
+    m_uncompressedFile.dropOldData();
+}
+
+void ObjectReader::skip(std::streamsize n) {
+    m_uncompressedFile.seekg(n);
+    m_uncompressedFile.dropOldData();
+}
+
+std::streampos ObjectReader::tellg() {
+    return m_uncompressedFile.tellg();
+}
+
+std::streamsize ObjectReader::available() {
+    return m_uncompressedFile.fileSize() - m_uncompressedFile.tellg();
+}
+
+}
+}
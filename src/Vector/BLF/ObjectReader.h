@@ -0,0 +1,124 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <Vector/BLF/platform.h>
+
+#include <memory>
+#include <vector>
+
+#include <Vector/BLF/AbstractFile.h>
+#include <Vector/BLF/LogContainer.h>
+#include <Vector/BLF/ObjectHeaderBase.h>
+#include <Vector/BLF/UncompressedFile.h>
+
+#include <Vector/BLF/vector_blf_export.h>
+
+namespace Vector {
+namespace BLF {
+
+/**
+ * Reader of the objects in a sequence of LogContainers
+ *
+ * The LogContainers are appended by the same thread, that reads the
+ * objects, so there are no read threads and no waiting. An object is only
+ * read, once the LogContainer with its end is appended. Positions are
+ * counted in the data of all LogContainers appended, so the caller knows,
+ * in which LogContainer an object starts.
+ *
+ * FileIndex::build and FileSplicer::append use it to read the objects
+ * LogContainer by LogContainer.
+ *
+ * This class is not thread-safe. It should only be accessed by one thread.
+ */
+class VECTOR_BLF_EXPORT ObjectReader final {
+  public:
+    ObjectReader();
+
+    /**
+     * Append an inflated LogContainer.
+     *
+     * @param[in] logContainer LogContainer
+     * @return position of its data
+     */
+    virtual std::streampos append(const std::shared_ptr<LogContainer> & logContainer);
+
+    /**
+     * Peek the header of the next object.
+     *
+     * The object is available, if all of it, including its padding, is in
+     * the LogContainers appended. If all LogContainers are appended, the
+     * padding at the end may be missing.
+     *
+     * @param[out] ohb object header
+     * @param[in] allDataAppended no more LogContainers will be appended
+     * @return true, if the object is available
+     */
+    virtual bool peek(ObjectHeaderBase & ohb, bool allDataAppended);
+
+    /**
+     * Read the object peeked before.
+     *
+     * Objects, whose classes read more data than objectSize, continue
+     * behind objectSize.
+     *
+     * @param[out] obj new or reset object of the peeked type, e.g. RawObject
+     * @param[in] ohb object header returned by peek
+     * @return true, if the object was read
+     */
+    virtual bool read(ObjectHeaderBase & obj, const ObjectHeaderBase & ohb);
+
+    /**
+     * Read an object, whose header was read before.
+     *
+     * Objects, whose classes read more data than objectSize, continue
+     * behind objectSize. This is shared by File and ObjectReader.
+     *
+     * @param[in] is input file, positioned at the object
+     * @param[out] obj new or reset object of the type in ohb
+     * @param[in] ohb object header
+     * @return true, if the object was read
+     */
+    static bool readObject(AbstractFile & is, ObjectHeaderBase & obj, const ObjectHeaderBase & ohb);
+
+    /**
+     * Copy data as it is.
+     *
+     * @param[in] os output file
+     * @param[in] n size of data, at most available
+     */
+    virtual void copy(AbstractFile & os, std::streamsize n);
+
+    /**
+     * Skip data.
+     *
+     * @param[in] n size of data, at most available
+     */
+    virtual void skip(std::streamsize n);
+
+    /**
+     * Get position of the next data read.
+     *
+     * @return get position
+     */
+    virtual std::streampos tellg();
+
+    /**
+     * Get size of data appended, but not read yet.
+     *
+     * @return size of data
+     */
+    virtual std::streamsize available();
+
+  private:
+    /** data of the LogContainers appended */
+    UncompressedFile m_uncompressedFile {};
+
+    /** buffer for copy */
+    std::vector<char> m_data {};
+};
+
+}
+}
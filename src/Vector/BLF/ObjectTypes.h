@@ -0,0 +1,275 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <Vector/BLF/platform.h>
+
+#include <Vector/BLF/ObjectHeaderBase.h>
+
+// UNKNOWN = 0
+#include <Vector/BLF/CanMessage.h> // CAN_MESSAGE = 1
+#include <Vector/BLF/CanErrorFrame.h> // CAN_ERROR = 2
+#include <Vector/BLF/CanOverloadFrame.h> // CAN_OVERLOAD = 3
+#include <Vector/BLF/CanDriverStatistic.h> // CAN_STATISTIC = 4
+#include <Vector/BLF/AppTrigger.h> // APP_TRIGGER = 5
+#include <Vector/BLF/EnvironmentVariable.h> // ENV_INTEGER = 6
+#include <Vector/BLF/EnvironmentVariable.h> // ENV_DOUBLE = 7
+#include <Vector/BLF/EnvironmentVariable.h> // ENV_STRING = 8
+#include <Vector/BLF/EnvironmentVariable.h> // ENV_DATA = 9
+#include <Vector/BLF/LogContainer.h> // LOG_CONTAINER = 10
+#include <Vector/BLF/LinMessage.h> // LIN_MESSAGE = 11
+#include <Vector/BLF/LinCrcError.h> // LIN_CRC_ERROR = 12
+#include <Vector/BLF/LinDlcInfo.h> // LIN_DLC_INFO = 13
+#include <Vector/BLF/LinReceiveError.h> // LIN_RCV_ERROR =  14
+#include <Vector/BLF/LinSendError.h> // LIN_SND_ERROR = 15
+#include <Vector/BLF/LinSlaveTimeout.h> // LIN_SLV_TIMEOUT = 16
+#include <Vector/BLF/LinSchedulerModeChange.h> // LIN_SCHED_MODCH = 17
+#include <Vector/BLF/LinSyncError.h> // LIN_SYN_ERROR = 18
+#include <Vector/BLF/LinBaudrateEvent.h> // LIN_BAUDRATE = 19
+#include <Vector/BLF/LinSleepModeEvent.h> // LIN_SLEEP = 20
+#include <Vector/BLF/LinWakeupEvent.h> // LIN_WAKEUP = 21
+#include <Vector/BLF/MostSpy.h> // MOST_SPY = 22
+#include <Vector/BLF/MostCtrl.h> // MOST_CTRL = 23
+#include <Vector/BLF/MostLightLock.h> // MOST_LIGHTLOCK = 24
+#include <Vector/BLF/MostStatistic.h> // MOST_STATISTIC = 25
+// Reserved26 = 26
+// Reserved27 = 27
+// Reserved28 = 28
+#include <Vector/BLF/FlexRayData.h> // FLEXRAY_DATA = 29
+#include <Vector/BLF/FlexRaySync.h> // FLEXRAY_SYNC = 30
+#include <Vector/BLF/CanDriverError.h> // CAN_DRIVER_ERROR = 31
+#include <Vector/BLF/MostPkt.h> // MOST_PKT  = 32
+#include <Vector/BLF/MostPkt2.h> // MOST_PKT2 = 33
+#include <Vector/BLF/MostHwMode.h> // MOST_HWMODE = 34
+#include <Vector/BLF/MostReg.h> // MOST_REG = 35
+#include <Vector/BLF/MostGenReg.h> // MOST_GENREG = 36
+#include <Vector/BLF/MostNetState.h> // MOST_NETSTATE = 37
+#include <Vector/BLF/MostDataLost.h> // MOST_DATALOST = 38
+#include <Vector/BLF/MostTrigger.h> // MOST_TRIGGER = 39
+#include <Vector/BLF/FlexRayV6StartCycleEvent.h> // FLEXRAY_CYCLE = 40
+#include <Vector/BLF/FlexRayV6Message.h> // FLEXRAY_MESSAGE = 41
+#include <Vector/BLF/LinChecksumInfo.h> // LIN_CHECKSUM_INFO = 42
+#include <Vector/BLF/LinSpikeEvent.h> // LIN_SPIKE_EVENT = 43
+#include <Vector/BLF/CanDriverHwSync.h> // CAN_DRIVER_SYNC = 44
+#include <Vector/BLF/FlexRayStatusEvent.h> // FLEXRAY_STATUS = 45
+#include <Vector/BLF/GpsEvent.h> // GPS_EVENT = 46
+#include <Vector/BLF/FlexRayVFrError.h> // FR_ERROR = 47
+#include <Vector/BLF/FlexRayVFrStatus.h> // FR_STATUS = 48
+#include <Vector/BLF/FlexRayVFrStartCycle.h> // FR_STARTCYCLE = 49
+#include <Vector/BLF/FlexRayVFrReceiveMsg.h> // FR_RCVMESSAGE = 50
+#include <Vector/BLF/RealtimeClock.h> // REALTIMECLOCK = 51
+// Reserved52 = 52
+// Reserved53 = 53
+#include <Vector/BLF/LinStatisticEvent.h> // LIN_STATISTIC = 54
+#include <Vector/BLF/J1708Message.h> // J1708_MESSAGE = 55
+#include <Vector/BLF/J1708Message.h> // J1708_VIRTUAL_MSG = 56
+#include <Vector/BLF/LinMessage2.h> // LIN_MESSAGE2 = 57
+#include <Vector/BLF/LinSendError2.h> // LIN_SND_ERROR2 = 58
+#include <Vector/BLF/LinSyncError2.h> // LIN_SYN_ERROR2 = 59
+#include <Vector/BLF/LinCrcError2.h> // LIN_CRC_ERROR2 = 60
+#include <Vector/BLF/LinReceiveError2.h> // LIN_RCV_ERROR2 = 61
+#include <Vector/BLF/LinWakeupEvent2.h> // LIN_WAKEUP2 = 62
+#include <Vector/BLF/LinSpikeEvent2.h> // LIN_SPIKE_EVENT2 = 63
+#include <Vector/BLF/LinLongDomSignalEvent.h> // LIN_LONG_DOM_SIG = 64
+#include <Vector/BLF/AppText.h> // APP_TEXT = 65
+#include <Vector/BLF/FlexRayVFrReceiveMsgEx.h> // FR_RCVMESSAGE_EX = 66
+#include <Vector/BLF/MostStatisticEx.h> // MOST_STATISTICEX = 67
+#include <Vector/BLF/MostTxLight.h> // MOST_TXLIGHT = 68
+#include <Vector/BLF/MostAllocTab.h> // MOST_ALLOCTAB = 69
+#include <Vector/BLF/MostStress.h> // MOST_STRESS = 70
+#include <Vector/BLF/EthernetFrame.h> // ETHERNET_FRAME = 71
+#include <Vector/BLF/SystemVariable.h> // SYS_VARIABLE = 72
+#include <Vector/BLF/CanErrorFrameExt.h> // CAN_ERROR_EXT = 73
+#include <Vector/BLF/CanDriverErrorExt.h> // CAN_DRIVER_ERROR_EXT = 74
+#include <Vector/BLF/LinLongDomSignalEvent2.h> // LIN_LONG_DOM_SIG2 = 75
+#include <Vector/BLF/Most150Message.h> // MOST_150_MESSAGE = 76
+#include <Vector/BLF/Most150Pkt.h> // MOST_150_PKT = 77
+#include <Vector/BLF/MostEthernetPkt.h> // MOST_ETHERNET_PKT = 78
+#include <Vector/BLF/Most150MessageFragment.h> // MOST_150_MESSAGE_FRAGMENT = 79
+#include <Vector/BLF/Most150PktFragment.h> // MOST_150_PKT_FRAGMENT = 80
+#include <Vector/BLF/MostEthernetPktFragment.h> // MOST_ETHERNET_PKT_FRAGMENT = 81
+#include <Vector/BLF/MostSystemEvent.h> // MOST_SYSTEM_EVENT = 82
+#include <Vector/BLF/Most150AllocTab.h> // MOST_150_ALLOCTAB = 83
+#include <Vector/BLF/Most50Message.h> // MOST_50_MESSAGE = 84
+#include <Vector/BLF/Most50Pkt.h> // MOST_50_PKT = 85
+#include <Vector/BLF/CanMessage2.h> // CAN_MESSAGE2 = 86
+#include <Vector/BLF/LinUnexpectedWakeup.h> // LIN_UNEXPECTED_WAKEUP = 87
+#include <Vector/BLF/LinShortOrSlowResponse.h> // LIN_SHORT_OR_SLOW_RESPONSE = 88
+#include <Vector/BLF/LinDisturbanceEvent.h> // LIN_DISTURBANCE_EVENT = 89
+#include <Vector/BLF/SerialEvent.h> // SERIAL_EVENT = 90
+#include <Vector/BLF/DriverOverrun.h> // OVERRUN_ERROR = 91
+#include <Vector/BLF/EventComment.h> // EVENT_COMMENT = 92
+#include <Vector/BLF/WlanFrame.h> // WLAN_FRAME = 93
+#include <Vector/BLF/WlanStatistic.h> // WLAN_STATISTIC = 94
+#include <Vector/BLF/MostEcl.h> // MOST_ECL = 95
+#include <Vector/BLF/GlobalMarker.h> // GLOBAL_MARKER = 96
+#include <Vector/BLF/AfdxFrame.h> // AFDX_FRAME = 97
+#include <Vector/BLF/AfdxStatistic.h> // AFDX_STATISTIC = 98
+#include <Vector/BLF/KLineStatusEvent.h> // KLINE_STATUSEVENT = 99
+#include <Vector/BLF/CanFdMessage.h> // CAN_FD_MESSAGE = 100
+#include <Vector/BLF/CanFdMessage64.h> // CAN_FD_MESSAGE_64 = 101
+#include <Vector/BLF/EthernetRxError.h> // ETHERNET_RX_ERROR = 102
+#include <Vector/BLF/EthernetStatus.h> // ETHERNET_STATUS = 103
+#include <Vector/BLF/CanFdErrorFrame64.h> // CAN_FD_ERROR_64 = 104
+#include <Vector/BLF/LinShortOrSlowResponse2.h> // LIN_SHORT_OR_SLOW_RESPONSE2 = 105
+#include <Vector/BLF/AfdxStatus.h> // AFDX_STATUS = 106
+#include <Vector/BLF/AfdxBusStatistic.h> // AFDX_BUS_STATISTIC = 107
+// Reserved108 = 108
+#include <Vector/BLF/AfdxErrorEvent.h> // AFDX_ERROR_EVENT = 109
+#include <Vector/BLF/A429Error.h> // A429_ERROR = 110
+#include <Vector/BLF/A429Status.h> // A429_STATUS = 111
+#include <Vector/BLF/A429BusStatistic.h> // A429_BUS_STATISTIC = 112
+#include <Vector/BLF/A429Message.h> // A429_MESSAGE = 113
+#include <Vector/BLF/EthernetStatistic.h> // ETHERNET_STATISTIC = 114
+#include <Vector/BLF/RestorePointContainer.h> // Unknown115 = 115
+// Reserved116 = 116
+// Reserved117 = 117
+#include <Vector/BLF/TestStructure.h> // TEST_STRUCTURE = 118
+#include <Vector/BLF/DiagRequestInterpretation.h> // DIAG_REQUEST_INTERPRETATION = 119
+#include <Vector/BLF/EthernetFrameEx.h> // ETHERNET_FRAME_EX = 120
+#include <Vector/BLF/EthernetFrameForwarded.h> // ETHERNET_FRAME_FORWARDED = 121
+#include <Vector/BLF/EthernetErrorEx.h> // ETHERNET_ERROR_EX = 122
+#include <Vector/BLF/EthernetErrorForwarded.h> // ETHERNET_ERROR_FORWARDED = 123
+#include <Vector/BLF/FunctionBus.h> // FUNCTION_BUS = 124
+#include <Vector/BLF/DataLostBegin.h> // DATA_LOST_BEGIN = 125
+#include <Vector/BLF/DataLostEnd.h> // DATA_LOST_END = 126
+#include <Vector/BLF/WaterMarkEvent.h> // WATER_MARK_EVENT = 127
+#include <Vector/BLF/TriggerCondition.h> // TRIGGER_CONDITION = 128
+#include <Vector/BLF/CanSettingChanged.h> // CAN_SETTING_CHANGED = 129
+#include <Vector/BLF/DistributedObjectMember.h> // DISTRIBUTED_OBJECT_MEMBER = 130
+#include <Vector/BLF/AttributeEvent.h> // ATTRIBUTE_EVENT = 131
+
+/**
+ * Table of the object types and their classes
+ *
+ * X(objectType, class) is expanded once for each object type, that has a
+ * class. Several object types can share a class, e.g. the ENV_* types.
+ * File::createObject, File::objectChannel, ObjectPool::reset and
+ * ObjectVisitor are generated from this table, so they can't drift apart.
+ */
+#define VECTOR_BLF_OBJECT_TYPES(X) \
+    X(CAN_MESSAGE, CanMessage) \
+    X(CAN_ERROR, CanErrorFrame) \
+    X(CAN_OVERLOAD, CanOverloadFrame) \
+    X(CAN_STATISTIC, CanDriverStatistic) \
+    X(APP_TRIGGER, AppTrigger) \
+    X(ENV_INTEGER, EnvironmentVariable) \
+    X(ENV_DOUBLE, EnvironmentVariable) \
+    X(ENV_STRING, EnvironmentVariable) \
+    X(ENV_DATA, EnvironmentVariable) \
+    X(LOG_CONTAINER, LogContainer) \
+    X(LIN_MESSAGE, LinMessage) \
+    X(LIN_CRC_ERROR, LinCrcError) \
+    X(LIN_DLC_INFO, LinDlcInfo) \
+    X(LIN_RCV_ERROR, LinReceiveError) \
+    X(LIN_SND_ERROR, LinSendError) \
+    X(LIN_SLV_TIMEOUT, LinSlaveTimeout) \
+    X(LIN_SCHED_MODCH, LinSchedulerModeChange) \
+    X(LIN_SYN_ERROR, LinSyncError) \
+    X(LIN_BAUDRATE, LinBaudrateEvent) \
+    X(LIN_SLEEP, LinSleepModeEvent) \
+    X(LIN_WAKEUP, LinWakeupEvent) \
+    X(MOST_SPY, MostSpy) \
+    X(MOST_CTRL, MostCtrl) \
+    X(MOST_LIGHTLOCK, MostLightLock) \
+    X(MOST_STATISTIC, MostStatistic) \
+    X(FLEXRAY_DATA, FlexRayData) \
+    X(FLEXRAY_SYNC, FlexRaySync) \
+    X(CAN_DRIVER_ERROR, CanDriverError) \
+    X(MOST_PKT, MostPkt) \
+    X(MOST_PKT2, MostPkt2) \
+    X(MOST_HWMODE, MostHwMode) \
+    X(MOST_REG, MostReg) \
+    X(MOST_GENREG, MostGenReg) \
+    X(MOST_NETSTATE, MostNetState) \
+    X(MOST_DATALOST, MostDataLost) \
+    X(MOST_TRIGGER, MostTrigger) \
+    X(FLEXRAY_CYCLE, FlexRayV6StartCycleEvent) \
+    X(FLEXRAY_MESSAGE, FlexRayV6Message) \
+    X(LIN_CHECKSUM_INFO, LinChecksumInfo) \
+    X(LIN_SPIKE_EVENT, LinSpikeEvent) \
+    X(CAN_DRIVER_SYNC, CanDriverHwSync) \
+    X(FLEXRAY_STATUS, FlexRayStatusEvent) \
+    X(GPS_EVENT, GpsEvent) \
+    X(FR_ERROR, FlexRayVFrError) \
+    X(FR_STATUS, FlexRayVFrStatus) \
+    X(FR_STARTCYCLE, FlexRayVFrStartCycle) \
+    X(FR_RCVMESSAGE, FlexRayVFrReceiveMsg) \
+    X(REALTIMECLOCK, RealtimeClock) \
+    X(LIN_STATISTIC, LinStatisticEvent) \
+    X(J1708_MESSAGE, J1708Message) \
+    X(J1708_VIRTUAL_MSG, J1708Message) \
+    X(LIN_MESSAGE2, LinMessage2) \
+    X(LIN_SND_ERROR2, LinSendError2) \
+    X(LIN_SYN_ERROR2, LinSyncError2) \
+    X(LIN_CRC_ERROR2, LinCrcError2) \
+    X(LIN_RCV_ERROR2, LinReceiveError2) \
+    X(LIN_WAKEUP2, LinWakeupEvent2) \
+    X(LIN_SPIKE_EVENT2, LinSpikeEvent2) \
+    X(LIN_LONG_DOM_SIG, LinLongDomSignalEvent) \
+    X(APP_TEXT, AppText) \
+    X(FR_RCVMESSAGE_EX, FlexRayVFrReceiveMsgEx) \
+    X(MOST_STATISTICEX, MostStatisticEx) \
+    X(MOST_TXLIGHT, MostTxLight) \
+    X(MOST_ALLOCTAB, MostAllocTab) \
+    X(MOST_STRESS, MostStress) \
+    X(ETHERNET_FRAME, EthernetFrame) \
+    X(SYS_VARIABLE, SystemVariable) \
+    X(CAN_ERROR_EXT, CanErrorFrameExt) \
+    X(CAN_DRIVER_ERROR_EXT, CanDriverErrorExt) \
+    X(LIN_LONG_DOM_SIG2, LinLongDomSignalEvent2) \
+    X(MOST_150_MESSAGE, Most150Message) \
+    X(MOST_150_PKT, Most150Pkt) \
+    X(MOST_ETHERNET_PKT, MostEthernetPkt) \
+    X(MOST_150_MESSAGE_FRAGMENT, Most150MessageFragment) \
+    X(MOST_150_PKT_FRAGMENT, Most150PktFragment) \
+    X(MOST_ETHERNET_PKT_FRAGMENT, MostEthernetPktFragment) \
+    X(MOST_SYSTEM_EVENT, MostSystemEvent) \
+    X(MOST_150_ALLOCTAB, Most150AllocTab) \
+    X(MOST_50_MESSAGE, Most50Message) \
+    X(MOST_50_PKT, Most50Pkt) \
+    X(CAN_MESSAGE2, CanMessage2) \
+    X(LIN_UNEXPECTED_WAKEUP, LinUnexpectedWakeup) \
+    X(LIN_SHORT_OR_SLOW_RESPONSE, LinShortOrSlowResponse) \
+    X(LIN_DISTURBANCE_EVENT, LinDisturbanceEvent) \
+    X(SERIAL_EVENT, SerialEvent) \
+    X(OVERRUN_ERROR, DriverOverrun) \
+    X(EVENT_COMMENT, EventComment) \
+    X(WLAN_FRAME, WlanFrame) \
+    X(WLAN_STATISTIC, WlanStatistic) \
+    X(MOST_ECL, MostEcl) \
+    X(GLOBAL_MARKER, GlobalMarker) \
+    X(AFDX_FRAME, AfdxFrame) \
+    X(AFDX_STATISTIC, AfdxStatistic) \
+    X(KLINE_STATUSEVENT, KLineStatusEvent) \
+    X(CAN_FD_MESSAGE, CanFdMessage) \
+    X(CAN_FD_MESSAGE_64, CanFdMessage64) \
+    X(ETHERNET_RX_ERROR, EthernetRxError) \
+    X(ETHERNET_STATUS, EthernetStatus) \
+    X(CAN_FD_ERROR_64, CanFdErrorFrame64) \
+    X(LIN_SHORT_OR_SLOW_RESPONSE2, LinShortOrSlowResponse2) \
+    X(AFDX_STATUS, AfdxStatus) \
+    X(AFDX_BUS_STATISTIC, AfdxBusStatistic) \
+    X(AFDX_ERROR_EVENT, AfdxErrorEvent) \
+    X(A429_ERROR, A429Error) \
+    X(A429_STATUS, A429Status) \
+    X(A429_BUS_STATISTIC, A429BusStatistic) \
+    X(A429_MESSAGE, A429Message) \
+    X(ETHERNET_STATISTIC, EthernetStatistic) \
+    X(Unknown115, RestorePointContainer) \
+    X(TEST_STRUCTURE, TestStructure) \
+    X(DIAG_REQUEST_INTERPRETATION, DiagRequestInterpretation) \
+    X(ETHERNET_FRAME_EX, EthernetFrameEx) \
+    X(ETHERNET_FRAME_FORWARDED, EthernetFrameForwarded) \
+    X(ETHERNET_ERROR_EX, EthernetErrorEx) \
+    X(ETHERNET_ERROR_FORWARDED, EthernetErrorForwarded) \
+    X(FUNCTION_BUS, FunctionBus) \
+    X(DATA_LOST_BEGIN, DataLostBegin) \
+    X(DATA_LOST_END, DataLostEnd) \
+    X(WATER_MARK_EVENT, WaterMarkEvent) \
+    X(TRIGGER_CONDITION, TriggerCondition) \
+    X(CAN_SETTING_CHANGED, CanSettingChanged) \
+    X(DISTRIBUTED_OBJECT_MEMBER, DistributedObjectMember) \
+    X(ATTRIBUTE_EVENT, AttributeEvent)
@@ -0,0 +1,140 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <Vector/BLF/platform.h>
+
+#include <typeinfo>
+#include <type_traits>
+#include <utility>
+
+#include <Vector/BLF/ObjectHeaderBase.h>
+#include <Vector/BLF/ObjectTypes.h>
+#include <Vector/BLF/RawObject.h>
+
+#include <Vector/BLF/vector_blf_export.h>
+
+namespace Vector {
+namespace BLF {
+
+/**
+ * Static dispatch of objects to a visitor
+ *
+ * A visitor is any class with function call operators for the object
+ * classes it is interested in, e.g.
+ *
+ *     struct Visitor {
+ *         void operator()(CanMessage & canMessage);
+ *         void operator()(CanFdMessage64 & canFdMessage64);
+ *     };
+ *
+ * The overload is selected at compile time by the object type, so there
+ * is no virtual call. An operator for ObjectHeaderBase & handles all
+ * object types without a more specific overload. RawObjects are passed
+ * to an operator for RawObject & (or ObjectHeaderBase &), independent of
+ * their object type. Other objects, whose class doesn't match their object
+ * type, are not passed at all.
+ */
+template <typename Visitor>
+class ObjectVisitor final {
+  public:
+    /**
+     * Check if the visitor handles objects of the object type.
+     *
+     * @param[in] type object type
+     * @return true if there is an overload for the object type
+     */
+    static bool handles(ObjectType type);
+
+    /**
+     * Check if the visitor handles RawObjects.
+     *
+     * @return true if there is an overload for RawObject
+     */
+    static constexpr bool handlesRawObjects() {
+        return Handles<RawObject>::value;
+    }
+
+    /**
+     * Pass object to the matching overload of the visitor.
+     *
+     * @param[in] visitor visitor
+     * @param[in] ohb object
+     * @return true if the visitor handled the object
+     */
+    static bool visit(Visitor & visitor, ObjectHeaderBase * ohb);
+
+  private:
+    /** overload exists */
+    template <typename T>
+    static auto handlesTest(int) -> decltype(std::declval<Visitor &>()(std::declval<T &>()), std::true_type());
+
+    /** overload doesn't exist */
+    template <typename T>
+    static std::false_type handlesTest(...);
+
+    /** std::true_type if the visitor handles the object class */
+    template <typename T>
+    using Handles = decltype(handlesTest<T>(0));
+
+    /**
+     * call overload
+     *
+     * The object type can be changed by the caller, so the class of the
+     * object is checked before the cast.
+     */
+    template <typename T>
+    static bool call(Visitor & visitor, ObjectHeaderBase * ohb, std::true_type) {
+        if (typeid(*ohb) != typeid(T))
+            return false;
+        visitor(*static_cast<T *>(ohb));
+        return true;
+    }
+
+    /** no overload to call */
+    template <typename T>
+    static bool call(Visitor & /*visitor*/, ObjectHeaderBase * /*ohb*/, std::false_type) {
+        return false;
+    }
+};
+
+template <typename Visitor>
+bool ObjectVisitor<Visitor>::handles(ObjectType type) {
+    switch (type) {
+#define VECTOR_BLF_OBJECT_TYPE(objectType, T) \
+    case ObjectType::objectType: \
+        return Handles<T>::value;
+    VECTOR_BLF_OBJECT_TYPES(VECTOR_BLF_OBJECT_TYPE)
+#undef VECTOR_BLF_OBJECT_TYPE
+
+    default:
+        break;
+    }
+
+    return false;
+}
+
+template <typename Visitor>
+bool ObjectVisitor<Visitor>::visit(Visitor & visitor, ObjectHeaderBase * ohb) {
+    /* raw objects are not of the class of their object type */
+    if (dynamic_cast<RawObject *>(ohb) != nullptr)
+        return call<RawObject>(visitor, ohb, Handles<RawObject>());
+
+    switch (ohb->objectType) {
+#define VECTOR_BLF_OBJECT_TYPE(objectType, T) \
+    case ObjectType::objectType: \
+        return call<T>(visitor, ohb, Handles<T>());
+    VECTOR_BLF_OBJECT_TYPES(VECTOR_BLF_OBJECT_TYPE)
+#undef VECTOR_BLF_OBJECT_TYPE
+
+    default:
+        break;
+    }
+
+    return false;
+}
+
+}
+}
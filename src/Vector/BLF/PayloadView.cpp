@@ -0,0 +1,41 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <Vector/BLF/PayloadView.h>
+
+#include <utility>
+
+namespace Vector {
+namespace BLF {
+
+PayloadView::PayloadView(std::shared_ptr<const void> owner, const uint8_t * data, std::size_t size) :
+    m_owner(std::move(owner)),
+    m_data(data),
+    m_size(size) {
+}
+
+const uint8_t * PayloadView::data() const {
+    return m_data;
+}
+
+std::size_t PayloadView::size() const {
+    return m_size;
+}
+
+bool PayloadView::empty() const {
+    return m_size == 0;
+}
+
+void PayloadView::copyTo(std::vector<uint8_t> & data) const {
+    data.assign(m_data, m_data + m_size);
+}
+
+void PayloadView::reset() {
+    m_owner.reset();
+    m_data = nullptr;
+    m_size = 0;
+}
+
+}
+}
@@ -0,0 +1,111 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <Vector/BLF/platform.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <Vector/BLF/vector_blf_export.h>
+
+namespace Vector {
+namespace BLF {
+
+/**
+ * View of the payload of an object, without copying it
+ *
+ * The view refers to the data in the storage it was read from, i.e. the
+ * inflated LogContainer, and keeps this storage alive as long as the
+ * view exists.
+ */
+struct VECTOR_BLF_EXPORT PayloadView final {
+    PayloadView() = default;
+
+    /**
+     * Create view.
+     *
+     * @param[in] owner storage of the data, which is kept alive
+     * @param[in] data data
+     * @param[in] size size of data
+     */
+    PayloadView(std::shared_ptr<const void> owner, const uint8_t * data, std::size_t size);
+
+    /**
+     * Get data.
+     *
+     * @return data, or nullptr if the view is not set
+     */
+    const uint8_t * data() const;
+
+    /**
+     * Get size of data.
+     *
+     * @return size of data
+     */
+    std::size_t size() const;
+
+    /**
+     * Check if the view is empty.
+     *
+     * @return true if there is no data
+     */
+    bool empty() const;
+
+    /**
+     * Copy data.
+     *
+     * @param[out] data copy of data
+     */
+    void copyTo(std::vector<uint8_t> & data) const;
+
+    /**
+     * Release the view and the storage.
+     */
+    void reset();
+
+    /**
+     * Get payload data, which is data or, if empty, view.
+     *
+     * @param[in] data owned data, e.g. std::vector or InlineVector
+     * @param[in] view view
+     * @return payload data
+     */
+    template <typename C>
+    static const uint8_t * dataOf(const C & data, const PayloadView & view) {
+        if (data.empty() && (view.m_data != nullptr))
+            return view.m_data;
+        return data.data();
+    }
+
+    /**
+     * Get payload size, which is of data or, if empty, of view.
+     *
+     * @param[in] data owned data, e.g. std::vector or InlineVector
+     * @param[in] view view
+     * @return payload size
+     */
+    template <typename C>
+    static std::size_t sizeOf(const C & data, const PayloadView & view) {
+        if (data.empty())
+            return view.m_size;
+        return data.size();
+    }
+
+  private:
+    /** storage */
+    std::shared_ptr<const void> m_owner {};
+
+    /** data */
+    const uint8_t * m_data {nullptr};
+
+    /** size of data */
+    std::size_t m_size {};
+};
+
+}
+}
@@ -0,0 +1,171 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <cstring>
+
+#include <Vector/BLF/RawObject.h>
+
+#include <Vector/BLF/Exceptions.h>
+#include <Vector/BLF/Fields.h>
+#include <Vector/BLF/File.h>
+#include <Vector/BLF/ObjectBuffer.h>
+#include <Vector/BLF/ObjectHeader.h>
+#include <Vector/BLF/ObjectHeader2.h>
+
+namespace Vector {
+namespace BLF {
+
+namespace {
+
+/** fields of ObjectHeaderBase from headerSize to objectType */
+using RawObjectFields = Fields<
+    VECTOR_BLF_FIELD(RawObject, headerSize),
+    VECTOR_BLF_FIELD(RawObject, headerVersion),
+    VECTOR_BLF_FIELD(RawObject, objectSize),
+    VECTOR_BLF_FIELD(RawObject, objectType)>;
+
+/**
+ * Check if objects of the object type are followed by padding.
+ *
+ * These are the object types, whose classes skip objectSize % 4 bytes
+ * after their data. For unknown object types no padding is assumed.
+ * Padding, that is there anyway, is skipped by ObjectHeaderBase::read of
+ * the next object.
+ *
+ * @param[in] type object type
+ * @return true if there is padding
+ */
+bool hasPadding(ObjectType type) {
+    switch (type) {
+    case ObjectType::ENV_INTEGER:
+    case ObjectType::ENV_DOUBLE:
+    case ObjectType::ENV_STRING:
+    case ObjectType::ENV_DATA:
+    case ObjectType::LOG_CONTAINER:
+    case ObjectType::MOST_PKT:
+    case ObjectType::MOST_PKT2:
+    case ObjectType::APP_TEXT:
+    case ObjectType::MOST_ALLOCTAB:
+    case ObjectType::ETHERNET_FRAME:
+    case ObjectType::SYS_VARIABLE:
+    case ObjectType::MOST_150_MESSAGE:
+    case ObjectType::MOST_150_PKT:
+    case ObjectType::MOST_ETHERNET_PKT:
+    case ObjectType::MOST_150_MESSAGE_FRAGMENT:
+    case ObjectType::MOST_150_PKT_FRAGMENT:
+    case ObjectType::MOST_ETHERNET_PKT_FRAGMENT:
+    case ObjectType::MOST_150_ALLOCTAB:
+    case ObjectType::MOST_50_MESSAGE:
+    case ObjectType::MOST_50_PKT:
+    case ObjectType::SERIAL_EVENT:
+    case ObjectType::EVENT_COMMENT:
+    case ObjectType::WLAN_FRAME:
+    case ObjectType::GLOBAL_MARKER:
+    case ObjectType::AFDX_FRAME:
+    case ObjectType::ETHERNET_RX_ERROR:
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+/**
+ * Write raw object as it is.
+ *
+ * @param[in] rawObject raw object
+ * @param[in] os output stream
+ */
+void writeRawObject(const RawObject & rawObject, AbstractFile & os) {
+    os.write(reinterpret_cast<const char *>(&rawObject.signature), sizeof(rawObject.signature));
+    RawObjectFields::write(os, rawObject);
+    os.write(reinterpret_cast<const char *>(rawObject.data.data()), static_cast<std::streamsize>(rawObject.data.size()));
+
+    /* skip padding */
+    if (hasPadding(rawObject.objectType))
+        os.skipp(rawObject.objectSize % 4);
+}
+
+}
+
+RawObject::RawObject() :
+    ObjectHeaderBase(0, ObjectType::UNKNOWN) {
+}
+
+void RawObject::read(AbstractFile & is) {
+    ObjectHeaderBase::read(is);
+    uint32_t headerBaseSize = ObjectHeaderBase::calculateHeaderSize();
+    data.resize(objectSize > headerBaseSize ? objectSize - headerBaseSize : 0);
+    is.read(reinterpret_cast<char *>(data.data()), static_cast<std::streamsize>(data.size()));
+
+    /* skip padding */
+    is.seekg(paddingSize(*this), std::ios_base::cur);
+}
+
+void RawObject::write(AbstractFile & os) {
+    /* pre processing */
+    objectSize = calculateObjectSize();
+
+    writeRawObject(*this, os);
+}
+
+uint16_t RawObject::calculateHeaderSize() const {
+    return headerSize;
+}
+
+uint32_t RawObject::calculateObjectSize() const {
+    return
+        ObjectHeaderBase::calculateHeaderSize() +
+        static_cast<uint32_t>(data.size());
+}
+
+uint64_t RawObject::objectTimeStampNs() const {
+    /* objectFlags (offset 0) and objectTimeStamp (offset 8) are at the same offsets in ObjectHeader and ObjectHeader2 */
+    if (data.size() < 16)
+        return 0;
+    ObjectHeader objectHeader(ObjectType::UNKNOWN);
+    std::memcpy(&objectHeader.objectFlags, &data[0], sizeof(objectHeader.objectFlags));
+    std::memcpy(&objectHeader.objectTimeStamp, &data[8], sizeof(objectHeader.objectTimeStamp));
+
+    switch (headerVersion) {
+    case 1:
+        return objectHeader.objectTimeStampNs();
+
+    case 2: {
+        ObjectHeader2 objectHeader2(ObjectType::UNKNOWN);
+        objectHeader2.objectFlags = objectHeader.objectFlags;
+        objectHeader2.objectTimeStamp = objectHeader.objectTimeStamp;
+        return objectHeader2.objectTimeStampNs();
+    }
+
+    default:
+        return 0;
+    }
+}
+
+ObjectHeaderBase * RawObject::decode() const {
+    /* create object */
+    ObjectHeaderBase * ohb = File::createObject(objectType);
+    if (ohb == nullptr)
+        return nullptr;
+    ohb->objectType = objectType;
+
+    /* decode it from the raw data */
+    ObjectBuffer objectBuffer;
+    writeRawObject(*this, objectBuffer);
+    ohb->read(objectBuffer);
+    if (!objectBuffer.good()) {
+        delete ohb;
+        throw Exception("RawObject::decode(): Read beyond end of object.");
+    }
+
+    return ohb;
+}
+
+uint32_t RawObject::paddingSize(const ObjectHeaderBase & ohb) {
+    return hasPadding(ohb.objectType) ? ohb.objectSize % 4 : 0;
+}
+
+}
+}
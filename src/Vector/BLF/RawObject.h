@@ -0,0 +1,91 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <Vector/BLF/platform.h>
+
+#include <vector>
+
+#include <Vector/BLF/AbstractFile.h>
+#include <Vector/BLF/ObjectHeaderBase.h>
+
+#include <Vector/BLF/vector_blf_export.h>
+
+namespace Vector {
+namespace BLF {
+
+/**
+ * Selection of objects, that File::read returns as RawObject
+ */
+enum class RawObjectMode : uint8_t {
+    /** all objects are decoded, objects of unknown type are skipped */
+    None = 0,
+
+    /** objects of unknown type are returned as RawObject */
+    Unknown = 1,
+
+    /** all objects are returned as RawObject */
+    All = 2
+};
+
+/**
+ * Object, that is not decoded
+ *
+ * It keeps the object type of the original object, and the bytes
+ * following the ObjectHeaderBase (i.e. the ObjectHeader/ObjectHeader2 and
+ * the object data), as they are in the file. Writing it reproduces the
+ * original object, so objects can be copied between files without
+ * decoding and encoding each field, and also objects of types not known
+ * to this library.
+ */
+struct VECTOR_BLF_EXPORT RawObject final : ObjectHeaderBase {
+    RawObject();
+
+    void read(AbstractFile & is) override;
+    void write(AbstractFile & os) override;
+
+    /**
+     * @copydoc ObjectHeaderBase::calculateHeaderSize
+     *
+     * This is the headerSize of the original object.
+     */
+    uint16_t calculateHeaderSize() const override;
+
+    uint32_t calculateObjectSize() const override;
+
+    /**
+     * @copydoc ObjectHeaderBase::objectTimeStampNs
+     *
+     * This is taken from the ObjectHeader resp. ObjectHeader2 in data.
+     */
+    uint64_t objectTimeStampNs() const override;
+
+    /**
+     * Decode into an object of the original type.
+     *
+     * Ownership is taken over from the library to the user.
+     *
+     * @return object, or nullptr for unknown object types
+     */
+    ObjectHeaderBase * decode() const;
+
+    /**
+     * Size of the padding behind an object.
+     *
+     * @param[in] ohb object header
+     * @return objectSize % 4 for object types followed by padding, otherwise 0
+     */
+    static uint32_t paddingSize(const ObjectHeaderBase & ohb);
+
+    /**
+     * @brief object data
+     *
+     * Bytes following the ObjectHeaderBase, without the padding.
+     */
+    std::vector<uint8_t> data {};
+};
+
+}
+}
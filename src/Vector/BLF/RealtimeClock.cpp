@@ -4,30 +4,34 @@
 
 #include <Vector/BLF/RealtimeClock.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of RealtimeClock from time to loggingOffset */
+using RealtimeClockFields = Fields<
+    VECTOR_BLF_FIELD(RealtimeClock, time),
+    VECTOR_BLF_FIELD(RealtimeClock, loggingOffset)>;
+
 RealtimeClock::RealtimeClock() :
     ObjectHeader(ObjectType::REALTIMECLOCK) {
 }
 
 void RealtimeClock::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&time), sizeof(time));
-    is.read(reinterpret_cast<char *>(&loggingOffset), sizeof(loggingOffset));
+    RealtimeClockFields::read(is, *this);
 }
 
 void RealtimeClock::write(AbstractFile & os) {
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&time), sizeof(time));
-    os.write(reinterpret_cast<char *>(&loggingOffset), sizeof(loggingOffset));
+    RealtimeClockFields::write(os, *this);
 }
 
 uint32_t RealtimeClock::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        sizeof(time) +
-        sizeof(loggingOffset);
+        RealtimeClockFields::size();
 }
 
 }
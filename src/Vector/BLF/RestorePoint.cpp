@@ -4,29 +4,29 @@
 
 #include <Vector/BLF/RestorePoint.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of RestorePoint from timeStamp to unknownRestorePoint */
+using RestorePointFields = Fields<
+    VECTOR_BLF_FIELD(RestorePoint, timeStamp),
+    VECTOR_BLF_FIELD(RestorePoint, compressedFilePosition),
+    VECTOR_BLF_FIELD(RestorePoint, uncompressedFileOffset),
+    VECTOR_BLF_FIELD(RestorePoint, unknownRestorePoint)>;
+
 void RestorePoint::read(AbstractFile & is) {
-    is.read(reinterpret_cast<char *>(&timeStamp), sizeof(timeStamp));
-    is.read(reinterpret_cast<char *>(&compressedFilePosition), sizeof(compressedFilePosition));
-    is.read(reinterpret_cast<char *>(&uncompressedFileOffset), sizeof(uncompressedFileOffset));
-    is.read(reinterpret_cast<char *>(&unknownRestorePoint), sizeof(unknownRestorePoint));
+    RestorePointFields::read(is, *this);
 }
 
 void RestorePoint::write(AbstractFile & os) {
-    os.write(reinterpret_cast<char *>(&timeStamp), sizeof(timeStamp));
-    os.write(reinterpret_cast<char *>(&compressedFilePosition), sizeof(compressedFilePosition));
-    os.write(reinterpret_cast<char *>(&uncompressedFileOffset), sizeof(uncompressedFileOffset));
-    os.write(reinterpret_cast<char *>(&unknownRestorePoint), sizeof(unknownRestorePoint));
+    RestorePointFields::write(os, *this);
 }
 
 uint32_t RestorePoint::calculateObjectSize() {
     return
-        sizeof(timeStamp) +
-        sizeof(compressedFilePosition) +
-        sizeof(uncompressedFileOffset) +
-        sizeof(unknownRestorePoint);
+        RestorePointFields::size();
 }
 
 }
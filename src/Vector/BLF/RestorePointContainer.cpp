@@ -4,9 +4,16 @@
 
 #include <Vector/BLF/RestorePointContainer.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of RestorePointContainer from reservedRestorePointContainer to dataLength */
+using RestorePointContainerFields = Fields<
+    VECTOR_BLF_FIELD(RestorePointContainer, reservedRestorePointContainer),
+    VECTOR_BLF_FIELD(RestorePointContainer, dataLength)>;
+
 RestorePointContainer::RestorePointContainer() :
     ObjectHeader(ObjectType::Unknown115) {
 }
@@ -14,8 +21,7 @@ RestorePointContainer::RestorePointContainer() :
 void RestorePointContainer::read(AbstractFile & is) {
     ObjectHeader::read(is);
 
-    is.read(reinterpret_cast<char *>(reservedRestorePointContainer.data()), static_cast<std::streamsize>(reservedRestorePointContainer.size()));
-    is.read(reinterpret_cast<char *>(&dataLength), sizeof(dataLength));
+    RestorePointContainerFields::read(is, *this);
     data.resize(dataLength);
     is.read(reinterpret_cast<char *>(data.data()), static_cast<std::streamsize>(data.size()));
 }
@@ -25,16 +31,14 @@ void RestorePointContainer::write(AbstractFile & os) {
     dataLength = static_cast<uint16_t>(data.size());
 
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(reservedRestorePointContainer.data()), static_cast<std::streamsize>(reservedRestorePointContainer.size()));
-    os.write(reinterpret_cast<char *>(&dataLength), sizeof(dataLength));
+    RestorePointContainerFields::write(os, *this);
     os.write(reinterpret_cast<char *>(data.data()), static_cast<std::streamsize>(data.size()));
 }
 
 uint32_t RestorePointContainer::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        static_cast<uint32_t>(reservedRestorePointContainer.size()) +
-        sizeof(dataLength) +
+        RestorePointContainerFields::size() +
         dataLength;
 }
 
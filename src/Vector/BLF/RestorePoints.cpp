@@ -12,8 +12,16 @@ namespace BLF {
 void RestorePoints::read(AbstractFile & is) {
     is.read(reinterpret_cast<char *>(&objectSize), sizeof(objectSize));
     is.read(reinterpret_cast<char *>(&objectInterval), sizeof(objectInterval));
-    restorePoints.resize((objectSize - calculateObjectSize()) / RestorePoint::calculateObjectSize()); // all remaining data
-    is.read(reinterpret_cast<char *>(restorePoints.data()), static_cast<std::streamsize>(restorePoints.size()) * RestorePoint::calculateObjectSize());
+
+    /* objectSize doesn't reflect the number of restore points, so read all remaining data */
+    restorePoints.clear();
+    for (;;) {
+        RestorePoint restorePoint;
+        restorePoint.read(is);
+        if (!is.good())
+            break;
+        restorePoints.push_back(restorePoint);
+    }
 }
 
 void RestorePoints::write(AbstractFile & os) {
@@ -22,7 +30,8 @@ void RestorePoints::write(AbstractFile & os) {
 
     os.write(reinterpret_cast<char *>(&objectSize), sizeof(objectSize));
     os.write(reinterpret_cast<char *>(&objectInterval), sizeof(objectInterval));
-    os.write(reinterpret_cast<char *>(restorePoints.data()), static_cast<std::streamsize>(restorePoints.size()) * RestorePoint::calculateObjectSize());
+    for (RestorePoint & restorePoint : restorePoints)
+        restorePoint.write(os);
 }
 
 uint32_t RestorePoints::calculateObjectSize() const {
@@ -0,0 +1,354 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <Vector/BLF/RingObjectQueue.h>
+
+#include <algorithm>
+#include <thread>
+
+namespace Vector {
+namespace BLF {
+
+/** number of times to yield, before a thread sleeps */
+static const unsigned int RingObjectQueueSpinCount = 16;
+
+/** maximum number of objects in the ring */
+static const uint32_t RingObjectQueueMaxBufferSize = 0x10000;
+
+template<typename T>
+RingObjectQueue<T>::RingObjectQueue() {
+    setBufferSize(1024);
+}
+
+template<typename T>
+RingObjectQueue<T>::~RingObjectQueue() {
+    abort();
+
+    /* delete elements in ring */
+    clear();
+}
+
+template<typename T>
+T * RingObjectQueue<T>::read() {
+    uint32_t tellg = m_tellg.load(std::memory_order_relaxed);
+
+    /* wait for data */
+    if (!waitForData(tellg))
+        return nullptr;
+
+    /* get first entry */
+    T * obj = m_ring[tellg & m_mask];
+    dequeued(AbstractObjectQueue<T>::objectBytes(obj));
+    m_tellg = tellg + 1;
+    m_rdstate = std::ios_base::goodbit;
+
+    /* notify */
+    notifyWriter();
+
+    return obj;
+}
+
+template<typename T>
+std::size_t RingObjectQueue<T>::read(std::vector<T *> & objects, std::size_t maxObjects) {
+    if (maxObjects == 0)
+        return 0;
+
+    uint32_t tellg = m_tellg.load(std::memory_order_relaxed);
+
+    /* wait for data */
+    if (!waitForData(tellg))
+        return 0;
+
+    /* get all available entries */
+    std::size_t count = std::min<std::size_t>(m_tellp.load() - tellg, maxObjects);
+    uint64_t bytes = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        objects.push_back(m_ring[(tellg + i) & m_mask]);
+        bytes += AbstractObjectQueue<T>::objectBytes(objects.back());
+    }
+    dequeued(bytes);
+    m_tellg = tellg + static_cast<uint32_t>(count);
+    m_rdstate = std::ios_base::goodbit;
+
+    /* notify */
+    notifyWriter();
+
+    return count;
+}
+
+template<typename T>
+uint32_t RingObjectQueue<T>::tellg() const {
+    return m_tellg;
+}
+
+template<typename T>
+void RingObjectQueue<T>::write(T * obj) {
+    uint32_t tellp = m_tellp.load(std::memory_order_relaxed);
+
+    /* wait for free space */
+    if (!waitForFreeSpace(tellp)) {
+        /* there is no space to keep the object */
+        delete obj;
+        return;
+    }
+
+    /* push data */
+    m_ring[tellp & m_mask] = obj;
+    enqueued(AbstractObjectQueue<T>::objectBytes(obj));
+    m_tellp = tellp + 1;
+
+    /* shift eof */
+    if (tellp + 1 > m_fileSize)
+        m_fileSize = tellp + 1;
+
+    /* notify */
+    notifyReader();
+}
+
+template<typename T>
+void RingObjectQueue<T>::write(const std::vector<T *> & objects) {
+    for (std::size_t i = 0; i < objects.size(); ) {
+        uint32_t tellp = m_tellp.load(std::memory_order_relaxed);
+
+        /* wait for free space */
+        if (!waitForFreeSpace(tellp)) {
+            /* there is no space to keep the objects */
+            for (; i < objects.size(); ++i)
+                delete objects[i];
+            return;
+        }
+
+        /* push as much data as fits, at least one object */
+        uint32_t tellg = m_tellg.load();
+        uint64_t freeBytes = m_maxBufferedBytes.load() - std::min(m_bufferedBytes.load(), m_maxBufferedBytes.load());
+        std::size_t count = 0;
+        uint64_t bytes = 0;
+        do {
+            m_ring[(tellp + count) & m_mask] = objects[i + count];
+            bytes += AbstractObjectQueue<T>::objectBytes(objects[i + count]);
+            count++;
+        } while ((i + count < objects.size()) && ((tellp + count) - tellg < m_bufferSize) && (bytes < freeBytes));
+        i += count;
+        tellp += static_cast<uint32_t>(count);
+        enqueued(bytes);
+        m_tellp = tellp;
+
+        /* shift eof */
+        if (tellp > m_fileSize)
+            m_fileSize = tellp;
+
+        /* notify */
+        notifyReader();
+    }
+}
+
+template<typename T>
+uint32_t RingObjectQueue<T>::tellp() const {
+    return m_tellp;
+}
+
+template<typename T>
+bool RingObjectQueue<T>::good() const {
+    return (m_rdstate == std::ios_base::goodbit);
+}
+
+template<typename T>
+bool RingObjectQueue<T>::eof() const {
+    return (m_rdstate & std::ios_base::eofbit);
+}
+
+template<typename T>
+void RingObjectQueue<T>::abort() {
+    /* stop */
+    m_abort = true;
+
+    /* mutex lock */
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    /* trigger blocked threads */
+    m_tellgChanged.notify_all();
+    m_tellpChanged.notify_all();
+}
+
+template<typename T>
+void RingObjectQueue<T>::reset() {
+    /* delete elements in ring */
+    clear();
+
+    /* initial state */
+    m_abort = false;
+    m_tellg = 0;
+    m_tellp = 0;
+    m_bufferedBytes = 0;
+    m_peakBufferedBytes = 0;
+    m_fileSize = std::numeric_limits<uint32_t>::max();
+    m_rdstate = std::ios_base::goodbit;
+}
+
+template<typename T>
+void RingObjectQueue<T>::setFileSize(uint32_t fileSize) {
+    /* set object count */
+    m_fileSize = fileSize;
+
+    /* notify */
+    notifyReader();
+}
+
+template<typename T>
+uint32_t RingObjectQueue<T>::bufferSize() const {
+    return m_bufferSize;
+}
+
+template<typename T>
+void RingObjectQueue<T>::setBufferSize(uint32_t bufferSize) {
+    /* set max size */
+    m_bufferSize = std::max(std::min(bufferSize, RingObjectQueueMaxBufferSize), 1U);
+
+    /* allocate ring with a power of two, so that the positions can wrap around */
+    uint32_t size = 1;
+    while (size < m_bufferSize)
+        size <<= 1;
+    clear();
+    m_ring.assign(size, nullptr);
+    m_mask = size - 1;
+    m_tellg = m_tellp.load();
+}
+
+template<typename T>
+uint64_t RingObjectQueue<T>::bufferedBytes() const {
+    return m_bufferedBytes;
+}
+
+template<typename T>
+uint64_t RingObjectQueue<T>::peakBufferedBytes() const {
+    return m_peakBufferedBytes;
+}
+
+template<typename T>
+void RingObjectQueue<T>::setMaxBufferedBytes(uint64_t maxBufferedBytes) {
+    /* set max size */
+    m_maxBufferedBytes = maxBufferedBytes;
+}
+
+template<typename T>
+bool RingObjectQueue<T>::full() const {
+    return !hasFreeSpace(m_tellp.load(), false);
+}
+
+template<typename T>
+bool RingObjectQueue<T>::waitForData(uint32_t tellg) {
+    for (unsigned int spin = 0; m_tellp.load() == tellg; ++spin) {
+        /* eof or abort */
+        if (m_abort || (tellg >= m_fileSize)) {
+            m_rdstate = std::ios_base::eofbit | std::ios_base::failbit;
+            return false;
+        }
+
+        /* yield first, then sleep */
+        if (spin < RingObjectQueueSpinCount) {
+            std::this_thread::yield();
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_readerWaiting = true;
+        m_tellpChanged.wait(lock, [&] {
+            return
+            m_abort ||
+            (m_tellp.load() != tellg) ||
+            (tellg >= m_fileSize);
+        });
+        m_readerWaiting = false;
+    }
+    return true;
+}
+
+template<typename T>
+bool RingObjectQueue<T>::waitForFreeSpace(uint32_t tellp) {
+    for (unsigned int spin = 0; !hasFreeSpace(tellp, false); ++spin) {
+        /* abort */
+        if (m_abort)
+            return false;
+
+        /* yield first, then sleep until half of the ring is free */
+        if (spin < RingObjectQueueSpinCount) {
+            std::this_thread::yield();
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_writerWaiting = true;
+        m_tellgChanged.wait(lock, [&] {
+            return
+            m_abort ||
+            hasFreeSpace(tellp, true);
+        });
+        m_writerWaiting = false;
+    }
+    return true;
+}
+
+template<typename T>
+void RingObjectQueue<T>::notifyReader() {
+    if (m_readerWaiting) {
+        /* mutex lock */
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_tellpChanged.notify_all();
+    }
+}
+
+template<typename T>
+void RingObjectQueue<T>::notifyWriter() {
+    if (m_writerWaiting && hasFreeSpace(m_tellp.load(), true)) {
+        /* mutex lock */
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_tellgChanged.notify_all();
+    }
+}
+
+template<typename T>
+bool RingObjectQueue<T>::hasFreeSpace(uint32_t tellp, bool half) const {
+    uint32_t tellg = m_tellg.load();
+
+    /* an object is always enqueued into an empty ring */
+    if (tellp == tellg)
+        return true;
+
+    if (half)
+        return
+            (tellp - tellg <= m_bufferSize / 2) &&
+            (m_bufferedBytes.load() <= m_maxBufferedBytes.load() / 2);
+    return
+        (tellp - tellg < m_bufferSize) &&
+        (m_bufferedBytes.load() < m_maxBufferedBytes.load());
+}
+
+template<typename T>
+void RingObjectQueue<T>::dequeued(uint64_t bytes) {
+    m_bufferedBytes -= bytes;
+}
+
+template<typename T>
+void RingObjectQueue<T>::enqueued(uint64_t bytes) {
+    /* this is called before the write position is advanced, so the reader can't subtract the bytes before */
+    uint64_t bufferedBytes = (m_bufferedBytes += bytes);
+    if (bufferedBytes > m_peakBufferedBytes.load())
+        m_peakBufferedBytes = bufferedBytes;
+}
+
+template<typename T>
+void RingObjectQueue<T>::clear() {
+    /* delete elements in ring */
+    for (uint32_t tellg = m_tellg; tellg != m_tellp; ++tellg) {
+        delete m_ring[tellg & m_mask];
+        m_ring[tellg & m_mask] = nullptr;
+    }
+    m_tellg = m_tellp.load();
+    m_bufferedBytes = 0;
+}
+
+template class RingObjectQueue<ObjectHeaderBase>;
+
+}
+}
@@ -0,0 +1,187 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <Vector/BLF/platform.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <ios>
+#include <limits>
+#include <mutex>
+#include <vector>
+
+#include <Vector/BLF/AbstractObjectQueue.h>
+#include <Vector/BLF/ObjectHeaderBase.h>
+
+#include <Vector/BLF/vector_blf_export.h>
+
+namespace Vector {
+namespace BLF {
+
+/**
+ * Lock-free single-producer/single-consumer ring for ObjectHeaderBase
+ *
+ * Only one thread may write and only one thread may read. abort can
+ * be called from any thread.
+ *
+ * Objects are passed via a bounded ring of pointers, without taking a
+ * lock. The mutex and condition variables are only used to sleep when
+ * the ring is empty or full, and the other side only notifies, if it
+ * knows that someone sleeps.
+ */
+template <typename T>
+class VECTOR_BLF_EXPORT RingObjectQueue final : public AbstractObjectQueue<T> {
+  public:
+    RingObjectQueue();
+    ~RingObjectQueue() override;
+    RingObjectQueue(const RingObjectQueue &) = delete;
+    RingObjectQueue & operator=(const RingObjectQueue &) = delete;
+    RingObjectQueue(RingObjectQueue &&) = delete;
+    RingObjectQueue & operator=(RingObjectQueue &&) = delete;
+
+    T * read() override;
+    std::size_t read(std::vector<T *> & objects, std::size_t maxObjects) override;
+    uint32_t tellg() const override;
+    void write(T * obj) override;
+    void write(const std::vector<T *> & objects) override;
+    uint32_t tellp() const override;
+    bool good() const override;
+    bool eof() const override;
+    void abort() override;
+    void reset() override;
+    void setFileSize(uint32_t fileSize) override;
+
+    /** @copydoc UncompressedFile::bufferSize */
+    uint32_t bufferSize() const override;
+
+    /**
+     * @copydoc UncompressedFile::setBufferSize
+     *
+     * The ring is reallocated, so this must not be called while objects are enqueued.
+     */
+    void setBufferSize(uint32_t bufferSize) override;
+
+    /** @copydoc AbstractObjectQueue::bufferedBytes */
+    uint64_t bufferedBytes() const override;
+
+    /** @copydoc AbstractObjectQueue::peakBufferedBytes */
+    uint64_t peakBufferedBytes() const override;
+
+    /** @copydoc AbstractObjectQueue::setMaxBufferedBytes */
+    void setMaxBufferedBytes(uint64_t maxBufferedBytes) override;
+
+    /** @copydoc AbstractObjectQueue::full */
+    bool full() const override;
+
+  private:
+    /** abort further operations */
+    std::atomic<bool> m_abort {};
+
+    /** ring of objects, with a size that is a power of two */
+    std::vector<T *> m_ring {};
+
+    /** m_ring.size() - 1 */
+    uint32_t m_mask {};
+
+    /** read position */
+    std::atomic<uint32_t> m_tellg {};
+
+    /** write position */
+    std::atomic<uint32_t> m_tellp {};
+
+    /** max size */
+    uint32_t m_bufferSize {};
+
+    /** size of the enqueued objects */
+    std::atomic<uint64_t> m_bufferedBytes {};
+
+    /** maximum of m_bufferedBytes, only updated by the writer */
+    std::atomic<uint64_t> m_peakBufferedBytes {};
+
+    /** max size of the enqueued objects */
+    std::atomic<uint64_t> m_maxBufferedBytes {std::numeric_limits<uint64_t>::max()};
+
+    /** eof position */
+    std::atomic<uint32_t> m_fileSize {std::numeric_limits<uint32_t>::max()};
+
+    /** error state */
+    std::atomic<std::ios_base::iostate> m_rdstate {std::ios_base::goodbit};
+
+    /** reader sleeps, waiting for data */
+    std::atomic<bool> m_readerWaiting {};
+
+    /** writer sleeps, waiting for free space */
+    std::atomic<bool> m_writerWaiting {};
+
+    /** mutex for sleeping */
+    std::mutex m_mutex {};
+
+    /** data was dequeued */
+    std::condition_variable m_tellgChanged {};
+
+    /** data was enqueued */
+    std::condition_variable m_tellpChanged {};
+
+    /**
+     * Wait until data is available.
+     *
+     * @param[in] tellg read position
+     * @return false on eof or abort
+     */
+    bool waitForData(uint32_t tellg);
+
+    /**
+     * Wait until there is free space.
+     *
+     * @param[in] tellp write position
+     * @return false on abort
+     */
+    bool waitForFreeSpace(uint32_t tellp);
+
+    /**
+     * Check if there is free space.
+     *
+     * @param[in] tellp write position
+     * @param[in] half require half of the ring and of maxBufferedBytes to be free
+     * @return true if an object can be enqueued
+     */
+    bool hasFreeSpace(uint32_t tellp, bool half) const;
+
+    /**
+     * Account objects taken out of the ring.
+     *
+     * @param[in] bytes size of the objects
+     */
+    void dequeued(uint64_t bytes);
+
+    /**
+     * Account objects put into the ring.
+     *
+     * @param[in] bytes size of the objects
+     */
+    void enqueued(uint64_t bytes);
+
+    /**
+     * Wake up the reader, if it sleeps.
+     */
+    void notifyReader();
+
+    /**
+     * Wake up the writer, if it sleeps.
+     */
+    void notifyWriter();
+
+    /**
+     * Delete all objects in the ring.
+     */
+    void clear();
+};
+
+/* explicit template instantiation */
+extern template class RingObjectQueue<ObjectHeaderBase>;
+
+}
+}
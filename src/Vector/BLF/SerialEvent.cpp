@@ -4,19 +4,25 @@
 
 #include <Vector/BLF/SerialEvent.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of SerialEvent from flags to reservedSerialEvent */
+using SerialEventFields = Fields<
+    VECTOR_BLF_FIELD(SerialEvent, flags),
+    VECTOR_BLF_FIELD(SerialEvent, port),
+    VECTOR_BLF_FIELD(SerialEvent, baudrate),
+    VECTOR_BLF_FIELD(SerialEvent, reservedSerialEvent)>;
+
 SerialEvent::SerialEvent() :
     ObjectHeader(ObjectType::SERIAL_EVENT) {
 }
 
 void SerialEvent::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&flags), sizeof(flags));
-    is.read(reinterpret_cast<char *>(&port), sizeof(port));
-    is.read(reinterpret_cast<char *>(&baudrate), sizeof(baudrate));
-    is.read(reinterpret_cast<char *>(&reservedSerialEvent), sizeof(reservedSerialEvent));
+    SerialEventFields::read(is, *this);
 
     if (flags & Flags::SingleByte)
         singleByte.read(is);
@@ -34,10 +40,7 @@ void SerialEvent::read(AbstractFile & is) {
 
 void SerialEvent::write(AbstractFile & os) {
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&flags), sizeof(flags));
-    os.write(reinterpret_cast<char *>(&port), sizeof(port));
-    os.write(reinterpret_cast<char *>(&baudrate), sizeof(baudrate));
-    os.write(reinterpret_cast<char *>(&reservedSerialEvent), sizeof(reservedSerialEvent));
+    SerialEventFields::write(os, *this);
 
     if (flags & Flags::SingleByte)
         singleByte.write(os);
@@ -55,10 +58,7 @@ void SerialEvent::write(AbstractFile & os) {
 uint32_t SerialEvent::calculateObjectSize() const {
     uint32_t size =
         ObjectHeader::calculateObjectSize() +
-        sizeof(flags) +
-        sizeof(port) +
-        sizeof(baudrate) +
-        sizeof(reservedSerialEvent) +
+        SerialEventFields::size() +
         16; // size of union of singleByte/compact/general
 
     if (flags & ~(Flags::SingleByte | Flags::CompactByte))
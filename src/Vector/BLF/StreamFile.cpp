@@ -0,0 +1,125 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <Vector/BLF/StreamFile.h>
+
+namespace Vector {
+namespace BLF {
+
+StreamFile::~StreamFile() {
+    close();
+}
+
+std::streamsize StreamFile::gcount() const {
+    return m_gcount;
+}
+
+void StreamFile::read(char * s, std::streamsize n) {
+    m_gcount = 0;
+
+    /* check state */
+    if ((m_stream == nullptr) || (m_rdstate != std::ios_base::goodbit)) {
+        m_rdstate |= std::ios_base::failbit;
+        return;
+    }
+
+    /* read data */
+    m_stream->read(s, n);
+    m_gcount = m_stream->gcount();
+    m_tellg += m_gcount;
+
+    /* handle read behind eof */
+    if (m_gcount < n)
+        m_rdstate = std::ios_base::eofbit | std::ios_base::failbit;
+}
+
+std::streampos StreamFile::tellg() {
+    /* in case of failure return -1 */
+    if ((m_stream == nullptr) || (m_rdstate & (std::ios_base::failbit | std::ios_base::badbit)))
+        return -1;
+    return m_tellg;
+}
+
+void StreamFile::seekg(std::streamoff off, const std::ios_base::seekdir way) {
+    /* check state */
+    if ((m_stream == nullptr) || (m_rdstate & (std::ios_base::failbit | std::ios_base::badbit))) {
+        m_rdstate |= std::ios_base::failbit;
+        return;
+    }
+
+    /* calculate new get position, the end is not known */
+    std::streamoff pos = off;
+    if (way == std::ios_base::cur)
+        pos += m_tellg;
+    else if (way == std::ios_base::end) {
+        m_rdstate |= std::ios_base::failbit;
+        return;
+    }
+
+    /* only skip forward */
+    if (pos < m_tellg) {
+        m_rdstate |= std::ios_base::failbit;
+        return;
+    }
+    if (pos > m_tellg)
+        m_stream->ignore(pos - m_tellg);
+
+    /* new get position, reading behind eof fails on the next read */
+    m_tellg = pos;
+}
+
+void StreamFile::write(const char * /*s*/, std::streamsize /*n*/) {
+    /* read-only */
+    m_rdstate |= std::ios_base::badbit;
+}
+
+std::streampos StreamFile::tellp() {
+    /* read-only */
+    return -1;
+}
+
+bool StreamFile::good() const {
+    return (m_stream != nullptr) && (m_rdstate == std::ios_base::goodbit);
+}
+
+bool StreamFile::eof() const {
+    return (m_rdstate & std::ios_base::eofbit);
+}
+
+void StreamFile::open(std::istream & stream) {
+    /* check */
+    if (m_stream != nullptr)
+        return;
+
+    /* reset state */
+    m_stream = &stream;
+    m_tellg = 0;
+    m_gcount = 0;
+    m_rdstate = stream.good() ? std::ios_base::goodbit : std::ios_base::eofbit | std::ios_base::failbit;
+}
+
+bool StreamFile::is_open() const {
+    return m_stream != nullptr;
+}
+
+void StreamFile::close() {
+    /* the stream is owned by the caller */
+    m_stream = nullptr;
+}
+
+void StreamFile::seekp(std::streampos /*pos*/) {
+    /* read-only */
+    m_rdstate |= std::ios_base::badbit;
+}
+
+void StreamFile::clear() {
+    m_rdstate = std::ios_base::goodbit;
+}
+
+bool StreamFile::seekable() const {
+    return false;
+}
+
+}
+}
@@ -0,0 +1,76 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <Vector/BLF/platform.h>
+
+#include <istream>
+
+#include <Vector/BLF/AbstractCompressedFile.h>
+
+#include <Vector/BLF/vector_blf_export.h>
+
+namespace Vector {
+namespace BLF {
+
+/**
+ * StreamFile (Forward-only input stream)
+ *
+ * The BLF data is read from an input stream owned by the caller, e.g.
+ * std::cin or a pipe. The stream is only read forward, so seekg can only
+ * skip data, and seekable returns false.
+ *
+ * The stream needs to stay valid as long as the file is open.
+ *
+ * This class is not thread-safe. It should only be accessed by one thread.
+ */
+class VECTOR_BLF_EXPORT StreamFile final : public AbstractCompressedFile {
+  public:
+    StreamFile() = default;
+    ~StreamFile() override;
+    StreamFile(const StreamFile &) = delete;
+    StreamFile & operator=(const StreamFile &) = delete;
+    StreamFile(StreamFile &&) = delete;
+    StreamFile & operator=(StreamFile &&) = delete;
+
+    std::streamsize gcount() const override;
+    void read(char * s, std::streamsize n) override;
+    std::streampos tellg() override;
+    void seekg(std::streamoff off, const std::ios_base::seekdir way = std::ios_base::cur) override;
+    void write(const char * s, std::streamsize n) override;
+    std::streampos tellp() override;
+    bool good() const override;
+    bool eof() const override;
+    bool is_open() const override;
+    void close() override;
+    void seekp(std::streampos pos) override;
+    void clear() override;
+    bool seekable() const override;
+
+    /**
+     * open stream for reading
+     *
+     * The get position counts from the current position of the stream.
+     *
+     * @param[in] stream input stream, opened in binary mode
+     */
+    virtual void open(std::istream & stream);
+
+  private:
+    /** input stream */
+    std::istream * m_stream {nullptr};
+
+    /** get position */
+    std::streamoff m_tellg {};
+
+    /** last read size */
+    std::streamsize m_gcount {};
+
+    /** error state */
+    std::ios_base::iostate m_rdstate {std::ios_base::goodbit};
+};
+
+}
+}
@@ -4,21 +4,27 @@
 
 #include <Vector/BLF/SystemVariable.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of SystemVariable from type to reservedSystemVariable2 */
+using SystemVariableFields = Fields<
+    VECTOR_BLF_FIELD(SystemVariable, type),
+    VECTOR_BLF_FIELD(SystemVariable, representation),
+    VECTOR_BLF_FIELD(SystemVariable, reservedSystemVariable1),
+    VECTOR_BLF_FIELD(SystemVariable, nameLength),
+    VECTOR_BLF_FIELD(SystemVariable, dataLength),
+    VECTOR_BLF_FIELD(SystemVariable, reservedSystemVariable2)>;
+
 SystemVariable::SystemVariable() :
     ObjectHeader(ObjectType::SYS_VARIABLE) {
 }
 
 void SystemVariable::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&type), sizeof(type));
-    is.read(reinterpret_cast<char *>(&representation), sizeof(representation));
-    is.read(reinterpret_cast<char *>(&reservedSystemVariable1), sizeof(reservedSystemVariable1));
-    is.read(reinterpret_cast<char *>(&nameLength), sizeof(nameLength));
-    is.read(reinterpret_cast<char *>(&dataLength), sizeof(dataLength));
-    is.read(reinterpret_cast<char *>(&reservedSystemVariable2), sizeof(reservedSystemVariable2));
+    SystemVariableFields::read(is, *this);
     name.resize(nameLength);
     is.read(const_cast<char *>(name.data()), nameLength);
     data.resize(dataLength);
@@ -34,12 +40,7 @@ void SystemVariable::write(AbstractFile & os) {
     dataLength = static_cast<uint32_t>(data.size());
 
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&type), sizeof(type));
-    os.write(reinterpret_cast<char *>(&representation), sizeof(representation));
-    os.write(reinterpret_cast<char *>(&reservedSystemVariable1), sizeof(reservedSystemVariable1));
-    os.write(reinterpret_cast<char *>(&nameLength), sizeof(nameLength));
-    os.write(reinterpret_cast<char *>(&dataLength), sizeof(dataLength));
-    os.write(reinterpret_cast<char *>(&reservedSystemVariable2), sizeof(reservedSystemVariable2));
+    SystemVariableFields::write(os, *this);
     os.write(const_cast<char *>(name.data()), nameLength);
     os.write(reinterpret_cast<char *>(data.data()), dataLength);
 
@@ -50,12 +51,7 @@ void SystemVariable::write(AbstractFile & os) {
 uint32_t SystemVariable::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        sizeof(type) +
-        sizeof(representation) +
-        sizeof(reservedSystemVariable1) +
-        sizeof(nameLength) +
-        sizeof(dataLength) +
-        sizeof(reservedSystemVariable2) +
+        SystemVariableFields::size() +
         nameLength +
         dataLength;
 }
@@ -4,24 +4,30 @@
 
 #include <Vector/BLF/TestStructure.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of TestStructure from executionObjectIdentify to textLength */
+using TestStructureFields = Fields<
+    VECTOR_BLF_FIELD(TestStructure, executionObjectIdentify),
+    VECTOR_BLF_FIELD(TestStructure, type),
+    VECTOR_BLF_FIELD(TestStructure, reservedTestStructure),
+    VECTOR_BLF_FIELD(TestStructure, uniqueNo),
+    VECTOR_BLF_FIELD(TestStructure, action),
+    VECTOR_BLF_FIELD(TestStructure, result),
+    VECTOR_BLF_FIELD(TestStructure, executingObjectNameLength),
+    VECTOR_BLF_FIELD(TestStructure, nameLength),
+    VECTOR_BLF_FIELD(TestStructure, textLength)>;
+
 TestStructure::TestStructure() :
     ObjectHeader(ObjectType::TEST_STRUCTURE) {
 }
 
 void TestStructure::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&executionObjectIdentify), sizeof(executionObjectIdentify));
-    is.read(reinterpret_cast<char *>(&type), sizeof(type));
-    is.read(reinterpret_cast<char *>(&reservedTestStructure), sizeof(reservedTestStructure));
-    is.read(reinterpret_cast<char *>(&uniqueNo), sizeof(uniqueNo));
-    is.read(reinterpret_cast<char *>(&action), sizeof(action));
-    is.read(reinterpret_cast<char *>(&result), sizeof(result));
-    is.read(reinterpret_cast<char *>(&executingObjectNameLength), sizeof(executingObjectNameLength));
-    is.read(reinterpret_cast<char *>(&nameLength), sizeof(nameLength));
-    is.read(reinterpret_cast<char *>(&textLength), sizeof(textLength));
+    TestStructureFields::read(is, *this);
     executingObjectName.resize(executingObjectNameLength);
     is.read(const_cast<char *>(reinterpret_cast<const char *>(executingObjectName.data())), executingObjectNameLength * sizeof(char16_t));
     name.resize(nameLength);
@@ -37,15 +43,7 @@ void TestStructure::write(AbstractFile & os) {
     textLength = static_cast<uint32_t>(text.size());
 
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&executionObjectIdentify), sizeof(executionObjectIdentify));
-    os.write(reinterpret_cast<char *>(&type), sizeof(type));
-    os.write(reinterpret_cast<char *>(&reservedTestStructure), sizeof(reservedTestStructure));
-    os.write(reinterpret_cast<char *>(&uniqueNo), sizeof(uniqueNo));
-    os.write(reinterpret_cast<char *>(&action), sizeof(action));
-    os.write(reinterpret_cast<char *>(&result), sizeof(result));
-    os.write(reinterpret_cast<char *>(&executingObjectNameLength), sizeof(executingObjectNameLength));
-    os.write(reinterpret_cast<char *>(&nameLength), sizeof(nameLength));
-    os.write(reinterpret_cast<char *>(&textLength), sizeof(textLength));
+    TestStructureFields::write(os, *this);
     os.write(const_cast<char *>(reinterpret_cast<const char *>(executingObjectName.data())), executingObjectNameLength * sizeof(char16_t));
     os.write(const_cast<char *>(reinterpret_cast<const char *>(name.data())), nameLength * sizeof(char16_t));
     os.write(const_cast<char *>(reinterpret_cast<const char *>(text.data())), textLength * sizeof(char16_t));
@@ -54,15 +52,7 @@ void TestStructure::write(AbstractFile & os) {
 uint32_t TestStructure::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        sizeof(executionObjectIdentify) +
-        sizeof(type) +
-        sizeof(reservedTestStructure) +
-        sizeof(uniqueNo) +
-        sizeof(action) +
-        sizeof(result) +
-        sizeof(executingObjectNameLength) +
-        sizeof(nameLength) +
-        sizeof(textLength) +
+        TestStructureFields::size() +
         (executingObjectNameLength + nameLength + textLength) * sizeof(char16_t);
 }
 
@@ -0,0 +1,83 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <Vector/BLF/ThreadPoolExecutor.h>
+
+#include <algorithm>
+
+namespace Vector {
+namespace BLF {
+
+ThreadPoolExecutor::ThreadPoolExecutor(uint32_t threads) {
+    /* start worker threads */
+    threads = std::max(threads, 1U);
+    for (uint32_t i = 0; i < threads; ++i)
+        m_threads.emplace_back(workerThread, this);
+}
+
+ThreadPoolExecutor::~ThreadPoolExecutor() {
+    /* stop */
+    {
+        /* mutex lock */
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_stop = true;
+
+        /* trigger blocked threads */
+        m_taskSubmitted.notify_all();
+    }
+
+    /* finalize worker threads */
+    for (std::thread & thread : m_threads)
+        if (thread.joinable())
+            thread.join();
+}
+
+void ThreadPoolExecutor::execute(Task task) {
+    /* mutex lock */
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    /* enqueue task */
+    m_tasks.push_back(std::move(task));
+
+    /* notify */
+    m_taskSubmitted.notify_one();
+}
+
+uint32_t ThreadPoolExecutor::threads() const {
+    return static_cast<uint32_t>(m_threads.size());
+}
+
+void ThreadPoolExecutor::workerThread(ThreadPoolExecutor * executor) {
+    for (;;) {
+        Task task;
+
+        /* get submitted task */
+        {
+            /* mutex lock */
+            std::unique_lock<std::mutex> lock(executor->m_mutex);
+
+            /* wait for task */
+            executor->m_taskSubmitted.wait(lock, [&] {
+                return
+                executor->m_stop ||
+                !executor->m_tasks.empty();
+            });
+            if (executor->m_tasks.empty())
+                return;
+
+            task = std::move(executor->m_tasks.front());
+            executor->m_tasks.pop_front();
+        }
+
+        /* run task, its exceptions are its own business */
+        try {
+            task();
+        } catch (...) {
+        }
+    }
+}
+
+}
+}
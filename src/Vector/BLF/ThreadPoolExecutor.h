@@ -0,0 +1,81 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <Vector/BLF/platform.h>
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <Vector/BLF/AbstractExecutor.h>
+
+#include <Vector/BLF/vector_blf_export.h>
+
+namespace Vector {
+namespace BLF {
+
+/**
+ * Executor with a fixed number of worker threads.
+ *
+ * Tasks are run in the order they were submitted.
+ *
+ * This class is thread-safe.
+ */
+class VECTOR_BLF_EXPORT ThreadPoolExecutor final : public AbstractExecutor {
+  public:
+    /**
+     * Start worker threads.
+     *
+     * @param[in] threads number of worker threads (at least one)
+     */
+    explicit ThreadPoolExecutor(uint32_t threads = std::thread::hardware_concurrency());
+
+    /**
+     * Run the remaining tasks and stop worker threads.
+     */
+    ~ThreadPoolExecutor() override;
+
+    ThreadPoolExecutor(const ThreadPoolExecutor &) = delete;
+    ThreadPoolExecutor & operator=(const ThreadPoolExecutor &) = delete;
+    ThreadPoolExecutor(ThreadPoolExecutor &&) = delete;
+    ThreadPoolExecutor & operator=(ThreadPoolExecutor &&) = delete;
+
+    /** @copydoc AbstractExecutor::execute */
+    void execute(Task task) override;
+
+    /**
+     * Number of worker threads.
+     *
+     * @return number of worker threads
+     */
+    virtual uint32_t threads() const;
+
+  private:
+    /** stop worker threads, once all tasks are done */
+    bool m_stop {};
+
+    /** tasks not yet taken by a worker thread */
+    std::deque<Task> m_tasks {};
+
+    /** worker threads */
+    std::vector<std::thread> m_threads {};
+
+    /** mutex */
+    mutable std::mutex m_mutex {};
+
+    /** task was submitted */
+    std::condition_variable m_taskSubmitted {};
+
+    /**
+     * run submitted tasks
+     */
+    static void workerThread(ThreadPoolExecutor * executor);
+};
+
+}
+}
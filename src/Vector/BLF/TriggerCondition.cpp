@@ -4,18 +4,24 @@
 
 #include <Vector/BLF/TriggerCondition.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of TriggerCondition from state to triggerConditionLength */
+using TriggerConditionFields = Fields<
+    VECTOR_BLF_FIELD(TriggerCondition, state),
+    VECTOR_BLF_FIELD(TriggerCondition, triggerBlockNameLength),
+    VECTOR_BLF_FIELD(TriggerCondition, triggerConditionLength)>;
+
 TriggerCondition::TriggerCondition() :
     ObjectHeader(ObjectType::TRIGGER_CONDITION) {
 }
 
 void TriggerCondition::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&state), sizeof(state));
-    is.read(reinterpret_cast<char *>(&triggerBlockNameLength), sizeof(triggerBlockNameLength));
-    is.read(reinterpret_cast<char *>(&triggerConditionLength), sizeof(triggerConditionLength));
+    TriggerConditionFields::read(is, *this);
     triggerBlockName.resize(triggerBlockNameLength);
     is.read(const_cast<char *>(triggerBlockName.data()), triggerBlockNameLength);
     triggerCondition.resize(triggerConditionLength);
@@ -28,9 +34,7 @@ void TriggerCondition::write(AbstractFile & os) {
     triggerConditionLength = static_cast<uint32_t>(triggerCondition.size());
 
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&state), sizeof(state));
-    os.write(reinterpret_cast<char *>(&triggerBlockNameLength), sizeof(triggerBlockNameLength));
-    os.write(reinterpret_cast<char *>(&triggerConditionLength), sizeof(triggerConditionLength));
+    TriggerConditionFields::write(os, *this);
     os.write(const_cast<char *>(triggerBlockName.data()), triggerBlockNameLength);
     os.write(const_cast<char *>(triggerCondition.data()), triggerConditionLength);
 }
@@ -38,9 +42,7 @@ void TriggerCondition::write(AbstractFile & os) {
 uint32_t TriggerCondition::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        sizeof(state) +
-        sizeof(triggerBlockNameLength) +
-        sizeof(triggerConditionLength) +
+        TriggerConditionFields::size() +
         triggerBlockNameLength +
         triggerConditionLength;
 }
@@ -13,6 +13,7 @@
 #endif
 
 #include <Vector/BLF/Exceptions.h>
+#include <Vector/BLF/ObjectBuffer.h>
 
 namespace Vector {
 namespace BLF {
@@ -51,7 +52,7 @@ void UncompressedFile::read(char * s, std::streamsize n) {
     m_gcount = 0;
     while (n > 0) {
         /* find starting log container */
-        std::shared_ptr<LogContainer> logContainer = logContainerContaining(m_tellg);
+        LogContainer * logContainer = logContainerContaining(m_tellg, m_tellgLogContainer);
         if (!logContainer)
             break;
 
@@ -114,20 +115,18 @@ void UncompressedFile::write(const char * s, std::streamsize n) {
     /* write data */
     while (n > 0) {
         /* find starting log container */
-        std::shared_ptr<LogContainer> logContainer = logContainerContaining(m_tellp);
+        LogContainer * logContainer = logContainerContaining(m_tellp, m_tellpLogContainer);
 
         /* append new log container */
         if (!logContainer) {
             /* append new log container */
-            logContainer = std::make_shared<LogContainer>();
-            logContainer->uncompressedFile.resize(m_defaultLogContainerSize);
-            logContainer->uncompressedFileSize = logContainer->uncompressedFile.size();
-            if (!m_data.empty()) {
-                logContainer->filePosition =
-                    m_data.back()->uncompressedFileSize +
-                    m_data.back()->filePosition;
-            }
-            m_data.push_back(logContainer);
+            std::shared_ptr<LogContainer> newLogContainer = m_logContainerPool.create();
+            newLogContainer->uncompressedFile.resize(m_defaultLogContainerSize);
+            newLogContainer->uncompressedFileSize = newLogContainer->uncompressedFile.size();
+            newLogContainer->filePosition = m_tellp;
+            m_data.push_back(newLogContainer);
+            m_tellpLogContainer = m_data.size() - 1;
+            logContainer = newLogContainer.get();
         }
 
         /* offset to write */
@@ -153,6 +152,9 @@ void UncompressedFile::write(const char * s, std::streamsize n) {
     if (m_tellp >= m_fileSize)
         m_fileSize = m_tellp;
 
+    /* statistics */
+    updatePeakBufferedBytes();
+
     /* notify */
     tellpChanged.notify_all();
 }
@@ -193,6 +195,29 @@ void UncompressedFile::abort() {
     tellpChanged.notify_all();
 }
 
+void UncompressedFile::reset() {
+    /* mutex lock */
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    /* drop data */
+    m_data.clear();
+    m_tellgLogContainer = 0;
+    m_tellpLogContainer = 0;
+
+    /* initial state */
+    m_abort = false;
+    m_tellg = 0;
+    m_tellp = 0;
+    m_gcount = 0;
+    m_fileSize = std::numeric_limits<std::streamsize>::max();
+    m_rdstate = std::ios_base::goodbit;
+    m_peakBufferedBytes = 0;
+
+    /* notify */
+    tellgChanged.notify_all();
+    tellpChanged.notify_all();
+}
+
 void UncompressedFile::write(const std::shared_ptr<LogContainer> & logContainer) {
     /* mutex lock */
     std::unique_lock<std::mutex> lock(m_mutex);
@@ -201,7 +226,7 @@ void UncompressedFile::write(const std::shared_ptr<LogContainer> & logContainer)
     tellgChanged.wait(lock, [&] {
         return
         m_abort ||
-        static_cast<uint32_t>(m_tellp - m_tellg) < m_bufferSize;
+        ((m_tellp - m_tellg) < m_bufferSize);
     });
 
     /* append logContainer */
@@ -217,16 +242,128 @@ void UncompressedFile::write(const std::shared_ptr<LogContainer> & logContainer)
     /* advance put pointer */
     m_tellp += logContainer->uncompressedFileSize;
 
+    /* statistics */
+    updatePeakBufferedBytes();
+
     /* notify */
     tellpChanged.notify_all();
 }
 
+const char * UncompressedFile::readShared(std::streamsize n, std::shared_ptr<LogContainer> & logContainer) {
+    /* mutex lock */
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    /* wait until there is sufficient data */
+    tellpChanged.wait(lock, [&] {
+        return
+        m_abort ||
+        (n + m_tellg <= m_tellp) ||
+        (n + m_tellg > m_fileSize);
+    });
+
+    /* eof or abort is handled by read */
+    if ((n + m_tellg > m_tellp) || (n + m_tellg > m_fileSize))
+        return nullptr;
+
+    /* find log container */
+    LogContainer * startLogContainer = logContainerContaining(m_tellg, m_tellgLogContainer);
+    if (!startLogContainer)
+        return nullptr;
+
+    /* data spanning several log containers is handled by read */
+    std::streamoff offset = m_tellg - startLogContainer->filePosition;
+    if (offset + n > startLogContainer->uncompressedFileSize)
+        return nullptr;
+
+    /* read data */
+    logContainer = m_data[m_tellgLogContainer];
+    m_rdstate = std::ios_base::goodbit;
+    m_gcount = n;
+    m_tellg += n;
+
+    /* notify */
+    tellgChanged.notify_all();
+
+    return reinterpret_cast<const char *>(startLogContainer->uncompressedFile.data()) + offset;
+}
+
+std::streamsize UncompressedFile::readObject(ObjectHeaderBase & ohb, ObjectBuffer & objectBuffer, bool shared, const std::function<bool(const ObjectHeaderBase &)> & selected) {
+    /* mutex lock */
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    /* drop data before the object */
+    dropOldDataLocked();
+
+    /* wait until there is the object header */
+    std::streamsize headerSize = ohb.calculateHeaderSize();
+    if (!waitForData(lock, headerSize))
+        return -1;
+
+    /* peek object header, and leave resynchronization to ObjectHeaderBase::read */
+    objectBuffer.clear();
+    std::streamoff tellg = m_tellg;
+    while (headerSize > 0) {
+        LogContainer * logContainer = logContainerContaining(tellg, m_tellgLogContainer);
+        std::streamoff offset = tellg - logContainer->filePosition;
+        std::streamsize size = std::min(headerSize, static_cast<std::streamsize>(logContainer->uncompressedFileSize - offset));
+        objectBuffer.write(reinterpret_cast<const char *>(logContainer->uncompressedFile.data()) + offset, size);
+        tellg += size;
+        headerSize -= size;
+    }
+    uint32_t signature = 0;
+    std::copy(objectBuffer.data(), objectBuffer.data() + sizeof(signature), reinterpret_cast<char *>(&signature));
+    if (signature != ObjectSignature)
+        return -1;
+    ohb.read(objectBuffer);
+    objectBuffer.clear();
+    if (ohb.objectSize < ohb.calculateHeaderSize())
+        return -1;
+    std::streamsize n = ohb.objectSize + ohb.objectSize % 4;
+
+    /* skip objects not selected */
+    if (!selected(ohb)) {
+        m_tellg = std::min(static_cast<std::streamsize>(m_tellg + n), m_fileSize);
+        tellgChanged.notify_all();
+        return 0;
+    }
+
+    /* wait until there is the object, which needs to fit into the buffer */
+    if ((n > m_bufferSize) || !waitForData(lock, n))
+        return -1;
+
+    /* refer to data in one LogContainer */
+    LogContainer * logContainer = logContainerContaining(m_tellg, m_tellgLogContainer);
+    std::streamoff offset = m_tellg - logContainer->filePosition;
+    if (shared && (offset + n <= logContainer->uncompressedFileSize)) {
+        objectBuffer.loadShared(m_data[m_tellgLogContainer], reinterpret_cast<const char *>(logContainer->uncompressedFile.data()) + offset, n);
+        m_tellg += n;
+    } else {
+        /* copy data */
+        std::streamsize remaining = n;
+        while (remaining > 0) {
+            logContainer = logContainerContaining(m_tellg, m_tellgLogContainer);
+            offset = m_tellg - logContainer->filePosition;
+            std::streamsize size = std::min(remaining, static_cast<std::streamsize>(logContainer->uncompressedFileSize - offset));
+            objectBuffer.write(reinterpret_cast<const char *>(logContainer->uncompressedFile.data()) + offset, size);
+            m_tellg += size;
+            remaining -= size;
+        }
+    }
+    m_gcount = n;
+    m_rdstate = std::ios_base::goodbit;
+
+    /* notify */
+    tellgChanged.notify_all();
+
+    return n;
+}
+
 void UncompressedFile::nextLogContainer() {
     /* mutex lock */
     std::lock_guard<std::mutex> lock(m_mutex);
 
     /* find starting log container */
-    std::shared_ptr<LogContainer> logContainer = logContainerContaining(m_tellp);
+    LogContainer * logContainer = logContainerContaining(m_tellp, m_tellpLogContainer);
     if (logContainer) {
         /* offset to write */
         std::streamoff offset = m_tellp - logContainer->filePosition;
@@ -258,6 +395,13 @@ void UncompressedFile::setFileSize(std::streamsize fileSize) {
     tellpChanged.notify_all();
 }
 
+std::streamsize UncompressedFile::bufferSize() const {
+    /* mutex lock */
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_bufferSize;
+}
+
 void UncompressedFile::setBufferSize(std::streamsize bufferSize) {
     /* mutex lock */
     std::lock_guard<std::mutex> lock(m_mutex);
@@ -266,15 +410,33 @@ void UncompressedFile::setBufferSize(std::streamsize bufferSize) {
     m_bufferSize = bufferSize;
 }
 
+std::streamsize UncompressedFile::bufferedBytes() const {
+    /* mutex lock */
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return bufferedBytesLocked();
+}
+
+std::streamsize UncompressedFile::peakBufferedBytes() const {
+    /* mutex lock */
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_peakBufferedBytes;
+}
+
 void UncompressedFile::dropOldData() {
     /* mutex lock */
     std::lock_guard<std::mutex> lock(m_mutex);
 
+    dropOldDataLocked();
+}
+
+void UncompressedFile::dropOldDataLocked() {
     /* check if drop should be done now */
     if (m_data.empty()) {
         return;
     }
-    std::shared_ptr<LogContainer> logContainer = m_data.front();
+    const std::shared_ptr<LogContainer> & logContainer = m_data.front();
     if (logContainer) {
         std::streampos position = logContainer->uncompressedFileSize + logContainer->filePosition;
         if ((position > m_tellg) || (position > m_tellp) || (position > m_fileSize)) {
@@ -285,6 +447,10 @@ void UncompressedFile::dropOldData() {
 
     /* drop data */
     m_data.pop_front();
+    if (m_tellgLogContainer > 0)
+        m_tellgLogContainer--;
+    if (m_tellpLogContainer > 0)
+        m_tellpLogContainer--;
 }
 
 uint32_t UncompressedFile::defaultLogContainerSize() const {
@@ -302,22 +468,52 @@ void UncompressedFile::setDefaultLogContainerSize(uint32_t defaultLogContainerSi
     m_defaultLogContainerSize = defaultLogContainerSize;
 }
 
-std::shared_ptr<LogContainer> UncompressedFile::logContainerContaining(const std::streampos pos) const {
-    /* find logContainer that contains file position */
-    std::list<std::shared_ptr<LogContainer>>::const_iterator result = std::find_if(m_data.cbegin(), m_data.cend(), [&pos](std::shared_ptr<LogContainer> logContainer) {
-        return
-            (pos >= logContainer->filePosition) &&
-            (pos < logContainer->uncompressedFileSize + logContainer->filePosition);
-    });
+LogContainer * UncompressedFile::logContainerContaining(const std::streampos pos, std::size_t & cursor) const {
+    if (m_data.empty())
+        return nullptr;
+
+    /* start at logContainer found last time */
+    if (cursor >= m_data.size())
+        cursor = m_data.size() - 1;
+
+    /* step backward/forward to logContainer that contains file position */
+    while ((cursor > 0) && (pos < m_data[cursor]->filePosition))
+        cursor--;
+    while ((cursor < m_data.size() - 1) && (pos >= m_data[cursor]->uncompressedFileSize + m_data[cursor]->filePosition))
+        cursor++;
 
     /* if found, return logContainer */
-    if (result != m_data.cend()) {
-        return *result;
-    }
+    const LogContainer * logContainer = m_data[cursor].get();
+    if ((pos >= logContainer->filePosition) &&
+            (pos < logContainer->uncompressedFileSize + logContainer->filePosition))
+        return m_data[cursor].get();
 
     /* otherwise return nullptr */
     return nullptr;
 }
 
+bool UncompressedFile::waitForData(std::unique_lock<std::mutex> & lock, std::streamsize n) {
+    tellpChanged.wait(lock, [&] {
+        return
+        m_abort ||
+        (n + m_tellg <= m_tellp) ||
+        (n + m_tellg > m_fileSize);
+    });
+
+    return !m_abort && (n + m_tellg <= m_tellp) && (n + m_tellg <= m_fileSize);
+}
+
+void UncompressedFile::updatePeakBufferedBytes() {
+    m_peakBufferedBytes = std::max(m_peakBufferedBytes, bufferedBytesLocked());
+}
+
+std::streamsize UncompressedFile::bufferedBytesLocked() const {
+    if (m_data.empty())
+        return 0;
+
+    /* LogContainers are contiguous */
+    return (m_data.back()->filePosition - m_data.front()->filePosition) + m_data.back()->uncompressedFileSize;
+}
+
 }
 }
@@ -7,19 +7,24 @@
 #include <Vector/BLF/platform.h>
 
 #include <condition_variable>
+#include <deque>
+#include <functional>
 #include <limits>
-#include <list>
 #include <memory>
 #include <mutex>
 
 #include <Vector/BLF/AbstractFile.h>
 #include <Vector/BLF/LogContainer.h>
+#include <Vector/BLF/LogContainerPool.h>
+#include <Vector/BLF/ObjectHeaderBase.h>
 
 #include <Vector/BLF/vector_blf_export.h>
 
 namespace Vector {
 namespace BLF {
 
+class ObjectBuffer;
+
 /**
  * UncompressedFile (Input/output memory stream)
  *
@@ -52,6 +57,13 @@ class VECTOR_BLF_EXPORT UncompressedFile final : public AbstractFile {
      */
     virtual void abort();
 
+    /**
+     * Drop all data and return to the initial state, e.g. after abort.
+     *
+     * Configured sizes are kept.
+     */
+    virtual void reset();
+
     /**
      * write LogContainer
      *
@@ -59,6 +71,40 @@ class VECTOR_BLF_EXPORT UncompressedFile final : public AbstractFile {
      */
     virtual void write(const std::shared_ptr<LogContainer> & logContainer);
 
+    /**
+     * Read block of data without copying it.
+     *
+     * This only succeeds, if the block is contained in one LogContainer.
+     * The get position is advanced as in read then, and the LogContainer
+     * is returned, to keep the data alive. Otherwise nothing is read.
+     *
+     * @param[in] n Requested size of data
+     * @param[out] logContainer LogContainer containing the data
+     * @return Pointer to data, or nullptr if not available in one LogContainer
+     */
+    virtual const char * readShared(std::streamsize n, std::shared_ptr<LogContainer> & logContainer);
+
+    /**
+     * Read the next object into an ObjectBuffer.
+     *
+     * In one mutex lock, old LogContainers are dropped, the object header
+     * is peeked, and the object including its padding (objectSize +
+     * objectSize % 4) is transferred into the buffer, starting with the
+     * header. Objects not selected are skipped instead. The get position is
+     * behind the padding then.
+     *
+     * Nothing is read, if there is no valid object header, the object
+     * doesn't fit into bufferSize, or the object ends behind eof. These
+     * cases are left to reading field by field.
+     *
+     * @param[out] ohb object header
+     * @param[out] objectBuffer buffer receiving the object
+     * @param[in] shared refer to the LogContainer instead of copying, as in ObjectBuffer::loadShared
+     * @param[in] selected returns false for objects to skip
+     * @return size of the staged object, 0 if skipped, or -1 if nothing was read
+     */
+    virtual std::streamsize readObject(ObjectHeaderBase & ohb, ObjectBuffer & objectBuffer, bool shared, const std::function<bool(const ObjectHeaderBase &)> & selected);
+
     /**
      * Close the current logContainer.
      */
@@ -78,6 +124,13 @@ class VECTOR_BLF_EXPORT UncompressedFile final : public AbstractFile {
      */
     virtual void setFileSize(std::streamsize fileSize);
 
+    /**
+     * Gets the maximum file size.
+     *
+     * @return maximum file size
+     */
+    virtual std::streamsize bufferSize() const;
+
     /**
      * Sets the maximum file size.
      * Write operations block, if the size is reached.
@@ -86,6 +139,22 @@ class VECTOR_BLF_EXPORT UncompressedFile final : public AbstractFile {
      */
     virtual void setBufferSize(std::streamsize bufferSize);
 
+    /**
+     * Get the size of the LogContainers, that are not dropped yet.
+     *
+     * This is the memory held, while bufferSize only limits the data between tellg and tellp.
+     *
+     * @return size of the LogContainers
+     */
+    virtual std::streamsize bufferedBytes() const;
+
+    /**
+     * Get the maximum of bufferedBytes since the last reset.
+     *
+     * @return maximum size of the LogContainers
+     */
+    virtual std::streamsize peakBufferedBytes() const;
+
     /**
      * drop old log container, if tellg/tellp are beyond it
      */
@@ -115,8 +184,17 @@ class VECTOR_BLF_EXPORT UncompressedFile final : public AbstractFile {
     /** abort further operations */
     bool m_abort {};
 
-    /** data */
-    std::list<std::shared_ptr<LogContainer>> m_data {};
+    /** data, ordered and contiguous by filePosition */
+    std::deque<std::shared_ptr<LogContainer>> m_data {};
+
+    /** pool of the log containers appended by write */
+    LogContainerPool m_logContainerPool {};
+
+    /** index into m_data of the log container last used for reading */
+    mutable std::size_t m_tellgLogContainer {};
+
+    /** index into m_data of the log container last used for writing */
+    mutable std::size_t m_tellpLogContainer {};
 
     /** get position */
     std::streampos m_tellg {};
@@ -133,6 +211,9 @@ class VECTOR_BLF_EXPORT UncompressedFile final : public AbstractFile {
     /** buffer size */
     std::streamsize m_bufferSize {std::numeric_limits<std::streamsize>::max()};
 
+    /** maximum of bufferedBytes */
+    std::streamsize m_peakBufferedBytes {};
+
     /** error state */
     std::ios_base::iostate m_rdstate {std::ios_base::goodbit};
 
@@ -145,14 +226,42 @@ class VECTOR_BLF_EXPORT UncompressedFile final : public AbstractFile {
     /**
      * Returns the file container, which contains pos.
      *
-     * Searches through the data vector to find the logContainer, which contains the position.
+     * The search starts at the log container found last time, so sequential
+     * access finds it in constant time, regardless of the number of log containers.
      * If the position is behind the last logContainer, return nullptr to indicate a new
      * LogContainer need to be appended.
      *
      * @param[in] pos position
+     * @param[in,out] cursor index of the log container found last time
      * @return log container or nullptr
      */
-    std::shared_ptr<LogContainer> logContainerContaining(const std::streampos pos) const;
+    LogContainer * logContainerContaining(const std::streampos pos, std::size_t & cursor) const;
+
+    /**
+     * Wait until data is available for reading, with m_mutex locked.
+     *
+     * @param[in] lock lock of m_mutex
+     * @param[in] n Requested size of data
+     * @return true if the data is available, false on eof or abort
+     */
+    bool waitForData(std::unique_lock<std::mutex> & lock, std::streamsize n);
+
+    /**
+     * Drop old log container, with m_mutex locked.
+     */
+    void dropOldDataLocked();
+
+    /**
+     * Update m_peakBufferedBytes after LogContainers were appended, with m_mutex locked.
+     */
+    void updatePeakBufferedBytes();
+
+    /**
+     * Size of the LogContainers, with m_mutex locked.
+     *
+     * @return size of the LogContainers
+     */
+    std::streamsize bufferedBytesLocked() const;
 };
 
 }
@@ -4,36 +4,36 @@
 
 #include <Vector/BLF/VarObjectHeader.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of VarObjectHeader from objectFlags to objectTimeStamp */
+using VarObjectHeaderFields = Fields<
+    VECTOR_BLF_FIELD(VarObjectHeader, objectFlags),
+    VECTOR_BLF_FIELD(VarObjectHeader, objectStaticSize),
+    VECTOR_BLF_FIELD(VarObjectHeader, objectVersion),
+    VECTOR_BLF_FIELD(VarObjectHeader, objectTimeStamp)>;
+
 VarObjectHeader::VarObjectHeader(const ObjectType objectType) :
     ObjectHeaderBase(1, objectType) {
 }
 
 void VarObjectHeader::read(AbstractFile & is) {
     ObjectHeaderBase::read(is);
-    is.read(reinterpret_cast<char *>(&objectFlags), sizeof(objectFlags));
-    is.read(reinterpret_cast<char *>(&objectStaticSize), sizeof(objectStaticSize));
-    is.read(reinterpret_cast<char *>(&objectVersion), sizeof(objectVersion));
-    is.read(reinterpret_cast<char *>(&objectTimeStamp), sizeof(objectTimeStamp));
+    VarObjectHeaderFields::read(is, *this);
 }
 
 void VarObjectHeader::write(AbstractFile & os) {
     ObjectHeaderBase::write(os);
-    os.write(reinterpret_cast<char *>(&objectFlags), sizeof(objectFlags));
-    os.write(reinterpret_cast<char *>(&objectStaticSize), sizeof(objectStaticSize));
-    os.write(reinterpret_cast<char *>(&objectVersion), sizeof(objectVersion));
-    os.write(reinterpret_cast<char *>(&objectTimeStamp), sizeof(objectTimeStamp));
+    VarObjectHeaderFields::write(os, *this);
 }
 
 uint16_t VarObjectHeader::calculateHeaderSize() const {
     return
         ObjectHeaderBase::calculateHeaderSize() +
-        sizeof(objectFlags) +
-        sizeof(objectStaticSize) +
-        sizeof(objectVersion) +
-        sizeof(objectTimeStamp);
+        VarObjectHeaderFields::size();
 }
 
 uint32_t VarObjectHeader::calculateObjectSize() const {
@@ -4,30 +4,34 @@
 
 #include <Vector/BLF/WaterMarkEvent.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of WaterMarkEvent from queueState to reservedWaterMarkEvent */
+using WaterMarkEventFields = Fields<
+    VECTOR_BLF_FIELD(WaterMarkEvent, queueState),
+    VECTOR_BLF_FIELD(WaterMarkEvent, reservedWaterMarkEvent)>;
+
 WaterMarkEvent::WaterMarkEvent() :
     ObjectHeader(ObjectType::WATER_MARK_EVENT) {
 }
 
 void WaterMarkEvent::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&queueState), sizeof(queueState));
-    is.read(reinterpret_cast<char *>(&reservedWaterMarkEvent), sizeof(reservedWaterMarkEvent));
+    WaterMarkEventFields::read(is, *this);
 }
 
 void WaterMarkEvent::write(AbstractFile & os) {
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&queueState), sizeof(queueState));
-    os.write(reinterpret_cast<char *>(&reservedWaterMarkEvent), sizeof(reservedWaterMarkEvent));
+    WaterMarkEventFields::write(os, *this);
 }
 
 uint32_t WaterMarkEvent::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        sizeof(queueState) +
-        sizeof(reservedWaterMarkEvent);
+        WaterMarkEventFields::size();
 }
 
 }
@@ -4,23 +4,29 @@
 
 #include <Vector/BLF/WlanFrame.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of WlanFrame from channel to reservedWlanFrame */
+using WlanFrameFields = Fields<
+    VECTOR_BLF_FIELD(WlanFrame, channel),
+    VECTOR_BLF_FIELD(WlanFrame, flags),
+    VECTOR_BLF_FIELD(WlanFrame, dir),
+    VECTOR_BLF_FIELD(WlanFrame, radioChannel),
+    VECTOR_BLF_FIELD(WlanFrame, signalStrength),
+    VECTOR_BLF_FIELD(WlanFrame, signalQuality),
+    VECTOR_BLF_FIELD(WlanFrame, frameLength),
+    VECTOR_BLF_FIELD(WlanFrame, reservedWlanFrame)>;
+
 WlanFrame::WlanFrame() :
     ObjectHeader(ObjectType::WLAN_FRAME) {
 }
 
 void WlanFrame::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&flags), sizeof(flags));
-    is.read(reinterpret_cast<char *>(&dir), sizeof(dir));
-    is.read(reinterpret_cast<char *>(&radioChannel), sizeof(radioChannel));
-    is.read(reinterpret_cast<char *>(&signalStrength), sizeof(signalStrength));
-    is.read(reinterpret_cast<char *>(&signalQuality), sizeof(signalQuality));
-    is.read(reinterpret_cast<char *>(&frameLength), sizeof(frameLength));
-    is.read(reinterpret_cast<char *>(&reservedWlanFrame), sizeof(reservedWlanFrame));
+    WlanFrameFields::read(is, *this);
     frameData.resize(frameLength);
     is.read(reinterpret_cast<char *>(frameData.data()), frameLength);
 
@@ -33,14 +39,7 @@ void WlanFrame::write(AbstractFile & os) {
     frameLength = static_cast<uint16_t>(frameData.size());
 
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&flags), sizeof(flags));
-    os.write(reinterpret_cast<char *>(&dir), sizeof(dir));
-    os.write(reinterpret_cast<char *>(&radioChannel), sizeof(radioChannel));
-    os.write(reinterpret_cast<char *>(&signalStrength), sizeof(signalStrength));
-    os.write(reinterpret_cast<char *>(&signalQuality), sizeof(signalQuality));
-    os.write(reinterpret_cast<char *>(&frameLength), sizeof(frameLength));
-    os.write(reinterpret_cast<char *>(&reservedWlanFrame), sizeof(reservedWlanFrame));
+    WlanFrameFields::write(os, *this);
     os.write(reinterpret_cast<char *>(frameData.data()), frameLength);
 
     /* skip padding */
@@ -50,14 +49,7 @@ void WlanFrame::write(AbstractFile & os) {
 uint32_t WlanFrame::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        sizeof(channel) +
-        sizeof(flags) +
-        sizeof(dir) +
-        sizeof(radioChannel) +
-        sizeof(signalStrength) +
-        sizeof(signalQuality) +
-        sizeof(frameLength) +
-        sizeof(reservedWlanFrame) +
+        WlanFrameFields::size() +
         frameLength;
 }
 
@@ -4,52 +4,42 @@
 
 #include <Vector/BLF/WlanStatistic.h>
 
+#include <Vector/BLF/Fields.h>
+
 namespace Vector {
 namespace BLF {
 
+/** fields of WlanStatistic from channel to reservedWlanStatistic */
+using WlanStatisticFields = Fields<
+    VECTOR_BLF_FIELD(WlanStatistic, channel),
+    VECTOR_BLF_FIELD(WlanStatistic, flags),
+    VECTOR_BLF_FIELD(WlanStatistic, rxPacketCount),
+    VECTOR_BLF_FIELD(WlanStatistic, rxByteCount),
+    VECTOR_BLF_FIELD(WlanStatistic, txPacketCount),
+    VECTOR_BLF_FIELD(WlanStatistic, txByteCount),
+    VECTOR_BLF_FIELD(WlanStatistic, collisionCount),
+    VECTOR_BLF_FIELD(WlanStatistic, errorCount),
+    VECTOR_BLF_FIELD(WlanStatistic, reservedWlanStatistic)>;
+
 WlanStatistic::WlanStatistic() :
     ObjectHeader(ObjectType::WLAN_STATISTIC) {
 }
 
 void WlanStatistic::read(AbstractFile & is) {
     ObjectHeader::read(is);
-    is.read(reinterpret_cast<char *>(&channel), sizeof(channel));
-    is.read(reinterpret_cast<char *>(&flags), sizeof(flags));
-    is.read(reinterpret_cast<char *>(&rxPacketCount), sizeof(rxPacketCount));
-    is.read(reinterpret_cast<char *>(&rxByteCount), sizeof(rxByteCount));
-    is.read(reinterpret_cast<char *>(&txPacketCount), sizeof(txPacketCount));
-    is.read(reinterpret_cast<char *>(&txByteCount), sizeof(txByteCount));
-    is.read(reinterpret_cast<char *>(&collisionCount), sizeof(collisionCount));
-    is.read(reinterpret_cast<char *>(&errorCount), sizeof(errorCount));
-    is.read(reinterpret_cast<char *>(&reservedWlanStatistic), sizeof(reservedWlanStatistic));
+    WlanStatisticFields::read(is, *this);
     // @note might be extended in future versions
 }
 
 void WlanStatistic::write(AbstractFile & os) {
     ObjectHeader::write(os);
-    os.write(reinterpret_cast<char *>(&channel), sizeof(channel));
-    os.write(reinterpret_cast<char *>(&flags), sizeof(flags));
-    os.write(reinterpret_cast<char *>(&rxPacketCount), sizeof(rxPacketCount));
-    os.write(reinterpret_cast<char *>(&rxByteCount), sizeof(rxByteCount));
-    os.write(reinterpret_cast<char *>(&txPacketCount), sizeof(txPacketCount));
-    os.write(reinterpret_cast<char *>(&txByteCount), sizeof(txByteCount));
-    os.write(reinterpret_cast<char *>(&collisionCount), sizeof(collisionCount));
-    os.write(reinterpret_cast<char *>(&errorCount), sizeof(errorCount));
-    os.write(reinterpret_cast<char *>(&reservedWlanStatistic), sizeof(reservedWlanStatistic));
+    WlanStatisticFields::write(os, *this);
 }
 
 uint32_t WlanStatistic::calculateObjectSize() const {
     return
         ObjectHeader::calculateObjectSize() +
-        sizeof(channel) +
-        sizeof(flags) +
-        sizeof(rxPacketCount) +
-        sizeof(rxByteCount) +
-        sizeof(txPacketCount) +
-        sizeof(txByteCount) +
-        sizeof(collisionCount) +
-        sizeof(errorCount) +
-        sizeof(reservedWlanStatistic);
+        WlanStatisticFields::size();
 }
 
 }
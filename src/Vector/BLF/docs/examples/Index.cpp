@@ -0,0 +1,62 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <set>
+#include <string>
+
+#include <Vector/BLF.h>
+
+int main(int argc, char * argv[]) {
+    if ((argc != 2) && (argc != 3)) {
+        std::cout << "Index <filename.blf> [<filename.idx>]" << std::endl;
+        return -1;
+    }
+    std::string indexFilename = (argc == 3) ? argv[2] : std::string(argv[1]) + ".idx";
+
+    /* build index */
+    Vector::BLF::FileIndex fileIndex;
+    try {
+        fileIndex.build(argv[1]);
+    } catch (std::runtime_error & e) {
+        std::cout << "Exception: " << e.what() << std::endl;
+        return -1;
+    }
+
+    /* summary */
+    std::map<Vector::BLF::ObjectType, uint64_t> objectCounts;
+    std::set<uint16_t> channels;
+    uint64_t minTimeStamp = UINT64_MAX;
+    uint64_t maxTimeStamp = 0;
+    for (const Vector::BLF::FileIndexEntry & fileIndexEntry : fileIndex.logContainers) {
+        for (const auto & objectCount : fileIndexEntry.objectCounts)
+            objectCounts[objectCount.first] += objectCount.second;
+        channels.insert(fileIndexEntry.channels.cbegin(), fileIndexEntry.channels.cend());
+        if (fileIndexEntry.uncompressedFileOffset < fileIndexEntry.uncompressedFileSize) {
+            minTimeStamp = std::min(minTimeStamp, fileIndexEntry.minTimeStamp);
+            maxTimeStamp = std::max(maxTimeStamp, fileIndexEntry.maxTimeStamp);
+        }
+    }
+    std::cout << "LogContainers: " << std::dec << fileIndex.logContainers.size() << std::endl;
+    if (minTimeStamp <= maxTimeStamp)
+        std::cout << "Time stamps: " << minTimeStamp << " ns - " << maxTimeStamp << " ns" << std::endl;
+    for (const auto & objectCount : objectCounts)
+        std::cout << "ObjectType " << static_cast<uint32_t>(objectCount.first) << ": " << objectCount.second << std::endl;
+    std::cout << "Channels:";
+    for (uint16_t channel : channels)
+        std::cout << " " << channel;
+    std::cout << std::endl;
+
+    /* save index */
+    if (!fileIndex.save(indexFilename.c_str())) {
+        std::cout << "Unable to write " << indexFilename << std::endl;
+        return -1;
+    }
+    std::cout << "Index written to " << indexFilename << std::endl;
+
+    return 0;
+}
@@ -2463,8 +2463,8 @@ int main(int argc, char * argv[]) {
         if (ohb->objectSize != ohb->calculateObjectSize())
             std::cout << "ObjectSize=" << std::dec << ohb->objectSize << " doesn't match calculatedObjectSize()=" << ohb->calculateObjectSize() << std::endl;
 
-        /* delete object */
-        delete ohb;
+        /* give object back for reuse */
+        file.recycle(ohb);
     }
 
     std::cout << std::endl;
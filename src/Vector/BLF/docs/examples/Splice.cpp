@@ -0,0 +1,71 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+#include <Vector/BLF.h>
+
+int main(int argc, char * argv[]) {
+    /* options */
+    bool timeRange = false;
+    uint64_t startTimeStamp = 0;
+    uint64_t endTimeStamp = UINT64_MAX;
+    int arg = 1;
+    try {
+        for (; (arg + 1 < argc) && (argv[arg][0] == '-'); arg += 2) {
+            std::string option = argv[arg];
+            if (option == "-s")
+                startTimeStamp = std::stoull(argv[arg + 1]);
+            else if (option == "-e")
+                endTimeStamp = std::stoull(argv[arg + 1]);
+            else {
+                arg = argc;
+                break;
+            }
+            timeRange = true;
+        }
+    } catch (std::logic_error &) {
+        arg = argc;
+    }
+    if (argc - arg < 2) {
+        std::cout << "Splice [-s <start ns>] [-e <end ns>] <output.blf> <input.blf>..." << std::endl;
+        std::cout << "Concatenates the input files, or the objects within the time range." << std::endl;
+        std::cout << "All input files need to have the same measurement start time." << std::endl;
+        std::cout << "Existing <input.blf>.idx files (see Index) avoid inflating the input files." << std::endl;
+        return -1;
+    }
+
+    /* open output file */
+    Vector::BLF::FileSplicer fileSplicer;
+    fileSplicer.open(argv[arg]);
+    if (!fileSplicer.is_open()) {
+        std::cout << "Unable to write " << argv[arg] << std::endl;
+        return -1;
+    }
+
+    /* append input files */
+    try {
+        for (++arg; arg < argc; ++arg) {
+            if (timeRange) {
+                fileSplicer.fileIndex.load((std::string(argv[arg]) + ".idx").c_str());
+                fileSplicer.append(argv[arg], startTimeStamp, endTimeStamp);
+            } else {
+                fileSplicer.append(argv[arg]);
+            }
+        }
+    } catch (std::runtime_error & e) {
+        std::cout << "Exception: " << e.what() << std::endl;
+        return -1;
+    }
+    fileSplicer.close();
+
+    /* summary */
+    std::cout << "Objects: " << std::dec << fileSplicer.fileStatistics.objectCount << std::endl;
+    std::cout << "LogContainers passed through: " << fileSplicer.passedLogContainers << std::endl;
+    std::cout << "LogContainers inflated: " << fileSplicer.inflatedLogContainers << std::endl;
+
+    return 0;
+}
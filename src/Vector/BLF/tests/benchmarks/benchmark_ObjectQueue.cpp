@@ -0,0 +1,81 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include <Vector/BLF.h>
+
+/**
+ * Hand over objects from a writer thread to the calling thread.
+ *
+ * The objects are not allocated/deleted, so only the queue is measured.
+ *
+ * @param[in] objectQueue queue
+ * @param[in] objects objects to hand over
+ * @param[in] batchSize number of objects per read/write call
+ * @return objects per second
+ */
+static double measure(Vector::BLF::AbstractObjectQueue<Vector::BLF::ObjectHeaderBase> & objectQueue, std::vector<Vector::BLF::CanMessage> & objects, std::size_t batchSize) {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    /* writer thread */
+    std::thread writer([&objectQueue, &objects, batchSize]() {
+        if (batchSize == 1) {
+            for (Vector::BLF::CanMessage & object : objects)
+                objectQueue.write(&object);
+        } else {
+            std::vector<Vector::BLF::ObjectHeaderBase *> batch;
+            batch.reserve(batchSize);
+            for (Vector::BLF::CanMessage & object : objects) {
+                batch.push_back(&object);
+                if (batch.size() == batchSize) {
+                    objectQueue.write(batch);
+                    batch.clear();
+                }
+            }
+            objectQueue.write(batch);
+        }
+        objectQueue.setFileSize(objectQueue.tellp());
+    });
+
+    /* read till eof */
+    if (batchSize == 1) {
+        while (objectQueue.read() != nullptr);
+    } else {
+        std::vector<Vector::BLF::ObjectHeaderBase *> batch;
+        batch.reserve(batchSize);
+        while (objectQueue.read(batch, batchSize) > 0)
+            batch.clear();
+    }
+    writer.join();
+
+    std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+    return objects.size() / duration.count();
+}
+
+int main(int argc, char * argv[]) {
+    std::size_t count = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 10000000;
+    std::vector<Vector::BLF::CanMessage> objects(count);
+
+    std::cout << "bufferSize; batchSize; ObjectQueue [objects/s]; RingObjectQueue [objects/s]" << std::endl;
+    for (uint32_t bufferSize : { 10, 100, 1000 }) {
+        for (std::size_t batchSize : { 1, 10, 100 }) {
+            Vector::BLF::ObjectQueue<Vector::BLF::ObjectHeaderBase> objectQueue;
+            objectQueue.setBufferSize(bufferSize);
+            double objectQueueRate = measure(objectQueue, objects, batchSize);
+
+            Vector::BLF::RingObjectQueue<Vector::BLF::ObjectHeaderBase> ringObjectQueue;
+            ringObjectQueue.setBufferSize(bufferSize);
+            double ringObjectQueueRate = measure(ringObjectQueue, objects, batchSize);
+
+            std::cout << bufferSize << "; " << batchSize << "; " << objectQueueRate << "; " << ringObjectQueueRate << std::endl;
+        }
+    }
+
+    return 0;
+}
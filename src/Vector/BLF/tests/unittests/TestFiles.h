@@ -0,0 +1,43 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <boost/test/unit_test.hpp>
+
+#include <Vector/BLF.h>
+
+/**
+ * Write a file with CAN messages on channels 1 and 2 every ms, with
+ * id and time stamp in ms equal to the index 0..4999. Between index 2000
+ * and 2099 there are LIN messages on channel 3 instead.
+ *
+ * The file has small LogContainers, so that objects continue from one
+ * LogContainer into the next. It's written with the default settings,
+ * so it ends with an empty restore points LogContainer.
+ *
+ * @param[in] filename file name
+ */
+inline void writeCanLinFile(const char * filename) {
+    Vector::BLF::File fileout;
+    fileout.setDefaultLogContainerSize(0x1000);
+    fileout.open(filename, std::ios_base::out);
+    BOOST_REQUIRE(fileout.is_open());
+    for (uint32_t i = 0; i < 5000; i++) {
+        if ((i >= 2000) && (i < 2100)) {
+            auto * linMessage = new Vector::BLF::LinMessage;
+            linMessage->objectTimeStamp = i * 1000000ULL;
+            linMessage->channel = 3;
+            linMessage->id = i % 64;
+            fileout.write(linMessage);
+        } else {
+            auto * canMessage = new Vector::BLF::CanMessage;
+            canMessage->objectTimeStamp = i * 1000000ULL;
+            canMessage->channel = 1 + (i % 2);
+            canMessage->id = i;
+            fileout.write(canMessage);
+        }
+    }
+    fileout.close();
+}
@@ -129,6 +129,52 @@ BOOST_AUTO_TEST_CASE(AllBinlogLogfiles) {
     }
 }
 
+/** Test with uncompressedFiles with Unknown115 ending, copied as RawObjects */
+BOOST_AUTO_TEST_CASE(AllBinlogLogfilesRaw) {
+    /* input directory */
+    boost::filesystem::path indir(CMAKE_CURRENT_SOURCE_DIR "/events_from_binlog/");
+
+    /* output directory */
+    boost::filesystem::path outdir(CMAKE_CURRENT_BINARY_DIR "/events_from_binlog_raw/");
+    if (!exists(outdir))
+        BOOST_REQUIRE(create_directory(outdir));
+
+    /* loop over all blfs */
+    for (boost::filesystem::directory_entry & x : boost::filesystem::directory_iterator(indir)) {
+        if (!boost::filesystem::is_regular_file(x))
+            continue;
+        std::string eventFile = x.path().filename().string();
+
+        /* open input file */
+        Vector::BLF::File filein;
+        filein.rawObjects = Vector::BLF::RawObjectMode::All;
+        boost::filesystem::path infile(indir.string() + eventFile);
+        filein.open(infile.string(), std::ios_base::in);
+        BOOST_REQUIRE(filein.is_open());
+
+        /* open output file */
+        Vector::BLF::File fileout;
+        fileout.compressionLevel = filein.fileStatistics.compressionLevel;
+        boost::filesystem::path outfile(outdir.string() + eventFile);
+        fileout.open(outfile.string(), std::ios_base::out);
+        BOOST_REQUIRE(fileout.is_open());
+
+        /* copy file statistics */
+        copyFileStatistics(filein, fileout);
+
+        /* copy objects */
+        copyObjects(filein, fileout);
+
+        /* compare files */
+        BOOST_CHECK_MESSAGE(
+            compareFiles(
+                infile.c_str(), outfile.c_str(),
+                static_cast<uint64_t>(fileout.fileStatistics.statisticsSize),
+                fileout.fileStatistics.restorePointsOffset),
+            eventFile + " is different");
+    }
+}
+
 /** Test with compressedFiles without Unknown115 ending */
 BOOST_AUTO_TEST_CASE(AllConvertedLogfiles) {
     /* input directory */
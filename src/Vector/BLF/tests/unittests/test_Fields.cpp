@@ -0,0 +1,98 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#define BOOST_TEST_MODULE Fields
+#if !defined(WIN32)
+#define BOOST_TEST_DYN_LINK
+#endif
+#include <boost/test/unit_test.hpp>
+
+#include <array>
+
+#include <Vector/BLF.h>
+#include <Vector/BLF/Fields.h>
+
+/** fields without padding in between */
+struct Packed {
+    uint32_t a {};
+    uint16_t b {};
+    uint8_t c {};
+    uint8_t d {};
+    std::array<uint8_t, 4> e {};
+};
+
+/** fields with padding in between */
+struct Padded {
+    uint8_t a {};
+    uint32_t b {};
+    uint16_t c {};
+};
+
+using PackedFields = Vector::BLF::Fields<
+    VECTOR_BLF_FIELD(Packed, a),
+    VECTOR_BLF_FIELD(Packed, b),
+    VECTOR_BLF_FIELD(Packed, c),
+    VECTOR_BLF_FIELD(Packed, d),
+    VECTOR_BLF_FIELD(Packed, e)>;
+
+using PaddedFields = Vector::BLF::Fields<
+    VECTOR_BLF_FIELD(Padded, a),
+    VECTOR_BLF_FIELD(Padded, b),
+    VECTOR_BLF_FIELD(Padded, c)>;
+
+/* sizes are known at compile time */
+static_assert(PackedFields::size() == 12, "PackedFields::size");
+static_assert(PaddedFields::size() == 7, "PaddedFields::size");
+
+/** Contiguous fields are transferred in one block. */
+BOOST_AUTO_TEST_CASE(Contiguous) {
+    Packed packed;
+    BOOST_CHECK(PackedFields::contiguous(packed));
+    packed.a = 0x04030201;
+    packed.b = 0x0605;
+    packed.c = 0x07;
+    packed.d = 0x08;
+    packed.e = {{0x09, 0x0a, 0x0b, 0x0c}};
+
+    /* write */
+    Vector::BLF::ObjectBuffer objectBuffer;
+    PackedFields::write(objectBuffer, packed);
+    BOOST_REQUIRE_EQUAL(objectBuffer.size(), 12);
+    for (int i = 0; i < 12; ++i)
+        BOOST_CHECK_EQUAL(objectBuffer.data()[i], static_cast<char>(i + 1));
+
+    /* read */
+    Packed packedRead;
+    PackedFields::read(objectBuffer, packedRead);
+    BOOST_CHECK(objectBuffer.good());
+    BOOST_CHECK_EQUAL(packedRead.a, packed.a);
+    BOOST_CHECK_EQUAL(packedRead.b, packed.b);
+    BOOST_CHECK_EQUAL(packedRead.c, packed.c);
+    BOOST_CHECK_EQUAL(packedRead.d, packed.d);
+    BOOST_CHECK(packedRead.e == packed.e);
+}
+
+/** Fields with padding in between are transferred one by one. */
+BOOST_AUTO_TEST_CASE(NotContiguous) {
+    Padded padded;
+    BOOST_CHECK(!PaddedFields::contiguous(padded));
+    padded.a = 0x01;
+    padded.b = 0x05040302;
+    padded.c = 0x0706;
+
+    /* write */
+    Vector::BLF::ObjectBuffer objectBuffer;
+    PaddedFields::write(objectBuffer, padded);
+    BOOST_REQUIRE_EQUAL(objectBuffer.size(), 7);
+    for (int i = 0; i < 7; ++i)
+        BOOST_CHECK_EQUAL(objectBuffer.data()[i], static_cast<char>(i + 1));
+
+    /* read */
+    Padded paddedRead;
+    PaddedFields::read(objectBuffer, paddedRead);
+    BOOST_CHECK(objectBuffer.good());
+    BOOST_CHECK_EQUAL(paddedRead.a, padded.a);
+    BOOST_CHECK_EQUAL(paddedRead.b, padded.b);
+    BOOST_CHECK_EQUAL(paddedRead.c, padded.c);
+}
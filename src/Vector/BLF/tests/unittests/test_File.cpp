@@ -9,6 +9,17 @@
 #include <boost/test/unit_test.hpp>
 #include <boost/filesystem.hpp>
 
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <istream>
+#include <iterator>
+#include <stdexcept>
+#include <streambuf>
+#include <string>
+#include <thread>
+#include <vector>
+
 #include <Vector/BLF.h>
 
 /** check error conditions in open */
@@ -165,3 +176,747 @@ BOOST_AUTO_TEST_CASE(OpenCloseCycles) {
     logfile.open(CMAKE_CURRENT_BINARY_DIR "test.blf", std::ios_base::out);
     logfile.close();
 }
+
+/** Write many LogContainers and read them back with parallel inflation. */
+BOOST_AUTO_TEST_CASE(ParallelInflation) {
+    /* write file with many small LogContainers */
+    Vector::BLF::File fileout;
+    fileout.compressionLevel = 6;
+    fileout.setDefaultLogContainerSize(0x100);
+    fileout.open(CMAKE_CURRENT_BINARY_DIR "/test_ParallelInflation.blf", std::ios_base::out);
+    BOOST_REQUIRE(fileout.is_open());
+    for (uint32_t i = 0; i < 1000; i++) {
+        auto * canMessage = new Vector::BLF::CanMessage;
+        canMessage->objectTimeStamp = i;
+        canMessage->id = i;
+        fileout.write(canMessage);
+    }
+    fileout.close();
+
+    /* read file with several inflation threads */
+    Vector::BLF::File filein;
+    filein.compressionThreads = 4;
+    filein.open(CMAKE_CURRENT_BINARY_DIR "/test_ParallelInflation.blf", std::ios_base::in);
+    BOOST_REQUIRE(filein.is_open());
+    uint32_t i = 0;
+    while (filein.good()) {
+        Vector::BLF::ObjectHeaderBase * ohb = filein.read();
+        if (ohb == nullptr)
+            break;
+        if (ohb->objectType == Vector::BLF::ObjectType::CAN_MESSAGE) {
+            auto * canMessage = static_cast<Vector::BLF::CanMessage *>(ohb);
+            BOOST_CHECK_EQUAL(canMessage->id, i);
+            i++;
+        }
+        delete ohb;
+    }
+    BOOST_CHECK_EQUAL(i, 1000);
+    filein.close();
+}
+
+/** Read a file via memory mapping, with sequential and parallel inflation. */
+BOOST_AUTO_TEST_CASE(MemoryMappedRead) {
+    for (uint32_t compressionThreads : { 0, 4 }) {
+        Vector::BLF::File filein;
+        filein.memoryMapped = true;
+        filein.compressionThreads = compressionThreads;
+        filein.open(CMAKE_CURRENT_BINARY_DIR "/test_ParallelInflation.blf", std::ios_base::in);
+        BOOST_REQUIRE(filein.is_open());
+        uint32_t i = 0;
+        while (filein.good()) {
+            Vector::BLF::ObjectHeaderBase * ohb = filein.read();
+            if (ohb == nullptr)
+                break;
+            if (ohb->objectType == Vector::BLF::ObjectType::CAN_MESSAGE) {
+                auto * canMessage = static_cast<Vector::BLF::CanMessage *>(ohb);
+                BOOST_CHECK_EQUAL(canMessage->id, i);
+                i++;
+            }
+            delete ohb;
+        }
+        BOOST_CHECK_EQUAL(i, 1000);
+        filein.close();
+    }
+}
+
+/** Write many LogContainers with parallel deflation and compare with sequential deflation. */
+BOOST_AUTO_TEST_CASE(ParallelDeflation) {
+    /* write the same file with sequential and parallel deflation */
+    for (uint32_t compressionThreads : { 0, 4 }) {
+        Vector::BLF::File fileout;
+        fileout.compressionLevel = 9;
+        fileout.compressionThreads = compressionThreads;
+        fileout.setDefaultLogContainerSize(0x100);
+        fileout.open(CMAKE_CURRENT_BINARY_DIR "/test_ParallelDeflation" + std::to_string(compressionThreads) + ".blf", std::ios_base::out);
+        BOOST_REQUIRE(fileout.is_open());
+        for (uint32_t i = 0; i < 1000; i++) {
+            auto * canMessage = new Vector::BLF::CanMessage;
+            canMessage->objectTimeStamp = i;
+            canMessage->id = i;
+            fileout.write(canMessage);
+        }
+        fileout.close();
+    }
+
+    /* compare files */
+    std::ifstream ifs0(CMAKE_CURRENT_BINARY_DIR "/test_ParallelDeflation0.blf", std::ios_base::binary);
+    std::ifstream ifs4(CMAKE_CURRENT_BINARY_DIR "/test_ParallelDeflation4.blf", std::ios_base::binary);
+    std::string data0((std::istreambuf_iterator<char>(ifs0)), std::istreambuf_iterator<char>());
+    std::string data4((std::istreambuf_iterator<char>(ifs4)), std::istreambuf_iterator<char>());
+    BOOST_CHECK_EQUAL(data0.size(), data4.size());
+    BOOST_CHECK(data0 == data4);
+}
+
+/** Write a file with restore points and seek to time stamps within it. */
+BOOST_AUTO_TEST_CASE(SeekWithRestorePoints) {
+    /* write file with a CanMessage every ms */
+    Vector::BLF::File fileout;
+    fileout.setDefaultLogContainerSize(0x1000);
+    fileout.restorePoints.objectInterval = 99;
+    fileout.writeRestorePointData = true;
+    fileout.open(CMAKE_CURRENT_BINARY_DIR "/test_SeekWithRestorePoints.blf", std::ios_base::out);
+    BOOST_REQUIRE(fileout.is_open());
+    for (uint32_t i = 0; i < 10000; i++) {
+        auto * canMessage = new Vector::BLF::CanMessage;
+        canMessage->objectTimeStamp = i * 1000000ULL;
+        canMessage->id = i;
+        fileout.write(canMessage);
+    }
+    fileout.close();
+    BOOST_CHECK_EQUAL(fileout.restorePoints.restorePoints.size(), 100);
+
+    for (bool memoryMapped : { false, true }) {
+        /* restore points are read on open */
+        Vector::BLF::File filein;
+        filein.memoryMapped = memoryMapped;
+        filein.open(CMAKE_CURRENT_BINARY_DIR "/test_SeekWithRestorePoints.blf", std::ios_base::in);
+        BOOST_REQUIRE(filein.is_open());
+        BOOST_REQUIRE_EQUAL(filein.restorePoints.restorePoints.size(), 100);
+        BOOST_CHECK_EQUAL(filein.restorePoints.objectInterval, 99);
+        BOOST_CHECK_EQUAL(filein.restorePoints.restorePoints[0].timeStamp, 99000000);
+
+        /* seek forward, backward, and to time stamps between objects */
+        for (uint32_t id : { 5000, 1234, 0, 9999, 4321 }) {
+            filein.seek(id * 1000000ULL);
+            Vector::BLF::ObjectHeaderBase * ohb = filein.read();
+            BOOST_REQUIRE(ohb);
+            BOOST_REQUIRE(ohb->objectType == Vector::BLF::ObjectType::CAN_MESSAGE);
+            BOOST_CHECK_EQUAL(static_cast<Vector::BLF::CanMessage *>(ohb)->id, id);
+            delete ohb;
+        }
+        filein.seek(1234500000ULL);
+        Vector::BLF::ObjectHeaderBase * ohb = filein.read();
+        BOOST_REQUIRE(ohb);
+        BOOST_CHECK_EQUAL(static_cast<Vector::BLF::CanMessage *>(ohb)->id, 1235);
+        delete ohb;
+
+        /* read till end of file */
+        uint32_t count = 0;
+        while ((ohb = filein.read()) != nullptr) {
+            if (ohb->objectType == Vector::BLF::ObjectType::CAN_MESSAGE)
+                count++;
+            delete ohb;
+        }
+        BOOST_CHECK_EQUAL(count, 10000 - 1236);
+        BOOST_CHECK(filein.eof());
+        filein.close();
+    }
+}
+
+/** Seek in a file without restore points. */
+BOOST_AUTO_TEST_CASE(SeekWithoutRestorePoints) {
+    Vector::BLF::File filein;
+    filein.open(CMAKE_CURRENT_SOURCE_DIR "/events_from_binlog/test_CanMessage.blf", std::ios_base::in);
+    BOOST_REQUIRE(filein.is_open());
+    BOOST_CHECK(filein.restorePoints.restorePoints.empty());
+    BOOST_CHECK_EQUAL(filein.restorePoints.objectInterval, 1000);
+
+    /* seek to beginning */
+    filein.seek(0);
+    Vector::BLF::ObjectHeaderBase * ohb = filein.read();
+    BOOST_REQUIRE(ohb);
+    BOOST_CHECK(ohb->objectType == Vector::BLF::ObjectType::CAN_MESSAGE);
+    delete ohb;
+    filein.close();
+}
+
+/** Recycle objects, so that they are reused by read. */
+BOOST_AUTO_TEST_CASE(RecycleObjects) {
+    /* write file with CAN FD messages */
+    Vector::BLF::File fileout;
+    fileout.open(CMAKE_CURRENT_BINARY_DIR "/test_RecycleObjects.blf", std::ios_base::out);
+    BOOST_REQUIRE(fileout.is_open());
+    for (uint32_t i = 0; i < 1000; i++) {
+        auto * canFdMessage64 = new Vector::BLF::CanFdMessage64;
+        canFdMessage64->id = i;
+        canFdMessage64->validDataBytes = (i % 2) ? 64 : 8;
+        canFdMessage64->data.assign(canFdMessage64->validDataBytes, static_cast<uint8_t>(i));
+        fileout.write(canFdMessage64);
+    }
+    fileout.close();
+
+    /* read and recycle */
+    Vector::BLF::File filein;
+    filein.open(CMAKE_CURRENT_BINARY_DIR "/test_RecycleObjects.blf", std::ios_base::in);
+    BOOST_REQUIRE(filein.is_open());
+    uint32_t count = 0;
+    Vector::BLF::ObjectHeaderBase * ohb;
+    while ((ohb = filein.read()) != nullptr) {
+        if (ohb->objectType == Vector::BLF::ObjectType::CAN_FD_MESSAGE_64) {
+            auto * canFdMessage64 = static_cast<Vector::BLF::CanFdMessage64 *>(ohb);
+            BOOST_CHECK_EQUAL(canFdMessage64->id, count);
+            BOOST_REQUIRE_EQUAL(canFdMessage64->data.size(), (count % 2) ? 64 : 8);
+            BOOST_CHECK_EQUAL(canFdMessage64->data[0], static_cast<uint8_t>(count));
+            count++;
+        }
+        filein.recycle(ohb);
+    }
+    BOOST_CHECK_EQUAL(count, 1000);
+    filein.close();
+}
+
+/** Write and read using the lock-free queue. */
+BOOST_AUTO_TEST_CASE(LockFreeQueue) {
+    /* write file */
+    Vector::BLF::File fileout;
+    fileout.lockFreeQueue = true;
+    fileout.open(CMAKE_CURRENT_BINARY_DIR "/test_LockFreeQueue.blf", std::ios_base::out);
+    BOOST_REQUIRE(fileout.is_open());
+    for (uint32_t i = 0; i < 10000; i++) {
+        auto * canMessage = new Vector::BLF::CanMessage;
+        canMessage->id = i;
+        fileout.write(canMessage);
+    }
+    fileout.close();
+
+    /* read file */
+    Vector::BLF::File filein;
+    filein.lockFreeQueue = true;
+    filein.open(CMAKE_CURRENT_BINARY_DIR "/test_LockFreeQueue.blf", std::ios_base::in);
+    BOOST_REQUIRE(filein.is_open());
+    uint32_t count = 0;
+    Vector::BLF::ObjectHeaderBase * ohb;
+    while ((ohb = filein.read()) != nullptr) {
+        if (ohb->objectType == Vector::BLF::ObjectType::CAN_MESSAGE) {
+            BOOST_CHECK_EQUAL(static_cast<Vector::BLF::CanMessage *>(ohb)->id, count);
+            count++;
+        }
+        delete ohb;
+    }
+    BOOST_CHECK_EQUAL(count, 10000);
+    BOOST_CHECK(filein.eof());
+    filein.close();
+}
+
+/** Write and read many objects at once. */
+BOOST_AUTO_TEST_CASE(BatchReadWrite) {
+    for (bool lockFreeQueue : { false, true }) {
+        /* write file */
+        Vector::BLF::File fileout;
+        fileout.lockFreeQueue = lockFreeQueue;
+        fileout.readWriteQueueSize = 100;
+        fileout.open(CMAKE_CURRENT_BINARY_DIR "/test_BatchReadWrite.blf", std::ios_base::out);
+        BOOST_REQUIRE(fileout.is_open());
+        std::vector<Vector::BLF::ObjectHeaderBase *> objects;
+        for (uint32_t i = 0; i < 10000; i++) {
+            auto * canMessage = new Vector::BLF::CanMessage;
+            canMessage->id = i;
+            objects.push_back(canMessage);
+            if (objects.size() == 250) {
+                fileout.write(objects);
+                objects.clear();
+            }
+        }
+        fileout.close();
+        BOOST_CHECK_EQUAL(fileout.currentObjectCount, 10000);
+
+        /* read file */
+        Vector::BLF::File filein;
+        filein.lockFreeQueue = lockFreeQueue;
+        filein.readWriteQueueSize = 100;
+        filein.open(CMAKE_CURRENT_BINARY_DIR "/test_BatchReadWrite.blf", std::ios_base::in);
+        BOOST_REQUIRE(filein.is_open());
+        uint32_t count = 0;
+        while (filein.read(objects, 64) > 0) {
+            for (Vector::BLF::ObjectHeaderBase * ohb : objects) {
+                if (ohb->objectType == Vector::BLF::ObjectType::CAN_MESSAGE) {
+                    BOOST_CHECK_EQUAL(static_cast<Vector::BLF::CanMessage *>(ohb)->id, count);
+                    count++;
+                }
+                filein.recycle(ohb);
+            }
+            objects.clear();
+        }
+        BOOST_CHECK_EQUAL(count, 10000);
+        BOOST_CHECK(filein.eof());
+        filein.close();
+    }
+}
+
+/** visitor counting CanMessages and AppTexts */
+struct ReadAllVisitor {
+    uint32_t canMessages {0};
+    uint32_t appTexts {0};
+
+    void operator()(Vector::BLF::CanMessage & canMessage) {
+        BOOST_CHECK_EQUAL(canMessage.id, canMessages);
+        canMessages++;
+    }
+
+    void operator()(Vector::BLF::AppText & appText) {
+        BOOST_CHECK_EQUAL(appText.text, "text");
+        appTexts++;
+    }
+};
+
+/** Read all objects with a visitor, that skips the other object types. */
+BOOST_AUTO_TEST_CASE(ReadAll) {
+    /* write file */
+    Vector::BLF::File fileout;
+    fileout.setDefaultLogContainerSize(0x1000);
+    fileout.open(CMAKE_CURRENT_BINARY_DIR "/test_ReadAll.blf", std::ios_base::out);
+    BOOST_REQUIRE(fileout.is_open());
+    for (uint32_t i = 0; i < 1000; i++) {
+        auto * canMessage = new Vector::BLF::CanMessage;
+        canMessage->id = i;
+        fileout.write(canMessage);
+
+        auto * linMessage = new Vector::BLF::LinMessage;
+        linMessage->id = i % 64;
+        fileout.write(linMessage);
+
+        if (i % 10 == 0) {
+            auto * appText = new Vector::BLF::AppText;
+            appText->text = "text";
+            fileout.write(appText);
+
+            /* object with size not a multiple of 4 */
+            auto * ethernetFrame = new Vector::BLF::EthernetFrame;
+            ethernetFrame->payLoad.resize(i % 7 + 1);
+            fileout.write(ethernetFrame);
+        }
+    }
+    fileout.close();
+
+    /* read file */
+    Vector::BLF::File filein;
+    filein.open(CMAKE_CURRENT_BINARY_DIR "/test_ReadAll.blf", std::ios_base::in);
+    BOOST_REQUIRE(filein.is_open());
+    ReadAllVisitor visitor;
+    filein.readAll(visitor);
+    BOOST_CHECK_EQUAL(visitor.canMessages, 1000);
+    BOOST_CHECK_EQUAL(visitor.appTexts, 100);
+    BOOST_CHECK(filein.eof());
+
+    /* all object types are read again after seek */
+    filein.seek(0);
+    uint32_t count = 0;
+    Vector::BLF::ObjectHeaderBase * ohb;
+    while ((ohb = filein.read()) != nullptr) {
+        if (ohb->objectType != Vector::BLF::ObjectType::Unknown115)
+            count++;
+        delete ohb;
+    }
+    BOOST_CHECK_EQUAL(count, 2200);
+    filein.close();
+}
+
+/** visitor throwing at a CanMessage */
+struct ThrowingVisitor {
+    void operator()(Vector::BLF::CanMessage & canMessage) {
+        if (canMessage.id == 500)
+            throw std::runtime_error("visitor");
+    }
+};
+
+/** Exceptions of the visitor leave readAll, and all object types are read again afterwards. */
+BOOST_AUTO_TEST_CASE(ReadAllVisitorThrows) {
+    /* write file */
+    Vector::BLF::File fileout;
+    fileout.setDefaultLogContainerSize(0x1000);
+    fileout.open(CMAKE_CURRENT_BINARY_DIR "/test_ReadAllVisitorThrows.blf", std::ios_base::out);
+    BOOST_REQUIRE(fileout.is_open());
+    for (uint32_t i = 0; i < 1000; i++) {
+        auto * canMessage = new Vector::BLF::CanMessage;
+        canMessage->id = i;
+        fileout.write(canMessage);
+
+        auto * linMessage = new Vector::BLF::LinMessage;
+        linMessage->id = i % 64;
+        fileout.write(linMessage);
+    }
+    fileout.close();
+
+    /* read file */
+    Vector::BLF::File filein;
+    filein.open(CMAKE_CURRENT_BINARY_DIR "/test_ReadAllVisitorThrows.blf", std::ios_base::in);
+    BOOST_REQUIRE(filein.is_open());
+    ThrowingVisitor visitor;
+    BOOST_CHECK_THROW(filein.readAll(visitor), std::runtime_error);
+
+    /* LinMessages are constructed again */
+    filein.seek(0);
+    uint32_t linMessages = 0;
+    Vector::BLF::ObjectHeaderBase * ohb;
+    while ((ohb = filein.read()) != nullptr) {
+        if (ohb->objectType == Vector::BLF::ObjectType::LIN_MESSAGE)
+            linMessages++;
+        filein.recycle(ohb);
+    }
+    BOOST_CHECK_EQUAL(linMessages, 1000);
+    filein.close();
+}
+
+/** Payloads are exposed as views in lazy read mode, and can be written back. */
+BOOST_AUTO_TEST_CASE(LazyPayloads) {
+    /* write file with payloads of different sizes */
+    Vector::BLF::File fileout;
+    fileout.setDefaultLogContainerSize(0x100);
+    fileout.open(CMAKE_CURRENT_BINARY_DIR "/test_LazyPayloads.blf", std::ios_base::out);
+    BOOST_REQUIRE(fileout.is_open());
+    for (uint16_t i = 0; i < 100; i++) {
+        auto * ethernetFrame = new Vector::BLF::EthernetFrame;
+        ethernetFrame->payLoad.assign(i % 50 + 1, static_cast<uint8_t>(i));
+        fileout.write(ethernetFrame);
+    }
+    fileout.close();
+
+    /* read file lazily and write it back */
+    Vector::BLF::File filein;
+    filein.lazyPayloads = true;
+    filein.open(CMAKE_CURRENT_BINARY_DIR "/test_LazyPayloads.blf", std::ios_base::in);
+    BOOST_REQUIRE(filein.is_open());
+    Vector::BLF::File fileout2;
+    fileout2.setDefaultLogContainerSize(0x100);
+    fileout2.open(CMAKE_CURRENT_BINARY_DIR "/test_LazyPayloads2.blf", std::ios_base::out);
+    BOOST_REQUIRE(fileout2.is_open());
+    uint16_t i = 0;
+    uint16_t views = 0;
+    Vector::BLF::ObjectHeaderBase * ohb;
+    while ((ohb = filein.read()) != nullptr) {
+        if (ohb->objectType == Vector::BLF::ObjectType::ETHERNET_FRAME) {
+            auto * ethernetFrame = static_cast<Vector::BLF::EthernetFrame *>(ohb);
+            BOOST_CHECK_EQUAL(ethernetFrame->payLoadLength, i % 50 + 1);
+            if (ethernetFrame->payLoadView.data() != nullptr) {
+                BOOST_CHECK(ethernetFrame->payLoad.empty());
+                views++;
+            }
+            std::vector<uint8_t> payLoad;
+            if (ethernetFrame->payLoad.empty())
+                ethernetFrame->payLoadView.copyTo(payLoad);
+            else
+                payLoad = ethernetFrame->payLoad;
+            BOOST_CHECK(payLoad == std::vector<uint8_t>(i % 50 + 1, static_cast<uint8_t>(i)));
+            i++;
+        }
+        fileout2.write(ohb);
+    }
+    BOOST_CHECK_EQUAL(i, 100);
+    BOOST_CHECK_GT(views, 0);
+    filein.close();
+    fileout2.close();
+
+    /* read back */
+    Vector::BLF::File filein2;
+    filein2.open(CMAKE_CURRENT_BINARY_DIR "/test_LazyPayloads2.blf", std::ios_base::in);
+    BOOST_REQUIRE(filein2.is_open());
+    i = 0;
+    while ((ohb = filein2.read()) != nullptr) {
+        if (ohb->objectType == Vector::BLF::ObjectType::ETHERNET_FRAME) {
+            auto * ethernetFrame = static_cast<Vector::BLF::EthernetFrame *>(ohb);
+            BOOST_CHECK(ethernetFrame->payLoad == std::vector<uint8_t>(i % 50 + 1, static_cast<uint8_t>(i)));
+            i++;
+        }
+        delete ohb;
+    }
+    BOOST_CHECK_EQUAL(i, 100);
+    filein2.close();
+}
+
+/** Read and write in the calling thread. */
+BOOST_AUTO_TEST_CASE(Synchronous) {
+    /* write file */
+    Vector::BLF::File fileout;
+    fileout.synchronous = true;
+    fileout.setDefaultLogContainerSize(0x1000);
+    fileout.restorePoints.objectInterval = 99;
+    fileout.writeRestorePointData = true;
+    fileout.open(CMAKE_CURRENT_BINARY_DIR "/test_Synchronous.blf", std::ios_base::out);
+    BOOST_REQUIRE(fileout.is_open());
+    std::vector<Vector::BLF::ObjectHeaderBase *> objects;
+    for (uint32_t i = 0; i < 10000; i++) {
+        auto * canMessage = new Vector::BLF::CanMessage;
+        canMessage->objectTimeStamp = i * 1000000ULL;
+        canMessage->id = i;
+        if (i % 20 < 10)
+            fileout.write(canMessage);
+        else
+            objects.push_back(canMessage);
+        if (objects.size() == 10) {
+            fileout.write(objects);
+            objects.clear();
+        }
+    }
+    fileout.write(objects);
+    fileout.close();
+    BOOST_CHECK_EQUAL(fileout.fileStatistics.objectCount, 10000);
+    BOOST_CHECK_EQUAL(fileout.restorePoints.restorePoints.size(), 100);
+
+    for (bool synchronous : { true, false }) {
+        /* read file */
+        Vector::BLF::File filein;
+        filein.synchronous = synchronous;
+        filein.open(CMAKE_CURRENT_BINARY_DIR "/test_Synchronous.blf", std::ios_base::in);
+        BOOST_REQUIRE(filein.is_open());
+        uint32_t count = 0;
+        Vector::BLF::ObjectHeaderBase * ohb;
+        while ((ohb = filein.read()) != nullptr) {
+            if (ohb->objectType == Vector::BLF::ObjectType::CAN_MESSAGE) {
+                BOOST_CHECK_EQUAL(static_cast<Vector::BLF::CanMessage *>(ohb)->id, count);
+                count++;
+            }
+            delete ohb;
+        }
+        BOOST_CHECK_EQUAL(count, 10000);
+        BOOST_CHECK(filein.eof());
+
+        /* seek back, and read in batches */
+        filein.seek(5000 * 1000000ULL);
+        count = 0;
+        while (filein.read(objects, 100) > 0) {
+            for (Vector::BLF::ObjectHeaderBase * object : objects) {
+                if (object->objectType == Vector::BLF::ObjectType::CAN_MESSAGE) {
+                    BOOST_CHECK_EQUAL(static_cast<Vector::BLF::CanMessage *>(object)->id, 5000 + count);
+                    count++;
+                }
+                delete object;
+            }
+            objects.clear();
+        }
+        BOOST_CHECK_EQUAL(count, 5000);
+        filein.close();
+    }
+}
+
+/** limit the memory of the read pipeline by bytes */
+BOOST_AUTO_TEST_CASE(ReadAheadBudget) {
+    /* write file with small and large objects */
+    Vector::BLF::File fileout;
+    fileout.open(CMAKE_CURRENT_BINARY_DIR "/test_ReadAheadBudget.blf", std::ios_base::out);
+    BOOST_REQUIRE(fileout.is_open());
+    for (uint32_t i = 0; i < 20000; i++) {
+        auto * canMessage = new Vector::BLF::CanMessage;
+        canMessage->objectTimeStamp = i * 1000000ULL;
+        canMessage->id = i;
+        fileout.write(canMessage);
+        if (i % 1000 == 999) {
+            auto * environmentVariable = new Vector::BLF::EnvironmentVariable;
+            environmentVariable->objectType = Vector::BLF::ObjectType::ENV_DATA;
+            environmentVariable->objectTimeStamp = i * 1000000ULL;
+            environmentVariable->name = "data";
+            environmentVariable->data.resize(0x8000);
+            fileout.write(environmentVariable);
+        }
+    }
+    fileout.close();
+
+    for (bool lockFreeQueue : { false, true }) {
+        /* open file and let the pipeline read ahead */
+        Vector::BLF::File filein;
+        filein.lockFreeQueue = lockFreeQueue;
+        filein.readAheadBudget = 0x40000;
+        filein.open(CMAKE_CURRENT_BINARY_DIR "/test_ReadAheadBudget.blf", std::ios_base::in);
+        BOOST_REQUIRE(filein.is_open());
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+        /* small objects are queued deeper than readWriteQueueSize */
+        Vector::BLF::ReadAheadUsage usage = filein.readAheadUsage();
+        BOOST_CHECK_GT(usage.readWriteQueueBytes, filein.readWriteQueueSize * 48);
+
+        /* read all objects */
+        uint32_t canMessages = 0;
+        uint32_t environmentVariables = 0;
+        Vector::BLF::ObjectHeaderBase * ohb;
+        while ((ohb = filein.read()) != nullptr) {
+            if (ohb->objectType == Vector::BLF::ObjectType::CAN_MESSAGE) {
+                BOOST_CHECK_EQUAL(static_cast<Vector::BLF::CanMessage *>(ohb)->id, canMessages);
+                canMessages++;
+            }
+            if (ohb->objectType == Vector::BLF::ObjectType::ENV_DATA)
+                environmentVariables++;
+            delete ohb;
+        }
+        BOOST_CHECK_EQUAL(canMessages, 20000);
+        BOOST_CHECK_EQUAL(environmentVariables, 20);
+
+        /* the stages stayed within their share of the budget, exceeded by at most one object or LogContainer */
+        usage = filein.readAheadUsage();
+        BOOST_CHECK_LE(usage.readWriteQueuePeakBytes, 0x10000 + 0x8100);
+        BOOST_CHECK_LE(usage.uncompressedFilePeakBytes, 0x30000 + 2 * 0x20000);
+        filein.close();
+    }
+}
+
+/** write into and read from memory */
+BOOST_AUTO_TEST_CASE(Memory) {
+    /* write into memory and into a file */
+    std::vector<char> data;
+    Vector::BLF::File fileout;
+    fileout.setDefaultLogContainerSize(0x1000);
+    fileout.openMemory(data);
+    BOOST_REQUIRE(fileout.is_open());
+    Vector::BLF::File fileout2;
+    fileout2.setDefaultLogContainerSize(0x1000);
+    fileout2.open(CMAKE_CURRENT_BINARY_DIR "/test_Memory.blf", std::ios_base::out);
+    BOOST_REQUIRE(fileout2.is_open());
+    for (uint32_t i = 0; i < 10000; i++) {
+        auto * canMessage = new Vector::BLF::CanMessage;
+        canMessage->objectTimeStamp = i * 1000000ULL;
+        canMessage->id = i;
+        fileout.write(canMessage);
+        auto * canMessage2 = new Vector::BLF::CanMessage;
+        canMessage2->objectTimeStamp = i * 1000000ULL;
+        canMessage2->id = i;
+        fileout2.write(canMessage2);
+    }
+    fileout.close();
+    fileout2.close();
+    BOOST_CHECK_EQUAL(fileout.fileStatistics.objectCount, 10000);
+    BOOST_CHECK_EQUAL(data.size(), fileout.fileStatistics.fileSize);
+
+    /* same data as in the file, except the file statistics with the time of writing */
+    std::ifstream ifs(CMAKE_CURRENT_BINARY_DIR "/test_Memory.blf", std::ios_base::binary);
+    std::vector<char> data2((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+    BOOST_REQUIRE_EQUAL(data.size(), data2.size());
+    BOOST_CHECK(std::equal(data.begin() + fileout.fileStatistics.statisticsSize, data.end(), data2.begin() + fileout.fileStatistics.statisticsSize));
+
+    /* read from memory */
+    Vector::BLF::File filein;
+    filein.openMemory(data.data(), static_cast<std::streamsize>(data.size()));
+    BOOST_REQUIRE(filein.is_open());
+    BOOST_CHECK_EQUAL(filein.fileStatistics.objectCount, 10000);
+    uint32_t count = 0;
+    Vector::BLF::ObjectHeaderBase * ohb;
+    while ((ohb = filein.read()) != nullptr) {
+        if (ohb->objectType == Vector::BLF::ObjectType::CAN_MESSAGE) {
+            BOOST_CHECK_EQUAL(static_cast<Vector::BLF::CanMessage *>(ohb)->id, count);
+            count++;
+        }
+        delete ohb;
+    }
+    BOOST_CHECK_EQUAL(count, 10000);
+    BOOST_CHECK(filein.eof());
+
+    /* seek in memory */
+    filein.seek(5000 * 1000000ULL);
+    ohb = filein.read();
+    BOOST_REQUIRE(ohb != nullptr);
+    BOOST_CHECK_EQUAL(static_cast<Vector::BLF::CanMessage *>(ohb)->id, 5000);
+    delete ohb;
+    filein.close();
+}
+
+/** stream buffer, that can't seek, like a pipe */
+class ForwardOnlyBuffer : public std::streambuf {
+  public:
+    explicit ForwardOnlyBuffer(std::vector<char> & data) {
+        setg(data.data(), data.data(), data.data() + data.size());
+    }
+};
+
+/** read from a forward-only stream */
+BOOST_AUTO_TEST_CASE(Stream) {
+    /* write file with restore points */
+    Vector::BLF::File fileout;
+    fileout.setDefaultLogContainerSize(0x1000);
+    fileout.restorePoints.objectInterval = 99;
+    fileout.writeRestorePointData = true;
+    fileout.open(CMAKE_CURRENT_BINARY_DIR "/test_Stream.blf", std::ios_base::out);
+    BOOST_REQUIRE(fileout.is_open());
+    for (uint32_t i = 0; i < 10000; i++) {
+        auto * canMessage = new Vector::BLF::CanMessage;
+        canMessage->objectTimeStamp = i * 1000000ULL;
+        canMessage->id = i;
+        fileout.write(canMessage);
+    }
+    fileout.close();
+    std::ifstream ifs(CMAKE_CURRENT_BINARY_DIR "/test_Stream.blf", std::ios_base::binary);
+    std::vector<char> data((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+
+    for (bool synchronous : { false, true }) {
+        /* read from stream */
+        ForwardOnlyBuffer buffer(data);
+        std::istream stream(&buffer);
+        Vector::BLF::File filein;
+        filein.synchronous = synchronous;
+        filein.openStream(stream);
+        BOOST_REQUIRE(filein.is_open());
+        BOOST_CHECK_EQUAL(filein.fileStatistics.objectCount, 10000);
+        BOOST_CHECK(filein.restorePoints.restorePoints.empty());
+        uint32_t count = 0;
+        Vector::BLF::ObjectHeaderBase * ohb;
+        while ((ohb = filein.read()) != nullptr) {
+            if (ohb->objectType == Vector::BLF::ObjectType::CAN_MESSAGE) {
+                BOOST_CHECK_EQUAL(static_cast<Vector::BLF::CanMessage *>(ohb)->id, count);
+                count++;
+            }
+            delete ohb;
+        }
+        BOOST_CHECK_EQUAL(count, 10000);
+        BOOST_CHECK(filein.eof());
+
+        /* seek is not possible */
+        BOOST_CHECK_THROW(filein.seek(0), Vector::BLF::Exception);
+        filein.close();
+    }
+}
+
+/**
+ * Write a file and compare it with the same objects written by version 2.4.2.
+ *
+ * @param[in] fileout file, configured but not opened
+ * @param[in] name file name
+ */
+static void writeAndCompareWithVersion242(Vector::BLF::File & fileout, const std::string & name) {
+    /* write file */
+    fileout.open((CMAKE_CURRENT_BINARY_DIR "/" + name).c_str(), std::ios_base::out);
+    BOOST_REQUIRE(fileout.is_open());
+    for (uint32_t i = 0; i < 5000; i++) {
+        auto * canMessage = new Vector::BLF::CanMessage;
+        canMessage->objectTimeStamp = i * 1000000ULL;
+        canMessage->channel = 1;
+        canMessage->id = i;
+        canMessage->dlc = 8;
+        for (uint8_t j = 0; j < 8; j++)
+            canMessage->data[j] = static_cast<uint8_t>(i + j);
+        fileout.write(canMessage);
+        if (i % 1000 == 0) {
+            auto * appText = new Vector::BLF::AppText;
+            appText->objectTimeStamp = i * 1000000ULL;
+            appText->text = "text";
+            fileout.write(appText);
+        }
+    }
+    fileout.close();
+
+    /* compare with the same objects written by version 2.4.2 */
+    std::ifstream ifs1((CMAKE_CURRENT_SOURCE_DIR "/writer/" + name).c_str(), std::ios_base::binary);
+    std::vector<char> data1((std::istreambuf_iterator<char>(ifs1)), std::istreambuf_iterator<char>());
+    std::ifstream ifs2((CMAKE_CURRENT_BINARY_DIR "/" + name).c_str(), std::ios_base::binary);
+    std::vector<char> data2((std::istreambuf_iterator<char>(ifs2)), std::istreambuf_iterator<char>());
+    BOOST_REQUIRE(!data1.empty());
+    BOOST_CHECK(data1 == data2);
+}
+
+/** a file written with the default settings is the same as written by version 2.4.2 */
+BOOST_AUTO_TEST_CASE(DefaultSettings) {
+    Vector::BLF::File fileout;
+    writeAndCompareWithVersion242(fileout, "test_DefaultSettings.blf");
+}
+
+/** a file written without restore points is the same as written by version 2.4.2 */
+BOOST_AUTO_TEST_CASE(WithoutRestorePoints) {
+    Vector::BLF::File fileout;
+    fileout.writeRestorePoints = false;
+    writeAndCompareWithVersion242(fileout, "test_WithoutRestorePoints.blf");
+}
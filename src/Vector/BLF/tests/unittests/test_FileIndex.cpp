@@ -0,0 +1,214 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#define BOOST_TEST_MODULE FileIndex
+#if !defined(WIN32)
+#define BOOST_TEST_DYN_LINK
+#endif
+#include <boost/test/unit_test.hpp>
+
+#include <Vector/BLF.h>
+
+#include "TestFiles.h"
+
+/** Build, save and load a file index. */
+BOOST_AUTO_TEST_CASE(BuildSaveLoad) {
+    writeCanLinFile(CMAKE_CURRENT_BINARY_DIR "/test_FileIndex.blf");
+
+    /* build index */
+    Vector::BLF::FileIndex fileIndex;
+    fileIndex.build(CMAKE_CURRENT_BINARY_DIR "/test_FileIndex.blf");
+    BOOST_REQUIRE(!fileIndex.logContainers.empty());
+
+    /* check entries */
+    uint32_t canMessages = 0;
+    uint32_t linMessages = 0;
+    bool continuedObjects = false;
+    std::set<uint16_t> channels;
+    for (const Vector::BLF::FileIndexEntry & fileIndexEntry : fileIndex.logContainers) {
+        BOOST_CHECK_LE(fileIndexEntry.minTimeStamp, fileIndexEntry.maxTimeStamp);
+        BOOST_CHECK_LE(fileIndexEntry.uncompressedFileOffset, fileIndexEntry.uncompressedFileSize);
+        if (fileIndexEntry.uncompressedFileOffset > 0)
+            continuedObjects = true;
+        if (fileIndexEntry.objectCounts.count(Vector::BLF::ObjectType::CAN_MESSAGE))
+            canMessages += fileIndexEntry.objectCounts.at(Vector::BLF::ObjectType::CAN_MESSAGE);
+        if (fileIndexEntry.objectCounts.count(Vector::BLF::ObjectType::LIN_MESSAGE))
+            linMessages += fileIndexEntry.objectCounts.at(Vector::BLF::ObjectType::LIN_MESSAGE);
+        channels.insert(fileIndexEntry.channels.cbegin(), fileIndexEntry.channels.cend());
+        BOOST_CHECK(fileIndex.find(fileIndexEntry.compressedFilePosition) == &fileIndexEntry);
+    }
+    BOOST_CHECK_EQUAL(canMessages, 4900);
+    BOOST_CHECK_EQUAL(linMessages, 100);
+    BOOST_CHECK(continuedObjects);
+    BOOST_CHECK(channels == std::set<uint16_t>({ 1, 2, 3 }));
+    BOOST_CHECK_EQUAL(fileIndex.logContainers.front().minTimeStamp, 0);
+    BOOST_CHECK_EQUAL(fileIndex.logContainers.back().maxTimeStamp, 4999000000ULL);
+    BOOST_CHECK(fileIndex.find(1) == nullptr);
+
+    /* the restore points LogContainer is not indexed */
+    Vector::BLF::File filein;
+    filein.open(CMAKE_CURRENT_BINARY_DIR "/test_FileIndex.blf", std::ios_base::in);
+    BOOST_REQUIRE(filein.is_open());
+    BOOST_REQUIRE_GT(filein.fileStatistics.restorePointsOffset, 0);
+    BOOST_CHECK_LT(fileIndex.logContainers.back().compressedFilePosition, filein.fileStatistics.restorePointsOffset);
+    BOOST_CHECK(fileIndex.matches(filein.fileStatistics));
+    filein.close();
+
+    /* save and load */
+    BOOST_REQUIRE(fileIndex.save(CMAKE_CURRENT_BINARY_DIR "/test_FileIndex.blf.idx"));
+    Vector::BLF::FileIndex fileIndex2;
+    BOOST_REQUIRE(fileIndex2.load(CMAKE_CURRENT_BINARY_DIR "/test_FileIndex.blf.idx"));
+    BOOST_CHECK_EQUAL(fileIndex2.fileSize, fileIndex.fileSize);
+    BOOST_CHECK_EQUAL(fileIndex2.uncompressedFileSize, fileIndex.uncompressedFileSize);
+    BOOST_CHECK_EQUAL(fileIndex2.objectCount, fileIndex.objectCount);
+    BOOST_CHECK(fileIndex2.measurementStartTime == fileIndex.measurementStartTime);
+    BOOST_REQUIRE_EQUAL(fileIndex2.logContainers.size(), fileIndex.logContainers.size());
+    for (std::size_t i = 0; i < fileIndex.logContainers.size(); ++i) {
+        BOOST_CHECK_EQUAL(fileIndex2.logContainers[i].compressedFilePosition, fileIndex.logContainers[i].compressedFilePosition);
+        BOOST_CHECK_EQUAL(fileIndex2.logContainers[i].uncompressedFileSize, fileIndex.logContainers[i].uncompressedFileSize);
+        BOOST_CHECK_EQUAL(fileIndex2.logContainers[i].uncompressedFileOffset, fileIndex.logContainers[i].uncompressedFileOffset);
+        BOOST_CHECK_EQUAL(fileIndex2.logContainers[i].minTimeStamp, fileIndex.logContainers[i].minTimeStamp);
+        BOOST_CHECK_EQUAL(fileIndex2.logContainers[i].maxTimeStamp, fileIndex.logContainers[i].maxTimeStamp);
+        BOOST_CHECK(fileIndex2.logContainers[i].objectCounts == fileIndex.logContainers[i].objectCounts);
+        BOOST_CHECK(fileIndex2.logContainers[i].channels == fileIndex.logContainers[i].channels);
+    }
+
+    /* load errors */
+    BOOST_CHECK(!fileIndex2.load(CMAKE_CURRENT_BINARY_DIR "/FileNotExists.idx"));
+    BOOST_CHECK(!fileIndex2.load(CMAKE_CURRENT_BINARY_DIR "/test_FileIndex.blf"));
+    BOOST_CHECK(fileIndex2.logContainers.empty());
+
+    /* unknown versions are rejected */
+    fileIndex.version = Vector::BLF::FileIndexVersion + 1;
+    BOOST_REQUIRE(fileIndex.save(CMAKE_CURRENT_BINARY_DIR "/test_FileIndex.blf.idx"));
+    BOOST_CHECK(!fileIndex2.load(CMAKE_CURRENT_BINARY_DIR "/test_FileIndex.blf.idx"));
+    BOOST_CHECK(fileIndex2.logContainers.empty());
+}
+
+/** Seek using the file index. */
+BOOST_AUTO_TEST_CASE(Seek) {
+    writeCanLinFile(CMAKE_CURRENT_BINARY_DIR "/test_FileIndexSeek.blf");
+
+    Vector::BLF::File filein;
+    filein.fileIndex.build(CMAKE_CURRENT_BINARY_DIR "/test_FileIndexSeek.blf");
+    filein.open(CMAKE_CURRENT_BINARY_DIR "/test_FileIndexSeek.blf", std::ios_base::in);
+    BOOST_REQUIRE(filein.is_open());
+    BOOST_CHECK(filein.restorePoints.restorePoints.empty());
+    BOOST_REQUIRE(!filein.fileIndex.logContainers.empty());
+
+    /* seek forward, backward, and to time stamps between objects */
+    for (uint32_t id : { 3000, 1234, 0, 4999, 4321 }) {
+        filein.seek(id * 1000000ULL);
+        Vector::BLF::ObjectHeaderBase * ohb = filein.read();
+        BOOST_REQUIRE(ohb);
+        BOOST_REQUIRE(ohb->objectType == Vector::BLF::ObjectType::CAN_MESSAGE);
+        BOOST_CHECK_EQUAL(static_cast<Vector::BLF::CanMessage *>(ohb)->id, id);
+        delete ohb;
+    }
+    filein.seek(1234500000ULL);
+    Vector::BLF::ObjectHeaderBase * ohb = filein.read();
+    BOOST_REQUIRE(ohb);
+    BOOST_CHECK_EQUAL(ohb->objectTimeStampNs(), 1235000000ULL);
+    delete ohb;
+
+    /* read till end of file */
+    uint32_t count = 0;
+    while ((ohb = filein.read()) != nullptr) {
+        count++;
+        delete ohb;
+    }
+    BOOST_CHECK_EQUAL(count, 5000 - 1236);
+
+    /* seek behind last object */
+    filein.seek(5000000000ULL);
+    BOOST_CHECK(filein.read() == nullptr);
+    filein.close();
+}
+
+/** Read only LogContainers selected by the file index. */
+BOOST_AUTO_TEST_CASE(LogContainerFilter) {
+    writeCanLinFile(CMAKE_CURRENT_BINARY_DIR "/test_FileIndexFilter.blf");
+
+    Vector::BLF::FileIndex fileIndex;
+    fileIndex.build(CMAKE_CURRENT_BINARY_DIR "/test_FileIndexFilter.blf");
+
+    for (uint32_t compressionThreads : { 0, 2 }) {
+        Vector::BLF::File filein;
+        filein.compressionThreads = compressionThreads;
+        filein.fileIndex = fileIndex;
+        filein.logContainerFilter = [](const Vector::BLF::FileIndexEntry & fileIndexEntry) {
+            return fileIndexEntry.channels.count(3) > 0;
+        };
+        filein.open(CMAKE_CURRENT_BINARY_DIR "/test_FileIndexFilter.blf", std::ios_base::in);
+        BOOST_REQUIRE(filein.is_open());
+
+        /* all objects read are complete and in order */
+        uint32_t objects = 0;
+        uint32_t linMessages = 0;
+        uint64_t timeStamp = 0;
+        Vector::BLF::ObjectHeaderBase * ohb;
+        while ((ohb = filein.read()) != nullptr) {
+            BOOST_CHECK_GE(ohb->objectTimeStampNs(), timeStamp);
+            timeStamp = ohb->objectTimeStampNs();
+            if (ohb->objectType == Vector::BLF::ObjectType::CAN_MESSAGE) {
+                BOOST_CHECK_EQUAL(static_cast<Vector::BLF::CanMessage *>(ohb)->id * 1000000ULL, timeStamp);
+            } else {
+                BOOST_REQUIRE(ohb->objectType == Vector::BLF::ObjectType::LIN_MESSAGE);
+                BOOST_CHECK_EQUAL(static_cast<Vector::BLF::LinMessage *>(ohb)->channel, 3);
+                linMessages++;
+            }
+            objects++;
+            delete ohb;
+        }
+        BOOST_CHECK_EQUAL(linMessages, 100);
+        BOOST_CHECK_LT(objects, 200);
+        filein.close();
+    }
+}
+
+/** The file index of another file is dropped on open. */
+BOOST_AUTO_TEST_CASE(OutdatedIndex) {
+    Vector::BLF::File filein;
+    filein.fileIndex.fileSize = 1;
+    filein.fileIndex.logContainers.resize(1);
+    filein.open(CMAKE_CURRENT_SOURCE_DIR "/events_from_binlog/test_CanMessage.blf", std::ios_base::in);
+    BOOST_REQUIRE(filein.is_open());
+    BOOST_CHECK(filein.fileIndex.logContainers.empty());
+
+    /* objects are read as usual */
+    Vector::BLF::ObjectHeaderBase * ohb = filein.read();
+    BOOST_REQUIRE(ohb);
+    BOOST_CHECK(ohb->objectType == Vector::BLF::ObjectType::CAN_MESSAGE);
+    delete ohb;
+    filein.close();
+}
+
+/** The file index is dropped on open, if any of the file statistics don't match. */
+BOOST_AUTO_TEST_CASE(MismatchingIndex) {
+    writeCanLinFile(CMAKE_CURRENT_BINARY_DIR "/test_FileIndexMismatch.blf");
+
+    Vector::BLF::FileIndex fileIndex;
+    fileIndex.build(CMAKE_CURRENT_BINARY_DIR "/test_FileIndexMismatch.blf");
+    BOOST_REQUIRE(!fileIndex.logContainers.empty());
+
+    for (int mismatch = 0; mismatch < 4; ++mismatch) {
+        Vector::BLF::File filein;
+        filein.fileIndex = fileIndex;
+        switch (mismatch) {
+        case 1:
+            filein.fileIndex.uncompressedFileSize++;
+            break;
+        case 2:
+            filein.fileIndex.objectCount++;
+            break;
+        case 3:
+            filein.fileIndex.measurementStartTime.second++;
+            break;
+        }
+        filein.open(CMAKE_CURRENT_BINARY_DIR "/test_FileIndexMismatch.blf", std::ios_base::in);
+        BOOST_REQUIRE(filein.is_open());
+        BOOST_CHECK_EQUAL(filein.fileIndex.logContainers.empty(), mismatch != 0);
+        filein.close();
+    }
+}
@@ -0,0 +1,128 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#define BOOST_TEST_MODULE FileMerger
+#if !defined(WIN32)
+#define BOOST_TEST_DYN_LINK
+#endif
+#include <boost/test/unit_test.hpp>
+
+#include <Vector/BLF.h>
+
+/**
+ * Write a file without restore points, and an object every 3 ms.
+ *
+ * The files use ObjectHeader resp. ObjectHeader2, and 1 ns resp. 10 us time stamps.
+ */
+static void writeFile(const char * filename, uint32_t file, uint16_t second) {
+    Vector::BLF::File fileout;
+    fileout.setDefaultLogContainerSize(0x1000);
+    fileout.writeRestorePoints = false;
+    fileout.fileStatistics.measurementStartTime = { 2021, 1, 5, 1, 12, 0, second, 0 };
+    fileout.open(filename, std::ios_base::out);
+    BOOST_REQUIRE(fileout.is_open());
+    for (uint32_t i = 0; i < 1000; i++) {
+        uint64_t timeStampMs = i * 3 + file;
+        switch (file) {
+        case 0: {
+            auto * canMessage = new Vector::BLF::CanMessage;
+            canMessage->objectTimeStamp = timeStampMs * 1000000ULL;
+            canMessage->id = i;
+            fileout.write(canMessage);
+        }
+        break;
+        case 1: {
+            auto * most50Message = new Vector::BLF::Most50Message;
+            most50Message->objectFlags = Vector::BLF::ObjectHeader2::ObjectFlags::TimeTenMics;
+            most50Message->objectTimeStamp = timeStampMs * 100ULL;
+            most50Message->sourceAdr = i;
+            fileout.write(most50Message);
+        }
+        break;
+        default: {
+            auto * canMessage = new Vector::BLF::CanMessage;
+            canMessage->objectFlags = Vector::BLF::ObjectHeader::ObjectFlags::TimeTenMics;
+            canMessage->objectTimeStamp = timeStampMs * 100ULL;
+            canMessage->id = i;
+            fileout.write(canMessage);
+        }
+        break;
+        }
+    }
+    fileout.close();
+}
+
+/** Merge files in time stamp order. */
+BOOST_AUTO_TEST_CASE(Merge) {
+    writeFile(CMAKE_CURRENT_BINARY_DIR "/test_FileMerger0.blf", 0, 0);
+    writeFile(CMAKE_CURRENT_BINARY_DIR "/test_FileMerger1.blf", 1, 0);
+    writeFile(CMAKE_CURRENT_BINARY_DIR "/test_FileMerger2.blf", 2, 0);
+
+    for (uint32_t compressionThreads : { 0, 2 }) {
+        Vector::BLF::FileMerger fileMerger;
+        fileMerger.compressionThreads = compressionThreads;
+        fileMerger.open(CMAKE_CURRENT_BINARY_DIR "/test_FileMerger2.blf");
+        fileMerger.open(CMAKE_CURRENT_BINARY_DIR "/test_FileMerger1.blf");
+        fileMerger.open(CMAKE_CURRENT_BINARY_DIR "/test_FileMerger0.blf");
+        fileMerger.open(CMAKE_CURRENT_BINARY_DIR "/FileNotExists.blf");
+        BOOST_REQUIRE(fileMerger.is_open());
+        BOOST_REQUIRE_EQUAL(fileMerger.files.size(), 3);
+
+        /* objects are read in time stamp order */
+        uint32_t objects = 0;
+        Vector::BLF::ObjectHeaderBase * ohb;
+        while ((ohb = fileMerger.read()) != nullptr) {
+            BOOST_CHECK_EQUAL(ohb->objectTimeStampNs(), objects * 1000000ULL);
+            BOOST_CHECK_EQUAL(fileMerger.lastFile(), 2 - (objects % 3));
+            if (objects % 3 == 1) {
+                BOOST_REQUIRE(ohb->objectType == Vector::BLF::ObjectType::MOST_50_MESSAGE);
+                BOOST_CHECK_EQUAL(static_cast<Vector::BLF::Most50Message *>(ohb)->sourceAdr, objects / 3);
+            } else {
+                BOOST_REQUIRE(ohb->objectType == Vector::BLF::ObjectType::CAN_MESSAGE);
+                BOOST_CHECK_EQUAL(static_cast<Vector::BLF::CanMessage *>(ohb)->id, objects / 3);
+            }
+            objects++;
+            delete ohb;
+        }
+        BOOST_CHECK_EQUAL(objects, 3000);
+
+        /* no more files can be opened */
+        BOOST_CHECK_THROW(fileMerger.open(CMAKE_CURRENT_BINARY_DIR "/test_FileMerger0.blf"), Vector::BLF::Exception);
+        fileMerger.close();
+        BOOST_CHECK(!fileMerger.is_open());
+    }
+}
+
+/** Align time stamps to the earliest measurement start time. */
+BOOST_AUTO_TEST_CASE(AlignMeasurementStartTime) {
+    writeFile(CMAKE_CURRENT_BINARY_DIR "/test_FileMergerAlign0.blf", 0, 1);
+    writeFile(CMAKE_CURRENT_BINARY_DIR "/test_FileMergerAlign1.blf", 1, 0);
+
+    Vector::BLF::FileMerger fileMerger;
+    fileMerger.alignMeasurementStartTime = true;
+    fileMerger.open(CMAKE_CURRENT_BINARY_DIR "/test_FileMergerAlign0.blf");
+    fileMerger.open(CMAKE_CURRENT_BINARY_DIR "/test_FileMergerAlign1.blf");
+
+    /* file 1 started 1 s before file 0 */
+    uint32_t objects = 0;
+    uint64_t timeStamp = 0;
+    Vector::BLF::ObjectHeaderBase * ohb;
+    while ((ohb = fileMerger.read()) != nullptr) {
+        BOOST_CHECK_GE(ohb->objectTimeStampNs(), timeStamp);
+        timeStamp = ohb->objectTimeStampNs();
+        if (objects == 0) {
+            BOOST_CHECK_EQUAL(fileMerger.lastFile(), 1);
+            BOOST_CHECK_EQUAL(timeStamp, 1000000ULL);
+        }
+        if (ohb->objectType == Vector::BLF::ObjectType::CAN_MESSAGE) {
+            auto * canMessage = static_cast<Vector::BLF::CanMessage *>(ohb);
+            BOOST_CHECK_EQUAL(timeStamp, 1000000000ULL + canMessage->id * 3000000ULL);
+        }
+        objects++;
+        delete ohb;
+    }
+    BOOST_CHECK_EQUAL(objects, 2000);
+    BOOST_CHECK_EQUAL(fileMerger.measurementStartTime.second, 0);
+    BOOST_CHECK_EQUAL(fileMerger.measurementStartTime.year, 2021);
+}
@@ -0,0 +1,281 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#define BOOST_TEST_MODULE FileSplicer
+#if !defined(WIN32)
+#define BOOST_TEST_DYN_LINK
+#endif
+#include <boost/test/unit_test.hpp>
+
+#include <fstream>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include <Vector/BLF.h>
+
+#include "TestFiles.h"
+
+/**
+ * Read a file and check that it contains the objects in order.
+ *
+ * @return number of objects
+ */
+static uint32_t readFile(const char * filename, uint32_t firstId, uint32_t lastId) {
+    Vector::BLF::File filein;
+    filein.open(filename, std::ios_base::in);
+    BOOST_REQUIRE(filein.is_open());
+
+    /* file statistics */
+    std::ifstream ifs(filename, std::ios_base::binary | std::ios_base::ate);
+    BOOST_CHECK_EQUAL(filein.fileStatistics.fileSize, static_cast<uint64_t>(ifs.tellg()));
+
+    uint32_t objects = 0;
+    uint32_t id = firstId;
+    Vector::BLF::ObjectHeaderBase * ohb;
+    while ((ohb = filein.read()) != nullptr) {
+        BOOST_CHECK_EQUAL(ohb->objectTimeStampNs(), id * 1000000ULL);
+        if (ohb->objectType == Vector::BLF::ObjectType::CAN_MESSAGE)
+            BOOST_CHECK_EQUAL(static_cast<Vector::BLF::CanMessage *>(ohb)->id, id);
+        else
+            BOOST_CHECK(ohb->objectType == Vector::BLF::ObjectType::LIN_MESSAGE);
+        id = (id == lastId) ? firstId : id + 1;
+        objects++;
+        delete ohb;
+    }
+    BOOST_CHECK_EQUAL(filein.fileStatistics.objectCount, objects);
+    BOOST_CHECK_EQUAL(filein.fileStatistics.uncompressedFileSize, filein.currentUncompressedFileSize);
+    filein.close();
+    return objects;
+}
+
+/**
+ * Write a file with padded objects every ms.
+ *
+ * AppTexts and EthernetFrames of different lengths, so that objects are
+ * followed by 0 to 3 bytes padding, and large EthernetFrames continue over
+ * several LogContainers.
+ */
+static void writePaddedFile(const char * filename) {
+    Vector::BLF::File fileout;
+    fileout.setDefaultLogContainerSize(0x1000);
+    fileout.open(filename, std::ios_base::out);
+    BOOST_REQUIRE(fileout.is_open());
+    for (uint32_t i = 0; i < 3000; i++) {
+        if (i % 3 == 0) {
+            auto * appText = new Vector::BLF::AppText;
+            appText->objectTimeStamp = i * 1000000ULL;
+            appText->text = std::string(i % 17, 'a' + (i % 26));
+            fileout.write(appText);
+        } else {
+            auto * ethernetFrame = new Vector::BLF::EthernetFrame;
+            ethernetFrame->objectTimeStamp = i * 1000000ULL;
+            ethernetFrame->channel = 1;
+            ethernetFrame->payLoad.resize((i % 10 == 1) ? 5000 + i : i % 61, static_cast<uint8_t>(i));
+            fileout.write(ethernetFrame);
+        }
+    }
+    fileout.close();
+}
+
+/** object type and data, as they are in the file */
+using RawObjects = std::vector<std::pair<Vector::BLF::ObjectType, std::vector<uint8_t>>>;
+
+/**
+ * Read the objects of a file within a time range undecoded.
+ *
+ * @return objects
+ */
+static RawObjects readRawObjects(const char * filename, uint64_t startTimeStamp, uint64_t endTimeStamp) {
+    Vector::BLF::File filein;
+    filein.rawObjects = Vector::BLF::RawObjectMode::All;
+    filein.open(filename, std::ios_base::in);
+    BOOST_REQUIRE(filein.is_open());
+
+    RawObjects rawObjects;
+    Vector::BLF::ObjectHeaderBase * ohb;
+    while ((ohb = filein.read()) != nullptr) {
+        auto * rawObject = static_cast<Vector::BLF::RawObject *>(ohb);
+        uint64_t timeStamp = rawObject->objectTimeStampNs();
+        if ((timeStamp >= startTimeStamp) && (timeStamp <= endTimeStamp))
+            rawObjects.emplace_back(rawObject->objectType, rawObject->data);
+        delete ohb;
+    }
+    BOOST_CHECK_EQUAL(filein.fileStatistics.uncompressedFileSize, filein.currentUncompressedFileSize);
+    filein.close();
+    return rawObjects;
+}
+
+/**
+ * Cut a time range out of a file, and check that it has the same objects as the input file within this range.
+ *
+ * @param[out] fileSplicer file splicer
+ * @return number of objects
+ */
+static std::size_t checkCut(Vector::BLF::FileSplicer & fileSplicer, const char * infilename, const char * outfilename, uint64_t startTimeStamp, uint64_t endTimeStamp) {
+    fileSplicer.open(outfilename);
+    BOOST_REQUIRE(fileSplicer.is_open());
+    fileSplicer.append(infilename, startTimeStamp, endTimeStamp);
+    fileSplicer.close();
+
+    RawObjects expected = readRawObjects(infilename, startTimeStamp, endTimeStamp);
+    RawObjects actual = readRawObjects(outfilename, 0, std::numeric_limits<uint64_t>::max());
+    BOOST_CHECK_EQUAL(actual.size(), expected.size());
+    BOOST_CHECK(actual == expected);
+    BOOST_CHECK_EQUAL(fileSplicer.fileStatistics.objectCount, actual.size());
+    return actual.size();
+}
+
+/** Cut a time range out of a file. */
+BOOST_AUTO_TEST_CASE(Cut) {
+    writeCanLinFile(CMAKE_CURRENT_BINARY_DIR "/test_FileSplicerIn.blf");
+
+    Vector::BLF::FileSplicer fileSplicer;
+    fileSplicer.open(CMAKE_CURRENT_BINARY_DIR "/test_FileSplicerCut.blf");
+    BOOST_REQUIRE(fileSplicer.is_open());
+    fileSplicer.append(CMAKE_CURRENT_BINARY_DIR "/test_FileSplicerIn.blf", 1500000000ULL, 3500000000ULL);
+    fileSplicer.close();
+    BOOST_CHECK(!fileSplicer.is_open());
+
+    /* only the boundary LogContainers are inflated */
+    BOOST_CHECK_GT(fileSplicer.passedLogContainers, 0);
+    BOOST_CHECK_LE(fileSplicer.inflatedLogContainers, 4);
+
+    BOOST_CHECK_EQUAL(readFile(CMAKE_CURRENT_BINARY_DIR "/test_FileSplicerCut.blf", 1500, 3500), 2001);
+}
+
+/** Concatenate files. */
+BOOST_AUTO_TEST_CASE(Concat) {
+    writeCanLinFile(CMAKE_CURRENT_BINARY_DIR "/test_FileSplicerIn2.blf");
+
+    Vector::BLF::FileSplicer fileSplicer;
+    fileSplicer.open(CMAKE_CURRENT_BINARY_DIR "/test_FileSplicerConcat.blf");
+    BOOST_REQUIRE(fileSplicer.is_open());
+    fileSplicer.append(CMAKE_CURRENT_BINARY_DIR "/test_FileSplicerIn2.blf");
+    fileSplicer.append(CMAKE_CURRENT_BINARY_DIR "/test_FileSplicerIn2.blf");
+    fileSplicer.close();
+
+    /* no LogContainer is inflated */
+    BOOST_CHECK_GT(fileSplicer.passedLogContainers, 0);
+    BOOST_CHECK_EQUAL(fileSplicer.inflatedLogContainers, 0);
+
+    BOOST_CHECK_EQUAL(readFile(CMAKE_CURRENT_BINARY_DIR "/test_FileSplicerConcat.blf", 0, 4999), 10000);
+}
+
+/** Append to a file, that is not open. */
+BOOST_AUTO_TEST_CASE(NotOpen) {
+    Vector::BLF::FileSplicer fileSplicer;
+    BOOST_CHECK_THROW(fileSplicer.append(CMAKE_CURRENT_SOURCE_DIR "/events_from_binlog/test_CanMessage.blf"), Vector::BLF::Exception);
+}
+
+/** Cut time ranges out of a file with padded objects. */
+BOOST_AUTO_TEST_CASE(PaddedObjects) {
+    writePaddedFile(CMAKE_CURRENT_BINARY_DIR "/test_FileSplicerPaddedIn.blf");
+
+    Vector::BLF::FileSplicer fileSplicer;
+    BOOST_CHECK_EQUAL(checkCut(fileSplicer, CMAKE_CURRENT_BINARY_DIR "/test_FileSplicerPaddedIn.blf", CMAKE_CURRENT_BINARY_DIR "/test_FileSplicerPadded.blf", 700000000ULL, 2300000000ULL), 1601);
+    BOOST_CHECK_GT(fileSplicer.passedLogContainers, 0);
+
+    /* all objects */
+    Vector::BLF::FileSplicer fileSplicer2;
+    BOOST_CHECK_EQUAL(checkCut(fileSplicer2, CMAKE_CURRENT_BINARY_DIR "/test_FileSplicerPaddedIn.blf", CMAKE_CURRENT_BINARY_DIR "/test_FileSplicerPadded.blf", 0, std::numeric_limits<uint64_t>::max()), 3000);
+    BOOST_CHECK_EQUAL(fileSplicer2.inflatedLogContainers, 0);
+}
+
+/** Cut time ranges, whose edges are the time stamps at LogContainer boundaries. */
+BOOST_AUTO_TEST_CASE(LogContainerBoundaries) {
+    writePaddedFile(CMAKE_CURRENT_BINARY_DIR "/test_FileSplicerBoundariesIn.blf");
+
+    Vector::BLF::FileIndex fileIndex;
+    fileIndex.build(CMAKE_CURRENT_BINARY_DIR "/test_FileSplicerBoundariesIn.blf");
+    const std::vector<Vector::BLF::FileIndexEntry> & logContainers = fileIndex.logContainers;
+    BOOST_REQUIRE_GT(logContainers.size(), 20);
+
+    for (std::size_t i = 5; i + 5 < logContainers.size(); i += 7) {
+        if ((logContainers[i].uncompressedFileOffset >= logContainers[i].uncompressedFileSize) ||
+                (logContainers[i + 4].uncompressedFileOffset >= logContainers[i + 4].uncompressedFileSize))
+            continue;
+
+        /* first resp. last objects of LogContainers */
+        Vector::BLF::FileSplicer fileSplicer;
+        fileSplicer.fileIndex = fileIndex;
+        checkCut(fileSplicer, CMAKE_CURRENT_BINARY_DIR "/test_FileSplicerBoundariesIn.blf", CMAKE_CURRENT_BINARY_DIR "/test_FileSplicerBoundaries.blf",
+                 logContainers[i].minTimeStamp, logContainers[i + 4].maxTimeStamp);
+
+        /* objects behind resp. before them */
+        Vector::BLF::FileSplicer fileSplicer2;
+        fileSplicer2.fileIndex = fileIndex;
+        checkCut(fileSplicer2, CMAKE_CURRENT_BINARY_DIR "/test_FileSplicerBoundariesIn.blf", CMAKE_CURRENT_BINARY_DIR "/test_FileSplicerBoundaries.blf",
+                 logContainers[i].maxTimeStamp + 1, logContainers[i + 4].minTimeStamp - 1);
+    }
+}
+
+/** Cut time ranges without objects. */
+BOOST_AUTO_TEST_CASE(EmptyTimeRange) {
+    writePaddedFile(CMAKE_CURRENT_BINARY_DIR "/test_FileSplicerEmptyIn.blf");
+
+    /* between two objects */
+    Vector::BLF::FileSplicer fileSplicer;
+    BOOST_CHECK_EQUAL(checkCut(fileSplicer, CMAKE_CURRENT_BINARY_DIR "/test_FileSplicerEmptyIn.blf", CMAKE_CURRENT_BINARY_DIR "/test_FileSplicerEmpty.blf", 1500000001ULL, 1500999999ULL), 0);
+    BOOST_CHECK_EQUAL(fileSplicer.passedLogContainers, 0);
+
+    /* behind the last object */
+    Vector::BLF::FileSplicer fileSplicer2;
+    BOOST_CHECK_EQUAL(checkCut(fileSplicer2, CMAKE_CURRENT_BINARY_DIR "/test_FileSplicerEmptyIn.blf", CMAKE_CURRENT_BINARY_DIR "/test_FileSplicerEmpty.blf", 3000000000ULL, 4000000000ULL), 0);
+    BOOST_CHECK_EQUAL(fileSplicer2.inflatedLogContainers, 0);
+
+    /* end before start */
+    Vector::BLF::FileSplicer fileSplicer3;
+    BOOST_CHECK_EQUAL(checkCut(fileSplicer3, CMAKE_CURRENT_BINARY_DIR "/test_FileSplicerEmptyIn.blf", CMAKE_CURRENT_BINARY_DIR "/test_FileSplicerEmpty.blf", 2000000000ULL, 1000000000ULL), 0);
+    BOOST_CHECK_EQUAL(fileSplicer3.inflatedLogContainers, 0);
+}
+
+/** Cut a time range, in which objects continue into LogContainers, that are passed through. */
+BOOST_AUTO_TEST_CASE(ObjectContinuedIntoPassedLogContainer) {
+    writePaddedFile(CMAKE_CURRENT_BINARY_DIR "/test_FileSplicerContinuedIn.blf");
+
+    /* LogContainers within the time range, which continue an object */
+    const uint64_t startTimeStamp = 1000000000ULL;
+    const uint64_t endTimeStamp = 2000000000ULL;
+    Vector::BLF::FileIndex fileIndex;
+    fileIndex.build(CMAKE_CURRENT_BINARY_DIR "/test_FileSplicerContinuedIn.blf");
+    uint32_t continued = 0;
+    for (const Vector::BLF::FileIndexEntry & fileIndexEntry : fileIndex.logContainers) {
+        if ((fileIndexEntry.uncompressedFileOffset > 0) &&
+                (fileIndexEntry.uncompressedFileOffset < fileIndexEntry.uncompressedFileSize) &&
+                (fileIndexEntry.minTimeStamp > startTimeStamp) &&
+                (fileIndexEntry.maxTimeStamp < endTimeStamp))
+            continued++;
+    }
+    BOOST_REQUIRE_GT(continued, 0);
+
+    Vector::BLF::FileSplicer fileSplicer;
+    fileSplicer.fileIndex = fileIndex;
+    BOOST_CHECK_EQUAL(checkCut(fileSplicer, CMAKE_CURRENT_BINARY_DIR "/test_FileSplicerContinuedIn.blf", CMAKE_CURRENT_BINARY_DIR "/test_FileSplicerContinued.blf", startTimeStamp, endTimeStamp), 1001);
+    BOOST_CHECK_GE(fileSplicer.passedLogContainers, continued);
+    BOOST_CHECK_LE(fileSplicer.inflatedLogContainers, 6);
+}
+
+/** Files with another measurementStartTime are rejected. */
+BOOST_AUTO_TEST_CASE(MeasurementStartTime) {
+    Vector::BLF::File fileout;
+    fileout.fileStatistics.measurementStartTime = { 2021, 1, 5, 1, 12, 0, 0, 0 };
+    fileout.open(CMAKE_CURRENT_BINARY_DIR "/test_FileSplicerStartTime1.blf", std::ios_base::out);
+    BOOST_REQUIRE(fileout.is_open());
+    fileout.close();
+    Vector::BLF::File fileout2;
+    fileout2.fileStatistics.measurementStartTime = { 2021, 1, 5, 1, 12, 0, 1, 0 };
+    fileout2.open(CMAKE_CURRENT_BINARY_DIR "/test_FileSplicerStartTime2.blf", std::ios_base::out);
+    BOOST_REQUIRE(fileout2.is_open());
+    fileout2.close();
+
+    Vector::BLF::FileSplicer fileSplicer;
+    fileSplicer.open(CMAKE_CURRENT_BINARY_DIR "/test_FileSplicerStartTime.blf");
+    BOOST_REQUIRE(fileSplicer.is_open());
+    fileSplicer.append(CMAKE_CURRENT_BINARY_DIR "/test_FileSplicerStartTime1.blf");
+    fileSplicer.append(CMAKE_CURRENT_BINARY_DIR "/test_FileSplicerStartTime1.blf");
+    BOOST_CHECK_THROW(fileSplicer.append(CMAKE_CURRENT_BINARY_DIR "/test_FileSplicerStartTime2.blf"), Vector::BLF::Exception);
+    BOOST_CHECK_THROW(fileSplicer.append(CMAKE_CURRENT_BINARY_DIR "/test_FileSplicerStartTime2.blf", 0, 1000), Vector::BLF::Exception);
+    fileSplicer.close();
+}
@@ -0,0 +1,87 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#define BOOST_TEST_MODULE InlineVector
+#if !defined(WIN32)
+#define BOOST_TEST_DYN_LINK
+#endif
+#include <boost/test/unit_test.hpp>
+
+#include <vector>
+
+#include <Vector/BLF.h>
+
+/** Elements are kept inline, up to the capacity. */
+BOOST_AUTO_TEST_CASE(ResizeAssign) {
+    Vector::BLF::InlineVector<uint8_t, 8> data;
+    BOOST_CHECK(data.empty());
+    BOOST_CHECK_EQUAL(data.capacity(), 8);
+    BOOST_CHECK(reinterpret_cast<const char *>(data.data()) >= reinterpret_cast<const char *>(&data));
+    BOOST_CHECK(reinterpret_cast<const char *>(data.data()) < reinterpret_cast<const char *>(&data + 1));
+
+    /* resize */
+    data.resize(4, 0xAA);
+    BOOST_CHECK_EQUAL(data.size(), 4);
+    BOOST_CHECK_EQUAL(data[3], 0xAA);
+    data.resize(2);
+    data.resize(3);
+    BOOST_CHECK_EQUAL(data[2], 0);
+
+    /* assign */
+    data.assign(8, 0x55);
+    BOOST_CHECK_EQUAL(data.size(), 8);
+    const std::vector<uint8_t> expected { 1, 2, 3 };
+    data.assign(expected.cbegin(), expected.cend());
+    BOOST_CHECK_EQUAL_COLLECTIONS(data.cbegin(), data.cend(), expected.cbegin(), expected.cend());
+    BOOST_CHECK(data == (Vector::BLF::InlineVector<uint8_t, 8> { 1, 2, 3 }));
+    BOOST_CHECK(data != (Vector::BLF::InlineVector<uint8_t, 8> { 1, 2 }));
+
+    /* clear */
+    data.clear();
+    BOOST_CHECK(data.empty());
+}
+
+/** The capacity can't be exceeded. */
+BOOST_AUTO_TEST_CASE(Capacity) {
+    Vector::BLF::InlineVector<uint8_t, 2> data;
+    BOOST_CHECK_THROW(data.resize(3), Vector::BLF::Exception);
+    data.push_back(1);
+    data.push_back(2);
+    BOOST_CHECK_THROW(data.push_back(3), Vector::BLF::Exception);
+    BOOST_CHECK_EQUAL(data.size(), 2);
+}
+
+/** The members of std::vector used on payloads are available. */
+BOOST_AUTO_TEST_CASE(VectorInterface) {
+    Vector::BLF::InlineVector<uint8_t, 8> data { 1, 2, 3 };
+    data.reserve(8);
+    BOOST_CHECK_THROW(data.reserve(9), Vector::BLF::Exception);
+
+    /* element access */
+    BOOST_CHECK_EQUAL(data.front(), 1);
+    BOOST_CHECK_EQUAL(data.back(), 3);
+    BOOST_CHECK_EQUAL(data.at(1), 2);
+    BOOST_CHECK_THROW(data.at(3), Vector::BLF::Exception);
+
+    /* insert */
+    BOOST_CHECK(data.insert(data.cbegin(), 0) == data.begin());
+    data.insert(data.cend(), 2, 4);
+    const std::vector<uint8_t> more { 7, 8 };
+    data.insert(data.cbegin() + 3, more.cbegin(), more.cend());
+    BOOST_CHECK(data == (Vector::BLF::InlineVector<uint8_t, 8> { 0, 1, 2, 7, 8, 3, 4, 4 }));
+    BOOST_CHECK_THROW(data.insert(data.cend(), 5), Vector::BLF::Exception);
+
+    /* erase */
+    BOOST_CHECK(data.erase(data.cbegin() + 3, data.cbegin() + 5) == data.begin() + 3);
+    data.erase(data.cbegin());
+    data.pop_back();
+    BOOST_CHECK(data == (Vector::BLF::InlineVector<uint8_t, 8> { 1, 2, 3, 4 }));
+
+    /* conversion from and to std::vector */
+    std::vector<uint8_t> vector = data;
+    BOOST_CHECK(vector == (std::vector<uint8_t> { 1, 2, 3, 4 }));
+    data = std::vector<uint8_t> { 5, 6 };
+    BOOST_CHECK(data == (Vector::BLF::InlineVector<uint8_t, 8> { 5, 6 }));
+    BOOST_CHECK_THROW(data = std::vector<uint8_t>(9), Vector::BLF::Exception);
+}
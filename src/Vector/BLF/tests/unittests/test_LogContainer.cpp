@@ -98,3 +98,52 @@ BOOST_AUTO_TEST_CASE(LogContainerCompressedWithWrongCompresionMethodOrLevel) {
     /* compress LogContainer */
     BOOST_CHECK_THROW(logContainer.compress(2, 10), Vector::BLF::Exception); // ZLib with undefined compressionLevel
 }
+
+/** compress and uncompress several LogContainers in a row, reusing the zlib streams */
+BOOST_AUTO_TEST_CASE(LogContainerReuseZlibStreams) {
+    std::vector<uint8_t> compressedFile;
+
+    for (int i = 0; i < 4; i++) {
+        Vector::BLF::LogContainer logContainer;
+
+        /* put in some uncompressedData, different per LogContainer */
+        logContainer.uncompressedFile.resize(0x20000);
+        for (std::size_t j = 0; j < logContainer.uncompressedFile.size(); j++)
+            logContainer.uncompressedFile[j] = static_cast<uint8_t>((j * (i + 1)) ^ (j >> 8));
+        logContainer.uncompressedFileSize = static_cast<uint32_t>(logContainer.uncompressedFile.size());
+        std::vector<uint8_t> uncompressedFile = logContainer.uncompressedFile;
+
+        /* compress LogContainer, with changing compressionLevel */
+        logContainer.compress(2, (i % 2) ? 9 : 6);
+
+        /* the same data and compressionLevel result in the same compressedFile */
+        if (i == 0)
+            compressedFile = logContainer.compressedFile;
+        if (i == 2) {
+            Vector::BLF::LogContainer logContainer0;
+            logContainer0.uncompressedFile.resize(0x20000);
+            for (std::size_t j = 0; j < logContainer0.uncompressedFile.size(); j++)
+                logContainer0.uncompressedFile[j] = static_cast<uint8_t>(j ^ (j >> 8));
+            logContainer0.uncompressedFileSize = static_cast<uint32_t>(logContainer0.uncompressedFile.size());
+            logContainer0.compress(2, 6);
+            BOOST_CHECK(logContainer0.compressedFile == compressedFile);
+        }
+
+        /* uncompress LogContainer */
+        logContainer.uncompressedFile.clear();
+        logContainer.uncompress();
+        BOOST_CHECK(logContainer.uncompressedFile == uncompressedFile);
+    }
+
+    /* a failed uncompress doesn't affect the next one */
+    Vector::BLF::LogContainer logContainer;
+    logContainer.uncompressedFile.assign(256, 0x55);
+    logContainer.uncompressedFileSize = 256;
+    logContainer.compress(2, 6);
+    logContainer.compressedFile.resize(logContainer.compressedFile.size() / 2);
+    logContainer.compressedFileSize = static_cast<uint32_t>(logContainer.compressedFile.size());
+    BOOST_CHECK_THROW(logContainer.uncompress(), Vector::BLF::Exception);
+    logContainer.compress(2, 6);
+    logContainer.uncompress();
+    BOOST_CHECK(logContainer.uncompressedFile == std::vector<uint8_t>(256, 0x55));
+}
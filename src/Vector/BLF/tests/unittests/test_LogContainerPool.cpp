@@ -0,0 +1,90 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#define BOOST_TEST_MODULE LogContainerPool
+#if !defined(WIN32)
+#define BOOST_TEST_DYN_LINK
+#endif
+#include <boost/test/unit_test.hpp>
+
+#include <Vector/BLF.h>
+
+/** Released LogContainers are reset and reused. */
+BOOST_AUTO_TEST_CASE(CreateRecycle) {
+    Vector::BLF::LogContainerPool logContainerPool;
+    BOOST_CHECK_EQUAL(logContainerPool.size(), 0);
+
+    /* create new LogContainer */
+    std::shared_ptr<Vector::BLF::LogContainer> logContainer = logContainerPool.create();
+    BOOST_REQUIRE(logContainer);
+    Vector::BLF::LogContainer * address = logContainer.get();
+    logContainer->uncompressedFileSize = 0x20000;
+    logContainer->uncompressedFile.resize(0x20000);
+    const uint8_t * uncompressedFile = logContainer->uncompressedFile.data();
+
+    /* release it */
+    logContainer.reset();
+    BOOST_CHECK_EQUAL(logContainerPool.size(), 1);
+
+    /* reuse it, with default values, but memory kept */
+    logContainer = logContainerPool.create();
+    BOOST_CHECK(logContainer.get() == address);
+    BOOST_CHECK_EQUAL(logContainerPool.size(), 0);
+    BOOST_CHECK_EQUAL(logContainer->uncompressedFileSize, 0);
+    BOOST_CHECK(logContainer->uncompressedFile.empty());
+    logContainer->uncompressedFile.resize(0x20000);
+    BOOST_CHECK(logContainer->uncompressedFile.data() == uncompressedFile);
+}
+
+/** Compressed buffers are dropped after inflation and passed to the next LogContainer. */
+BOOST_AUTO_TEST_CASE(ReleaseCompressedFile) {
+    Vector::BLF::LogContainerPool logContainerPool;
+
+    /* inflated LogContainer */
+    std::shared_ptr<Vector::BLF::LogContainer> logContainer1 = logContainerPool.create();
+    logContainer1->compressedFile.resize(0x1000);
+    const uint8_t * compressedFile = logContainer1->compressedFile.data();
+    logContainerPool.releaseCompressedFile(*logContainer1);
+    BOOST_CHECK(logContainer1->compressedFile.empty());
+    BOOST_CHECK_EQUAL(logContainer1->compressedFile.capacity(), 0);
+    BOOST_CHECK(logContainer1->compressedFileView == nullptr);
+
+    /* next LogContainer reuses the compressed buffer */
+    std::shared_ptr<Vector::BLF::LogContainer> logContainer2 = logContainerPool.create();
+    BOOST_CHECK(logContainer2->compressedFile.empty());
+    BOOST_CHECK_GE(logContainer2->compressedFile.capacity(), 0x1000);
+    logContainer2->compressedFile.resize(0x1000);
+    BOOST_CHECK(logContainer2->compressedFile.data() == compressedFile);
+}
+
+/** The pool doesn't keep more LogContainers than allowed, and can be released before them. */
+BOOST_AUTO_TEST_CASE(MaxSize) {
+    std::vector<std::shared_ptr<Vector::BLF::LogContainer>> logContainers;
+    {
+        Vector::BLF::LogContainerPool logContainerPool;
+        logContainerPool.setMaxSize(2);
+        BOOST_CHECK_EQUAL(logContainerPool.maxSize(), 2);
+
+        /* keep two LogContainers */
+        for (int i = 0; i < 3; ++i)
+            logContainers.push_back(logContainerPool.create());
+        logContainers.clear();
+        BOOST_CHECK_EQUAL(logContainerPool.size(), 2);
+
+        /* reduce */
+        logContainerPool.setMaxSize(1);
+        BOOST_CHECK_EQUAL(logContainerPool.size(), 1);
+
+        /* disable */
+        logContainerPool.setMaxSize(0);
+        BOOST_CHECK_EQUAL(logContainerPool.size(), 0);
+        logContainerPool.create();
+        BOOST_CHECK_EQUAL(logContainerPool.size(), 0);
+
+        /* LogContainers outliving the pool */
+        logContainerPool.setMaxSize(16);
+        logContainers.push_back(logContainerPool.create());
+    }
+    logContainers.clear();
+}
@@ -0,0 +1,71 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#define BOOST_TEST_MODULE LogContainerThreadPool
+#if !defined(WIN32)
+#define BOOST_TEST_DYN_LINK
+#endif
+#include <boost/test/unit_test.hpp>
+#include <boost/filesystem.hpp>
+
+#include <Vector/BLF.h>
+
+/** create a compressed LogContainer with recognizable content */
+static std::shared_ptr<Vector::BLF::LogContainer> createLogContainer(uint8_t value) {
+    std::shared_ptr<Vector::BLF::LogContainer> logContainer(new Vector::BLF::LogContainer);
+    logContainer->uncompressedFile.resize(256 + value);
+    for (uint16_t i = 0; i < logContainer->uncompressedFile.size(); i++)
+        logContainer->uncompressedFile[i] = value;
+    logContainer->uncompressedFileSize = static_cast<uint32_t>(logContainer->uncompressedFile.size());
+    logContainer->compress(2, 6); // ZLib compression with default compressionLevel
+    logContainer->uncompressedFile.clear();
+    return logContainer;
+}
+
+/** inflate several LogContainers in parallel and check that the order is kept */
+BOOST_AUTO_TEST_CASE(InflateInOrder) {
+    Vector::BLF::LogContainerThreadPool threadPool;
+    threadPool.start(4, [](Vector::BLF::LogContainer & logContainer) {
+        logContainer.uncompress();
+    });
+    BOOST_CHECK_EQUAL(threadPool.threads(), 4);
+
+    /* empty pool */
+    BOOST_CHECK_EQUAL(threadPool.size(), 0);
+    BOOST_CHECK(threadPool.read() == nullptr);
+
+    /* enqueue log containers */
+    for (uint8_t i = 0; i < 32; i++)
+        threadPool.write(createLogContainer(i));
+    BOOST_CHECK_EQUAL(threadPool.size(), 32);
+
+    /* dequeue log containers */
+    for (uint8_t i = 0; i < 32; i++) {
+        std::shared_ptr<Vector::BLF::LogContainer> logContainer = threadPool.read();
+        BOOST_REQUIRE(logContainer);
+        BOOST_CHECK_EQUAL(logContainer->uncompressedFile.size(), 256 + i);
+        BOOST_CHECK_EQUAL(logContainer->uncompressedFile[0], i);
+    }
+    BOOST_CHECK_EQUAL(threadPool.size(), 0);
+
+    threadPool.stop();
+    BOOST_CHECK_EQUAL(threadPool.threads(), 0);
+}
+
+/** check that an exception in a worker thread is forwarded to the reader */
+BOOST_AUTO_TEST_CASE(ForwardException) {
+    Vector::BLF::LogContainerThreadPool threadPool;
+    threadPool.start(2, [](Vector::BLF::LogContainer & logContainer) {
+        logContainer.uncompress();
+    });
+
+    /* second log container has an unknown compression method */
+    threadPool.write(createLogContainer(1));
+    std::shared_ptr<Vector::BLF::LogContainer> logContainer = createLogContainer(2);
+    logContainer->compressionMethod = 123;
+    threadPool.write(logContainer);
+
+    BOOST_CHECK(threadPool.read());
+    BOOST_CHECK_THROW(threadPool.read(), Vector::BLF::Exception);
+}
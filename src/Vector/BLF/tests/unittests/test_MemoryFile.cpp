@@ -0,0 +1,103 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#define BOOST_TEST_MODULE MemoryFile
+#if !defined(WIN32)
+#define BOOST_TEST_DYN_LINK
+#endif
+#include <boost/test/unit_test.hpp>
+
+#include <cstring>
+#include <vector>
+
+#include <Vector/BLF.h>
+
+/** Test read operations on a memory block. */
+BOOST_AUTO_TEST_CASE(ReadTest) {
+    Vector::BLF::MemoryFile memoryFile;
+
+    /* checks after initialize */
+    BOOST_CHECK_EQUAL(memoryFile.gcount(), 0);
+    BOOST_CHECK_EQUAL(memoryFile.tellg(), -1);
+    BOOST_CHECK_EQUAL(memoryFile.tellp(), -1);
+    BOOST_CHECK(!memoryFile.eof());
+    BOOST_CHECK(!memoryFile.is_open());
+
+    /* open memory */
+    const char data[] = "LOGG0123456789";
+    memoryFile.open(data, 14);
+    BOOST_CHECK_EQUAL(memoryFile.tellg(), 0);
+    BOOST_CHECK(memoryFile.is_open());
+    BOOST_CHECK_EQUAL(memoryFile.fileSize(), 14);
+
+    /* read some data */
+    char signature[5] = { 0, 0, 0, 0, 0 }; // including null termination
+    memoryFile.read(signature, 4);
+    BOOST_CHECK_EQUAL(signature, "LOGG");
+    BOOST_CHECK_EQUAL(memoryFile.tellg(), 4);
+    BOOST_CHECK_EQUAL(memoryFile.gcount(), 4);
+
+    /* view data without copying */
+    const char * view = memoryFile.readView(4);
+    BOOST_CHECK(view == data + 4);
+    BOOST_CHECK_EQUAL(memoryFile.tellg(), 8);
+
+    /* view behind eof is not possible */
+    BOOST_CHECK(memoryFile.readView(memoryFile.fileSize()) == nullptr);
+    BOOST_CHECK_EQUAL(memoryFile.tellg(), 8);
+
+    /* read behind eof */
+    memoryFile.seekg(-2, std::ios_base::end);
+    memoryFile.read(signature, 4);
+    BOOST_CHECK_EQUAL(memoryFile.gcount(), 2);
+    BOOST_CHECK(memoryFile.eof());
+    BOOST_CHECK(!memoryFile.good());
+
+    /* write is not possible */
+    memoryFile.clear();
+    memoryFile.write(signature, 4);
+    BOOST_CHECK(!memoryFile.good());
+
+    /* close file, memory is still there */
+    memoryFile.close();
+    BOOST_CHECK(!memoryFile.is_open());
+    BOOST_CHECK(std::memcmp(data, "LOGG", 4) == 0);
+}
+
+/** Test write operations into a vector. */
+BOOST_AUTO_TEST_CASE(WriteTest) {
+    Vector::BLF::MemoryFile memoryFile;
+
+    /* open vector, which is cleared */
+    std::vector<char> data { 'x', 'y' };
+    memoryFile.open(data);
+    BOOST_CHECK(memoryFile.is_open());
+    BOOST_CHECK(data.empty());
+    BOOST_CHECK_EQUAL(memoryFile.tellp(), 0);
+
+    /* write some data */
+    memoryFile.write("LOGG", 4);
+    memoryFile.write("0123", 4);
+    BOOST_CHECK_EQUAL(memoryFile.tellp(), 8);
+    BOOST_CHECK_EQUAL(memoryFile.fileSize(), 8);
+    BOOST_CHECK_EQUAL(data.size(), 8);
+
+    /* overwrite data */
+    memoryFile.seekp(4);
+    memoryFile.write("ab", 2);
+    BOOST_CHECK_EQUAL(memoryFile.tellp(), 6);
+    BOOST_CHECK_EQUAL(data.size(), 8);
+    BOOST_CHECK(std::memcmp(data.data(), "LOGGab23", 8) == 0);
+
+    /* read written data */
+    char signature[5] = { 0, 0, 0, 0, 0 }; // including null termination
+    memoryFile.read(signature, 4);
+    BOOST_CHECK_EQUAL(signature, "LOGG");
+    BOOST_CHECK(memoryFile.good());
+
+    /* close file, data stays in vector */
+    memoryFile.close();
+    BOOST_CHECK(!memoryFile.is_open());
+    BOOST_CHECK_EQUAL(data.size(), 8);
+}
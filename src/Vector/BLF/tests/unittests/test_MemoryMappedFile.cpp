@@ -0,0 +1,70 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#define BOOST_TEST_MODULE MemoryMappedFile
+#if !defined(WIN32)
+#define BOOST_TEST_DYN_LINK
+#endif
+#include <boost/test/unit_test.hpp>
+#include <boost/filesystem.hpp>
+
+#include <cstring>
+
+#include <Vector/BLF.h>
+
+/** Test read operations on a blf file. */
+BOOST_AUTO_TEST_CASE(ReadTest) {
+    Vector::BLF::MemoryMappedFile memoryMappedFile;
+
+    /* checks after initialize */
+    BOOST_CHECK_EQUAL(memoryMappedFile.gcount(), 0);
+    BOOST_CHECK_EQUAL(memoryMappedFile.tellg(), -1);
+    BOOST_CHECK_EQUAL(memoryMappedFile.tellp(), -1);
+    BOOST_CHECK(!memoryMappedFile.eof());
+    BOOST_CHECK(!memoryMappedFile.is_open());
+
+    /* open file */
+    memoryMappedFile.open(CMAKE_CURRENT_SOURCE_DIR "/events_from_binlog/test_CanMessage.blf");
+    BOOST_CHECK_EQUAL(memoryMappedFile.tellg(), 0);
+    BOOST_CHECK(memoryMappedFile.is_open());
+    BOOST_CHECK_EQUAL(memoryMappedFile.fileSize(), static_cast<std::streamsize>(boost::filesystem::file_size(CMAKE_CURRENT_SOURCE_DIR "/events_from_binlog/test_CanMessage.blf")));
+
+    /* read some data */
+    char signature[5] = { 0, 0, 0, 0, 0 }; // including null termination
+    memoryMappedFile.read(signature, 4);
+    BOOST_CHECK_EQUAL(signature, "LOGG");
+    BOOST_CHECK_EQUAL(memoryMappedFile.tellg(), 4);
+    BOOST_CHECK_EQUAL(memoryMappedFile.gcount(), 4);
+
+    /* rewind to beginning of file */
+    memoryMappedFile.seekg(0, std::ios_base::beg);
+    BOOST_CHECK_EQUAL(memoryMappedFile.tellg(), 0);
+
+    /* view data without copying */
+    const char * view = memoryMappedFile.readView(4);
+    BOOST_REQUIRE(view != nullptr);
+    BOOST_CHECK(std::memcmp(view, "LOGG", 4) == 0);
+    BOOST_CHECK_EQUAL(memoryMappedFile.tellg(), 4);
+    BOOST_CHECK_EQUAL(memoryMappedFile.gcount(), 4);
+
+    /* view behind eof is not possible */
+    BOOST_CHECK(memoryMappedFile.readView(memoryMappedFile.fileSize()) == nullptr);
+    BOOST_CHECK_EQUAL(memoryMappedFile.tellg(), 4);
+
+    /* read behind eof */
+    memoryMappedFile.seekg(-2, std::ios_base::end);
+    memoryMappedFile.read(signature, 4);
+    BOOST_CHECK_EQUAL(memoryMappedFile.gcount(), 2);
+    BOOST_CHECK(memoryMappedFile.eof());
+    BOOST_CHECK(!memoryMappedFile.good());
+
+    /* write is not possible */
+    memoryMappedFile.seekg(0, std::ios_base::beg);
+    memoryMappedFile.write(signature, 4);
+    BOOST_CHECK(!memoryMappedFile.good());
+
+    /* close file */
+    memoryMappedFile.close();
+    BOOST_CHECK(!memoryMappedFile.is_open());
+}
@@ -0,0 +1,75 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#define BOOST_TEST_MODULE ObjectBuffer
+#if !defined(WIN32)
+#define BOOST_TEST_DYN_LINK
+#endif
+#include <boost/test/unit_test.hpp>
+
+#include <Vector/BLF.h>
+
+/** Encode an object into the buffer and decode it again. */
+BOOST_AUTO_TEST_CASE(WriteRead) {
+    Vector::BLF::ObjectBuffer objectBuffer;
+
+    /* encode */
+    Vector::BLF::CanFdMessage64 canFdMessage64;
+    canFdMessage64.channel = 3;
+    canFdMessage64.id = 0x123;
+    canFdMessage64.validDataBytes = 12;
+    canFdMessage64.data.assign(12, 0xAA);
+    canFdMessage64.objectSize = canFdMessage64.calculateObjectSize();
+    canFdMessage64.write(objectBuffer);
+    BOOST_CHECK_EQUAL(objectBuffer.size(), canFdMessage64.objectSize + canFdMessage64.objectSize % 4);
+    BOOST_CHECK_EQUAL(objectBuffer.tellp(), objectBuffer.size());
+
+    /* decode */
+    Vector::BLF::CanFdMessage64 canFdMessage64Read;
+    canFdMessage64Read.read(objectBuffer);
+    BOOST_CHECK(objectBuffer.good());
+    BOOST_CHECK_EQUAL(objectBuffer.tellg(), objectBuffer.size());
+    BOOST_CHECK_EQUAL(canFdMessage64Read.channel, 3);
+    BOOST_CHECK_EQUAL(canFdMessage64Read.id, 0x123);
+    BOOST_CHECK(canFdMessage64Read.data == canFdMessage64.data);
+
+    /* read behind end of data */
+    char c;
+    objectBuffer.read(&c, 1);
+    BOOST_CHECK_EQUAL(objectBuffer.gcount(), 0);
+    BOOST_CHECK(objectBuffer.eof());
+    BOOST_CHECK(!objectBuffer.good());
+
+    /* clear keeps nothing but the memory */
+    objectBuffer.clear();
+    BOOST_CHECK_EQUAL(objectBuffer.size(), 0);
+    BOOST_CHECK(objectBuffer.good());
+}
+
+/** Transfer data in one block from and to other files. */
+BOOST_AUTO_TEST_CASE(LoadSave) {
+    Vector::BLF::ObjectBuffer source;
+    source.write("abcdefgh", 8);
+
+    /* load part of the data */
+    Vector::BLF::ObjectBuffer objectBuffer;
+    objectBuffer.load(source, 5);
+    BOOST_CHECK_EQUAL(objectBuffer.size(), 5);
+    BOOST_CHECK_EQUAL(std::string(objectBuffer.data(), 5), "abcde");
+    BOOST_CHECK(objectBuffer.readView(2) != nullptr);
+    BOOST_CHECK_EQUAL(objectBuffer.tellg(), 2);
+    BOOST_CHECK(objectBuffer.readView(4) == nullptr);
+    objectBuffer.seekg(0, std::ios_base::beg);
+    BOOST_CHECK_EQUAL(objectBuffer.tellg(), 0);
+
+    /* load behind end of data */
+    objectBuffer.load(source, 5);
+    BOOST_CHECK_EQUAL(objectBuffer.size(), 3);
+    BOOST_CHECK(source.eof());
+
+    /* save */
+    Vector::BLF::ObjectBuffer destination;
+    objectBuffer.save(destination);
+    BOOST_CHECK_EQUAL(std::string(destination.data(), 3), "fgh");
+}
@@ -0,0 +1,134 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#define BOOST_TEST_MODULE ObjectFilter
+#if !defined(WIN32)
+#define BOOST_TEST_DYN_LINK
+#endif
+#include <boost/test/unit_test.hpp>
+
+#include <Vector/BLF.h>
+
+#include "TestFiles.h"
+
+/** Check single objects against the filter criteria. */
+BOOST_AUTO_TEST_CASE(MatchObjects) {
+    Vector::BLF::CanMessage canMessage;
+    canMessage.channel = 2;
+    canMessage.objectTimeStamp = 1000;
+    Vector::BLF::AppText appText;
+
+    /* empty filter selects everything */
+    Vector::BLF::ObjectFilter objectFilter;
+    BOOST_CHECK(objectFilter.empty());
+    BOOST_CHECK(objectFilter.matches(&canMessage));
+    BOOST_CHECK(objectFilter.matches(&appText));
+
+    /* object types */
+    objectFilter.objectTypes.insert(Vector::BLF::ObjectType::CAN_MESSAGE);
+    BOOST_CHECK(!objectFilter.empty());
+    BOOST_CHECK(objectFilter.matches(&canMessage));
+    BOOST_CHECK(!objectFilter.matches(&appText));
+    objectFilter.objectTypes.clear();
+
+    /* channels, objects without channel are not selected */
+    objectFilter.channels.emplace_back(2, 4);
+    BOOST_CHECK(objectFilter.matches(&canMessage));
+    BOOST_CHECK(!objectFilter.matches(&appText));
+    BOOST_CHECK(!objectFilter.matchesChannel(1));
+    BOOST_CHECK(objectFilter.matchesChannel(4));
+    BOOST_CHECK(!objectFilter.matchesChannel(5));
+    objectFilter.channels.clear();
+
+    /* time window */
+    objectFilter.minTimeStamp = 1000;
+    objectFilter.maxTimeStamp = 2000;
+    BOOST_CHECK(objectFilter.hasTimeWindow());
+    BOOST_CHECK(objectFilter.matches(&canMessage));
+    canMessage.objectTimeStamp = 2001;
+    BOOST_CHECK(!objectFilter.matches(&canMessage));
+}
+
+/** Channels are only taken from objects, whose class matches the object type. */
+BOOST_AUTO_TEST_CASE(ChannelOfChangedObjectType) {
+    Vector::BLF::CanMessage canMessage;
+    canMessage.channel = 2;
+    BOOST_CHECK_EQUAL(Vector::BLF::File::objectChannel(&canMessage), 2);
+
+    /* objects without channel */
+    Vector::BLF::AppText appText;
+    BOOST_CHECK_EQUAL(Vector::BLF::File::objectChannel(&appText), 0);
+
+    /* object type doesn't match the class */
+    appText.objectType = Vector::BLF::ObjectType::CAN_MESSAGE;
+    BOOST_CHECK_EQUAL(Vector::BLF::File::objectChannel(&appText), 0);
+    Vector::BLF::ObjectFilter objectFilter;
+    objectFilter.channels.emplace_back(0, 4);
+    BOOST_CHECK(!objectFilter.matches(&appText));
+}
+
+/** Check LogContainer summaries against the filter criteria. */
+BOOST_AUTO_TEST_CASE(MatchFileIndexEntries) {
+    Vector::BLF::FileIndexEntry fileIndexEntry;
+    fileIndexEntry.minTimeStamp = 1000;
+    fileIndexEntry.maxTimeStamp = 2000;
+    fileIndexEntry.objectCounts[Vector::BLF::ObjectType::CAN_MESSAGE] = 10;
+    fileIndexEntry.channels.insert(1);
+
+    Vector::BLF::ObjectFilter objectFilter;
+    BOOST_CHECK(objectFilter.matches(fileIndexEntry));
+
+    objectFilter.objectTypes.insert(Vector::BLF::ObjectType::LIN_MESSAGE);
+    BOOST_CHECK(!objectFilter.matches(fileIndexEntry));
+    objectFilter.objectTypes.insert(Vector::BLF::ObjectType::CAN_MESSAGE);
+    BOOST_CHECK(objectFilter.matches(fileIndexEntry));
+
+    objectFilter.channels.emplace_back(2, 2);
+    BOOST_CHECK(!objectFilter.matches(fileIndexEntry));
+    objectFilter.channels.emplace_back(1, 1);
+    BOOST_CHECK(objectFilter.matches(fileIndexEntry));
+
+    objectFilter.minTimeStamp = 2001;
+    BOOST_CHECK(!objectFilter.matches(fileIndexEntry));
+    objectFilter.minTimeStamp = 1500;
+    objectFilter.maxTimeStamp = 1600;
+    BOOST_CHECK(objectFilter.matches(fileIndexEntry));
+    objectFilter.maxTimeStamp = 999;
+    BOOST_CHECK(!objectFilter.matches(fileIndexEntry));
+}
+
+/** Read only the selected objects, with and without file index. */
+BOOST_AUTO_TEST_CASE(ReadFiltered) {
+    writeCanLinFile(CMAKE_CURRENT_BINARY_DIR "/test_ObjectFilter.blf");
+
+    Vector::BLF::FileIndex fileIndex;
+    fileIndex.build(CMAKE_CURRENT_BINARY_DIR "/test_ObjectFilter.blf");
+
+    for (bool withFileIndex : { false, true }) {
+        Vector::BLF::File filein;
+        if (withFileIndex)
+            filein.fileIndex = fileIndex;
+        filein.objectFilter.objectTypes.insert(Vector::BLF::ObjectType::CAN_MESSAGE);
+        filein.objectFilter.channels.emplace_back(2, 2);
+        filein.objectFilter.minTimeStamp = 1000 * 1000000ULL;
+        filein.objectFilter.maxTimeStamp = 2000 * 1000000ULL - 1;
+        filein.open(CMAKE_CURRENT_BINARY_DIR "/test_ObjectFilter.blf", std::ios_base::in);
+        BOOST_REQUIRE(filein.is_open());
+
+        /* only CAN messages on channel 2 within the time window */
+        uint32_t canMessages = 0;
+        Vector::BLF::ObjectHeaderBase * ohb;
+        while ((ohb = filein.read()) != nullptr) {
+            BOOST_REQUIRE(ohb->objectType == Vector::BLF::ObjectType::CAN_MESSAGE);
+            auto * canMessage = static_cast<Vector::BLF::CanMessage *>(ohb);
+            BOOST_CHECK_EQUAL(canMessage->channel, 2);
+            BOOST_CHECK_GE(canMessage->id, 1000);
+            BOOST_CHECK_LT(canMessage->id, 2000);
+            canMessages++;
+            filein.recycle(ohb);
+        }
+        BOOST_CHECK_EQUAL(canMessages, 500);
+        filein.close();
+    }
+}
@@ -0,0 +1,92 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#define BOOST_TEST_MODULE ObjectPool
+#if !defined(WIN32)
+#define BOOST_TEST_DYN_LINK
+#endif
+#include <boost/test/unit_test.hpp>
+
+#include <Vector/BLF.h>
+
+/** Recycled objects are reset and reused. */
+BOOST_AUTO_TEST_CASE(CreateRecycle) {
+    Vector::BLF::ObjectPool objectPool;
+    BOOST_CHECK_EQUAL(objectPool.size(), 0);
+
+    /* unknown object types */
+    BOOST_CHECK(objectPool.create(Vector::BLF::ObjectType::UNKNOWN) == nullptr);
+    objectPool.recycle(nullptr);
+
+    /* create new object */
+    auto * canFdMessage64 = static_cast<Vector::BLF::CanFdMessage64 *>(objectPool.create(Vector::BLF::ObjectType::CAN_FD_MESSAGE_64));
+    BOOST_REQUIRE(canFdMessage64);
+    BOOST_CHECK(canFdMessage64->objectType == Vector::BLF::ObjectType::CAN_FD_MESSAGE_64);
+    canFdMessage64->channel = 5;
+    canFdMessage64->data.resize(64);
+    const uint8_t * data = canFdMessage64->data.data();
+
+    /* recycle it */
+    objectPool.recycle(canFdMessage64);
+    BOOST_CHECK_EQUAL(objectPool.size(), 1);
+
+    /* reuse it, with default values, but memory kept */
+    BOOST_CHECK(objectPool.create(Vector::BLF::ObjectType::CAN_FD_MESSAGE_64) == canFdMessage64);
+    BOOST_CHECK_EQUAL(objectPool.size(), 0);
+    BOOST_CHECK_EQUAL(canFdMessage64->channel, 0);
+    BOOST_CHECK(canFdMessage64->data.empty());
+    BOOST_CHECK_GE(canFdMessage64->data.capacity(), 64);
+    canFdMessage64->data.resize(64);
+    BOOST_CHECK(canFdMessage64->data.data() == data);
+    delete canFdMessage64;
+
+    /* object type of classes used for several object types */
+    objectPool.recycle(objectPool.create(Vector::BLF::ObjectType::ENV_DOUBLE));
+    Vector::BLF::ObjectHeaderBase * ohb = objectPool.create(Vector::BLF::ObjectType::ENV_DOUBLE);
+    BOOST_REQUIRE(ohb);
+    BOOST_CHECK(ohb->objectType == Vector::BLF::ObjectType::ENV_DOUBLE);
+    delete ohb;
+}
+
+/** The pool doesn't keep more objects than allowed. */
+BOOST_AUTO_TEST_CASE(MaxSize) {
+    Vector::BLF::ObjectPool objectPool;
+    objectPool.setMaxSize(2);
+    BOOST_CHECK_EQUAL(objectPool.maxSize(), 2);
+
+    /* keep two objects per object type */
+    for (int i = 0; i < 3; ++i) {
+        objectPool.recycle(new Vector::BLF::CanMessage);
+        objectPool.recycle(new Vector::BLF::LinMessage);
+    }
+    BOOST_CHECK_EQUAL(objectPool.size(), 4);
+
+    /* reduce */
+    objectPool.setMaxSize(1);
+    BOOST_CHECK_EQUAL(objectPool.size(), 2);
+
+    /* disable */
+    objectPool.setMaxSize(0);
+    BOOST_CHECK_EQUAL(objectPool.size(), 0);
+    objectPool.recycle(new Vector::BLF::CanMessage);
+    BOOST_CHECK_EQUAL(objectPool.size(), 0);
+}
+
+/** Objects, whose object type was changed, are not kept. */
+BOOST_AUTO_TEST_CASE(ChangedObjectType) {
+    Vector::BLF::ObjectPool objectPool;
+
+    /* the class doesn't match the object type */
+    auto * canMessage = new Vector::BLF::CanMessage;
+    canMessage->objectType = Vector::BLF::ObjectType::CAN_FD_MESSAGE_64;
+    BOOST_CHECK(!Vector::BLF::ObjectPool::reset(canMessage));
+    objectPool.recycle(canMessage);
+    BOOST_CHECK_EQUAL(objectPool.size(), 0);
+
+    /* so it's not returned as the wrong class */
+    Vector::BLF::ObjectHeaderBase * ohb = objectPool.create(Vector::BLF::ObjectType::CAN_FD_MESSAGE_64);
+    BOOST_REQUIRE(ohb);
+    BOOST_CHECK(dynamic_cast<Vector::BLF::CanFdMessage64 *>(ohb) != nullptr);
+    delete ohb;
+}
@@ -0,0 +1,86 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#define BOOST_TEST_MODULE ObjectVisitor
+#if !defined(WIN32)
+#define BOOST_TEST_DYN_LINK
+#endif
+#include <boost/test/unit_test.hpp>
+
+#include <Vector/BLF.h>
+
+/** visitor for some object classes */
+struct CanVisitor {
+    unsigned int canMessages {0};
+    unsigned int environmentVariables {0};
+
+    void operator()(Vector::BLF::CanMessage & /*canMessage*/) {
+        canMessages++;
+    }
+
+    void operator()(Vector::BLF::EnvironmentVariable & /*environmentVariable*/) {
+        environmentVariables++;
+    }
+};
+
+/** visitor for all object classes */
+struct AllVisitor {
+    unsigned int canMessages {0};
+    unsigned int objects {0};
+
+    void operator()(Vector::BLF::CanMessage & /*canMessage*/) {
+        canMessages++;
+    }
+
+    void operator()(Vector::BLF::ObjectHeaderBase & /*ohb*/) {
+        objects++;
+    }
+};
+
+/** Object types are handled according to the overloads. */
+BOOST_AUTO_TEST_CASE(Handles) {
+    BOOST_CHECK(Vector::BLF::ObjectVisitor<CanVisitor>::handles(Vector::BLF::ObjectType::CAN_MESSAGE));
+    BOOST_CHECK(Vector::BLF::ObjectVisitor<CanVisitor>::handles(Vector::BLF::ObjectType::ENV_INTEGER));
+    BOOST_CHECK(Vector::BLF::ObjectVisitor<CanVisitor>::handles(Vector::BLF::ObjectType::ENV_DATA));
+    BOOST_CHECK(!Vector::BLF::ObjectVisitor<CanVisitor>::handles(Vector::BLF::ObjectType::CAN_MESSAGE2));
+    BOOST_CHECK(!Vector::BLF::ObjectVisitor<CanVisitor>::handles(Vector::BLF::ObjectType::MOST_STATISTIC));
+    BOOST_CHECK(!Vector::BLF::ObjectVisitor<CanVisitor>::handles(Vector::BLF::ObjectType::UNKNOWN));
+
+    BOOST_CHECK(Vector::BLF::ObjectVisitor<AllVisitor>::handles(Vector::BLF::ObjectType::CAN_MESSAGE));
+    BOOST_CHECK(Vector::BLF::ObjectVisitor<AllVisitor>::handles(Vector::BLF::ObjectType::MOST_STATISTIC));
+    BOOST_CHECK(!Vector::BLF::ObjectVisitor<AllVisitor>::handles(Vector::BLF::ObjectType::UNKNOWN));
+}
+
+/** Objects are passed to the most specific overload. */
+BOOST_AUTO_TEST_CASE(Visit) {
+    Vector::BLF::CanMessage canMessage;
+    Vector::BLF::EnvironmentVariable environmentVariable;
+    environmentVariable.objectType = Vector::BLF::ObjectType::ENV_STRING;
+    Vector::BLF::MostStatistic mostStatistic;
+
+    CanVisitor canVisitor;
+    BOOST_CHECK(Vector::BLF::ObjectVisitor<CanVisitor>::visit(canVisitor, &canMessage));
+    BOOST_CHECK(Vector::BLF::ObjectVisitor<CanVisitor>::visit(canVisitor, &environmentVariable));
+    BOOST_CHECK(!Vector::BLF::ObjectVisitor<CanVisitor>::visit(canVisitor, &mostStatistic));
+    BOOST_CHECK_EQUAL(canVisitor.canMessages, 1);
+    BOOST_CHECK_EQUAL(canVisitor.environmentVariables, 1);
+
+    AllVisitor allVisitor;
+    BOOST_CHECK(Vector::BLF::ObjectVisitor<AllVisitor>::visit(allVisitor, &canMessage));
+    BOOST_CHECK(Vector::BLF::ObjectVisitor<AllVisitor>::visit(allVisitor, &environmentVariable));
+    BOOST_CHECK(Vector::BLF::ObjectVisitor<AllVisitor>::visit(allVisitor, &mostStatistic));
+    BOOST_CHECK_EQUAL(allVisitor.canMessages, 1);
+    BOOST_CHECK_EQUAL(allVisitor.objects, 2);
+}
+
+/** Objects, whose class doesn't match the object type, are not passed. */
+BOOST_AUTO_TEST_CASE(ChangedObjectType) {
+    Vector::BLF::CanMessage canMessage;
+    canMessage.objectType = Vector::BLF::ObjectType::ENV_INTEGER;
+
+    CanVisitor canVisitor;
+    BOOST_CHECK(!Vector::BLF::ObjectVisitor<CanVisitor>::visit(canVisitor, &canMessage));
+    BOOST_CHECK_EQUAL(canVisitor.canMessages, 0);
+    BOOST_CHECK_EQUAL(canVisitor.environmentVariables, 0);
+}
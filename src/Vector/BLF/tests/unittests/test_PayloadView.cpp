@@ -0,0 +1,55 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#define BOOST_TEST_MODULE PayloadView
+#if !defined(WIN32)
+#define BOOST_TEST_DYN_LINK
+#endif
+#include <boost/test/unit_test.hpp>
+
+#include <memory>
+#include <vector>
+
+#include <Vector/BLF.h>
+
+/** The view keeps its storage alive and copies on request. */
+BOOST_AUTO_TEST_CASE(CopyReset) {
+    Vector::BLF::PayloadView view;
+    BOOST_CHECK(view.data() == nullptr);
+    BOOST_CHECK(view.empty());
+
+    /* view on storage */
+    auto storage = std::make_shared<std::vector<uint8_t>>(std::vector<uint8_t> { 1, 2, 3, 4 });
+    std::weak_ptr<std::vector<uint8_t>> weakStorage = storage;
+    view = Vector::BLF::PayloadView(storage, storage->data() + 1, 2);
+    storage.reset();
+    BOOST_CHECK(!weakStorage.expired());
+    BOOST_CHECK_EQUAL(view.size(), 2);
+    BOOST_CHECK(!view.empty());
+
+    /* copy */
+    std::vector<uint8_t> data;
+    view.copyTo(data);
+    BOOST_CHECK(data == std::vector<uint8_t>({ 2, 3 }));
+
+    /* release storage */
+    view.reset();
+    BOOST_CHECK(weakStorage.expired());
+    BOOST_CHECK(view.data() == nullptr);
+    BOOST_CHECK_EQUAL(view.size(), 0);
+}
+
+/** Owned data takes precedence over the view. */
+BOOST_AUTO_TEST_CASE(DataOfSizeOf) {
+    auto storage = std::make_shared<std::vector<uint8_t>>(std::vector<uint8_t> { 1, 2, 3 });
+    Vector::BLF::PayloadView view(storage, storage->data(), storage->size());
+
+    std::vector<uint8_t> data;
+    BOOST_CHECK(Vector::BLF::PayloadView::dataOf(data, view) == storage->data());
+    BOOST_CHECK_EQUAL(Vector::BLF::PayloadView::sizeOf(data, view), 3);
+
+    data = { 4, 5 };
+    BOOST_CHECK(Vector::BLF::PayloadView::dataOf(data, view) == data.data());
+    BOOST_CHECK_EQUAL(Vector::BLF::PayloadView::sizeOf(data, view), 2);
+}
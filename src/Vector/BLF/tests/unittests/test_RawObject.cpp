@@ -0,0 +1,160 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#define BOOST_TEST_MODULE RawObject
+#if !defined(WIN32)
+#define BOOST_TEST_DYN_LINK
+#endif
+#include <boost/test/unit_test.hpp>
+
+#include <memory>
+
+#include <Vector/BLF.h>
+
+/** object type not known to the library */
+static const Vector::BLF::ObjectType unknownObjectType = static_cast<Vector::BLF::ObjectType>(200);
+
+/** Write a file with known and unknown object types. */
+static void writeFile(const char * filename) {
+    Vector::BLF::File fileout;
+    fileout.open(filename, std::ios_base::out);
+    BOOST_REQUIRE(fileout.is_open());
+
+    auto * canMessage = new Vector::BLF::CanMessage;
+    canMessage->channel = 3;
+    canMessage->objectTimeStamp = 1000;
+    fileout.write(canMessage);
+
+    /* unknown object with ObjectHeader, written as raw object */
+    Vector::BLF::ObjectHeader objectHeader(unknownObjectType);
+    objectHeader.objectTimeStamp = 2000;
+    Vector::BLF::ObjectBuffer objectBuffer;
+    objectHeader.write(objectBuffer);
+    auto * rawObject = new Vector::BLF::RawObject;
+    rawObject->read(objectBuffer);
+    rawObject->data.push_back(0x11);
+    rawObject->data.push_back(0x22);
+    rawObject->data.push_back(0x33);
+    rawObject->data.push_back(0x44);
+    fileout.write(rawObject);
+
+    auto * ethernetFrame = new Vector::BLF::EthernetFrame;
+    ethernetFrame->objectTimeStamp = 3000;
+    ethernetFrame->payLoad.resize(3);
+    fileout.write(ethernetFrame);
+
+    fileout.close();
+}
+
+/** Unknown object types are skipped, or read as raw objects. */
+BOOST_AUTO_TEST_CASE(UnknownObjects) {
+    writeFile(CMAKE_CURRENT_BINARY_DIR "/test_RawObjectUnknown.blf");
+
+    /* skipped */
+    Vector::BLF::File filein;
+    filein.open(CMAKE_CURRENT_BINARY_DIR "/test_RawObjectUnknown.blf", std::ios_base::in);
+    BOOST_REQUIRE(filein.is_open());
+    std::unique_ptr<Vector::BLF::ObjectHeaderBase> ohb(filein.read());
+    BOOST_REQUIRE(ohb);
+    BOOST_CHECK(ohb->objectType == Vector::BLF::ObjectType::CAN_MESSAGE);
+    ohb.reset(filein.read());
+    BOOST_REQUIRE(ohb);
+    BOOST_CHECK(ohb->objectType == Vector::BLF::ObjectType::ETHERNET_FRAME);
+    filein.close();
+
+    /* raw objects */
+    Vector::BLF::File filein2;
+    filein2.rawObjects = Vector::BLF::RawObjectMode::Unknown;
+    filein2.open(CMAKE_CURRENT_BINARY_DIR "/test_RawObjectUnknown.blf", std::ios_base::in);
+    BOOST_REQUIRE(filein2.is_open());
+    ohb.reset(filein2.read());
+    BOOST_REQUIRE(ohb);
+    BOOST_CHECK(dynamic_cast<Vector::BLF::CanMessage *>(ohb.get()) != nullptr);
+    ohb.reset(filein2.read());
+    BOOST_REQUIRE(ohb);
+    auto * rawObject = dynamic_cast<Vector::BLF::RawObject *>(ohb.get());
+    BOOST_REQUIRE(rawObject != nullptr);
+    BOOST_CHECK(rawObject->objectType == unknownObjectType);
+    BOOST_CHECK_EQUAL(rawObject->headerVersion, 1);
+    BOOST_CHECK_EQUAL(rawObject->calculateHeaderSize(), 32);
+    BOOST_CHECK_EQUAL(rawObject->objectSize, 36);
+    BOOST_CHECK_EQUAL(rawObject->data.size(), 20);
+    BOOST_CHECK_EQUAL(rawObject->data[16], 0x11);
+    BOOST_CHECK_EQUAL(rawObject->objectTimeStampNs(), 2000);
+    BOOST_CHECK(rawObject->decode() == nullptr);
+    ohb.reset(filein2.read());
+    BOOST_REQUIRE(ohb);
+    BOOST_CHECK(dynamic_cast<Vector::BLF::EthernetFrame *>(ohb.get()) != nullptr);
+    filein2.close();
+}
+
+/** All objects are read as raw objects, and can be decoded. */
+BOOST_AUTO_TEST_CASE(AllObjects) {
+    writeFile(CMAKE_CURRENT_BINARY_DIR "/test_RawObjectAll.blf");
+
+    Vector::BLF::File filein;
+    filein.rawObjects = Vector::BLF::RawObjectMode::All;
+    filein.open(CMAKE_CURRENT_BINARY_DIR "/test_RawObjectAll.blf", std::ios_base::in);
+    BOOST_REQUIRE(filein.is_open());
+
+    /* CanMessage */
+    std::unique_ptr<Vector::BLF::ObjectHeaderBase> ohb(filein.read());
+    BOOST_REQUIRE(ohb);
+    auto * rawObject = dynamic_cast<Vector::BLF::RawObject *>(ohb.get());
+    BOOST_REQUIRE(rawObject != nullptr);
+    BOOST_CHECK(rawObject->objectType == Vector::BLF::ObjectType::CAN_MESSAGE);
+    BOOST_CHECK_EQUAL(rawObject->objectTimeStampNs(), 1000);
+    BOOST_CHECK_EQUAL(Vector::BLF::File::objectChannel(rawObject), 3);
+    std::unique_ptr<Vector::BLF::ObjectHeaderBase> decoded(rawObject->decode());
+    BOOST_REQUIRE(decoded);
+    auto * canMessage = dynamic_cast<Vector::BLF::CanMessage *>(decoded.get());
+    BOOST_REQUIRE(canMessage != nullptr);
+    BOOST_CHECK_EQUAL(canMessage->channel, 3);
+
+    /* unknown object */
+    ohb.reset(filein.read());
+    BOOST_REQUIRE(ohb);
+    BOOST_CHECK(ohb->objectType == unknownObjectType);
+
+    /* EthernetFrame, with padding */
+    ohb.reset(filein.read());
+    BOOST_REQUIRE(ohb);
+    rawObject = dynamic_cast<Vector::BLF::RawObject *>(ohb.get());
+    BOOST_REQUIRE(rawObject != nullptr);
+    BOOST_CHECK(rawObject->objectType == Vector::BLF::ObjectType::ETHERNET_FRAME);
+    BOOST_CHECK_EQUAL(rawObject->objectSize % 4, 3);
+    decoded.reset(rawObject->decode());
+    BOOST_REQUIRE(decoded);
+    BOOST_CHECK_EQUAL(static_cast<Vector::BLF::EthernetFrame *>(decoded.get())->payLoad.size(), 3);
+
+    /* eof */
+    ohb.reset(filein.read());
+    while (ohb && (ohb->objectType == Vector::BLF::ObjectType::Unknown115))
+        ohb.reset(filein.read());
+    BOOST_CHECK(!ohb);
+    filein.close();
+}
+
+/** Raw objects are recycled independent of their object type. */
+BOOST_AUTO_TEST_CASE(ObjectPool) {
+    Vector::BLF::ObjectPool objectPool;
+    Vector::BLF::RawObject * rawObject = objectPool.createRawObject(Vector::BLF::ObjectType::CAN_MESSAGE);
+    BOOST_REQUIRE(rawObject);
+    BOOST_CHECK(rawObject->objectType == Vector::BLF::ObjectType::CAN_MESSAGE);
+    rawObject->data.resize(16);
+    objectPool.recycle(rawObject);
+    BOOST_CHECK_EQUAL(objectPool.size(), 1);
+
+    /* not reused as CanMessage */
+    Vector::BLF::ObjectHeaderBase * ohb = objectPool.create(Vector::BLF::ObjectType::CAN_MESSAGE);
+    BOOST_CHECK(ohb != rawObject);
+    delete ohb;
+
+    /* reused as raw object */
+    BOOST_CHECK(objectPool.createRawObject(Vector::BLF::ObjectType::LIN_MESSAGE) == rawObject);
+    BOOST_CHECK(rawObject->objectType == Vector::BLF::ObjectType::LIN_MESSAGE);
+    BOOST_CHECK(rawObject->data.empty());
+    BOOST_CHECK_GE(rawObject->data.capacity(), 16);
+    delete rawObject;
+}
@@ -0,0 +1,248 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#define BOOST_TEST_MODULE RingObjectQueue
+#if !defined(WIN32)
+#define BOOST_TEST_DYN_LINK
+#endif
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <Vector/BLF.h>
+
+/** insert and remove some elements and check state of queue */
+BOOST_AUTO_TEST_CASE(SimpleTest) {
+    Vector::BLF::RingObjectQueue<Vector::BLF::ObjectHeaderBase> objectQueue;
+
+    /* open queue and empty checks */
+    BOOST_CHECK_EQUAL(objectQueue.tellg(), 0);
+    BOOST_CHECK_EQUAL(objectQueue.tellp(), 0);
+    BOOST_CHECK(!objectQueue.eof());
+
+    /* add some objects */
+    objectQueue.write(new Vector::BLF::CanMessage);
+    objectQueue.write(new Vector::BLF::LinMessage);
+    objectQueue.write(new Vector::BLF::J1708Message);
+    BOOST_CHECK_EQUAL(objectQueue.tellg(), 0);
+    BOOST_CHECK_EQUAL(objectQueue.tellp(), 3);
+    BOOST_CHECK(!objectQueue.eof());
+
+    /* check eof */
+    objectQueue.setFileSize(3);
+    BOOST_CHECK(!objectQueue.eof());
+
+    /* remove some objects */
+    Vector::BLF::ObjectHeaderBase * ohb;
+
+    ohb = objectQueue.read();
+    BOOST_CHECK(ohb->objectType == Vector::BLF::ObjectType::CAN_MESSAGE);
+    delete ohb;
+
+    BOOST_CHECK_EQUAL(objectQueue.tellg(), 1);
+    BOOST_CHECK(!objectQueue.eof());
+
+    ohb = objectQueue.read();
+    BOOST_CHECK(ohb->objectType == Vector::BLF::ObjectType::LIN_MESSAGE);
+    delete ohb;
+
+    BOOST_CHECK_EQUAL(objectQueue.tellg(), 2);
+    BOOST_CHECK(!objectQueue.eof());
+
+    ohb = objectQueue.read();
+    BOOST_CHECK(ohb->objectType == Vector::BLF::ObjectType::J1708_MESSAGE);
+    delete ohb;
+
+    BOOST_CHECK_EQUAL(objectQueue.tellg(), 3);
+    BOOST_CHECK(!objectQueue.eof());
+
+    /* remove one more to trigger eof */
+    ohb = objectQueue.read();
+    BOOST_CHECK(ohb == nullptr);
+    BOOST_CHECK_EQUAL(objectQueue.tellg(), 3);
+    BOOST_CHECK(objectQueue.eof());
+
+    /* close */
+    objectQueue.abort();
+
+    /* check clear on open */
+    objectQueue.write(new Vector::BLF::CanMessage);
+    objectQueue.write(new Vector::BLF::LinMessage);
+    objectQueue.write(new Vector::BLF::J1708Message);
+}
+
+/** hand over objects between two threads, with a ring smaller than the number of objects */
+BOOST_AUTO_TEST_CASE(ThreadTest) {
+    Vector::BLF::RingObjectQueue<Vector::BLF::ObjectHeaderBase> objectQueue;
+    objectQueue.setBufferSize(10);
+
+    /* writer thread */
+    std::thread writer([&objectQueue]() {
+        for (uint32_t i = 0; i < 100000; ++i) {
+            auto * canMessage = new Vector::BLF::CanMessage;
+            canMessage->id = i;
+            objectQueue.write(canMessage);
+        }
+        objectQueue.setFileSize(objectQueue.tellp());
+    });
+
+    /* read in order till eof */
+    uint32_t count = 0;
+    Vector::BLF::ObjectHeaderBase * ohb;
+    while ((ohb = objectQueue.read()) != nullptr) {
+        BOOST_REQUIRE_EQUAL(static_cast<Vector::BLF::CanMessage *>(ohb)->id, count);
+        delete ohb;
+        count++;
+    }
+    writer.join();
+    BOOST_CHECK_EQUAL(count, 100000);
+    BOOST_CHECK(objectQueue.eof());
+}
+
+/** abort a blocked reader and writer */
+BOOST_AUTO_TEST_CASE(AbortTest) {
+    Vector::BLF::RingObjectQueue<Vector::BLF::ObjectHeaderBase> objectQueue;
+    objectQueue.setBufferSize(1);
+
+    /* blocked reader */
+    std::thread reader([&objectQueue]() {
+        BOOST_CHECK(objectQueue.read() == nullptr);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    objectQueue.abort();
+    reader.join();
+
+    /* blocked writer */
+    objectQueue.reset();
+    objectQueue.write(new Vector::BLF::CanMessage);
+    std::thread writer([&objectQueue]() {
+        objectQueue.write(new Vector::BLF::CanMessage);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    objectQueue.abort();
+    writer.join();
+    BOOST_CHECK_EQUAL(objectQueue.tellp(), 1);
+}
+
+/** hand over objects in batches between two threads */
+BOOST_AUTO_TEST_CASE(BatchTest) {
+    Vector::BLF::RingObjectQueue<Vector::BLF::ObjectHeaderBase> objectQueue;
+    objectQueue.setBufferSize(10);
+
+    /* writer thread */
+    std::thread writer([&objectQueue]() {
+        std::vector<Vector::BLF::ObjectHeaderBase *> objects;
+        for (uint32_t i = 0; i < 100000; ++i) {
+            auto * canMessage = new Vector::BLF::CanMessage;
+            canMessage->id = i;
+            objects.push_back(canMessage);
+            if (objects.size() == 25) {
+                objectQueue.write(objects);
+                objects.clear();
+            }
+        }
+        objectQueue.setFileSize(objectQueue.tellp());
+    });
+
+    /* read in order till eof */
+    uint32_t count = 0;
+    std::vector<Vector::BLF::ObjectHeaderBase *> objects;
+    std::size_t size;
+    while ((size = objectQueue.read(objects, 7)) > 0) {
+        BOOST_REQUIRE_LE(size, 7);
+        BOOST_REQUIRE_EQUAL(objects.size(), size);
+        for (Vector::BLF::ObjectHeaderBase * ohb : objects) {
+            BOOST_REQUIRE_EQUAL(static_cast<Vector::BLF::CanMessage *>(ohb)->id, count);
+            delete ohb;
+            count++;
+        }
+        objects.clear();
+    }
+    writer.join();
+    BOOST_CHECK_EQUAL(count, 100000);
+    BOOST_CHECK_EQUAL(objectQueue.tellg(), 100000);
+    BOOST_CHECK(objectQueue.eof());
+}
+
+/** account the size of the enqueued objects and limit it */
+BOOST_AUTO_TEST_CASE(BufferedBytes) {
+    Vector::BLF::RingObjectQueue<Vector::BLF::ObjectHeaderBase> objectQueue;
+    objectQueue.setMaxBufferedBytes(250);
+    BOOST_CHECK_EQUAL(objectQueue.bufferedBytes(), 0);
+    BOOST_CHECK(!objectQueue.full());
+
+    /* write objects till the limit is reached */
+    for (uint32_t i = 0; i < 3; ++i) {
+        BOOST_REQUIRE(!objectQueue.full());
+        auto * canMessage = new Vector::BLF::CanMessage;
+        canMessage->objectSize = 100;
+        objectQueue.write(canMessage);
+    }
+    BOOST_CHECK_EQUAL(objectQueue.bufferedBytes(), 300);
+    BOOST_CHECK_EQUAL(objectQueue.peakBufferedBytes(), 300);
+    BOOST_CHECK(objectQueue.full());
+
+    /* read objects */
+    delete objectQueue.read();
+    BOOST_CHECK_EQUAL(objectQueue.bufferedBytes(), 200);
+    BOOST_CHECK(!objectQueue.full());
+    delete objectQueue.read();
+    delete objectQueue.read();
+    BOOST_CHECK_EQUAL(objectQueue.bufferedBytes(), 0);
+    BOOST_CHECK_EQUAL(objectQueue.peakBufferedBytes(), 300);
+
+    /* an object larger than the limit is enqueued into an empty queue */
+    auto * canMessage = new Vector::BLF::CanMessage;
+    canMessage->objectSize = 1000;
+    objectQueue.write(canMessage);
+    BOOST_CHECK_EQUAL(objectQueue.bufferedBytes(), 1000);
+    BOOST_CHECK(objectQueue.full());
+    delete objectQueue.read();
+    BOOST_CHECK_EQUAL(objectQueue.peakBufferedBytes(), 1000);
+}
+
+/** object, that counts its deletions */
+struct CountedObject final : Vector::BLF::ObjectHeaderBase {
+    static unsigned int deleted;
+
+    CountedObject() :
+        Vector::BLF::ObjectHeaderBase(1, Vector::BLF::ObjectType::UNKNOWN) {
+    }
+
+    ~CountedObject() override {
+        deleted++;
+    }
+};
+
+unsigned int CountedObject::deleted {0};
+
+/** After abort, writes keep objects while there is space, and delete the others. */
+BOOST_AUTO_TEST_CASE(WriteAfterAbort) {
+    Vector::BLF::RingObjectQueue<Vector::BLF::ObjectHeaderBase> objectQueue;
+    objectQueue.setBufferSize(4);
+    CountedObject::deleted = 0;
+
+    /* fill the queue up to one object */
+    objectQueue.write(new CountedObject);
+    objectQueue.write(std::vector<Vector::BLF::ObjectHeaderBase *> { new CountedObject, new CountedObject });
+    BOOST_CHECK_EQUAL(objectQueue.tellp(), 3);
+
+    /* writes don't block after abort */
+    objectQueue.abort();
+    objectQueue.write(std::vector<Vector::BLF::ObjectHeaderBase *> { new CountedObject, new CountedObject, new CountedObject });
+    BOOST_CHECK_EQUAL(objectQueue.tellp(), 4);
+    BOOST_CHECK_EQUAL(CountedObject::deleted, 2);
+    objectQueue.write(new CountedObject);
+    BOOST_CHECK_EQUAL(objectQueue.tellp(), 4);
+    BOOST_CHECK_EQUAL(CountedObject::deleted, 3);
+
+    /* enqueued objects can still be read */
+    std::vector<Vector::BLF::ObjectHeaderBase *> objects;
+    BOOST_CHECK_EQUAL(objectQueue.read(objects, 10), 4);
+    for (Vector::BLF::ObjectHeaderBase * ohb : objects)
+        delete ohb;
+    BOOST_CHECK_EQUAL(CountedObject::deleted, 7);
+}
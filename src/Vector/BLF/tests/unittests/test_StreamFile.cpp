@@ -0,0 +1,85 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#define BOOST_TEST_MODULE StreamFile
+#if !defined(WIN32)
+#define BOOST_TEST_DYN_LINK
+#endif
+#include <boost/test/unit_test.hpp>
+
+#include <istream>
+#include <streambuf>
+#include <vector>
+
+#include <Vector/BLF.h>
+
+/** stream buffer, that can't seek, like a pipe */
+class ForwardOnlyBuffer : public std::streambuf {
+  public:
+    explicit ForwardOnlyBuffer(std::vector<char> & data) {
+        setg(data.data(), data.data(), data.data() + data.size());
+    }
+};
+
+/** Test read operations on a forward-only stream. */
+BOOST_AUTO_TEST_CASE(ReadTest) {
+    Vector::BLF::StreamFile streamFile;
+
+    /* checks after initialize */
+    BOOST_CHECK_EQUAL(streamFile.gcount(), 0);
+    BOOST_CHECK_EQUAL(streamFile.tellg(), -1);
+    BOOST_CHECK_EQUAL(streamFile.tellp(), -1);
+    BOOST_CHECK(!streamFile.eof());
+    BOOST_CHECK(!streamFile.is_open());
+    BOOST_CHECK(!streamFile.seekable());
+
+    /* open stream */
+    std::vector<char> data { 'L', 'O', 'G', 'G', '0', '1', '2', '3', '4', '5' };
+    ForwardOnlyBuffer buffer(data);
+    std::istream stream(&buffer);
+    streamFile.open(stream);
+    BOOST_CHECK(streamFile.is_open());
+    BOOST_CHECK_EQUAL(streamFile.tellg(), 0);
+
+    /* read some data */
+    char signature[5] = { 0, 0, 0, 0, 0 }; // including null termination
+    streamFile.read(signature, 4);
+    BOOST_CHECK_EQUAL(signature, "LOGG");
+    BOOST_CHECK_EQUAL(streamFile.tellg(), 4);
+    BOOST_CHECK_EQUAL(streamFile.gcount(), 4);
+
+    /* view data is not possible */
+    BOOST_CHECK(streamFile.readView(2) == nullptr);
+    BOOST_CHECK_EQUAL(streamFile.tellg(), 4);
+
+    /* skip forward */
+    streamFile.seekg(2, std::ios_base::cur);
+    BOOST_CHECK_EQUAL(streamFile.tellg(), 6);
+    streamFile.read(signature, 2);
+    BOOST_CHECK_EQUAL(signature[0], '2');
+    BOOST_CHECK(streamFile.good());
+
+    /* seek back is not possible */
+    streamFile.seekg(0, std::ios_base::beg);
+    BOOST_CHECK(!streamFile.good());
+    streamFile.clear();
+    streamFile.seekg(0, std::ios_base::end);
+    BOOST_CHECK(!streamFile.good());
+    streamFile.clear();
+
+    /* read behind eof */
+    streamFile.read(signature, 4);
+    BOOST_CHECK_EQUAL(streamFile.gcount(), 2);
+    BOOST_CHECK(streamFile.eof());
+    BOOST_CHECK(!streamFile.good());
+
+    /* write is not possible */
+    streamFile.clear();
+    streamFile.write(signature, 4);
+    BOOST_CHECK(!streamFile.good());
+
+    /* close file */
+    streamFile.close();
+    BOOST_CHECK(!streamFile.is_open());
+}
@@ -0,0 +1,106 @@
+// SPDX-FileCopyrightText: 2013-2021 Tobias Lorenz <tobias.lorenz@gmx.net>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#define BOOST_TEST_MODULE ThreadPoolExecutor
+#if !defined(WIN32)
+#define BOOST_TEST_DYN_LINK
+#endif
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <Vector/BLF.h>
+
+/** Run tasks on the worker threads. */
+BOOST_AUTO_TEST_CASE(Execute) {
+    std::atomic<uint32_t> tasks {0};
+    {
+        Vector::BLF::ThreadPoolExecutor executor(2);
+        BOOST_CHECK_EQUAL(executor.threads(), 2);
+        for (uint32_t i = 0; i < 100; i++) {
+            executor.execute([&tasks]() {
+                tasks++;
+            });
+        }
+
+        /* remaining tasks are run at destruction */
+    }
+    BOOST_CHECK_EQUAL(tasks, 100);
+}
+
+/** Write and read many files concurrently on two shared threads. */
+BOOST_AUTO_TEST_CASE(SharedByFiles) {
+    const uint32_t fileCount = 16;
+    Vector::BLF::ThreadPoolExecutor executor(2);
+
+    /* write files interleaved */
+    std::vector<std::unique_ptr<Vector::BLF::File>> files;
+    for (uint32_t file = 0; file < fileCount; file++) {
+        files.emplace_back(new Vector::BLF::File);
+        files[file]->executor = &executor;
+        files[file]->setDefaultLogContainerSize(0x1000);
+        files[file]->writeRestorePoints = false;
+        files[file]->open(CMAKE_CURRENT_BINARY_DIR "/test_ThreadPoolExecutor" + std::to_string(file) + ".blf", std::ios_base::out);
+        BOOST_REQUIRE(files[file]->is_open());
+    }
+    for (uint32_t i = 0; i < 1000; i++) {
+        for (uint32_t file = 0; file < fileCount; file++) {
+            auto * canMessage = new Vector::BLF::CanMessage;
+            canMessage->objectTimeStamp = i;
+            canMessage->id = file;
+            files[file]->write(canMessage);
+        }
+    }
+
+    /* an object larger than the read ahead, spanning several LogContainers */
+    auto * environmentVariable = new Vector::BLF::EnvironmentVariable;
+    environmentVariable->objectType = Vector::BLF::ObjectType::ENV_DATA;
+    environmentVariable->name = "large";
+    environmentVariable->data.assign(0x30000, 0xAA);
+    files[0]->write(environmentVariable);
+    for (std::unique_ptr<Vector::BLF::File> & file : files)
+        file->close();
+    files.clear();
+
+    /* read files interleaved */
+    for (uint32_t file = 0; file < fileCount; file++) {
+        files.emplace_back(new Vector::BLF::File);
+        files[file]->executor = &executor;
+        files[file]->open(CMAKE_CURRENT_BINARY_DIR "/test_ThreadPoolExecutor" + std::to_string(file) + ".blf", std::ios_base::in);
+        BOOST_REQUIRE(files[file]->is_open());
+        BOOST_CHECK_EQUAL(files[file]->fileStatistics.objectCount, (file == 0) ? 1001 : 1000);
+    }
+    for (uint32_t i = 0; i < 1000; i++) {
+        for (uint32_t file = 0; file < fileCount; file++) {
+            Vector::BLF::ObjectHeaderBase * ohb = files[file]->read();
+            BOOST_REQUIRE(ohb != nullptr);
+            BOOST_REQUIRE(ohb->objectType == Vector::BLF::ObjectType::CAN_MESSAGE);
+            auto * canMessage = static_cast<Vector::BLF::CanMessage *>(ohb);
+            BOOST_CHECK_EQUAL(canMessage->objectTimeStamp, i);
+            BOOST_CHECK_EQUAL(canMessage->id, file);
+            delete ohb;
+        }
+    }
+    Vector::BLF::ObjectHeaderBase * ohb = files[0]->read();
+    BOOST_REQUIRE(ohb != nullptr);
+    BOOST_REQUIRE(ohb->objectType == Vector::BLF::ObjectType::ENV_DATA);
+    BOOST_CHECK_EQUAL(static_cast<Vector::BLF::EnvironmentVariable *>(ohb)->data.size(), 0x30000);
+    delete ohb;
+    for (std::unique_ptr<Vector::BLF::File> & file : files) {
+        BOOST_CHECK(file->read() == nullptr);
+        BOOST_CHECK(file->eof());
+    }
+
+    /* seek and close while the tasks are running */
+    files[1]->seek(500);
+    ohb = files[1]->read();
+    BOOST_REQUIRE(ohb != nullptr);
+    BOOST_CHECK_EQUAL(ohb->objectTimeStampNs(), 500);
+    delete ohb;
+    for (std::unique_ptr<Vector::BLF::File> & file : files)
+        file->close();
+}
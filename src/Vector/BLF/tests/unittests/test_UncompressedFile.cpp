@@ -9,7 +9,9 @@
 #include <boost/test/unit_test.hpp>
 #include <boost/filesystem.hpp>
 
+#include <algorithm>
 #include <sstream>
+#include <vector>
 #include <Vector/BLF.h>
 
 /** Open a file, read/write on it, close it again. */
@@ -236,3 +238,78 @@ BOOST_AUTO_TEST_CASE(StdStringStream2) {
     BOOST_CHECK_EQUAL(ss.good(), uncompressedFile.good());
     BOOST_CHECK_EQUAL(ss.eof(), uncompressedFile.eof());
 }
+
+/** Write and read across many small logContainers, while old ones are dropped. */
+BOOST_AUTO_TEST_CASE(ManyLogContainers) {
+    Vector::BLF::UncompressedFile uncompressedFile;
+    uncompressedFile.setDefaultLogContainerSize(16);
+
+    /* write data spanning many logContainers */
+    std::vector<char> data(10000);
+    for (std::size_t i = 0; i < data.size(); ++i)
+        data[i] = static_cast<char>(i % 251);
+    for (std::size_t i = 0; i < data.size(); i += 100)
+        uncompressedFile.write(data.data() + i, 100);
+    BOOST_CHECK_EQUAL(uncompressedFile.tellp(), 10000);
+    uncompressedFile.setFileSize(uncompressedFile.tellp());
+
+    /* read it back in chunks crossing logContainer boundaries */
+    std::vector<char> chunk(7);
+    for (std::size_t i = 0; i + chunk.size() <= data.size(); i += chunk.size()) {
+        uncompressedFile.read(chunk.data(), chunk.size());
+        BOOST_REQUIRE(uncompressedFile.good());
+        BOOST_REQUIRE(std::equal(chunk.cbegin(), chunk.cend(), data.cbegin() + i));
+
+        /* seek back within the remaining logContainers */
+        if (i % 70 == 0) {
+            uncompressedFile.seekg(-3);
+            uncompressedFile.read(chunk.data(), 3);
+            BOOST_REQUIRE(std::equal(chunk.cbegin(), chunk.cbegin() + 3, data.cbegin() + i + 4));
+        }
+
+        uncompressedFile.dropOldData();
+    }
+}
+
+/** Objects are staged with their padding in one step, or skipped. */
+BOOST_AUTO_TEST_CASE(ReadObject) {
+    Vector::BLF::UncompressedFile uncompressedFile;
+    uncompressedFile.setDefaultLogContainerSize(40);
+
+    /* write objects, spanning several log containers */
+    Vector::BLF::AppText appText;
+    appText.text = "hello";
+    appText.write(uncompressedFile);
+    Vector::BLF::CanMessage canMessage;
+    canMessage.write(uncompressedFile);
+    uncompressedFile.setFileSize(uncompressedFile.tellp());
+    std::streamsize appTextSize = appText.objectSize + appText.objectSize % 4;
+
+    /* stage selected object */
+    Vector::BLF::ObjectHeaderBase ohb(0, Vector::BLF::ObjectType::UNKNOWN);
+    Vector::BLF::ObjectBuffer objectBuffer;
+    auto all = [](const Vector::BLF::ObjectHeaderBase & /*ohb*/) {
+        return true;
+    };
+    BOOST_CHECK_EQUAL(uncompressedFile.readObject(ohb, objectBuffer, true, all), appTextSize);
+    BOOST_CHECK(ohb.objectType == Vector::BLF::ObjectType::APP_TEXT);
+    BOOST_CHECK_EQUAL(objectBuffer.size(), appTextSize);
+    BOOST_CHECK_EQUAL(uncompressedFile.tellg(), appTextSize);
+    Vector::BLF::AppText appText2;
+    appText2.read(objectBuffer);
+    BOOST_CHECK(objectBuffer.good());
+    BOOST_CHECK_EQUAL(appText2.text, "hello");
+
+    /* skip object not selected */
+    auto none = [](const Vector::BLF::ObjectHeaderBase & /*ohb*/) {
+        return false;
+    };
+    BOOST_CHECK_EQUAL(uncompressedFile.readObject(ohb, objectBuffer, false, none), 0);
+    BOOST_CHECK(ohb.objectType == Vector::BLF::ObjectType::CAN_MESSAGE);
+    BOOST_CHECK_EQUAL(objectBuffer.size(), 0);
+    BOOST_CHECK_EQUAL(uncompressedFile.tellg(), uncompressedFile.fileSize());
+
+    /* nothing read at eof */
+    BOOST_CHECK_EQUAL(uncompressedFile.readObject(ohb, objectBuffer, false, all), -1);
+    BOOST_CHECK_EQUAL(uncompressedFile.tellg(), uncompressedFile.fileSize());
+}